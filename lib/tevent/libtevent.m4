@@ -28,8 +28,8 @@ TEVENT_CFLAGS="-I$teventdir"
 
 TEVENT_OBJ="tevent.o tevent_debug.o tevent_util.o"
 TEVENT_OBJ="$TEVENT_OBJ tevent_fd.o tevent_timed.o tevent_immediate.o tevent_signal.o"
-TEVENT_OBJ="$TEVENT_OBJ tevent_req.o tevent_wakeup.o tevent_queue.o"
-TEVENT_OBJ="$TEVENT_OBJ tevent_standard.o tevent_select.o"
+TEVENT_OBJ="$TEVENT_OBJ tevent_req.o tevent_wakeup.o tevent_queue.o tevent_io.o"
+TEVENT_OBJ="$TEVENT_OBJ tevent_standard.o tevent_select.o tevent_threads.o"
 
 AC_CHECK_HEADERS(sys/epoll.h)
 AC_CHECK_FUNCS(epoll_create)
@@ -38,6 +38,29 @@ if test x"$ac_cv_header_sys_epoll_h" = x"yes" -a x"$ac_cv_func_epoll_create" = x
    AC_DEFINE(HAVE_EPOLL, 1, [Whether epoll available])
 fi
 
+AC_CHECK_HEADERS(linux/io_uring.h)
+AC_CACHE_CHECK([for io_uring syscalls],tevent_cv_io_uring,[
+AC_TRY_COMPILE([
+#include <sys/syscall.h>
+#include <linux/io_uring.h>],[
+struct io_uring_getevents_arg arg;
+int n = __NR_io_uring_setup + __NR_io_uring_enter + IORING_FEAT_EXT_ARG;
+],
+tevent_cv_io_uring=yes,tevent_cv_io_uring=no)])
+if test x"$tevent_cv_io_uring" = x"yes"; then
+   TEVENT_OBJ="$TEVENT_OBJ tevent_uring.o"
+   AC_DEFINE(HAVE_IO_URING, 1, [Whether io_uring is available])
+fi
+
+AC_CHECK_HEADERS(pthread.h sys/eventfd.h)
+AC_CHECK_LIB(pthread, pthread_create, [tevent_cv_pthread=yes], [tevent_cv_pthread=no])
+AC_CHECK_FUNCS(eventfd)
+if test x"$ac_cv_header_pthread_h" = x"yes" -a x"$tevent_cv_pthread" = x"yes" -a \
+	x"$ac_cv_header_sys_eventfd_h" = x"yes" -a x"$ac_cv_func_eventfd" = x"yes"; then
+   TEVENT_LIBS="$TEVENT_LIBS -lpthread"
+   AC_DEFINE(HAVE_TEVENT_THREADS, 1, [Whether the tevent loop pool is available])
+fi
+
 if test x"$VERSIONSCRIPT" != "x"; then
     EXPORTSFILE=tevent.exports
     AC_SUBST(EXPORTSFILE)
@@ -23,10 +23,14 @@
    License along with this library; if not, see <http://www.gnu.org/licenses/>.
 */
 
+#define TEVENT_DEPRECATED 1
 #include "includes.h"
 #include "lib/events/events.h"
 #include "system/filesys.h"
 #include "torture/torture.h"
+#ifdef HAVE_TEVENT_THREADS
+#include <pthread.h>
+#endif
 
 static int fde_count;
 
@@ -144,6 +148,601 @@ static bool test_event_context(struct torture_context *test,
 	return true;
 }
 
+/*
+  dispatch rate with many fds ready at once: every pipe has a byte in it
+  that is never read, so each loop sees all of them ready again
+*/
+#define BENCH_FDS 1000
+
+struct bench_fd {
+	int *count;
+	int hits;
+};
+
+static void bench_handler(struct tevent_context *ev_ctx, struct tevent_fd *f,
+			  uint16_t flags, void *private_data)
+{
+	struct bench_fd *b = (struct bench_fd *)private_data;
+	b->hits++;
+	(*b->count)++;
+}
+
+static bool test_event_fd_bench(struct torture_context *test,
+				const void *test_data)
+{
+	struct tevent_context *ev_ctx;
+	const char *backend = (const char *)test_data;
+	struct bench_fd *b;
+	int num = BENCH_FDS;
+	int count = 0, loops = 0;
+	int finished = 0;
+	struct timeval t;
+	double secs;
+	int i;
+#ifdef HAVE_SYS_RESOURCE_H
+	struct rlimit rl;
+
+	/* two fds per pipe, plus some for everything else */
+	if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < 2*num + 64) {
+		rl.rlim_cur = MIN(rl.rlim_max, 2*num + 64);
+		setrlimit(RLIMIT_NOFILE, &rl);
+		if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < 2*num + 64) {
+			num = (rl.rlim_cur - 64) / 2;
+		}
+	}
+#endif
+	torture_assert(test, num > 0, "not enough file descriptors");
+
+	ev_ctx = event_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	b = talloc_zero_array(ev_ctx, struct bench_fd, num);
+	for (i = 0; i < num; i++) {
+		int fd[2];
+		char c = 0;
+		struct tevent_fd *fde;
+
+		if (pipe(fd) != 0) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "pipe %d failed: %s\n",
+							   i, strerror(errno)));
+		}
+		write(fd[1], &c, 1);
+		b[i].count = &count;
+		fde = event_add_fd(ev_ctx, b, fd[0], EVENT_FD_READ,
+				   bench_handler, &b[i]);
+		tevent_fd_set_auto_close(fde);
+		/* the write side stays open, the reader must not see EOF */
+		fde = event_add_fd(ev_ctx, b, fd[1], 0, NULL, NULL);
+		tevent_fd_set_auto_close(fde);
+	}
+
+	event_add_timed(ev_ctx, ev_ctx, timeval_current_ofs(1,0),
+			finished_handler, &finished);
+
+	t = timeval_current();
+	while (!finished) {
+		if (event_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "Failed event loop %s\n", strerror(errno)));
+		}
+		loops++;
+	}
+	secs = timeval_elapsed(&t);
+
+	torture_comment(test, "Backend '%s': %.2f events/sec with %d active fds "
+			"(%.1f events per loop)\n", backend, count/secs, num,
+			(double)count/loops);
+
+	/* level triggered, nobody may be starved */
+	for (i = 0; i < num; i++) {
+		if (b[i].hits == 0) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "fd %d never dispatched\n", i));
+		}
+	}
+
+	talloc_free(ev_ctx);
+
+	return true;
+}
+
+/*
+  several fds ready in the same wait: the first handler to run frees one
+  of the others and stops waiting on another, neither may be called
+*/
+struct batch_fd {
+	struct batch_state *state;
+	struct tevent_fd *fde;
+	int hits;
+};
+
+struct batch_state {
+	struct batch_fd fds[3];
+	struct batch_fd *first;
+	struct batch_fd *freed;
+	struct batch_fd *cleared;
+};
+
+static void batch_handler(struct tevent_context *ev_ctx, struct tevent_fd *f,
+			  uint16_t flags, void *private_data)
+{
+	struct batch_fd *b = (struct batch_fd *)private_data;
+	struct batch_state *state = b->state;
+	int i;
+
+	b->hits++;
+	if (state->first != NULL) {
+		return;
+	}
+	state->first = b;
+	for (i = 0; i < 3; i++) {
+		struct batch_fd *other = &state->fds[i];
+		if (other == b) {
+			continue;
+		}
+		if (state->freed == NULL) {
+			state->freed = other;
+			talloc_free(other->fde);
+			other->fde = NULL;
+		} else {
+			state->cleared = other;
+			tevent_fd_set_flags(other->fde, 0);
+		}
+	}
+}
+
+static bool test_event_batch_free(struct torture_context *test,
+				  const void *test_data)
+{
+	struct tevent_context *ev_ctx;
+	const char *backend = (const char *)test_data;
+	struct batch_state state;
+	int fd[3][2];
+	char c = 0;
+	int i;
+
+	ev_ctx = event_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	ZERO_STRUCT(state);
+	for (i = 0; i < 3; i++) {
+		torture_assert(test, pipe(fd[i]) == 0, "pipe failed");
+		write(fd[i][1], &c, 1);
+		state.fds[i].state = &state;
+		state.fds[i].fde = event_add_fd(ev_ctx, ev_ctx, fd[i][0],
+						EVENT_FD_READ, batch_handler,
+						&state.fds[i]);
+	}
+
+	/* the first fd stays readable, so none of these block */
+	for (i = 0; i < 3; i++) {
+		if (event_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "Failed event loop %s\n", strerror(errno)));
+		}
+	}
+
+	torture_assert(test, state.first != NULL, "no handler called");
+	torture_assert(test, state.first->hits == 3, "first fd not dispatched every loop");
+	torture_assert_int_equal(test, state.freed->hits, 0, "freed fde dispatched");
+	torture_assert_int_equal(test, state.cleared->hits, 0, "fde without flags dispatched");
+
+	talloc_free(ev_ctx);
+	for (i = 0; i < 3; i++) {
+		close(fd[i][0]);
+		close(fd[i][1]);
+	}
+
+	return true;
+}
+
+/*
+  a handler running a nested loop: whatever the nested loop dispatched
+  must not be dispatched again by the outer one
+*/
+struct nested_fd {
+	struct nested_state *state;
+	int fd[2];
+	int hits;
+};
+
+struct nested_state {
+	struct nested_fd fds[2];
+	int spurious;
+	bool nested;
+};
+
+static void nested_handler(struct tevent_context *ev_ctx, struct tevent_fd *f,
+			   uint16_t flags, void *private_data)
+{
+	struct nested_fd *n = (struct nested_fd *)private_data;
+	struct nested_state *state = n->state;
+	char c;
+
+	if (read(n->fd[0], &c, 1) != 1) {
+		/* not readable any more, a blocking fd would hang here */
+		state->spurious++;
+		return;
+	}
+	n->hits++;
+
+	if (!state->nested) {
+		/* the other fd is still ready */
+		state->nested = true;
+		event_loop_once(ev_ctx);
+	}
+}
+
+static bool test_event_nested(struct torture_context *test,
+			      const void *test_data)
+{
+	struct tevent_context *ev_ctx;
+	const char *backend = (const char *)test_data;
+	struct nested_state state;
+	char c = 0;
+	int i;
+
+	ev_ctx = event_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	tevent_loop_allow_nesting(ev_ctx);
+
+	ZERO_STRUCT(state);
+	for (i = 0; i < 2; i++) {
+		struct nested_fd *n = &state.fds[i];
+
+		torture_assert(test, pipe(n->fd) == 0, "pipe failed");
+		set_blocking(n->fd[0], false);
+		write(n->fd[1], &c, 1);
+		n->state = &state;
+		event_add_fd(ev_ctx, ev_ctx, n->fd[0], EVENT_FD_READ,
+			     nested_handler, n);
+	}
+
+	if (event_loop_once(ev_ctx) == -1) {
+		talloc_free(ev_ctx);
+		torture_fail(test, talloc_asprintf(test, "Failed event loop %s\n", strerror(errno)));
+	}
+
+	torture_assert(test, state.nested, "no handler called");
+	torture_assert_int_equal(test, state.fds[0].hits, 1, "first fd");
+	torture_assert_int_equal(test, state.fds[1].hits, 1, "second fd");
+	torture_assert_int_equal(test, state.spurious, 0, "handler called without data");
+
+	talloc_free(ev_ctx);
+	for (i = 0; i < 2; i++) {
+		close(state.fds[i].fd[0]);
+		close(state.fds[i].fd[1]);
+	}
+
+	return true;
+}
+
+/*
+  tevent_io requests: recv/send on a pipe, read/write at an offset in a
+  file, and freeing a pending request must leave the data alone
+*/
+static bool test_event_io(struct torture_context *test,
+			  const void *test_data)
+{
+	struct tevent_context *ev_ctx;
+	const char *backend = (const char *)test_data;
+	struct tevent_req *req, *req2;
+	char wbuf[4096], rbuf[4096];
+	int fd[2];
+	FILE *f;
+	ssize_t ret;
+	int err = 0;
+	int i;
+
+	ev_ctx = event_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	for (i = 0; i < sizeof(wbuf); i++) {
+		wbuf[i] = i * 7;
+	}
+
+	torture_assert(test, pipe(fd) == 0, "pipe failed");
+
+	/* the read is in flight before there is anything to read */
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_RECV, fd[0],
+			     rbuf, sizeof(rbuf), 0);
+	req2 = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_SEND, fd[1],
+			      wbuf, 100, 0);
+	torture_assert(test, req != NULL && req2 != NULL, "tevent_io_send failed");
+	torture_assert(test, tevent_req_poll(req2, ev_ctx), "send poll failed");
+	ret = tevent_io_recv(req2, &err);
+	torture_assert_int_equal(test, ret, 100, "send");
+	torture_assert(test, tevent_req_poll(req, ev_ctx), "recv poll failed");
+	ret = tevent_io_recv(req, &err);
+	torture_assert_int_equal(test, ret, 100, "recv");
+	torture_assert(test, memcmp(rbuf, wbuf, 100) == 0, "recv data");
+	talloc_free(req);
+	talloc_free(req2);
+
+	/* a cancelled recv must not eat the next byte */
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_RECV, fd[0],
+			     rbuf, sizeof(rbuf), 0);
+	torture_assert(test, req != NULL, "tevent_io_send failed");
+	talloc_free(req);
+	torture_assert(test, write(fd[1], "x", 1) == 1, "write failed");
+	torture_assert(test, read(fd[0], rbuf, 1) == 1 && rbuf[0] == 'x',
+		       "cancelled recv consumed data");
+	close(fd[0]);
+	close(fd[1]);
+
+	f = tmpfile();
+	torture_assert(test, f != NULL, "tmpfile failed");
+
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_WRITE, fileno(f),
+			     wbuf, sizeof(wbuf), 1000);
+	torture_assert(test, req != NULL, "tevent_io_send failed");
+	torture_assert(test, tevent_req_poll(req, ev_ctx), "write poll failed");
+	ret = tevent_io_recv(req, &err);
+	torture_assert_int_equal(test, ret, sizeof(wbuf), "write");
+	talloc_free(req);
+
+	memset(rbuf, 0, sizeof(rbuf));
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_READ, fileno(f),
+			     rbuf, sizeof(rbuf), 1000);
+	torture_assert(test, req != NULL, "tevent_io_send failed");
+	torture_assert(test, tevent_req_poll(req, ev_ctx), "read poll failed");
+	ret = tevent_io_recv(req, &err);
+	torture_assert_int_equal(test, ret, sizeof(rbuf), "read");
+	torture_assert(test, memcmp(rbuf, wbuf, sizeof(rbuf)) == 0, "read data");
+	talloc_free(req);
+
+	/* reading past the end is a short read, not an error */
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_READ, fileno(f),
+			     rbuf, sizeof(rbuf), 1000 + sizeof(wbuf) - 10);
+	torture_assert(test, tevent_req_poll(req, ev_ctx), "read poll failed");
+	ret = tevent_io_recv(req, &err);
+	torture_assert_int_equal(test, ret, 10, "short read");
+	talloc_free(req);
+
+	/* errors come back as errno */
+	req = tevent_io_send(ev_ctx, ev_ctx, TEVENT_IO_READ, -1,
+			     rbuf, sizeof(rbuf), 0);
+	tevent_req_poll(req, ev_ctx);
+	ret = tevent_io_recv(req, &err);
+	torture_assert_int_equal(test, ret, -1, "read from bad fd");
+	torture_assert_int_equal(test, err, EBADF, "read from bad fd");
+	talloc_free(req);
+
+	fclose(f);
+	talloc_free(ev_ctx);
+
+	return true;
+}
+
+/*
+  cost of adding and cancelling many timers, e.g. one timeout per
+  outstanding request, and that they still fire in time order
+*/
+#define BENCH_TIMERS 100000
+
+struct bench_timer_state {
+	struct timeval last;
+	int fired;
+	bool out_of_order;
+};
+
+struct bench_timer {
+	struct bench_timer_state *state;
+	struct timeval due;
+};
+
+static void bench_timer_handler(struct tevent_context *ev_ctx,
+				struct tevent_timer *te,
+				struct timeval tval, void *private_data)
+{
+	struct bench_timer *b = (struct bench_timer *)private_data;
+
+	if (timeval_compare(&b->due, &b->state->last) < 0) {
+		b->state->out_of_order = true;
+	}
+	b->state->last = b->due;
+	b->state->fired++;
+}
+
+static bool test_event_timer_bench(struct torture_context *test)
+{
+	struct tevent_context *ev_ctx;
+	struct tevent_timer **te;
+	struct bench_timer *b;
+	struct bench_timer_state state;
+	struct timeval t, base;
+	double add_secs, cancel_secs;
+	int i;
+
+	ev_ctx = event_context_init(test);
+	torture_assert(test, ev_ctx != NULL, "no event context");
+
+	te = talloc_array(ev_ctx, struct tevent_timer *, BENCH_TIMERS);
+	b = talloc_zero_array(ev_ctx, struct bench_timer, BENCH_TIMERS);
+	torture_assert(test, te != NULL && b != NULL, "no memory");
+
+	ZERO_STRUCT(state);
+	for (i = 0; i < BENCH_TIMERS; i++) {
+		/* spread over 100 seconds, added out of order */
+		uint32_t ms = (uint32_t)((i * 7919ULL) % BENCH_TIMERS);
+		b[i].state = &state;
+		b[i].due = timeval_set(1000 + ms / 1000, (ms % 1000) * 1000);
+	}
+
+	base = timeval_current_ofs(1000, 0);
+	t = timeval_current();
+	for (i = 0; i < BENCH_TIMERS; i++) {
+		struct timeval due = timeval_add(&base, b[i].due.tv_sec,
+						 b[i].due.tv_usec);
+		te[i] = event_add_timed(ev_ctx, te, due,
+					bench_timer_handler, &b[i]);
+		if (te[i] == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "event_add_timed failed");
+		}
+	}
+	add_secs = timeval_elapsed(&t);
+
+	/* cancel in an order unrelated to both adding and expiry */
+	t = timeval_current();
+	for (i = 0; i < BENCH_TIMERS; i += 2) {
+		talloc_free(te[i]);
+	}
+	for (i = BENCH_TIMERS - 1; i > 0; i -= 2) {
+		talloc_free(te[i]);
+	}
+	cancel_secs = timeval_elapsed(&t);
+
+	torture_comment(test, "%d timers: %.0f adds/sec, %.0f cancels/sec\n",
+			BENCH_TIMERS, BENCH_TIMERS/add_secs,
+			BENCH_TIMERS/cancel_secs);
+
+	/* timers already due (b[].due is in the past) fire in time order */
+	for (i = 0; i < 1000; i++) {
+		te[i] = event_add_timed(ev_ctx, te, b[i].due,
+					bench_timer_handler, &b[i]);
+	}
+	for (i = 0; i < 1000; i += 3) {
+		talloc_free(te[i]);
+	}
+	while (state.fired < 666) {
+		if (event_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "Failed event loop %s\n", strerror(errno)));
+		}
+	}
+	torture_assert(test, !state.out_of_order, "timers fired out of order");
+
+	talloc_free(ev_ctx);
+
+	return true;
+}
+
+#ifdef HAVE_TEVENT_THREADS
+/*
+  round trips through a pool of loops: the main thread assigns each job
+  to a loop and posts it there, the loop posts it back when done
+*/
+#define POOL_LOOPS 4
+#define POOL_JOBS 10000
+
+struct pool_job {
+	struct tevent_loop_pool *pool;
+	struct tevent_thread_wakeup *main_wakeup;
+	int *done;
+	int loop;
+	pthread_t thread;
+	struct tevent_context *ev;
+};
+
+static void pool_job_done(struct tevent_context *ev_ctx, void *private_data)
+{
+	struct pool_job *job = (struct pool_job *)private_data;
+
+	tevent_loop_pool_release(job->pool, job->loop);
+	(*job->done)++;
+}
+
+static void pool_job_run(struct tevent_context *ev_ctx, void *private_data)
+{
+	struct pool_job *job = (struct pool_job *)private_data;
+
+	job->thread = pthread_self();
+	job->ev = ev_ctx;
+	tevent_thread_wakeup_post(job->main_wakeup, pool_job_done, job);
+}
+
+static bool test_event_loop_pool(struct torture_context *test)
+{
+	struct tevent_context *ev_ctx;
+	struct tevent_thread_wakeup *w;
+	struct tevent_loop_pool *pool;
+	struct pool_job *jobs;
+	int per_loop[POOL_LOOPS];
+	struct pool_job *first[POOL_LOOPS];
+	int done = 0;
+	struct timeval t;
+	int i, j;
+
+	ev_ctx = event_context_init(test);
+	torture_assert(test, ev_ctx != NULL, "no event context");
+	w = tevent_thread_wakeup_create(ev_ctx, ev_ctx);
+	torture_assert(test, w != NULL, "tevent_thread_wakeup_create failed");
+
+	pool = tevent_loop_pool_create(ev_ctx, POOL_LOOPS, NULL);
+	torture_assert(test, pool != NULL, "tevent_loop_pool_create failed");
+	torture_assert_int_equal(test, tevent_loop_pool_num_loops(pool),
+				 POOL_LOOPS, "wrong number of loops");
+
+	jobs = talloc_zero_array(ev_ctx, struct pool_job, POOL_JOBS);
+	torture_assert(test, jobs != NULL, "no memory");
+
+	t = timeval_current();
+	for (i = 0; i < POOL_JOBS; i++) {
+		jobs[i].pool = pool;
+		jobs[i].main_wakeup = w;
+		jobs[i].done = &done;
+		jobs[i].loop = tevent_loop_pool_assign(pool);
+		torture_assert(test, tevent_loop_pool_post(pool, jobs[i].loop,
+							   pool_job_run, &jobs[i]),
+			       "tevent_loop_pool_post failed");
+	}
+	while (done < POOL_JOBS) {
+		if (event_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, talloc_asprintf(test, "Failed event loop %s\n", strerror(errno)));
+		}
+	}
+
+	torture_comment(test, "%.0f pool round trips/sec over %d loops\n",
+			POOL_JOBS/timeval_elapsed(&t), POOL_LOOPS);
+
+	/* nothing completed before all were assigned, so they are spread evenly */
+	ZERO_STRUCT(per_loop);
+	ZERO_STRUCT(first);
+	for (i = 0; i < POOL_JOBS; i++) {
+		int l = jobs[i].loop;
+		per_loop[l]++;
+		if (first[l] == NULL) {
+			first[l] = &jobs[i];
+		}
+		torture_assert(test, pthread_equal(jobs[i].thread, first[l]->thread) &&
+			       jobs[i].ev == first[l]->ev,
+			       "jobs of one loop ran on different threads");
+	}
+	for (i = 0; i < POOL_LOOPS; i++) {
+		torture_assert_int_equal(test, per_loop[i], POOL_JOBS / POOL_LOOPS,
+					 "jobs not spread evenly");
+		torture_assert(test, !pthread_equal(first[i]->thread, pthread_self()),
+			       "job ran on the main thread");
+		for (j = 0; j < i; j++) {
+			torture_assert(test, !pthread_equal(first[i]->thread, first[j]->thread),
+				       "two loops share a thread");
+		}
+	}
+
+	/* stops and joins the loops */
+	talloc_free(pool);
+	talloc_free(ev_ctx);
+
+	return true;
+}
+#endif
+
 struct torture_suite *torture_local_event(TALLOC_CTX *mem_ctx)
 {
 	struct torture_suite *suite = torture_suite_create(mem_ctx, "EVENT");
@@ -154,6 +753,38 @@ struct torture_suite *torture_local_event(TALLOC_CTX *mem_ctx)
 		torture_suite_add_simple_tcase_const(suite, list[i],
 					       test_event_context,
 					       (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+					       talloc_asprintf(suite, "%s-io", list[i]),
+					       test_event_io,
+					       (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+					       talloc_asprintf(suite, "%s-batch-free", list[i]),
+					       test_event_batch_free,
+					       (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+					       talloc_asprintf(suite, "%s-nested", list[i]),
+					       test_event_nested,
+					       (const void *)list[i]);
+	}
+
+	torture_suite_add_simple_test(suite, "timer-bench",
+				      test_event_timer_bench);
+
+#ifdef HAVE_TEVENT_THREADS
+	torture_suite_add_simple_test(suite, "loop-pool",
+				      test_event_loop_pool);
+#endif
+
+	/* select() can not take fds above FD_SETSIZE */
+	for (i=0;list && list[i];i++) {
+		if (strcmp(list[i], "epoll") != 0 &&
+		    strcmp(list[i], "io_uring") != 0) {
+			continue;
+		}
+		torture_suite_add_simple_tcase_const(suite,
+					       talloc_asprintf(suite, "%s-bench", list[i]),
+					       test_event_fd_bench,
+					       (const void *)list[i]);
 	}
 
 	return suite;
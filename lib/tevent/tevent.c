@@ -118,6 +118,9 @@ static void tevent_backend_init(void)
 #ifdef HAVE_EPOLL
 	tevent_epoll_init();
 #endif
+#ifdef HAVE_IO_URING
+	tevent_uring_init();
+#endif
 }
 
 /*
@@ -142,9 +145,9 @@ const char **tevent_backend_list(TALLOC_CTX *mem_ctx)
 int tevent_common_context_destructor(struct tevent_context *ev)
 {
 	struct tevent_fd *fd, *fn;
-	struct tevent_timer *te, *tn;
 	struct tevent_immediate *ie, *in;
 	struct tevent_signal *se, *sn;
+	size_t i;
 
 	if (ev->pipe_fde) {
 		talloc_free(ev->pipe_fde);
@@ -159,11 +162,10 @@ int tevent_common_context_destructor(struct tevent_context *ev)
 		DLIST_REMOVE(ev->fd_events, fd);
 	}
 
-	for (te = ev->timer_events; te; te = tn) {
-		tn = te->next;
-		te->event_ctx = NULL;
-		DLIST_REMOVE(ev->timer_events, te);
+	for (i = 0; i < ev->num_timers; i++) {
+		ev->timer_heap[i]->event_ctx = NULL;
 	}
+	ev->num_timers = 0;
 
 	for (ie = ev->immediate_events; ie; ie = in) {
 		in = ie->next;
@@ -584,7 +586,7 @@ int tevent_common_loop_wait(struct tevent_context *ev,
 	 * loop as long as we have events pending
 	 */
 	while (ev->fd_events ||
-	       ev->timer_events ||
+	       ev->num_timers ||
 	       ev->immediate_events ||
 	       ev->signal_events) {
 		int ret;
@@ -300,6 +300,53 @@ struct tevent_req *tevent_wakeup_send(TALLOC_CTX *mem_ctx,
 				      struct timeval wakeup_time);
 bool tevent_wakeup_recv(struct tevent_req *req);
 
+/*
+  I/O requests, submitted directly to the kernel by the io_uring
+  backend and done as readiness plus a syscall by the others.
+  See tevent_io.c.
+*/
+enum tevent_io_op {
+	TEVENT_IO_READ,		/* pread() at offset */
+	TEVENT_IO_WRITE,	/* pwrite() at offset */
+	TEVENT_IO_RECV,		/* read() on a stream, offset ignored */
+	TEVENT_IO_SEND		/* write() on a stream, offset ignored */
+};
+
+struct tevent_req *tevent_io_send(TALLOC_CTX *mem_ctx,
+				  struct tevent_context *ev,
+				  enum tevent_io_op op,
+				  int fd, void *buf, size_t len,
+				  off_t offset);
+ssize_t tevent_io_recv(struct tevent_req *req, int *perrno);
+bool tevent_io_is_async(struct tevent_context *ev);
+
+/*
+  Running event loops in threads, this needs pthreads and eventfd
+  (HAVE_TEVENT_THREADS), otherwise creating a wakeup or a pool fails.
+  A tevent_context stays single threaded, other threads can only post
+  handlers to it. See tevent_threads.c.
+*/
+typedef void (*tevent_thread_handler_t)(struct tevent_context *ev,
+					void *private_data);
+
+struct tevent_thread_wakeup;
+struct tevent_thread_wakeup *tevent_thread_wakeup_create(TALLOC_CTX *mem_ctx,
+							  struct tevent_context *ev);
+bool tevent_thread_wakeup_post(struct tevent_thread_wakeup *w,
+			       tevent_thread_handler_t handler,
+			       void *private_data);
+
+struct tevent_loop_pool;
+struct tevent_loop_pool *tevent_loop_pool_create(TALLOC_CTX *mem_ctx,
+						 int num_loops,
+						 const char *backend);
+int tevent_loop_pool_num_loops(struct tevent_loop_pool *pool);
+int tevent_loop_pool_assign(struct tevent_loop_pool *pool);
+void tevent_loop_pool_release(struct tevent_loop_pool *pool, int loop);
+bool tevent_loop_pool_post(struct tevent_loop_pool *pool, int loop,
+			   tevent_thread_handler_t handler,
+			   void *private_data);
+
 int tevent_timeval_compare(const struct timeval *tv1,
 			   const struct timeval *tv2);
 
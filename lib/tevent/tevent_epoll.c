@@ -31,6 +31,20 @@
 #include "tevent_internal.h"
 #include "tevent_util.h"
 
+/*
+  events harvested by one epoll_wait() call, dispatched one after another.
+  A handler can free any fde of the batch (or the whole event context),
+  so fdes still to be dispatched are found and cleared by the destructors
+  through this list. There is one of these per nested loop.
+*/
+struct epoll_dispatch {
+	struct epoll_dispatch *prev;
+	struct epoll_event *events;
+	int num;
+	int next;
+	bool *ctx_freed;
+};
+
 struct epoll_event_context {
 	/* a pointer back to the generic event_context */
 	struct tevent_context *ev;
@@ -39,8 +53,14 @@ struct epoll_event_context {
 	int epoll_fd;
 
 	pid_t pid;
+
+	/* batches being dispatched, innermost first */
+	struct epoll_dispatch *dispatch;
 };
 
+/* Number of events harvested by a single epoll_wait() */
+#define EPOLL_MAXEVENTS 64
+
 /*
   called when a epoll call fails, and we should fallback
   to using select
@@ -68,6 +88,11 @@ static uint32_t epoll_map_flags(uint16_t flags)
 */
 static int epoll_ctx_destructor(struct epoll_event_context *epoll_ev)
 {
+	struct epoll_dispatch *d;
+
+	for (d = epoll_ev->dispatch; d; d = d->prev) {
+		*d->ctx_freed = true;
+	}
 	close(epoll_ev->epoll_fd);
 	epoll_ev->epoll_fd = -1;
 	return 0;
@@ -228,14 +253,32 @@ static void epoll_change_event(struct epoll_event_context *epoll_ev, struct teve
 	}
 }
 
+/*
+  forget a freed fde in the batches still being dispatched
+*/
+static void epoll_dispatch_forget(struct epoll_event_context *epoll_ev, struct tevent_fd *fde)
+{
+	struct epoll_dispatch *d;
+	int i;
+
+	for (d = epoll_ev->dispatch; d; d = d->prev) {
+		for (i = d->next; i < d->num; i++) {
+			if (d->events[i].data.ptr == fde) {
+				d->events[i].data.ptr = NULL;
+			}
+		}
+	}
+}
+
 /*
   event loop handling using epoll
 */
 static int epoll_event_loop(struct epoll_event_context *epoll_ev, struct timeval *tvalp)
 {
 	int ret, i;
-#define MAXEVENTS 1
-	struct epoll_event events[MAXEVENTS];
+	struct epoll_event events[EPOLL_MAXEVENTS];
+	struct epoll_dispatch d, *dp;
+	bool ctx_freed = false;
 	int timeout = -1;
 
 	if (epoll_ev->epoll_fd == -1) return -1;
@@ -250,7 +293,17 @@ static int epoll_event_loop(struct epoll_event_context *epoll_ev, struct timeval
 		return 0;
 	}
 
-	ret = epoll_wait(epoll_ev->epoll_fd, events, MAXEVENTS, timeout);
+	/*
+	  called from a handler (a nested loop): the readiness harvested by the
+	  outer batches is stale from now on (this loop may consume it),
+	  so they stop dispatching. The fds are level triggered, so
+	  whatever is still ready is reported again by epoll_wait().
+	*/
+	for (dp = epoll_ev->dispatch; dp; dp = dp->prev) {
+		dp->next = dp->num;
+	}
+
+	ret = epoll_wait(epoll_ev->epoll_fd, events, EPOLL_MAXEVENTS, timeout);
 
 	if (ret == -1 && errno == EINTR && epoll_ev->ev->signal_events) {
 		if (tevent_common_check_signal(epoll_ev->ev)) {
@@ -270,10 +323,29 @@ static int epoll_event_loop(struct epoll_event_context *epoll_ev, struct timeval
 	}
 
 	for (i=0;i<ret;i++) {
-		struct tevent_fd *fde = talloc_get_type(events[i].data.ptr, 
-						       struct tevent_fd);
+		if (events[i].data.ptr == NULL) {
+			epoll_panic(epoll_ev, "epoll_wait() gave bad data");
+			return -1;
+		}
+	}
+
+	d.events = events;
+	d.num = ret;
+	d.next = 0;
+	d.ctx_freed = &ctx_freed;
+	d.prev = epoll_ev->dispatch;
+	epoll_ev->dispatch = &d;
+
+	while (d.next < d.num) {
+		struct tevent_fd *fde;
 		uint16_t flags = 0;
 
+		i = d.next++;
+		/* freed by an earlier handler of this batch */
+		if (events[i].data.ptr == NULL) {
+			continue;
+		}
+		fde = talloc_get_type(events[i].data.ptr, struct tevent_fd);
 		if (fde == NULL) {
 			epoll_panic(epoll_ev, "epoll_wait() gave bad data");
 			return -1;
@@ -294,12 +366,17 @@ static int epoll_event_loop(struct epoll_event_context *epoll_ev, struct timeval
 		}
 		if (events[i].events & EPOLLIN) flags |= TEVENT_FD_READ;
 		if (events[i].events & EPOLLOUT) flags |= TEVENT_FD_WRITE;
+		/* an earlier handler may have changed what we wait for */
+		flags &= fde->flags;
 		if (flags) {
 			fde->handler(epoll_ev->ev, fde, flags, fde->private_data);
-			break;
+			if (ctx_freed) {
+				return 0;
+			}
 		}
 	}
 
+	epoll_ev->dispatch = d.prev;
 	return 0;
 }
 
@@ -341,6 +418,8 @@ static int epoll_event_fd_destructor(struct tevent_fd *fde)
 		epoll_check_reopen(epoll_ev);
 
 		epoll_del_event(epoll_ev, fde);
+
+		epoll_dispatch_forget(epoll_ev, fde);
 	}
 
 	return tevent_common_fd_destructor(fde);
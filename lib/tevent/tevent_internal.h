@@ -167,8 +167,11 @@ struct tevent_fd {
 };
 
 struct tevent_timer {
-	struct tevent_timer *prev, *next;
 	struct tevent_context *event_ctx;
+	/* position in event_ctx->timer_heap */
+	size_t heap_index;
+	/* orders timers with the same next_event by creation */
+	uint64_t seq;
 	struct timeval next_event;
 	tevent_timer_handler_t handler;
 	/* this is private for the specific handler */
@@ -226,8 +229,11 @@ struct tevent_context {
 	/* list of fd events - used by common code */
 	struct tevent_fd *fd_events;
 
-	/* list of timed events - used by common code */
-	struct tevent_timer *timer_events;
+	/* timed events, a binary heap ordered by next_event - used by common code */
+	struct tevent_timer **timer_heap;
+	size_t num_timers;
+	size_t timer_heap_size;
+	uint64_t timer_seq;
 
 	/* list of immediate events - used by common code */
 	struct tevent_immediate *immediate_events;
@@ -281,6 +287,7 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev,
 					     const char *handler_name,
 					     const char *location);
 struct timeval tevent_common_loop_timer_delay(struct tevent_context *);
+struct tevent_timer *tevent_common_first_timer(struct tevent_context *ev);
 
 void tevent_common_schedule_immediate(struct tevent_immediate *im,
 				      struct tevent_context *ev,
@@ -305,3 +312,29 @@ bool tevent_select_init(void);
 #ifdef HAVE_EPOLL
 bool tevent_epoll_init(void);
 #endif
+#ifdef HAVE_IO_URING
+bool tevent_uring_init(void);
+#endif
+
+/* tevent_io.c - state of a tevent_io_send() request */
+struct tevent_io_state {
+	enum tevent_io_op op;
+	int fd;
+	void *buf;
+	size_t len;
+	off_t offset;
+	ssize_t ret;
+	/* waiting for readiness if the backend does not do the I/O */
+	struct tevent_fd *fde;
+	/* set by a backend that has the I/O in flight */
+	void (*cancel_fn)(struct tevent_io_state *state);
+	void *additional_data;
+};
+
+void tevent_io_done(struct tevent_req *req, ssize_t ret, int err);
+#ifdef HAVE_IO_URING
+bool tevent_uring_io_submit(struct tevent_context *ev,
+			    struct tevent_req *req,
+			    struct tevent_io_state *state);
+bool tevent_uring_is_backend(struct tevent_context *ev);
+#endif
@@ -0,0 +1,190 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   I/O requests: read/write at an offset, or recv/send on a stream
+
+     ** NOTE! The following LGPL license applies to the tevent
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  A backend that can do I/O itself (io_uring) gets the request submitted
+  directly and completes it without a readiness round trip. Otherwise
+  TEVENT_IO_READ/WRITE are plain pread()/pwrite() done at once, and
+  TEVENT_IO_RECV/SEND wait for the fd to become ready and then do one
+  read()/write().
+
+  The buffer is not copied and must stay valid until the request is
+  finished. Freeing the request before that cancels the I/O and, on
+  backends with the I/O in flight, waits for the kernel to let go of
+  the buffer.
+*/
+
+#include "replace.h"
+#include "system/filesys.h"
+#include "tevent.h"
+#include "tevent_internal.h"
+#include "tevent_util.h"
+
+static int tevent_io_state_destructor(struct tevent_io_state *state)
+{
+	if (state->cancel_fn) {
+		state->cancel_fn(state);
+	}
+	return 0;
+}
+
+/*
+  finish an I/O request, used by backends too
+*/
+void tevent_io_done(struct tevent_req *req, ssize_t ret, int err)
+{
+	struct tevent_io_state *state = tevent_req_data(req,
+					struct tevent_io_state);
+
+	state->cancel_fn = NULL;
+	TALLOC_FREE(state->fde);
+
+	state->ret = ret;
+	if (ret == -1) {
+		tevent_req_error(req, err);
+		return;
+	}
+	tevent_req_done(req);
+}
+
+static void tevent_io_fd_handler(struct tevent_context *ev,
+				 struct tevent_fd *fde,
+				 uint16_t flags, void *private_data)
+{
+	struct tevent_req *req = talloc_get_type(private_data,
+				 struct tevent_req);
+	struct tevent_io_state *state = tevent_req_data(req,
+					struct tevent_io_state);
+	ssize_t ret;
+
+	if (state->op == TEVENT_IO_RECV) {
+		ret = read(state->fd, state->buf, state->len);
+	} else {
+		ret = write(state->fd, state->buf, state->len);
+	}
+	if (ret == -1 &&
+	    (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) {
+		return;
+	}
+
+	tevent_io_done(req, ret, errno);
+}
+
+struct tevent_req *tevent_io_send(TALLOC_CTX *mem_ctx,
+				  struct tevent_context *ev,
+				  enum tevent_io_op op,
+				  int fd, void *buf, size_t len,
+				  off_t offset)
+{
+	struct tevent_req *req;
+	struct tevent_io_state *state;
+	ssize_t ret;
+
+	req = tevent_req_create(mem_ctx, &state, struct tevent_io_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->op	= op;
+	state->fd	= fd;
+	state->buf	= buf;
+	state->len	= len;
+	state->offset	= offset;
+	state->ret	= -1;
+	talloc_set_destructor(state, tevent_io_state_destructor);
+
+#ifdef HAVE_IO_URING
+	if (tevent_uring_io_submit(ev, req, state)) {
+		return req;
+	}
+#endif
+
+	switch (op) {
+	case TEVENT_IO_READ:
+		ret = pread(fd, buf, len, offset);
+		break;
+	case TEVENT_IO_WRITE:
+		ret = pwrite(fd, buf, len, offset);
+		break;
+	case TEVENT_IO_RECV:
+	case TEVENT_IO_SEND:
+		state->fde = tevent_add_fd(ev, state, fd,
+					   op == TEVENT_IO_RECV ?
+					   TEVENT_FD_READ : TEVENT_FD_WRITE,
+					   tevent_io_fd_handler, req);
+		if (tevent_req_nomem(state->fde, req)) {
+			return tevent_req_post(req, ev);
+		}
+		return req;
+	default:
+		tevent_req_error(req, EINVAL);
+		return tevent_req_post(req, ev);
+	}
+
+	tevent_io_done(req, ret, errno);
+	return tevent_req_post(req, ev);
+}
+
+/*
+  returns the number of bytes transferred, or -1 with *perrno set
+*/
+ssize_t tevent_io_recv(struct tevent_req *req, int *perrno)
+{
+	struct tevent_io_state *state = tevent_req_data(req,
+					struct tevent_io_state);
+	enum tevent_req_state req_state;
+	uint64_t err;
+	ssize_t ret;
+
+	if (tevent_req_is_error(req, &req_state, &err)) {
+		switch (req_state) {
+		case TEVENT_REQ_USER_ERROR:
+			*perrno = (int)err;
+			break;
+		case TEVENT_REQ_TIMED_OUT:
+			*perrno = ETIMEDOUT;
+			break;
+		default:
+			*perrno = ENOMEM;
+			break;
+		}
+		tevent_req_received(req);
+		return -1;
+	}
+
+	ret = state->ret;
+	tevent_req_received(req);
+	return ret;
+}
+
+/*
+  true if the backend of ev does tevent_io_send() I/O without blocking
+  the loop, callers can then prefer it over synchronous file I/O
+*/
+bool tevent_io_is_async(struct tevent_context *ev)
+{
+#ifdef HAVE_IO_URING
+	return tevent_uring_is_backend(ev);
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,469 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   cross-thread wakeups and pools of event loops running in threads
+
+     ** NOTE! The following LGPL license applies to the tevent
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  A tevent_context is only ever touched by the thread that runs it. The
+  only thing other threads may do is post a handler to it through a
+  tevent_thread_wakeup: the handler is queued under a mutex and an
+  eventfd makes the owning loop wake up and run it.
+
+  A tevent_loop_pool starts N threads, each with its own event context
+  and wakeup. Work gets onto a loop only by posting a handler to it, and
+  tevent_loop_pool_assign() picks the loop with the fewest connections.
+
+  talloc is not thread safe, so each loop has its own talloc tree under
+  its event context and data passed between threads must not be
+  allocated or freed by both sides. Talloc null tracking must be off.
+  Signal events can only be used on the main thread's context.
+
+  Without pthreads and eventfd (HAVE_TEVENT_THREADS) the same functions
+  exist, but nothing can be created and nothing can be posted.
+*/
+
+#include "replace.h"
+#include "system/filesys.h"
+#include "tevent.h"
+#include "tevent_internal.h"
+#include "tevent_util.h"
+
+#ifdef HAVE_TEVENT_THREADS
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+struct tevent_thread_job {
+	struct tevent_thread_job *next;
+	tevent_thread_handler_t handler;
+	void *private_data;
+};
+
+struct tevent_thread_wakeup {
+	struct tevent_fd *fde;
+	int fd;
+	pthread_mutex_t mutex;
+	struct tevent_thread_job *jobs;
+	struct tevent_thread_job **jobs_tail;
+};
+
+static void tevent_thread_wakeup_handler(struct tevent_context *ev,
+					 struct tevent_fd *fde,
+					 uint16_t flags, void *private_data)
+{
+	struct tevent_thread_wakeup *w = talloc_get_type(private_data,
+					 struct tevent_thread_wakeup);
+	struct tevent_thread_job *jobs, *job;
+	uint64_t count;
+
+	/*
+	  EAGAIN: the count was already taken, e.g. by a nested loop, and
+	  with it everything queued so far. Later posts write it again.
+	*/
+	if (read(w->fd, &count, sizeof(count)) != sizeof(count)) {
+		return;
+	}
+
+	pthread_mutex_lock(&w->mutex);
+	jobs = w->jobs;
+	w->jobs = NULL;
+	w->jobs_tail = &w->jobs;
+	pthread_mutex_unlock(&w->mutex);
+
+	/* a handler may free w, only the taken list is used from here on */
+	while ((job = jobs) != NULL) {
+		jobs = job->next;
+		job->handler(ev, job->private_data);
+		free(job);
+	}
+}
+
+static int tevent_thread_wakeup_destructor(struct tevent_thread_wakeup *w)
+{
+	struct tevent_thread_job *job;
+
+	talloc_free(w->fde);
+	close(w->fd);
+
+	/* nobody may post any more, jobs not run yet are dropped */
+	while ((job = w->jobs) != NULL) {
+		w->jobs = job->next;
+		free(job);
+	}
+	pthread_mutex_destroy(&w->mutex);
+	return 0;
+}
+
+/*
+  create a wakeup for ev, it must only be freed in the thread running ev
+  and when no other thread posts to it any more
+*/
+struct tevent_thread_wakeup *tevent_thread_wakeup_create(TALLOC_CTX *mem_ctx,
+							  struct tevent_context *ev)
+{
+	struct tevent_thread_wakeup *w;
+
+	w = talloc_zero(mem_ctx, struct tevent_thread_wakeup);
+	if (w == NULL) {
+		return NULL;
+	}
+
+	w->fd = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	if (w->fd == -1) {
+		talloc_free(w);
+		return NULL;
+	}
+	if (pthread_mutex_init(&w->mutex, NULL) != 0) {
+		close(w->fd);
+		talloc_free(w);
+		return NULL;
+	}
+	w->jobs_tail = &w->jobs;
+	talloc_set_destructor(w, tevent_thread_wakeup_destructor);
+
+	w->fde = tevent_add_fd(ev, w, w->fd, TEVENT_FD_READ,
+			       tevent_thread_wakeup_handler, w);
+	if (w->fde == NULL) {
+		talloc_free(w);
+		return NULL;
+	}
+
+	return w;
+}
+
+/*
+  run handler(private_data) in the thread owning w. Can be called from
+  any thread, handlers posted by one thread run in the order posted.
+*/
+bool tevent_thread_wakeup_post(struct tevent_thread_wakeup *w,
+			       tevent_thread_handler_t handler,
+			       void *private_data)
+{
+	struct tevent_thread_job *job;
+	uint64_t one = 1;
+	ssize_t ret;
+
+	job = (struct tevent_thread_job *)malloc(sizeof(*job));
+	if (job == NULL) {
+		return false;
+	}
+	job->next = NULL;
+	job->handler = handler;
+	job->private_data = private_data;
+
+	pthread_mutex_lock(&w->mutex);
+	*w->jobs_tail = job;
+	w->jobs_tail = &job->next;
+	pthread_mutex_unlock(&w->mutex);
+
+	/* only fails if the counter would overflow, it is read soon */
+	do {
+		ret = write(w->fd, &one, sizeof(one));
+	} while (ret == -1 && errno == EINTR);
+
+	return true;
+}
+
+struct tevent_loop {
+	struct tevent_loop_pool *pool;
+	pthread_t thread;
+	bool started;
+	/*
+	  set by the loop thread once it runs, NULL if it failed or has
+	  ended. Protected by pool->mutex, posts hold it so the wakeup is
+	  not freed under them.
+	*/
+	struct tevent_thread_wakeup *wakeup;
+	bool ready;
+	/* only used by the loop thread */
+	bool stop;
+	/* protected by pool->mutex */
+	int assigned;
+};
+
+struct tevent_loop_pool {
+	const char *backend;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	int num_loops;
+	struct tevent_loop *loops;
+};
+
+static void *tevent_loop_main(void *arg)
+{
+	struct tevent_loop *loop = (struct tevent_loop *)arg;
+	struct tevent_loop_pool *pool = loop->pool;
+	struct tevent_context *ev;
+	struct tevent_thread_wakeup *w = NULL;
+
+	if (pool->backend) {
+		ev = tevent_context_init_byname(NULL, pool->backend);
+	} else {
+		ev = tevent_context_init(NULL);
+	}
+	if (ev != NULL) {
+		w = tevent_thread_wakeup_create(ev, ev);
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+	loop->wakeup = w;
+	loop->ready = true;
+	pthread_cond_broadcast(&pool->cond);
+	pthread_mutex_unlock(&pool->mutex);
+
+	if (w == NULL) {
+		talloc_free(ev);
+		return NULL;
+	}
+
+	while (!loop->stop) {
+		if (tevent_loop_once(ev) != 0) {
+			tevent_debug(ev, TEVENT_DEBUG_FATAL,
+				     "tevent_loop_pool: loop failed\n");
+			break;
+		}
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+	loop->wakeup = NULL;
+	pthread_mutex_unlock(&pool->mutex);
+
+	talloc_free(ev);
+	return NULL;
+}
+
+static void tevent_loop_stop(struct tevent_context *ev, void *private_data)
+{
+	struct tevent_loop *loop = (struct tevent_loop *)private_data;
+	loop->stop = true;
+}
+
+static int tevent_loop_pool_destructor(struct tevent_loop_pool *pool)
+{
+	int i;
+
+	pthread_mutex_lock(&pool->mutex);
+	for (i = 0; i < pool->num_loops; i++) {
+		struct tevent_loop *loop = &pool->loops[i];
+		if (loop->wakeup != NULL) {
+			tevent_thread_wakeup_post(loop->wakeup,
+						  tevent_loop_stop, loop);
+		}
+	}
+	pthread_mutex_unlock(&pool->mutex);
+	for (i = 0; i < pool->num_loops; i++) {
+		if (pool->loops[i].started) {
+			pthread_join(pool->loops[i].thread, NULL);
+		}
+	}
+	pthread_cond_destroy(&pool->cond);
+	pthread_mutex_destroy(&pool->mutex);
+	return 0;
+}
+
+/*
+  start num_loops threads, each running its own event context of the
+  given backend (NULL for the default). Freeing the pool stops and
+  joins them, handlers posted before that are run first.
+*/
+struct tevent_loop_pool *tevent_loop_pool_create(TALLOC_CTX *mem_ctx,
+						 int num_loops,
+						 const char *backend)
+{
+	struct tevent_loop_pool *pool;
+	const char **list;
+	bool failed = false;
+	int i;
+
+	if (num_loops < 1) {
+		return NULL;
+	}
+
+	/* register the backends before any thread looks them up */
+	list = tevent_backend_list(NULL);
+	talloc_free(list);
+
+	pool = talloc_zero(mem_ctx, struct tevent_loop_pool);
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->loops = talloc_zero_array(pool, struct tevent_loop, num_loops);
+	if (pool->loops == NULL) {
+		talloc_free(pool);
+		return NULL;
+	}
+	if (backend != NULL) {
+		pool->backend = talloc_strdup(pool, backend);
+		if (pool->backend == NULL) {
+			talloc_free(pool);
+			return NULL;
+		}
+	}
+	if (pthread_mutex_init(&pool->mutex, NULL) != 0) {
+		talloc_free(pool);
+		return NULL;
+	}
+	if (pthread_cond_init(&pool->cond, NULL) != 0) {
+		pthread_mutex_destroy(&pool->mutex);
+		talloc_free(pool);
+		return NULL;
+	}
+	pool->num_loops = num_loops;
+	talloc_set_destructor(pool, tevent_loop_pool_destructor);
+
+	for (i = 0; i < num_loops; i++) {
+		struct tevent_loop *loop = &pool->loops[i];
+		loop->pool = pool;
+		if (pthread_create(&loop->thread, NULL,
+				   tevent_loop_main, loop) != 0) {
+			failed = true;
+			break;
+		}
+		loop->started = true;
+	}
+
+	/* wait until every started loop can take posts */
+	pthread_mutex_lock(&pool->mutex);
+	for (i = 0; i < num_loops; i++) {
+		struct tevent_loop *loop = &pool->loops[i];
+		if (!loop->started) {
+			break;
+		}
+		while (!loop->ready) {
+			pthread_cond_wait(&pool->cond, &pool->mutex);
+		}
+		if (loop->wakeup == NULL) {
+			failed = true;
+		}
+	}
+	pthread_mutex_unlock(&pool->mutex);
+
+	if (failed) {
+		talloc_free(pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+int tevent_loop_pool_num_loops(struct tevent_loop_pool *pool)
+{
+	return pool->num_loops;
+}
+
+/*
+  pick the loop with the fewest connections assigned and count one more
+  on it. Give it back with tevent_loop_pool_release() when done.
+*/
+int tevent_loop_pool_assign(struct tevent_loop_pool *pool)
+{
+	int i, best = 0;
+
+	pthread_mutex_lock(&pool->mutex);
+	for (i = 1; i < pool->num_loops; i++) {
+		if (pool->loops[i].assigned < pool->loops[best].assigned) {
+			best = i;
+		}
+	}
+	pool->loops[best].assigned++;
+	pthread_mutex_unlock(&pool->mutex);
+
+	return best;
+}
+
+void tevent_loop_pool_release(struct tevent_loop_pool *pool, int loop)
+{
+	if (loop < 0 || loop >= pool->num_loops) {
+		return;
+	}
+	pthread_mutex_lock(&pool->mutex);
+	if (pool->loops[loop].assigned > 0) {
+		pool->loops[loop].assigned--;
+	}
+	pthread_mutex_unlock(&pool->mutex);
+}
+
+/*
+  run handler(private_data) on the given loop's thread, with that loop's
+  event context. Can be called from any thread, including pool loops.
+  Returns false if the loop has ended.
+*/
+bool tevent_loop_pool_post(struct tevent_loop_pool *pool, int loop,
+			   tevent_thread_handler_t handler,
+			   void *private_data)
+{
+	bool ret = false;
+
+	if (loop < 0 || loop >= pool->num_loops) {
+		return false;
+	}
+	pthread_mutex_lock(&pool->mutex);
+	if (pool->loops[loop].wakeup != NULL) {
+		ret = tevent_thread_wakeup_post(pool->loops[loop].wakeup,
+						handler, private_data);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+	return ret;
+}
+
+#else /* HAVE_TEVENT_THREADS */
+
+struct tevent_thread_wakeup *tevent_thread_wakeup_create(TALLOC_CTX *mem_ctx,
+							  struct tevent_context *ev)
+{
+	return NULL;
+}
+
+bool tevent_thread_wakeup_post(struct tevent_thread_wakeup *w,
+			       tevent_thread_handler_t handler,
+			       void *private_data)
+{
+	return false;
+}
+
+struct tevent_loop_pool *tevent_loop_pool_create(TALLOC_CTX *mem_ctx,
+						 int num_loops,
+						 const char *backend)
+{
+	return NULL;
+}
+
+int tevent_loop_pool_num_loops(struct tevent_loop_pool *pool)
+{
+	return 0;
+}
+
+int tevent_loop_pool_assign(struct tevent_loop_pool *pool)
+{
+	return -1;
+}
+
+void tevent_loop_pool_release(struct tevent_loop_pool *pool, int loop)
+{
+}
+
+bool tevent_loop_pool_post(struct tevent_loop_pool *pool, int loop,
+			   tevent_thread_handler_t handler,
+			   void *private_data)
+{
+	return false;
+}
+
+#endif /* HAVE_TEVENT_THREADS */
@@ -128,6 +128,116 @@ struct timeval tevent_timeval_current_ofs(uint32_t secs, uint32_t usecs)
 	return tevent_timeval_add(&tv, secs, usecs);
 }
 
+/*
+  The pending timers are kept in a binary heap, so adding and removing
+  one is O(log n) instead of a walk over a sorted list. Timers due at the
+  same time fire in the order they were added.
+*/
+static bool tevent_timer_before(const struct tevent_timer *te1,
+				const struct tevent_timer *te2)
+{
+	int cmp = tevent_timeval_compare(&te1->next_event, &te2->next_event);
+	if (cmp != 0) {
+		return cmp < 0;
+	}
+	return te1->seq < te2->seq;
+}
+
+static void tevent_timer_heap_set(struct tevent_context *ev, size_t i,
+				  struct tevent_timer *te)
+{
+	ev->timer_heap[i] = te;
+	te->heap_index = i;
+}
+
+static void tevent_timer_heap_up(struct tevent_context *ev, size_t i)
+{
+	struct tevent_timer *te = ev->timer_heap[i];
+
+	while (i > 0) {
+		size_t parent = (i - 1) / 2;
+		if (!tevent_timer_before(te, ev->timer_heap[parent])) {
+			break;
+		}
+		tevent_timer_heap_set(ev, i, ev->timer_heap[parent]);
+		i = parent;
+	}
+	tevent_timer_heap_set(ev, i, te);
+}
+
+static void tevent_timer_heap_down(struct tevent_context *ev, size_t i)
+{
+	struct tevent_timer *te = ev->timer_heap[i];
+
+	while (true) {
+		size_t child = 2 * i + 1;
+		if (child >= ev->num_timers) {
+			break;
+		}
+		if (child + 1 < ev->num_timers &&
+		    tevent_timer_before(ev->timer_heap[child + 1],
+					ev->timer_heap[child])) {
+			child++;
+		}
+		if (!tevent_timer_before(ev->timer_heap[child], te)) {
+			break;
+		}
+		tevent_timer_heap_set(ev, i, ev->timer_heap[child]);
+		i = child;
+	}
+	tevent_timer_heap_set(ev, i, te);
+}
+
+static bool tevent_timer_heap_add(struct tevent_context *ev,
+				  struct tevent_timer *te)
+{
+	if (ev->num_timers == ev->timer_heap_size) {
+		size_t size = ev->timer_heap_size ? ev->timer_heap_size * 2 : 16;
+		struct tevent_timer **heap;
+
+		heap = talloc_realloc(ev, ev->timer_heap,
+				      struct tevent_timer *, size);
+		if (heap == NULL) {
+			return false;
+		}
+		ev->timer_heap = heap;
+		ev->timer_heap_size = size;
+	}
+
+	te->seq = ev->timer_seq++;
+	tevent_timer_heap_set(ev, ev->num_timers++, te);
+	tevent_timer_heap_up(ev, te->heap_index);
+	return true;
+}
+
+static void tevent_timer_heap_remove(struct tevent_context *ev,
+				     struct tevent_timer *te)
+{
+	size_t i = te->heap_index;
+	struct tevent_timer *last = ev->timer_heap[--ev->num_timers];
+
+	if (last == te) {
+		return;
+	}
+	tevent_timer_heap_set(ev, i, last);
+	if (i > 0 && tevent_timer_before(last, ev->timer_heap[(i - 1) / 2])) {
+		tevent_timer_heap_up(ev, i);
+	} else {
+		tevent_timer_heap_down(ev, i);
+	}
+}
+
+/*
+  return the timer that is due first, NULL if there is none
+*/
+struct tevent_timer *tevent_common_first_timer(struct tevent_context *ev)
+{
+	if (ev->num_timers == 0) {
+		return NULL;
+	}
+	return ev->timer_heap[0];
+}
+
 /*
   destroy a timed event
 */
@@ -138,7 +248,7 @@ static int tevent_common_timed_destructor(struct tevent_timer *te)
 		     te, te->handler_name);
 
 	if (te->event_ctx) {
-		DLIST_REMOVE(te->event_ctx->timer_events, te);
+		tevent_timer_heap_remove(te->event_ctx, te);
 	}
 
 	return 0;
@@ -160,7 +270,7 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 					     const char *handler_name,
 					     const char *location)
 {
-	struct tevent_timer *te, *last_te, *cur_te;
+	struct tevent_timer *te;
 
 	te = talloc(mem_ctx?mem_ctx:ev, struct tevent_timer);
 	if (te == NULL) return NULL;
@@ -173,19 +283,11 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 	te->location		= location;
 	te->additional_data	= NULL;
 
-	/* keep the list ordered */
-	last_te = NULL;
-	for (cur_te = ev->timer_events; cur_te; cur_te = cur_te->next) {
-		/* if the new event comes before the current one break */
-		if (tevent_timeval_compare(&te->next_event, &cur_te->next_event) < 0) {
-			break;
-		}
-
-		last_te = cur_te;
+	if (!tevent_timer_heap_add(ev, te)) {
+		talloc_free(te);
+		return NULL;
 	}
 
-	DLIST_ADD_AFTER(ev->timer_events, te, last_te);
-
 	talloc_set_destructor(te, tevent_common_timed_destructor);
 
 	tevent_debug(ev, TEVENT_DEBUG_TRACE,
@@ -203,7 +305,7 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 struct timeval tevent_common_loop_timer_delay(struct tevent_context *ev)
 {
 	struct timeval current_time = tevent_timeval_zero();
-	struct tevent_timer *te = ev->timer_events;
+	struct tevent_timer *te = tevent_common_first_timer(ev);
 
 	if (!te) {
 		/* have a default tick time of 30 seconds. This guarantees
@@ -242,7 +344,7 @@ struct timeval tevent_common_loop_timer_delay(struct tevent_context *ev)
 	/* We need to remove the timer from the list before calling the
 	 * handler because in a semi-async inner event loop called from the
 	 * handler we don't want to come across this event again -- vl */
-	DLIST_REMOVE(ev->timer_events, te);
+	tevent_timer_heap_remove(ev, te);
 
 	/*
 	 * If the timed event was registered for a zero current_time,
@@ -0,0 +1,947 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   main select loop and event handling - Linux io_uring implementation
+
+     ** NOTE! The following LGPL license applies to the tevent
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  fd events are one-shot IORING_OP_POLL_ADD requests, armed again each
+  time they fire. tevent_io_send() requests become READV/WRITEV
+  submissions, so their completion is the I/O result and no second
+  syscall is needed. Submissions queue up in the ring and go to the
+  kernel together with the wait of the next loop iteration.
+
+  Every submission has a uring_op, which outlives the fde or request it
+  was made for until the kernel has posted its completion. The ring is
+  driven by raw syscalls, it needs IORING_FEAT_EXT_ARG (Linux 5.11) for
+  waits with a timeout.
+*/
+
+#include "replace.h"
+#include "system/filesys.h"
+#include "tevent.h"
+#include "tevent_internal.h"
+#include "tevent_util.h"
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* Submission queue size, the completion queue is twice that */
+#define URING_ENTRIES 256
+
+struct uring_context;
+
+struct uring_op {
+	struct uring_op *prev, *next;
+	struct uring_context *ring;
+	/* what the op is for, both NULL once the owner is gone */
+	struct tevent_fd *fde;
+	struct tevent_req *req;
+	struct tevent_io_state *io;
+	struct iovec iov;
+	/* submitted and its completion not reaped yet */
+	bool in_flight;
+	/* an IORING_OP_ASYNC_CANCEL for it is queued */
+	bool cancelled;
+	/* somebody waits for the completion and frees it */
+	bool waited;
+	int32_t res;
+};
+
+/* one per nested loop, told when the context is freed by a handler */
+struct uring_dispatch {
+	struct uring_dispatch *prev;
+	bool ctx_freed;
+};
+
+struct uring_context {
+	/* a pointer back to the generic event_context */
+	struct tevent_context *ev;
+
+	int ring_fd;
+	pid_t pid;
+
+	/* submission ring, sq_local_tail is published on submit */
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned sq_entries;
+	unsigned sq_local_tail;
+	struct io_uring_sqe *sqes;
+
+	/* completion ring */
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_cqe *cqes;
+
+	void *sq_ring, *cq_ring;
+	size_t sq_ring_len, cq_ring_len, sqes_len;
+
+	/* ops the kernel has, and ops reaped but not dispatched yet */
+	struct uring_op *in_flight;
+	struct uring_op *completed;
+
+	struct uring_dispatch *dispatch;
+
+	/* some fdes could not be armed for lack of room, see uring_rearm() */
+	bool rearm;
+};
+
+#define URING_ADDITIONAL_FD_FLAG_GOT_ERROR	(1<<0)
+#define URING_ADDITIONAL_FD_FLAG_REARM		(1<<1)
+
+static void uring_panic(struct uring_context *ring, const char *reason)
+{
+	tevent_debug(ring->ev, TEVENT_DEBUG_FATAL,
+		 "%s (%s) - calling abort()\n", reason, strerror(errno));
+	abort();
+}
+
+static int uring_setup(unsigned entries, struct io_uring_params *p)
+{
+	return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int uring_enter(struct uring_context *ring, unsigned min_complete,
+		       const struct timeval *tvalp)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	unsigned flags = 0;
+	unsigned to_submit;
+	void *argp = NULL;
+	size_t argsz = 0;
+
+	__atomic_store_n(ring->sq_tail, ring->sq_local_tail, __ATOMIC_RELEASE);
+	to_submit = ring->sq_local_tail -
+		__atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+
+	if (min_complete > 0) {
+		flags |= IORING_ENTER_GETEVENTS;
+	}
+	if (tvalp) {
+		ts.tv_sec = tvalp->tv_sec;
+		ts.tv_nsec = tvalp->tv_usec * 1000;
+		ZERO_STRUCT(arg);
+		arg.ts = (uint64_t)(uintptr_t)&ts;
+		flags |= IORING_ENTER_EXT_ARG;
+		argp = &arg;
+		argsz = sizeof(arg);
+	}
+
+	return syscall(__NR_io_uring_enter, ring->ring_fd, to_submit,
+		       min_complete, flags, argp, argsz);
+}
+
+/*
+  get a free submission entry, pushing queued ones to the kernel if the
+  ring is full
+*/
+static struct io_uring_sqe *uring_get_sqe(struct uring_context *ring)
+{
+	struct io_uring_sqe *sqe;
+	unsigned head, idx;
+
+	head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+	if (ring->sq_local_tail - head >= ring->sq_entries) {
+		if (uring_enter(ring, 0, NULL) == -1) {
+			return NULL;
+		}
+		head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+		if (ring->sq_local_tail - head >= ring->sq_entries) {
+			return NULL;
+		}
+	}
+
+	idx = ring->sq_local_tail & *ring->sq_mask;
+	sqe = &ring->sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	ring->sq_array[idx] = idx;
+	ring->sq_local_tail++;
+	return sqe;
+}
+
+static struct uring_op *uring_op_new(struct uring_context *ring)
+{
+	struct uring_op *op;
+
+	op = talloc_zero(ring, struct uring_op);
+	if (op == NULL) {
+		return NULL;
+	}
+	op->ring = ring;
+	return op;
+}
+
+static void uring_op_submitted(struct uring_context *ring, struct uring_op *op,
+			       struct io_uring_sqe *sqe)
+{
+	sqe->user_data = (uint64_t)(uintptr_t)op;
+	op->in_flight = true;
+	DLIST_ADD(ring->in_flight, op);
+}
+
+/*
+  move completions from the ring to the ops. Ops whose owner went away
+  are freed here, the rest wait on the completed list for dispatch.
+*/
+static void uring_reap(struct uring_context *ring)
+{
+	unsigned head, tail;
+
+	head = *ring->cq_head;
+	tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+	while (head != tail) {
+		struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+		struct uring_op *op = (struct uring_op *)(uintptr_t)cqe->user_data;
+
+		head++;
+		/* cancel requests carry no op */
+		if (op == NULL) {
+			continue;
+		}
+		op->res = cqe->res;
+		op->in_flight = false;
+		DLIST_REMOVE(ring->in_flight, op);
+		if (op->fde == NULL && op->req == NULL) {
+			if (!op->waited) {
+				talloc_free(op);
+			}
+			continue;
+		}
+		DLIST_ADD_END(ring->completed, op, struct uring_op *);
+	}
+
+	__atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+/*
+  ask the kernel to drop an in flight op, its completion comes back
+  with -ECANCELED (or the result, if it was too late). The op must not
+  be freed by a reap (fde or waited set). Returns false if there was no
+  room to queue the cancel, the op then runs until it completes.
+*/
+static bool uring_cancel(struct uring_context *ring, struct uring_op *op)
+{
+	struct io_uring_sqe *sqe;
+
+	sqe = uring_get_sqe(ring);
+	if (sqe == NULL) {
+		/*
+		  the kernel takes no more submissions while the completion
+		  queue is backed up, empty it and push the queue again
+		*/
+		uring_reap(ring);
+		if (!op->in_flight) {
+			return true;
+		}
+		sqe = uring_get_sqe(ring);
+		if (sqe == NULL) {
+			tevent_debug(ring->ev, TEVENT_DEBUG_ERROR,
+				     "io_uring: no room to cancel op: %s\n",
+				     strerror(errno));
+			return false;
+		}
+	}
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = (uint64_t)(uintptr_t)op;
+	sqe->user_data = 0;
+	op->cancelled = true;
+	return true;
+}
+
+/*
+  wait until the kernel is done with an op, used when its buffer is
+  about to go away. A cancel that could not be queued is retried as
+  completions make room for it.
+*/
+static void uring_wait_op(struct uring_context *ring, struct uring_op *op)
+{
+	op->waited = true;
+	while (op->in_flight) {
+		int ret;
+
+		if (!op->cancelled) {
+			uring_cancel(ring, op);
+			if (!op->in_flight) {
+				break;
+			}
+		}
+		ret = uring_enter(ring, 1, NULL);
+		if (ret == -1 && errno != EINTR && errno != EAGAIN &&
+		    errno != EBUSY) {
+			tevent_debug(ring->ev, TEVENT_DEBUG_FATAL,
+				     "io_uring wait for cancel failed: %s\n",
+				     strerror(errno));
+			/* leave it to be freed by a later reap */
+			op->waited = false;
+			return;
+		}
+		uring_reap(ring);
+	}
+	talloc_free(op);
+}
+
+/*
+  map from TEVENT_FD_* to poll events
+*/
+static uint32_t uring_map_flags(uint16_t flags)
+{
+	uint32_t ret = 0;
+	if (flags & TEVENT_FD_READ) ret |= (POLLIN | POLLERR | POLLHUP);
+	if (flags & TEVENT_FD_WRITE) ret |= (POLLOUT | POLLERR | POLLHUP);
+	return ret;
+}
+
+/*
+  arm a one-shot poll for the current flags of fde
+*/
+static void uring_arm_fd(struct uring_context *ring, struct tevent_fd *fde)
+{
+	struct io_uring_sqe *sqe;
+	struct uring_op *op;
+	uint32_t mask;
+
+	if (ring->ring_fd == -1) return;
+
+	fde->additional_flags &= ~URING_ADDITIONAL_FD_FLAG_REARM;
+
+	if (!(fde->flags & (TEVENT_FD_READ|TEVENT_FD_WRITE))) return;
+
+	/* errors are only reported to readers, like select() */
+	if ((fde->additional_flags & URING_ADDITIONAL_FD_FLAG_GOT_ERROR) &&
+	    !(fde->flags & TEVENT_FD_READ)) {
+		return;
+	}
+
+	op = uring_op_new(ring);
+	if (op == NULL) {
+		uring_panic(ring, "out of memory arming fd");
+		return;
+	}
+	sqe = uring_get_sqe(ring);
+	if (sqe == NULL) {
+		/* the completion queue is backed up, like in uring_cancel() */
+		uring_reap(ring);
+		sqe = uring_get_sqe(ring);
+	}
+	if (sqe == NULL) {
+		/* try again before the loop waits next time */
+		talloc_free(op);
+		fde->additional_flags |= URING_ADDITIONAL_FD_FLAG_REARM;
+		ring->rearm = true;
+		return;
+	}
+
+	mask = uring_map_flags(fde->flags);
+#if __BYTE_ORDER == __BIG_ENDIAN
+	mask = (mask << 16) | (mask >> 16);
+#endif
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = fde->fd;
+	sqe->poll32_events = mask;
+
+	op->fde = fde;
+	fde->additional_data = op;
+	uring_op_submitted(ring, op, sqe);
+}
+
+/*
+  arm the fdes uring_arm_fd() had no room for, they stay marked if
+  there still is none
+*/
+static void uring_rearm(struct uring_context *ring)
+{
+	struct tevent_fd *fde;
+
+	ring->rearm = false;
+	for (fde=ring->ev->fd_events;fde;fde=fde->next) {
+		if (fde->additional_flags & URING_ADDITIONAL_FD_FLAG_REARM) {
+			uring_arm_fd(ring, fde);
+		}
+	}
+}
+
+/*
+  forget the poll of fde, a completion still to come is dropped
+*/
+static void uring_disarm_fd(struct uring_context *ring, struct tevent_fd *fde)
+{
+	struct uring_op *op = (struct uring_op *)fde->additional_data;
+
+	if (op == NULL) return;
+
+	fde->additional_data = NULL;
+	if (op->in_flight) {
+		/* without room to cancel the poll stays until it fires */
+		uring_cancel(ring, op);
+	}
+	if (op->in_flight) {
+		op->fde = NULL;
+		return;
+	}
+	/* reaped, waiting for dispatch */
+	DLIST_REMOVE(ring->completed, op);
+	talloc_free(op);
+}
+
+static void uring_free_ring(struct uring_context *ring)
+{
+	if (ring->sqes) munmap(ring->sqes, ring->sqes_len);
+	if (ring->cq_ring && ring->cq_ring != ring->sq_ring) {
+		munmap(ring->cq_ring, ring->cq_ring_len);
+	}
+	if (ring->sq_ring) munmap(ring->sq_ring, ring->sq_ring_len);
+	ring->sqes = NULL;
+	ring->cq_ring = NULL;
+	ring->sq_ring = NULL;
+	if (ring->ring_fd != -1) close(ring->ring_fd);
+	ring->ring_fd = -1;
+}
+
+/*
+ create the ring and map it
+*/
+static int uring_init_ring(struct uring_context *ring)
+{
+	struct io_uring_params p;
+	uint8_t *sq, *cq;
+
+	ZERO_STRUCT(p);
+	ring->ring_fd = uring_setup(URING_ENTRIES, &p);
+	ring->pid = getpid();
+	if (ring->ring_fd == -1) {
+		return -1;
+	}
+	if (!(p.features & IORING_FEAT_EXT_ARG)) {
+		uring_free_ring(ring);
+		errno = ENOSYS;
+		return -1;
+	}
+
+	ring->sq_ring_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	ring->cq_ring_len = p.cq_off.cqes +
+		p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		ring->sq_ring_len = MAX(ring->sq_ring_len, ring->cq_ring_len);
+		ring->cq_ring_len = ring->sq_ring_len;
+	}
+
+	ring->sq_ring = mmap(NULL, ring->sq_ring_len, PROT_READ|PROT_WRITE,
+			     MAP_SHARED|MAP_POPULATE, ring->ring_fd,
+			     IORING_OFF_SQ_RING);
+	if (ring->sq_ring == MAP_FAILED) {
+		ring->sq_ring = NULL;
+		uring_free_ring(ring);
+		return -1;
+	}
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		ring->cq_ring = ring->sq_ring;
+	} else {
+		ring->cq_ring = mmap(NULL, ring->cq_ring_len,
+				     PROT_READ|PROT_WRITE,
+				     MAP_SHARED|MAP_POPULATE, ring->ring_fd,
+				     IORING_OFF_CQ_RING);
+		if (ring->cq_ring == MAP_FAILED) {
+			ring->cq_ring = NULL;
+			uring_free_ring(ring);
+			return -1;
+		}
+	}
+	ring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqes_len, PROT_READ|PROT_WRITE,
+			  MAP_SHARED|MAP_POPULATE, ring->ring_fd,
+			  IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED) {
+		ring->sqes = NULL;
+		uring_free_ring(ring);
+		return -1;
+	}
+
+	sq = (uint8_t *)ring->sq_ring;
+	ring->sq_head = (unsigned *)(sq + p.sq_off.head);
+	ring->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+	ring->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+	ring->sq_array = (unsigned *)(sq + p.sq_off.array);
+	ring->sq_entries = p.sq_entries;
+	ring->sq_local_tail = *ring->sq_tail;
+
+	cq = (uint8_t *)ring->cq_ring;
+	ring->cq_head = (unsigned *)(cq + p.cq_off.head);
+	ring->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+	ring->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+	return 0;
+}
+
+/*
+ free the ring, waiting for I/O into buffers that are still in use
+*/
+static int uring_ctx_destructor(struct uring_context *ring)
+{
+	struct uring_dispatch *d;
+	struct uring_op *op;
+
+	for (d = ring->dispatch; d; d = d->prev) {
+		d->ctx_freed = true;
+	}
+
+	if (ring->ring_fd != -1 && ring->pid == getpid()) {
+		/* cancel all I/O at once, then wait for each */
+		for (op = ring->in_flight; op; op = op->next) {
+			if (op->io == NULL) {
+				continue;
+			}
+			op->io->cancel_fn = NULL;
+			op->req = NULL;
+			op->io = NULL;
+			op->waited = true;
+		}
+		/* a cancel may reap, so look the next one up from the start */
+		while (true) {
+			for (op = ring->in_flight; op; op = op->next) {
+				if (op->waited && !op->cancelled) break;
+			}
+			if (op == NULL) break;
+			/* no room, uring_wait_op() retries the rest */
+			if (!uring_cancel(ring, op)) break;
+		}
+		while (true) {
+			for (op = ring->in_flight; op; op = op->next) {
+				if (op->waited) break;
+			}
+			if (op == NULL) break;
+			uring_wait_op(ring, op);
+		}
+	}
+	for (op = ring->completed; op; op = op->next) {
+		if (op->io != NULL) {
+			op->io->cancel_fn = NULL;
+		}
+	}
+
+	uring_free_ring(ring);
+	return 0;
+}
+
+/*
+  a tevent_io_send() request is freed while the kernel still has it
+*/
+static void uring_io_cancel(struct tevent_io_state *state)
+{
+	struct uring_op *op = (struct uring_op *)state->additional_data;
+	struct uring_context *ring = op->ring;
+
+	state->cancel_fn = NULL;
+	op->req = NULL;
+	op->io = NULL;
+
+	if (!op->in_flight) {
+		DLIST_REMOVE(ring->completed, op);
+		talloc_free(op);
+		return;
+	}
+
+	/* keeps a reap inside uring_cancel() from freeing it */
+	op->waited = true;
+	uring_cancel(ring, op);
+	uring_wait_op(ring, op);
+}
+
+/*
+  recreate the ring when our pid changes, the parent's ring is shared
+  with us after fork just like an epoll handle
+*/
+static void uring_check_reopen(struct uring_context *ring)
+{
+	struct tevent_fd *fde;
+	struct uring_op *op, *next;
+
+	if (ring->pid == getpid()) {
+		return;
+	}
+
+	/* the kernel serves these for the parent, not for us */
+	for (op = ring->in_flight; op; op = next) {
+		next = op->next;
+		DLIST_REMOVE(ring->in_flight, op);
+		op->in_flight = false;
+		if (op->io != NULL) {
+			op->res = -ECANCELED;
+			DLIST_ADD_END(ring->completed, op, struct uring_op *);
+			continue;
+		}
+		if (op->fde != NULL) {
+			op->fde->additional_data = NULL;
+		}
+		talloc_free(op);
+	}
+
+	uring_free_ring(ring);
+	if (uring_init_ring(ring) != 0) {
+		tevent_debug(ring->ev, TEVENT_DEBUG_FATAL,
+			     "Failed to recreate io_uring after fork\n");
+		return;
+	}
+	for (fde=ring->ev->fd_events;fde;fde=fde->next) {
+		uring_arm_fd(ring, fde);
+	}
+}
+
+/*
+  an fd poll fired
+*/
+static void uring_fd_done(struct uring_context *ring, struct uring_op *op)
+{
+	struct tevent_fd *fde = op->fde;
+	int32_t res = op->res;
+	uint16_t flags = 0;
+
+	fde->additional_data = NULL;
+	talloc_free(op);
+
+	if (res < 0) {
+		/* e.g. the fd was closed under us, wait for a flag change */
+		tevent_debug(ring->ev, TEVENT_DEBUG_WARNING,
+			     "io_uring poll on fd %d failed: %s\n",
+			     fde->fd, strerror(-res));
+		return;
+	}
+
+	if (res & (POLLHUP|POLLERR)) {
+		fde->additional_flags |= URING_ADDITIONAL_FD_FLAG_GOT_ERROR;
+		flags |= TEVENT_FD_READ;
+	}
+	if (res & POLLIN) flags |= TEVENT_FD_READ;
+	if (res & POLLOUT) flags |= TEVENT_FD_WRITE;
+
+	/* level triggered: arm again before the handler, which may free fde */
+	uring_arm_fd(ring, fde);
+
+	flags &= fde->flags;
+	if (flags) {
+		fde->handler(ring->ev, fde, flags, fde->private_data);
+	}
+}
+
+/*
+  a tevent_io_send() request completed
+*/
+static void uring_io_done(struct uring_context *ring, struct uring_op *op)
+{
+	struct tevent_req *req = op->req;
+	int32_t res = op->res;
+
+	op->io->cancel_fn = NULL;
+	talloc_free(op);
+
+	if (res < 0) {
+		tevent_io_done(req, -1, -res);
+		return;
+	}
+	tevent_io_done(req, res, 0);
+}
+
+/*
+  event loop handling using io_uring
+*/
+static int uring_event_loop(struct uring_context *ring, struct timeval *tvalp)
+{
+	struct uring_dispatch d;
+	struct uring_op *op;
+	int ret;
+
+	if (ring->ring_fd == -1) return -1;
+
+	if (ring->ev->signal_events &&
+	    tevent_common_check_signal(ring->ev)) {
+		return 0;
+	}
+
+	if (ring->rearm) {
+		uring_rearm(ring);
+	}
+
+	if (ring->completed == NULL) {
+		ret = uring_enter(ring, 1, tvalp);
+
+		if (ret == -1 && errno == EINTR && ring->ev->signal_events) {
+			if (tevent_common_check_signal(ring->ev)) {
+				return 0;
+			}
+		}
+
+		if (ret == -1 && errno != EINTR && errno != ETIME &&
+		    errno != EAGAIN && errno != EBUSY) {
+			uring_panic(ring, "io_uring_enter() failed");
+			return -1;
+		}
+
+		uring_reap(ring);
+	}
+
+	if (ring->completed == NULL) {
+		if (tvalp) {
+			/* we don't care about a possible delay here */
+			tevent_common_loop_timer_delay(ring->ev);
+		}
+		return 0;
+	}
+
+	d.ctx_freed = false;
+	d.prev = ring->dispatch;
+	ring->dispatch = &d;
+
+	while ((op = ring->completed) != NULL) {
+		DLIST_REMOVE(ring->completed, op);
+		if (op->fde != NULL) {
+			uring_fd_done(ring, op);
+		} else if (op->req != NULL) {
+			uring_io_done(ring, op);
+		} else {
+			talloc_free(op);
+		}
+		if (d.ctx_freed) {
+			return 0;
+		}
+	}
+
+	ring->dispatch = d.prev;
+	return 0;
+}
+
+/*
+  create a uring_context structure.
+*/
+static int uring_event_context_init(struct tevent_context *ev)
+{
+	int ret;
+	struct uring_context *ring;
+
+	ring = talloc_zero(ev, struct uring_context);
+	if (!ring) return -1;
+	ring->ev = ev;
+	ring->ring_fd = -1;
+
+	ret = uring_init_ring(ring);
+	if (ret != 0) {
+		talloc_free(ring);
+		return ret;
+	}
+	talloc_set_destructor(ring, uring_ctx_destructor);
+
+	ev->additional_data = ring;
+	return 0;
+}
+
+/*
+  destroy an fd_event
+*/
+static int uring_event_fd_destructor(struct tevent_fd *fde)
+{
+	struct tevent_context *ev = fde->event_ctx;
+	struct uring_context *ring = NULL;
+
+	if (ev) {
+		ring = talloc_get_type(ev->additional_data,
+				       struct uring_context);
+
+		uring_check_reopen(ring);
+
+		uring_disarm_fd(ring, fde);
+	}
+
+	return tevent_common_fd_destructor(fde);
+}
+
+/*
+  add a fd based event
+  return NULL on failure (memory allocation error)
+*/
+static struct tevent_fd *uring_event_add_fd(struct tevent_context *ev, TALLOC_CTX *mem_ctx,
+					    int fd, uint16_t flags,
+					    tevent_fd_handler_t handler,
+					    void *private_data,
+					    const char *handler_name,
+					    const char *location)
+{
+	struct uring_context *ring = talloc_get_type(ev->additional_data,
+						     struct uring_context);
+	struct tevent_fd *fde;
+
+	uring_check_reopen(ring);
+
+	fde = tevent_common_add_fd(ev, mem_ctx, fd, flags,
+				   handler, private_data,
+				   handler_name, location);
+	if (!fde) return NULL;
+
+	talloc_set_destructor(fde, uring_event_fd_destructor);
+
+	uring_arm_fd(ring, fde);
+
+	return fde;
+}
+
+/*
+  set the fd event flags
+*/
+static void uring_event_set_fd_flags(struct tevent_fd *fde, uint16_t flags)
+{
+	struct tevent_context *ev;
+	struct uring_context *ring;
+	uint16_t old_flags = fde->flags;
+
+	if (fde->flags == flags) return;
+
+	ev = fde->event_ctx;
+	ring = talloc_get_type(ev->additional_data, struct uring_context);
+
+	fde->flags = flags;
+
+	uring_check_reopen(ring);
+
+	fde->additional_flags &= ~URING_ADDITIONAL_FD_FLAG_GOT_ERROR;
+
+	/* a poll for fewer events still fires correctly, results are masked */
+	if (fde->additional_data != NULL && !(flags & ~old_flags)) {
+		return;
+	}
+	uring_disarm_fd(ring, fde);
+	uring_arm_fd(ring, fde);
+}
+
+/*
+  do a single event loop using the events defined in ev
+*/
+static int uring_event_loop_once(struct tevent_context *ev, const char *location)
+{
+	struct uring_context *ring = talloc_get_type(ev->additional_data,
+						     struct uring_context);
+	struct timeval tval;
+
+	if (ev->signal_events &&
+	    tevent_common_check_signal(ev)) {
+		return 0;
+	}
+
+	if (ev->immediate_events &&
+	    tevent_common_loop_immediate(ev)) {
+		return 0;
+	}
+
+	tval = tevent_common_loop_timer_delay(ev);
+	if (tevent_timeval_is_zero(&tval)) {
+		return 0;
+	}
+
+	uring_check_reopen(ring);
+
+	return uring_event_loop(ring, &tval);
+}
+
+static const struct tevent_ops uring_event_ops = {
+	.context_init		= uring_event_context_init,
+	.add_fd			= uring_event_add_fd,
+	.set_fd_close_fn	= tevent_common_fd_set_close_fn,
+	.get_fd_flags		= tevent_common_fd_get_flags,
+	.set_fd_flags		= uring_event_set_fd_flags,
+	.add_timer		= tevent_common_add_timer,
+	.schedule_immediate	= tevent_common_schedule_immediate,
+	.add_signal		= tevent_common_add_signal,
+	.loop_once		= uring_event_loop_once,
+	.loop_wait		= tevent_common_loop_wait,
+};
+
+bool tevent_uring_is_backend(struct tevent_context *ev)
+{
+	return ev->ops == &uring_event_ops;
+}
+
+/*
+  hand a tevent_io_send() request to the ring, false if the caller
+  has to do the I/O itself
+*/
+bool tevent_uring_io_submit(struct tevent_context *ev,
+			    struct tevent_req *req,
+			    struct tevent_io_state *state)
+{
+	struct uring_context *ring;
+	struct io_uring_sqe *sqe;
+	struct uring_op *op;
+
+	if (!tevent_uring_is_backend(ev)) {
+		return false;
+	}
+	ring = talloc_get_type(ev->additional_data, struct uring_context);
+
+	uring_check_reopen(ring);
+	if (ring->ring_fd == -1) {
+		return false;
+	}
+
+	op = uring_op_new(ring);
+	if (op == NULL) {
+		return false;
+	}
+	sqe = uring_get_sqe(ring);
+	if (sqe == NULL) {
+		talloc_free(op);
+		return false;
+	}
+
+	op->iov.iov_base = state->buf;
+	op->iov.iov_len = state->len;
+
+	switch (state->op) {
+	case TEVENT_IO_READ:
+	case TEVENT_IO_RECV:
+		sqe->opcode = IORING_OP_READV;
+		break;
+	case TEVENT_IO_WRITE:
+	case TEVENT_IO_SEND:
+		sqe->opcode = IORING_OP_WRITEV;
+		break;
+	}
+	sqe->fd = state->fd;
+	sqe->addr = (uint64_t)(uintptr_t)&op->iov;
+	sqe->len = 1;
+	if (state->op == TEVENT_IO_READ || state->op == TEVENT_IO_WRITE) {
+		sqe->off = state->offset;
+	} else {
+		/* the current position, ignored for sockets and pipes */
+		sqe->off = (uint64_t)-1;
+	}
+
+	op->req = req;
+	op->io = state;
+	state->additional_data = op;
+	state->cancel_fn = uring_io_cancel;
+	uring_op_submitted(ring, op, sqe);
+
+	return true;
+}
+
+bool tevent_uring_init(void)
+{
+	return tevent_register_backend("io_uring", &uring_event_ops);
+}
@@ -30,6 +30,20 @@ sub bindir_path($$) {
 	return "$self->{bindir}/$path$self->{exeext}";
 }
 
+# WINEXESVC_MOCK is only built for selftest and developer builds
+sub have_winexesvc_mock($)
+{
+	my ($self) = @_;
+	my $found = 0;
+
+	open(CONFIG_H, "<$self->{bindir}/../include/config.h") or return 0;
+	while (<CONFIG_H>) {
+		$found = 1 if (/^#define WINEXESVC_MOCK 1/);
+	}
+	close(CONFIG_H);
+	return $found;
+}
+
 sub openldap_start($$$) {
 }
 
@@ -723,10 +737,19 @@ sub provision($$$$$$$)
 	push(@{$ctx->{directories}}, "$ctx->{tmpdir}/test1");
 	push(@{$ctx->{directories}}, "$ctx->{tmpdir}/test2");
 
+	# winexe is tested against winexesvc stand-in, see
+	# source4/winexe/mocksvc.c. smbd does not start with a service it
+	# does not have, so only ask for it when it is built
+	my $winexesvc = "";
+	if ($self->have_winexesvc_mock()) {
+		$winexesvc = "	server services = smb rpc nbt wrepl ldap cldap kdc drepl winbind ntp_signd kcc winexesvc";
+	}
+
 	$ctx->{smb_conf_extra_options} = "
 
 	max xmit = 32K
 	server max protocol = SMB2
+$winexesvc
 
 [tmp]
 	path = $ctx->{tmpdir}
@@ -51,6 +51,7 @@ bool event_add_to_select_args(struct tevent_context *ev,
 			      struct timeval *timeout, int *maxfd)
 {
 	struct tevent_fd *fde;
+	struct tevent_timer *te;
 	struct timeval diff;
 	bool ret = false;
 
@@ -75,11 +76,12 @@ bool event_add_to_select_args(struct tevent_context *ev,
 		return true;
 	}
 
-	if (ev->timer_events == NULL) {
+	te = tevent_common_first_timer(ev);
+	if (te == NULL) {
 		return ret;
 	}
 
-	diff = timeval_until(now, &ev->timer_events->next_event);
+	diff = timeval_until(now, &te->next_event);
 	*timeout = timeval_min(timeout, &diff);
 
 	return true;
@@ -89,6 +91,7 @@ bool run_events(struct tevent_context *ev,
 		int selrtn, fd_set *read_fds, fd_set *write_fds)
 {
 	struct tevent_fd *fde;
+	struct tevent_timer *te;
 	struct timeval now;
 
 	if (ev->signal_events &&
@@ -103,14 +106,14 @@ bool run_events(struct tevent_context *ev,
 
 	GetTimeOfDay(&now);
 
-	if ((ev->timer_events != NULL)
-	    && (timeval_compare(&now, &ev->timer_events->next_event) >= 0)) {
+	te = tevent_common_first_timer(ev);
+	if ((te != NULL)
+	    && (timeval_compare(&now, &te->next_event) >= 0)) {
 
 		DEBUG(10, ("Running timed event \"%s\" %p\n",
-			   ev->timer_events->handler_name, ev->timer_events));
+			   te->handler_name, te));
 
-		ev->timer_events->handler(ev, ev->timer_events, now,
-					  ev->timer_events->private_data);
+		te->handler(ev, te, now, te->private_data);
 		return true;
 	}
 
@@ -141,8 +144,9 @@ struct timeval *get_timed_events_timeout(struct tevent_context *ev,
 					 struct timeval *to_ret)
 {
 	struct timeval now;
+	struct tevent_timer *te = tevent_common_first_timer(ev);
 
-	if ((ev->timer_events == NULL) && (ev->immediate_events == NULL)) {
+	if ((te == NULL) && (ev->immediate_events == NULL)) {
 		return NULL;
 	}
 	if (ev->immediate_events != NULL) {
@@ -151,7 +155,7 @@ struct timeval *get_timed_events_timeout(struct tevent_context *ev,
 	}
 
 	now = timeval_current();
-	*to_ret = timeval_until(&now, &ev->timer_events->next_event);
+	*to_ret = timeval_until(&now, &te->next_event);
 
 	DEBUG(10, ("timed_events_timeout: %d/%d\n", (int)to_ret->tv_sec,
 		(int)to_ret->tv_usec));
@@ -211,6 +215,7 @@ void dump_event_list(struct tevent_context *ev)
 	struct tevent_timer *te;
 	struct tevent_fd *fe;
 	struct timeval evt, now;
+	size_t i;
 
 	if (!ev) {
 		return;
@@ -220,7 +225,9 @@ void dump_event_list(struct tevent_context *ev)
 
 	DEBUG(10,("dump_event_list:\n"));
 
-	for (te = ev->timer_events; te; te = te->next) {
+	/* heap order, not sorted by time */
+	for (i = 0; i < ev->num_timers; i++) {
+		te = ev->timer_heap[i];
 
 		evt = timeval_until(&now, &te->next_event);
 
@@ -54,6 +54,7 @@ static void smbcli_transport_event_handler(struct tevent_context *ev,
 static int transport_destructor(struct smbcli_transport *transport)
 {
 	smbcli_transport_dead(transport, NT_STATUS_LOCAL_DISCONNECT);
+	transport->req_pool.closing = true;
 	return 0;
 }
 
@@ -308,6 +309,21 @@ again:
 	return mid;
 }
 
+/****************************************************************************
+count the requests that are waiting for a reply
+****************************************************************************/
+int smbcli_transport_pending(struct smbcli_transport *transport)
+{
+	struct smbcli_request *req;
+	int count = 0;
+
+	for (req=transport->pending_recv; req; req=req->next) {
+		count++;
+	}
+
+	return count;
+}
+
 static void idle_handler(struct tevent_context *ev, 
 			 struct tevent_timer *te, struct timeval t, void *private_data)
 {
@@ -360,6 +376,9 @@ static NTSTATUS smbcli_transport_finish_recv(void *private_data, DATA_BLOB blob)
 	buffer = blob.data;
 	len = blob.length;
 
+	transport->stats.replies++;
+	transport->stats.reply_bytes += len;
+
 	hdr = buffer+NBT_HDR_SIZE;
 	vwv = hdr + HDR_VWV;
 
@@ -566,6 +585,7 @@ static int smbcli_request_destructor(struct smbcli_request *req)
 	if (req->state == SMBCLI_REQUEST_RECV) {
 		DLIST_REMOVE(req->transport->pending_recv, req);
 	}
+	smbcli_request_pool_release(req);
 	return 0;
 }
 
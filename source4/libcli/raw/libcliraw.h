@@ -105,6 +105,25 @@ struct smbcli_options {
 	enum smb_signing_state signing;
 };
 
+/*
+  small requests are carved from a talloc pool per request, so the
+  request, its packet, its timeout and what the reply is parsed into
+  take one malloc. Freed pools are kept on the transport for reuse.
+*/
+#define SMBCLI_REQ_POOL_SIZE 4096
+#define SMBCLI_REQ_POOL_MAX 32
+
+/* allocation counters of a transport */
+struct smbcli_transport_stats {
+	uint64_t requests;	/* requests set up */
+	uint64_t unpooled;	/* requests too large for a pool */
+	uint64_t pool_allocs;	/* pools allocated */
+	uint64_t pool_reuses;	/* requests set up in a recycled pool */
+	uint64_t pool_frees;	/* pools freed because enough were kept */
+	uint64_t replies;	/* reply buffers taken over from the socket */
+	uint64_t reply_bytes;
+};
+
 /* this is the context for the client transport layer */
 struct smbcli_transport {
 	/* socket level info */
@@ -167,6 +186,18 @@ struct smbcli_transport {
 
 	/* iconv convenience */
 	struct smb_iconv_convenience *iconv_convenience;
+
+	/* pools of freed requests, see SMBCLI_REQ_POOL_SIZE */
+	struct {
+		void *free[SMBCLI_REQ_POOL_MAX];
+		int num_free;
+		/* one more pool, freed once its request is gone */
+		void *retired;
+		/* set while the transport is freed */
+		bool closing;
+	} req_pool;
+
+	struct smbcli_transport_stats stats;
 };
 
 /* this is the context for the user */
@@ -278,6 +309,9 @@ struct smbcli_request {
 	/* the mid of this packet - used to match replies */
 	uint16_t mid;
 
+	/* the talloc pool this request lives in, NULL if none */
+	void *pool;
+
 	struct smb_request_buffer in;
 	struct smb_request_buffer out;
 
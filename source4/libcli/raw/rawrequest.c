@@ -80,6 +80,69 @@ _PUBLIC_ NTSTATUS smbcli_request_destroy(struct smbcli_request *req)
 }
 
 
+/*
+  get a talloc pool for a new request, a recycled one if there is one
+*/
+static void *smbcli_req_pool_get(struct smbcli_transport *transport)
+{
+	void *pool;
+
+	if (transport->req_pool.retired) {
+		talloc_free(transport->req_pool.retired);
+		transport->req_pool.retired = NULL;
+		transport->stats.pool_frees++;
+	}
+
+	if (transport->req_pool.num_free > 0) {
+		pool = transport->req_pool.free[--transport->req_pool.num_free];
+		/* the request in it is gone, this rewinds the pool unless
+		   something allocated in it was stolen and is still alive */
+		talloc_free_children(pool);
+		transport->stats.pool_reuses++;
+		return pool;
+	}
+
+	pool = talloc_pool(transport, SMBCLI_REQ_POOL_SIZE);
+	if (pool) {
+		transport->stats.pool_allocs++;
+	}
+	return pool;
+}
+
+/*
+  give the pool of a request back to the transport, called when the
+  request is freed. The request is still in the pool at this point, so
+  the pool is only rewound or freed when it is needed again.
+*/
+void smbcli_request_pool_release(struct smbcli_request *req)
+{
+	struct smbcli_transport *transport = req->transport;
+	void *pool = req->pool;
+
+	if (pool == NULL) return;
+	req->pool = NULL;
+
+	/* the pools go with the transport */
+	if (transport->req_pool.closing) return;
+
+	if (transport->req_pool.num_free < SMBCLI_REQ_POOL_MAX) {
+		transport->req_pool.free[transport->req_pool.num_free++] = pool;
+		return;
+	}
+
+	if (transport->req_pool.retired) {
+		talloc_free(transport->req_pool.retired);
+		transport->stats.pool_frees++;
+	}
+	transport->req_pool.retired = pool;
+}
+
+static int smbcli_request_pool_destructor(struct smbcli_request *req)
+{
+	smbcli_request_pool_release(req);
+	return 0;
+}
+
 /*
   low-level function to setup a request buffer for a non-SMB packet 
   at the transport level
@@ -87,9 +150,24 @@ _PUBLIC_ NTSTATUS smbcli_request_destroy(struct smbcli_request *req)
 struct smbcli_request *smbcli_request_setup_nonsmb(struct smbcli_transport *transport, size_t size)
 {
 	struct smbcli_request *req;
+	void *pool = NULL;
+
+	transport->stats.requests++;
+
+	/* leave room in the pool for what hangs off the request */
+	if (size + sizeof(struct smbcli_request) <= SMBCLI_REQ_POOL_SIZE / 2) {
+		pool = smbcli_req_pool_get(transport);
+	} else {
+		transport->stats.unpooled++;
+	}
 
-	req = talloc(transport, struct smbcli_request);
+	if (pool) {
+		req = talloc(pool, struct smbcli_request);
+	} else {
+		req = talloc(transport, struct smbcli_request);
+	}
 	if (!req) {
+		talloc_free(pool);
 		return NULL;
 	}
 	ZERO_STRUCTP(req);
@@ -97,6 +175,10 @@ struct smbcli_request *smbcli_request_setup_nonsmb(struct smbcli_transport *tran
 	/* setup the request context */
 	req->state = SMBCLI_REQUEST_INIT;
 	req->transport = transport;
+	req->pool = pool;
+	if (pool) {
+		talloc_set_destructor(req, smbcli_request_pool_destructor);
+	}
 	req->session = NULL;
 	req->tree = NULL;
 	req->out.size = size;
@@ -97,6 +97,7 @@ static NTSTATUS connect_session_setup_anon(struct composite_context *c,
 
 	status = smb_composite_sesssetup_recv(state->creq);
 	NT_STATUS_NOT_OK_RETURN(status);
+	io->out.session_setup = timeval_current();
 
 	io->out.anonymous_fallback_done = true;
 	
@@ -179,6 +180,7 @@ static NTSTATUS connect_session_setup(struct composite_context *c,
 	}
 
 	NT_STATUS_NOT_OK_RETURN(status);
+	io->out.session_setup = timeval_current();
 	
 	state->session->vuid = state->io_setup->out.vuid;
 	
@@ -232,6 +234,7 @@ static NTSTATUS connect_negprot(struct composite_context *c,
 
 	status = smb_raw_negotiate_recv(state->req);
 	NT_STATUS_NOT_OK_RETURN(status);
+	io->out.negotiated = timeval_current();
 
 	/* next step is a session setup */
 	state->session = smbcli_session_init(state->transport, state, true, io->in.session_options);
@@ -320,6 +323,7 @@ static NTSTATUS connect_socket(struct composite_context *c,
 
 	status = smbcli_sock_connect_recv(state->creq, state, &state->sock);
 	NT_STATUS_NOT_OK_RETURN(status);
+	io->out.connected = timeval_current();
 
 	/* the socket is up - we can initialise the smbcli transport layer */
 	state->transport = smbcli_transport_init(state->sock, state, true, 
@@ -373,6 +377,7 @@ static NTSTATUS connect_resolve(struct composite_context *c,
 
 	status = resolve_name_recv(state->creq, state, &address);
 	NT_STATUS_NOT_OK_RETURN(status);
+	io->out.resolved = timeval_current();
 
 	state->creq = smbcli_sock_connect_send(state, address, 
 					       io->in.dest_ports,
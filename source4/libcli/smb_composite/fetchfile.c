@@ -33,7 +33,7 @@ struct fetchfile_state {
 	struct smb_composite_fetchfile *io;
 	struct composite_context *creq;
 	struct smb_composite_connect *connect;
-	struct smb_composite_loadfile *loadfile;
+	struct smb_composite_loadfile_window *loadfile;
 };
 
 static void fetchfile_composite_handler(struct composite_context *req);
@@ -48,13 +48,12 @@ static NTSTATUS fetchfile_connect(struct composite_context *c,
 	status = smb_composite_connect_recv(state->creq, c);
 	NT_STATUS_NOT_OK_RETURN(status);
 
-	state->loadfile = talloc(state, struct smb_composite_loadfile);
-	NT_STATUS_HAVE_NO_MEMORY(state->loadfile);
-
-	state->loadfile->in.fname = io->in.filename;
+	if (state->loadfile->in.fname == NULL) {
+		state->loadfile->in.fname = io->in.filename;
+	}
 
-	state->creq = smb_composite_loadfile_send(state->connect->out.tree,
-						 state->loadfile);
+	state->creq = smb_composite_loadfile_window_send(state->connect->out.tree,
+							 state->loadfile);
 	NT_STATUS_HAVE_NO_MEMORY(state->creq);
 
 	state->creq->async.private_data = c;
@@ -72,9 +71,10 @@ static NTSTATUS fetchfile_read(struct composite_context *c,
 	struct fetchfile_state *state;
 	state = talloc_get_type(c->private_data, struct fetchfile_state);
 
-	status = smb_composite_loadfile_recv(state->creq, NULL);
+	status = smb_composite_loadfile_window_recv(state->creq, NULL);
 	NT_STATUS_NOT_OK_RETURN(status);
 
+	/* out.data is NULL when a sink took the data */
 	io->out.data = state->loadfile->out.data;
 	io->out.size = state->loadfile->out.size;
 
@@ -119,8 +119,15 @@ static void fetchfile_composite_handler(struct composite_context *creq)
 	fetchfile_state_handler(c);
 }
 
-struct composite_context *smb_composite_fetchfile_send(struct smb_composite_fetchfile *io,
-						       struct tevent_context *event_ctx)
+/*
+  fetchfile with the reads done by a windowed loadfile. lw may be NULL
+  for the default window with the file collected in io->out.data,
+  otherwise its in fields choose the window, chunk and sink, and its
+  in.fname defaults to io->in.filename.
+*/
+struct composite_context *smb_composite_fetchfile_window_send(struct smb_composite_fetchfile *io,
+							      struct smb_composite_loadfile_window *lw,
+							      struct tevent_context *event_ctx)
 {
 	struct composite_context *c;
 	struct fetchfile_state *state;
@@ -136,6 +143,12 @@ struct composite_context *smb_composite_fetchfile_send(struct smb_composite_fetc
 
 	state->io = io;
 
+	if (lw == NULL) {
+		lw = talloc_zero(state, struct smb_composite_loadfile_window);
+		if (lw == NULL) goto failed;
+	}
+	state->loadfile = lw;
+
 	state->connect->in.dest_host    = io->in.dest_host;
 	state->connect->in.dest_ports   = io->in.ports;
 	state->connect->in.socket_options = io->in.socket_options;
@@ -168,6 +181,12 @@ struct composite_context *smb_composite_fetchfile_send(struct smb_composite_fetc
 	return NULL;
 }
 
+struct composite_context *smb_composite_fetchfile_send(struct smb_composite_fetchfile *io,
+						       struct tevent_context *event_ctx)
+{
+	return smb_composite_fetchfile_window_send(io, NULL, event_ctx);
+}
+
 NTSTATUS smb_composite_fetchfile_recv(struct composite_context *c,
 				      TALLOC_CTX *mem_ctx)
 {
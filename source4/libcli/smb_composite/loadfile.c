@@ -22,6 +22,7 @@
 
 #include "includes.h"
 #include "libcli/raw/libcliraw.h"
+#include "libcli/raw/raw_proto.h"
 #include "libcli/composite/composite.h"
 #include "libcli/smb_composite/smb_composite.h"
 
@@ -291,3 +292,299 @@ NTSTATUS smb_composite_loadfile(struct smbcli_tree *tree,
 	return smb_composite_loadfile_recv(c, mem_ctx);
 }
 
+
+
+/*
+  windowed loadfile - the reads for a window of chunks are all in flight
+  at once, and are handed over in file order as they complete
+*/
+struct loadfile_window_slot {
+	struct loadfile_window_state *state;
+	union smb_read io;
+	uint8_t *buf;
+	uint64_t offset;
+	uint32_t len;
+	uint32_t got;
+	bool done;
+	struct smbcli_request *req;
+};
+
+struct loadfile_window_state {
+	struct composite_context *c;
+	struct smbcli_tree *tree;
+	struct smb_composite_loadfile_window *io;
+	union smb_open io_open;
+	union smb_close io_close;
+	uint16_t fnum;
+	uint64_t size;
+	uint64_t offset;
+	uint32_t chunk;
+	int window;
+	int head;
+	int in_use;
+	int in_flight;
+	NTSTATUS status;
+	struct loadfile_window_slot *slots;
+};
+
+static void loadfile_window_opened(struct smbcli_request *req);
+static void loadfile_window_fill(struct loadfile_window_state *state);
+static void loadfile_window_read(struct smbcli_request *req);
+static void loadfile_window_closed(struct smbcli_request *req);
+
+struct composite_context *smb_composite_loadfile_window_send(struct smbcli_tree *tree,
+							     struct smb_composite_loadfile_window *io)
+{
+	struct composite_context *c;
+	struct loadfile_window_state *state;
+
+	c = composite_create(tree, tree->session->transport->socket->event.ctx);
+	if (c == NULL) return NULL;
+
+	state = talloc_zero(c, struct loadfile_window_state);
+	if (composite_nomem(state, c)) return c;
+	c->private_data = state;
+
+	state->c = c;
+	state->tree = tree;
+	state->io = io;
+	state->status = NT_STATUS_OK;
+	io->out.data = NULL;
+	io->out.size = 0;
+
+	state->io_open.ntcreatex.level               = RAW_OPEN_NTCREATEX;
+	state->io_open.ntcreatex.in.flags            = NTCREATEX_FLAGS_EXTENDED;
+	state->io_open.ntcreatex.in.access_mask      = SEC_FILE_READ_DATA;
+	state->io_open.ntcreatex.in.file_attr        = FILE_ATTRIBUTE_NORMAL;
+	state->io_open.ntcreatex.in.share_access     = NTCREATEX_SHARE_ACCESS_READ | NTCREATEX_SHARE_ACCESS_WRITE;
+	state->io_open.ntcreatex.in.open_disposition = NTCREATEX_DISP_OPEN;
+	state->io_open.ntcreatex.in.impersonation    = NTCREATEX_IMPERSONATION_ANONYMOUS;
+	state->io_open.ntcreatex.in.fname            = io->in.fname;
+
+	composite_continue_smb(c, smb_raw_open_send(tree, &state->io_open),
+			       loadfile_window_opened, state);
+	return c;
+}
+
+/*
+  called when the open is done - size the window and send the first reads
+*/
+static void loadfile_window_opened(struct smbcli_request *req)
+{
+	struct loadfile_window_state *state = talloc_get_type(req->async.private_data,
+							      struct loadfile_window_state);
+	struct composite_context *c = state->c;
+	struct smb_composite_loadfile_window *io = state->io;
+	struct smbcli_transport *transport = state->tree->session->transport;
+	int i;
+
+	c->status = smb_raw_open_recv(req, state, &state->io_open);
+	if (!composite_is_ok(c)) return;
+	state->fnum = state->io_open.ntcreatex.out.file.fnum;
+	state->size = state->io_open.ntcreatex.out.size;
+
+	/* the server only promises to handle max_mux requests at once,
+	   and other users of the transport may already have some of them
+	   in flight */
+	state->window = io->in.window > 0 ? io->in.window : LOADFILE_WINDOW_DEFAULT;
+	state->window = MIN(state->window,
+			    MAX(transport->negotiate.max_mux - smbcli_transport_pending(transport), 1));
+
+	/* a readx reply has to fit in max_xmit unless the server does
+	   CAP_LARGE_READX */
+	state->chunk = io->in.chunk > 0 ? io->in.chunk : LOADFILE_CHUNK_DEFAULT;
+	if (transport->negotiate.capabilities & CAP_LARGE_READX) {
+		state->chunk = MIN(state->chunk, 0xFFFF);
+	} else {
+		state->chunk = MIN(state->chunk, transport->negotiate.max_xmit - 100);
+	}
+
+	state->slots = talloc_zero_array(state, struct loadfile_window_slot, state->window);
+	if (composite_nomem(state->slots, c)) return;
+	for (i = 0; i < state->window; i++) {
+		state->slots[i].state = state;
+		if (io->in.sink != NULL) {
+			state->slots[i].buf = talloc_size(state->slots, state->chunk);
+			if (composite_nomem(state->slots[i].buf, c)) return;
+		}
+	}
+
+	if (io->in.sink == NULL) {
+		/* same limit as loadfile when the whole file is kept */
+		if (state->size > 100*1000*1000) {
+			state->status = NT_STATUS_INSUFFICIENT_RESOURCES;
+		} else {
+			io->out.data = talloc_array(c, uint8_t, state->size);
+			if (io->out.data == NULL) {
+				state->status = NT_STATUS_NO_MEMORY;
+			}
+		}
+	}
+
+	loadfile_window_fill(state);
+}
+
+static bool loadfile_window_issue(struct loadfile_window_slot *slot)
+{
+	struct loadfile_window_state *state = slot->state;
+
+	slot->io.readx.level        = RAW_READ_READX;
+	slot->io.readx.in.file.fnum = state->fnum;
+	slot->io.readx.in.offset    = slot->offset + slot->got;
+	slot->io.readx.in.mincnt    = slot->len - slot->got;
+	slot->io.readx.in.maxcnt    = slot->len - slot->got;
+	slot->io.readx.in.remaining = 0;
+	slot->io.readx.in.read_for_execute = false;
+	slot->io.readx.out.data     = slot->buf + slot->got;
+
+	slot->req = smb_raw_read_send(state->tree, &slot->io);
+	if (slot->req == NULL) {
+		return false;
+	}
+	slot->req->async.fn = loadfile_window_read;
+	slot->req->async.private_data = slot;
+	state->in_flight++;
+	return true;
+}
+
+/*
+  keep the window full, close the file once everything has been read or
+  something failed and no replies are outstanding
+*/
+static void loadfile_window_fill(struct loadfile_window_state *state)
+{
+	struct composite_context *c = state->c;
+	struct smb_composite_loadfile_window *io = state->io;
+	union smb_close *io_close = &state->io_close;
+
+	while (state->in_use < state->window &&
+	       state->offset < state->size && NT_STATUS_IS_OK(state->status)) {
+		struct loadfile_window_slot *slot;
+
+		slot = &state->slots[(state->head + state->in_use) % state->window];
+		slot->offset = state->offset;
+		slot->len    = MIN(state->chunk, state->size - state->offset);
+		slot->got    = 0;
+		slot->done   = false;
+		if (io->in.sink == NULL) {
+			slot->buf = io->out.data + slot->offset;
+		}
+		if (!loadfile_window_issue(slot)) {
+			state->status = NT_STATUS_NO_MEMORY;
+			break;
+		}
+		state->in_use++;
+		state->offset += slot->len;
+	}
+
+	if (state->in_flight > 0 ||
+	    (state->in_use > 0 && NT_STATUS_IS_OK(state->status))) {
+		return;
+	}
+
+	io_close->close.level = RAW_CLOSE_CLOSE;
+	io_close->close.in.file.fnum = state->fnum;
+	io_close->close.in.write_time = 0;
+
+	composite_continue_smb(c, smb_raw_close_send(state->tree, io_close),
+			       loadfile_window_closed, state);
+}
+
+/*
+  called when a read is done - a short read is continued in the same
+  slot, then every completed chunk at the head of the window is handed
+  over
+*/
+static void loadfile_window_read(struct smbcli_request *req)
+{
+	/* slots are array members, not talloc chunks of their own */
+	struct loadfile_window_slot *slot = (struct loadfile_window_slot *)req->async.private_data;
+	struct loadfile_window_state *state = slot->state;
+	struct smb_composite_loadfile_window *io = state->io;
+	NTSTATUS status;
+
+	status = smb_raw_read_recv(req, &slot->io);
+	slot->req = NULL;
+	state->in_flight--;
+
+	if (NT_STATUS_IS_OK(status) && slot->io.readx.out.nread == 0) {
+		/* the file was truncated under us */
+		status = NT_STATUS_END_OF_FILE;
+	}
+	if (!NT_STATUS_IS_OK(status)) {
+		if (NT_STATUS_IS_OK(state->status)) {
+			state->status = status;
+		}
+		loadfile_window_fill(state);
+		return;
+	}
+
+	slot->got += slot->io.readx.out.nread;
+	if (slot->got < slot->len && NT_STATUS_IS_OK(state->status)) {
+		if (!loadfile_window_issue(slot)) {
+			state->status = NT_STATUS_NO_MEMORY;
+			loadfile_window_fill(state);
+		}
+		return;
+	}
+	slot->done = true;
+
+	while (state->in_use > 0 && NT_STATUS_IS_OK(state->status)) {
+		struct loadfile_window_slot *head = &state->slots[state->head];
+
+		if (!head->done) break;
+		if (io->in.sink != NULL) {
+			state->status = io->in.sink(io->in.sink_private, head->offset,
+						    head->buf, head->len);
+		}
+		head->done = false;
+		state->head = (state->head + 1) % state->window;
+		state->in_use--;
+	}
+
+	loadfile_window_fill(state);
+}
+
+/*
+  called when the close is done, the first read error wins over its status
+*/
+static void loadfile_window_closed(struct smbcli_request *req)
+{
+	struct loadfile_window_state *state = talloc_get_type(req->async.private_data,
+							      struct loadfile_window_state);
+	struct composite_context *c = state->c;
+
+	c->status = smbcli_request_simple_recv(req);
+	if (!NT_STATUS_IS_OK(state->status)) {
+		composite_error(c, state->status);
+		return;
+	}
+	if (!composite_is_ok(c)) return;
+
+	state->io->out.size = state->size;
+	composite_done(c);
+}
+
+NTSTATUS smb_composite_loadfile_window_recv(struct composite_context *c, TALLOC_CTX *mem_ctx)
+{
+	NTSTATUS status;
+
+	status = composite_wait(c);
+
+	if (NT_STATUS_IS_OK(status)) {
+		struct loadfile_window_state *state = talloc_get_type(c->private_data,
+								      struct loadfile_window_state);
+		talloc_steal(mem_ctx, state->io->out.data);
+	}
+
+	talloc_free(c);
+	return status;
+}
+
+NTSTATUS smb_composite_loadfile_window(struct smbcli_tree *tree,
+				       TALLOC_CTX *mem_ctx,
+				       struct smb_composite_loadfile_window *io)
+{
+	struct composite_context *c = smb_composite_loadfile_window_send(tree, io);
+	return smb_composite_loadfile_window_recv(c, mem_ctx);
+}
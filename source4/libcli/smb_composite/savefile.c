@@ -286,3 +286,249 @@ NTSTATUS smb_composite_savefile(struct smbcli_tree *tree,
 	struct composite_context *c = smb_composite_savefile_send(tree, io);
 	return smb_composite_savefile_recv(c);
 }
+
+
+/*
+  windowed savefile - keeps up to in.window writes in flight instead of
+  waiting for each reply, data comes from memory or is pulled from a
+  source callback chunk by chunk
+*/
+struct savefile_window_state;
+
+struct savefile_window_slot {
+	struct savefile_window_state *state;
+	union smb_write io;
+	uint8_t *buf;
+	struct smbcli_request *req;
+};
+
+struct savefile_window_state {
+	struct composite_context *c;
+	struct smbcli_tree *tree;
+	struct smb_composite_savefile_window *io;
+	union smb_open io_open;
+	union smb_close io_close;
+	uint16_t fnum;
+	uint32_t chunk;
+	int window;
+	int in_flight;
+	off_t offset;
+	off_t total_written;
+	bool eof;
+	NTSTATUS status;
+	struct savefile_window_slot *slots;
+};
+
+static void savefile_window_opened(struct smbcli_request *req);
+static void savefile_window_fill(struct savefile_window_state *state);
+static void savefile_window_written(struct smbcli_request *req);
+static void savefile_window_closed(struct smbcli_request *req);
+
+struct composite_context *smb_composite_savefile_window_send(struct smbcli_tree *tree,
+							     struct smb_composite_savefile_window *io)
+{
+	struct composite_context *c;
+	struct savefile_window_state *state;
+
+	c = composite_create(tree, tree->session->transport->socket->event.ctx);
+	if (c == NULL) return NULL;
+
+	state = talloc_zero(c, struct savefile_window_state);
+	if (composite_nomem(state, c)) return c;
+	c->private_data = state;
+
+	state->c = c;
+	state->tree = tree;
+	state->io = io;
+	state->status = NT_STATUS_OK;
+	io->out.size = 0;
+
+	state->io_open.ntcreatex.level               = RAW_OPEN_NTCREATEX;
+	state->io_open.ntcreatex.in.flags            = NTCREATEX_FLAGS_EXTENDED;
+	state->io_open.ntcreatex.in.access_mask      = SEC_FILE_WRITE_DATA;
+	state->io_open.ntcreatex.in.file_attr        = FILE_ATTRIBUTE_NORMAL;
+	state->io_open.ntcreatex.in.share_access     = NTCREATEX_SHARE_ACCESS_READ | NTCREATEX_SHARE_ACCESS_WRITE;
+	state->io_open.ntcreatex.in.open_disposition = NTCREATEX_DISP_OVERWRITE_IF;
+	state->io_open.ntcreatex.in.impersonation    = NTCREATEX_IMPERSONATION_ANONYMOUS;
+	state->io_open.ntcreatex.in.fname            = io->in.fname;
+
+	composite_continue_smb(c, smb_raw_open_send(tree, &state->io_open),
+			       savefile_window_opened, state);
+	return c;
+}
+
+/*
+  called when the open is done - size the window and send the first writes
+*/
+static void savefile_window_opened(struct smbcli_request *req)
+{
+	struct savefile_window_state *state = talloc_get_type(req->async.private_data,
+							      struct savefile_window_state);
+	struct composite_context *c = state->c;
+	struct smbcli_transport *transport = state->tree->session->transport;
+	int i;
+
+	c->status = smb_raw_open_recv(req, state, &state->io_open);
+	if (!composite_is_ok(c)) return;
+	state->fnum = state->io_open.ntcreatex.out.file.fnum;
+
+	/* the server only promises to handle max_mux requests at once,
+	   and other users of the transport may already have some of them
+	   in flight */
+	state->window = state->io->in.window > 0 ? state->io->in.window : SAVEFILE_WINDOW_DEFAULT;
+	state->window = MIN(state->window,
+			    MAX(transport->negotiate.max_mux - smbcli_transport_pending(transport), 1));
+	state->chunk = transport->negotiate.max_xmit - 100;
+
+	state->slots = talloc_zero_array(state, struct savefile_window_slot, state->window);
+	if (composite_nomem(state->slots, c)) return;
+	for (i = 0; i < state->window; i++) {
+		state->slots[i].state = state;
+		if (state->io->in.data == NULL) {
+			state->slots[i].buf = talloc_size(state->slots, state->chunk);
+			if (composite_nomem(state->slots[i].buf, c)) return;
+		}
+	}
+
+	savefile_window_fill(state);
+}
+
+/*
+  get the next chunk into slot, returns its length or 0 at end of data
+*/
+static ssize_t savefile_window_next(struct savefile_window_state *state,
+				    struct savefile_window_slot *slot)
+{
+	struct smb_composite_savefile_window *io = state->io;
+	size_t len = state->chunk;
+	ssize_t n;
+
+	if (io->in.size != 0 || io->in.data != NULL) {
+		if (state->offset >= io->in.size) return 0;
+		len = MIN(len, io->in.size - state->offset);
+	}
+	if (io->in.data != NULL) {
+		slot->io.writex.in.data = io->in.data + state->offset;
+		return len;
+	}
+
+	n = io->in.source(io->in.source_private, slot->buf, len);
+	if (n < 0) {
+		state->status = map_nt_error_from_unix(errno);
+		return 0;
+	}
+	slot->io.writex.in.data = slot->buf;
+	return n;
+}
+
+/*
+  keep the window full, close the file once everything has been written
+  or a write failed and no replies are outstanding
+*/
+static void savefile_window_fill(struct savefile_window_state *state)
+{
+	struct composite_context *c = state->c;
+	union smb_close *io_close = &state->io_close;
+	int i;
+
+	for (i = 0; i < state->window &&
+		     !state->eof && NT_STATUS_IS_OK(state->status); i++) {
+		struct savefile_window_slot *slot = &state->slots[i];
+		ssize_t n;
+
+		if (slot->req != NULL) continue;
+
+		n = savefile_window_next(state, slot);
+		if (n == 0) {
+			state->eof = true;
+			break;
+		}
+		slot->io.writex.level        = RAW_WRITE_WRITEX;
+		slot->io.writex.in.file.fnum = state->fnum;
+		slot->io.writex.in.offset    = state->offset;
+		slot->io.writex.in.wmode     = 0;
+		slot->io.writex.in.remaining = 0;
+		slot->io.writex.in.count     = n;
+
+		slot->req = smb_raw_write_send(state->tree, &slot->io);
+		if (slot->req == NULL) {
+			state->status = NT_STATUS_NO_MEMORY;
+			break;
+		}
+		slot->req->async.fn = savefile_window_written;
+		slot->req->async.private_data = slot;
+		state->in_flight++;
+		state->offset += n;
+	}
+
+	if (state->in_flight > 0 ||
+	    (!state->eof && NT_STATUS_IS_OK(state->status))) {
+		return;
+	}
+
+	io_close->close.level = RAW_CLOSE_CLOSE;
+	io_close->close.in.file.fnum = state->fnum;
+	io_close->close.in.write_time = 0;
+
+	composite_continue_smb(c, smb_raw_close_send(state->tree, io_close),
+			       savefile_window_closed, state);
+}
+
+static void savefile_window_written(struct smbcli_request *req)
+{
+	/* slots are array members, not talloc chunks of their own */
+	struct savefile_window_slot *slot = (struct savefile_window_slot *)req->async.private_data;
+	struct savefile_window_state *state = slot->state;
+	NTSTATUS status;
+
+	status = smb_raw_write_recv(req, &slot->io);
+	slot->req = NULL;
+	state->in_flight--;
+
+	if (NT_STATUS_IS_OK(status) &&
+	    slot->io.writex.out.nwritten != slot->io.writex.in.count) {
+		status = NT_STATUS_DISK_FULL;
+	}
+	if (NT_STATUS_IS_OK(status)) {
+		state->total_written += slot->io.writex.out.nwritten;
+	} else if (NT_STATUS_IS_OK(state->status)) {
+		state->status = status;
+	}
+
+	savefile_window_fill(state);
+}
+
+/*
+  called when the close is done, the first write error wins over its status
+*/
+static void savefile_window_closed(struct smbcli_request *req)
+{
+	struct savefile_window_state *state = talloc_get_type(req->async.private_data,
+							      struct savefile_window_state);
+	struct composite_context *c = state->c;
+
+	c->status = smbcli_request_simple_recv(req);
+	if (!NT_STATUS_IS_OK(state->status)) {
+		composite_error(c, state->status);
+		return;
+	}
+	if (!composite_is_ok(c)) return;
+
+	state->io->out.size = state->total_written;
+	composite_done(c);
+}
+
+NTSTATUS smb_composite_savefile_window_recv(struct composite_context *c)
+{
+	NTSTATUS status;
+	status = composite_wait(c);
+	talloc_free(c);
+	return status;
+}
+
+NTSTATUS smb_composite_savefile_window(struct smbcli_tree *tree,
+				       struct smb_composite_savefile_window *io)
+{
+	struct composite_context *c = smb_composite_savefile_window_send(tree, io);
+	return smb_composite_savefile_window_recv(c);
+}
@@ -46,6 +46,35 @@ struct smb_composite_loadfile {
 	} out;
 };
 
+/*
+  like loadfile, but with up to in.window reads of in.chunk bytes in
+  flight (defaults LOADFILE_WINDOW_DEFAULT and LOADFILE_CHUNK_DEFAULT).
+  The chunk is cut down to what a single readx can return and the window
+  never exceeds the server's max_mux less the requests already
+  outstanding on the transport when the file is opened; requests sent by
+  others while the load runs are not accounted for. If in.sink is set, every
+  chunk is passed to it in file order as soon as it and everything before
+  it has arrived and out.data stays NULL, so the file never has to be
+  resident. An error returned by the sink aborts the load.
+*/
+#define LOADFILE_WINDOW_DEFAULT 8
+#define LOADFILE_CHUNK_DEFAULT 32768
+
+struct smb_composite_loadfile_window {
+	struct {
+		const char *fname;
+		int window;
+		uint32_t chunk;
+		NTSTATUS (*sink)(void *private_data, uint64_t offset,
+				 const uint8_t *data, uint32_t len);
+		void *sink_private;
+	} in;
+	struct {
+		uint8_t *data;
+		uint64_t size;
+	} out;
+};
+
 struct smb_composite_fetchfile {
 	struct {
 		const char *dest_host;
@@ -81,6 +110,31 @@ struct smb_composite_savefile {
 	} in;
 };
 
+/*
+  like savefile, but with up to in.window writes in flight (default
+  SAVEFILE_WINDOW_DEFAULT, never more than the server's max_mux less the
+  requests already outstanding on the transport when the file is opened;
+  requests sent by others while the save runs are not accounted for).
+  Data is taken from in.data (which may be an mmap'd file) or, if that is
+  NULL, pulled in chunks from in.source until it returns 0 or in.size
+  bytes have been read (in.size of 0 means no limit).
+*/
+#define SAVEFILE_WINDOW_DEFAULT 8
+
+struct smb_composite_savefile_window {
+	struct {
+		const char *fname;
+		const uint8_t *data;
+		uint32_t size;
+		ssize_t (*source)(void *private_data, uint8_t *buf, size_t len);
+		void *source_private;
+		int window;
+	} in;
+	struct {
+		uint32_t size;
+	} out;
+};
+
 
 /*
   a composite request for a full connection to a remote server. Includes
@@ -110,6 +164,11 @@ struct smb_composite_connect {
 	struct {
 		struct smbcli_tree *tree;
 		bool anonymous_fallback_done;
+		/* when each step finished, for callers tracing latency */
+		struct timeval resolved;
+		struct timeval connected;
+		struct timeval negotiated;
+		struct timeval session_setup;
 	} out;
 };
 
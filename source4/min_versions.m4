@@ -3,4 +3,4 @@
 define(TDB_MIN_VERSION,1.2.0)
 define(TALLOC_MIN_VERSION,2.0.0)
 define(LDB_REQUIRED_VERSION,0.9.10)
-define(TEVENT_REQUIRED_VERSION,0.9.8)
+define(TEVENT_REQUIRED_VERSION,0.9.10)
@@ -29,8 +29,3 @@ if test x"$ac_cv_func_ext_blkid_get_cache" = x"yes"; then
 	AC_DEFINE(HAVE_LIBBLKID,1,[Whether we have blkid support (e2fsprogs)])
 	SMB_ENABLE(BLKID,YES)
 fi
-
-SMB_ENABLE(pvfs_aio,NO)
-if test x"$tevent_cv_aio_support" = x"yes"; then
-	SMB_ENABLE(pvfs_aio,YES)
-fi
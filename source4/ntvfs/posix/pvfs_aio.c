@@ -1,7 +1,7 @@
 /* 
    Unix SMB/CIFS implementation.
 
-   POSIX NTVFS backend - Linux AIO calls
+   POSIX NTVFS backend - async read and write
 
    Copyright (C) Andrew Tridgell 2006
 
@@ -22,50 +22,67 @@
 #include "includes.h"
 #include <tevent.h>
 #include "vfs_posix.h"
-#include "system/aio.h"
+
+/*
+  Reads and writes go through tevent_io_send(), which the event backend
+  submits directly to the kernel when it can (io_uring). With other
+  backends it would just be a pread()/pwrite() with extra steps, so we
+  return NT_STATUS_NOT_IMPLEMENTED and the caller does it synchronously.
+*/
 
 struct pvfs_aio_read_state {
 	struct ntvfs_request *req;
 	union smb_read *rd;
 	struct pvfs_file *f;
-	struct tevent_aio *ae;
+	uint32_t maxcnt;
 };
 
 struct pvfs_aio_write_state {
 	struct ntvfs_request *req;
 	union smb_write *wr;
 	struct pvfs_file *f;
-	struct tevent_aio *ae;
 };
 
 /*
   called when an aio read has finished
 */
-static void pvfs_aio_read_handler(struct tevent_context *ev, struct tevent_aio *ae,
-			     int ret, void *private_data)
+static void pvfs_aio_read_handler(struct tevent_req *subreq)
 {
-	struct pvfs_aio_read_state *state = talloc_get_type(private_data,
+	struct pvfs_aio_read_state *state = tevent_req_callback_data(subreq,
 							    struct pvfs_aio_read_state);
+	struct ntvfs_request *req = state->req;
 	struct pvfs_file *f = state->f;
 	union smb_read *rd = state->rd;
+	ssize_t ret;
+	int err;
+
+	ret = tevent_io_recv(subreq, &err);
+	talloc_free(subreq);
 
-	if (ret < 0) {
-		/* errno is -ret on error */
-		state->req->async_states->status = pvfs_map_errno(f->pvfs, -ret);
-		state->req->async_states->send_fn(state->req);
+	if (ret == -1) {
+		req->async_states->status = pvfs_map_errno(f->pvfs, err);
+		req->async_states->send_fn(req);
 		return;
 	}
 
+	/* only SMB2 honors mincnt */
+	if (req->ctx->protocol == PROTOCOL_SMB2) {
+		if (rd->readx.in.mincnt > ret ||
+		    (ret == 0 && state->maxcnt > 0)) {
+			req->async_states->status = NT_STATUS_END_OF_FILE;
+			req->async_states->send_fn(req);
+			return;
+		}
+	}
+
 	f->handle->position = f->handle->seek_offset = rd->readx.in.offset + ret;
 
 	rd->readx.out.nread = ret;
 	rd->readx.out.remaining = 0xFFFF;
 	rd->readx.out.compaction_mode = 0; 
 
-	talloc_steal(ev, state->ae);
-
-	state->req->async_states->status = NT_STATUS_OK;
-	state->req->async_states->send_fn(state->req);
+	req->async_states->status = NT_STATUS_OK;
+	req->async_states->send_fn(req);
 }
 
 
@@ -75,25 +92,30 @@ static void pvfs_aio_read_handler(struct tevent_context *ev, struct tevent_aio *
 NTSTATUS pvfs_aio_pread(struct ntvfs_request *req, union smb_read *rd,
 			struct pvfs_file *f, uint32_t maxcnt)
 {
-	struct iocb iocb;
 	struct pvfs_aio_read_state *state;
+	struct tevent_req *subreq;
+
+	if (!tevent_io_is_async(req->ctx->event_ctx)) {
+		return NT_STATUS_NOT_IMPLEMENTED;
+	}
 
 	state = talloc(req, struct pvfs_aio_read_state);
 	NT_STATUS_HAVE_NO_MEMORY(state);
 
-        io_prep_pread(&iocb, f->handle->fd, rd->readx.out.data,
-		      maxcnt, rd->readx.in.offset);
-	state->ae = tevent_add_aio(req->ctx->event_ctx, req->ctx->event_ctx, &iocb,
-				   pvfs_aio_read_handler, state);
-	if (state->ae == NULL) {
-		DEBUG(0,("Failed tevent_add_aio\n"));
+	state->req    = req;
+	state->rd     = rd;
+	state->f      = f;
+	state->maxcnt = maxcnt;
+
+	/* freeing the request cancels the read before the buffer goes away */
+	subreq = tevent_io_send(state, req->ctx->event_ctx, TEVENT_IO_READ,
+				f->handle->fd, rd->readx.out.data,
+				maxcnt, rd->readx.in.offset);
+	if (subreq == NULL) {
 		talloc_free(state);
-		return NT_STATUS_NOT_IMPLEMENTED;
+		return NT_STATUS_NO_MEMORY;
 	}
-
-	state->req  = req;
-	state->rd   = rd;
-	state->f    = f;
+	tevent_req_set_callback(subreq, pvfs_aio_read_handler, state);
 
 	req->async_states->state |= NTVFS_ASYNC_STATE_ASYNC;
 
@@ -106,18 +128,26 @@ NTSTATUS pvfs_aio_pread(struct ntvfs_request *req, union smb_read *rd,
 /*
   called when an aio write has finished
 */
-static void pvfs_aio_write_handler(struct tevent_context *ev, struct tevent_aio *ae,
-			     int ret, void *private_data)
+static void pvfs_aio_write_handler(struct tevent_req *subreq)
 {
-	struct pvfs_aio_write_state *state = talloc_get_type(private_data,
+	struct pvfs_aio_write_state *state = tevent_req_callback_data(subreq,
 							    struct pvfs_aio_write_state);
+	struct ntvfs_request *req = state->req;
 	struct pvfs_file *f = state->f;
 	union smb_write *wr = state->wr;
-
-	if (ret < 0) {
-		/* errno is -ret on error */
-		state->req->async_states->status = pvfs_map_errno(f->pvfs, -ret);
-		state->req->async_states->send_fn(state->req);
+	ssize_t ret;
+	int err;
+
+	ret = tevent_io_recv(subreq, &err);
+	talloc_free(subreq);
+
+	if (ret == -1) {
+		if (err == EFBIG) {
+			req->async_states->status = NT_STATUS_INVALID_PARAMETER;
+		} else {
+			req->async_states->status = pvfs_map_errno(f->pvfs, err);
+		}
+		req->async_states->send_fn(req);
 		return;
 	}
 
@@ -126,10 +156,8 @@ static void pvfs_aio_write_handler(struct tevent_context *ev, struct tevent_aio
 	wr->writex.out.nwritten = ret;
 	wr->writex.out.remaining = 0;
 
-	talloc_steal(ev, state->ae);
-
-	state->req->async_states->status = NT_STATUS_OK;
-	state->req->async_states->send_fn(state->req);
+	req->async_states->status = NT_STATUS_OK;
+	req->async_states->send_fn(req);
 }
 
 
@@ -139,28 +167,30 @@ static void pvfs_aio_write_handler(struct tevent_context *ev, struct tevent_aio
 NTSTATUS pvfs_aio_pwrite(struct ntvfs_request *req, union smb_write *wr,
 			 struct pvfs_file *f)
 {
-	struct iocb iocb;
 	struct pvfs_aio_write_state *state;
+	struct tevent_req *subreq;
 
-	state = talloc(req, struct pvfs_aio_write_state);
-	NT_STATUS_HAVE_NO_MEMORY(state);
-
-	io_prep_pwrite(&iocb, f->handle->fd, discard_const(wr->writex.in.data),
-		       wr->writex.in.count, wr->writex.in.offset);
-	state->ae = tevent_add_aio(req->ctx->event_ctx, req->ctx->event_ctx, &iocb,
-				   pvfs_aio_write_handler, state);
-	if (state->ae == NULL) {
-		DEBUG(0,("Failed tevent_add_aio\n"));
-		talloc_free(state);
+	if (!tevent_io_is_async(req->ctx->event_ctx)) {
 		return NT_STATUS_NOT_IMPLEMENTED;
 	}
 
+	state = talloc(req, struct pvfs_aio_write_state);
+	NT_STATUS_HAVE_NO_MEMORY(state);
+
 	state->req  = req;
 	state->wr   = wr;
 	state->f    = f;
 
+	subreq = tevent_io_send(state, req->ctx->event_ctx, TEVENT_IO_WRITE,
+				f->handle->fd, discard_const(wr->writex.in.data),
+				wr->writex.in.count, wr->writex.in.offset);
+	if (subreq == NULL) {
+		talloc_free(state);
+		return NT_STATUS_NO_MEMORY;
+	}
+	tevent_req_set_callback(subreq, pvfs_aio_write_handler, state);
+
 	req->async_states->state |= NTVFS_ASYNC_STATE_ASYNC;
 
 	return NT_STATUS_OK;
 }
-
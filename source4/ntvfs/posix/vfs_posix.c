@@ -57,7 +57,7 @@ static void pvfs_setup_options(struct pvfs_state *pvfs)
 	if (share_bool_option(scfg, PVFS_FAKE_OPLOCKS, PVFS_FAKE_OPLOCKS_DEFAULT))
 		pvfs->flags |= PVFS_FLAG_FAKE_OPLOCKS;
 	if (share_bool_option(scfg, PVFS_AIO, false))
-		pvfs->flags |= PVFS_FLAG_LINUX_AIO;
+		pvfs->flags |= PVFS_FLAG_AIO;
 
 	/* file perm options */
 	pvfs->options.create_mask       = share_int_option(scfg,
@@ -243,7 +243,7 @@ struct pvfs_search_state {
 #define PVFS_FLAG_STRICT_LOCKING (1<<6)
 #define PVFS_FLAG_XATTR_ENABLE   (1<<7)
 #define PVFS_FLAG_FAKE_OPLOCKS   (1<<8)
-#define PVFS_FLAG_LINUX_AIO      (1<<9)
+#define PVFS_FLAG_AIO            (1<<9)
 
 /* forward declare some anonymous structures */
 struct pvfs_dir;
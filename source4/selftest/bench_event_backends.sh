@@ -0,0 +1,77 @@
+#!/bin/sh
+# Compare event backends by running smbd with each of them in turn and
+# putting an nbench load on it. posix:aio is switched on so that with
+# io_uring file reads and writes are submitted through the event loop.
+
+if [ $# -lt 4 ]; then
+cat <<EOF
+Usage: bench_event_backends.sh CONFIGFILE UNC USERNAME PASSWORD [BACKEND...]
+EOF
+exit 1;
+fi
+
+CONFIGFILE=$1
+UNC=$2
+USERNAME=$3
+PASSWORD=$4
+shift 4
+BACKENDS=${*:-"epoll io_uring"}
+
+samba4bindir="${BUILDDIR:-.}/bin"
+smbd="$samba4bindir/smbd$EXEEXT"
+smbtorture="$samba4bindir/smbtorture$EXEEXT"
+
+# nbench parameters, the load file is the dbench client.txt
+NBENCH_LOADFILE=${NBENCH_LOADFILE:-client.txt}
+NBENCH_PROCS=${NBENCH_PROCS:-8}
+NBENCH_TIME=${NBENCH_TIME:-60}
+
+if [ ! -f "$NBENCH_LOADFILE" ]; then
+	echo "nbench load file $NBENCH_LOADFILE not found, set NBENCH_LOADFILE"
+	exit 1
+fi
+
+results=""
+failed=0
+
+for backend in $BACKENDS; do
+	echo "Starting smbd with event backend $backend"
+
+	# -i exits when stdin is closed, keep it open while the load runs
+	fifo=`mktemp -u /tmp/bench_event.XXXXXX`
+	mkfifo $fifo || exit 1
+	$smbd -i -M single --event-backend=$backend -s $CONFIGFILE \
+		--option=posix:aio=yes < $fifo > smbd.$backend.log 2>&1 &
+	smbd_pid=$!
+	exec 9> $fifo
+	rm -f $fifo
+
+	sleep 5
+	if ! kill -0 $smbd_pid 2>/dev/null; then
+		echo "smbd with event backend $backend did not start, see smbd.$backend.log"
+		exec 9>&-
+		failed=`expr $failed + 1`
+		continue
+	fi
+
+	rate=`$smbtorture --loadfile=$NBENCH_LOADFILE --num-progs=$NBENCH_PROCS \
+		-t $NBENCH_TIME -U"$USERNAME"%"$PASSWORD" $UNC BENCH-NBENCH 2>&1 |
+		tee nbench.$backend.log | sed -n 's/^Throughput \(.*\) MB\/sec$/\1/p'`
+
+	exec 9>&-
+	wait $smbd_pid
+
+	if [ -z "$rate" ]; then
+		echo "nbench against event backend $backend failed, see nbench.$backend.log"
+		failed=`expr $failed + 1`
+		continue
+	fi
+	results="$results$backend $rate
+"
+done
+
+echo
+echo "backend throughput (MB/sec, $NBENCH_PROCS clients, $NBENCH_TIME secs)"
+printf "%s" "$results"
+
+exit $failed
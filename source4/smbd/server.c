@@ -265,6 +265,7 @@ static int binary_smbd_main(const char *binary_name, int argc, const char *argv[
 	uint16_t stdin_event_flags;
 	NTSTATUS status;
 	const char *model = "standard";
+	const char *event_backend = NULL;
 	int max_runtime = 0;
 	enum {
 		OPT_DAEMON = 1000,
@@ -279,6 +280,8 @@ static int binary_smbd_main(const char *binary_name, int argc, const char *argv[
 		 "Run interactive (not a daemon)", NULL},
 		{"model", 'M', POPT_ARG_STRING,	NULL, OPT_PROCESS_MODEL, 
 		 "Select process model", "MODEL"},
+		{"event-backend", 0, POPT_ARG_STRING, &event_backend, 0,
+		 "Select event backend (e.g. epoll, io_uring)", "BACKEND"},
 		{"maximum-runtime",0, POPT_ARG_INT, &max_runtime, 0, 
 		 "set maximum runtime of the server process, till autotermination", "seconds"},
 		POPT_COMMON_SAMBA
@@ -372,12 +375,20 @@ static int binary_smbd_main(const char *binary_name, int argc, const char *argv[
 
 	talloc_free(shared_init);
 	
+	/* child processes of the process model create their event
+	   contexts with the same default backend */
+	if (event_backend != NULL) {
+		tevent_set_default_backend(event_backend);
+	}
+
 	/* the event context is the top level structure in smbd. Everything else
 	   should hang off that */
 	event_ctx = s4_event_context_init(talloc_autofree_context());
 
 	if (event_ctx == NULL) {
-		DEBUG(0,("Initializing event context failed\n"));
+		DEBUG(0,("Initializing event context failed%s%s\n",
+			 event_backend ? " - backend " : "",
+			 event_backend ? event_backend : ""));
 		return 1;
 	}
 
@@ -217,6 +217,208 @@ static bool test_fetchfile(struct smbcli_state *cli, struct torture_context *tct
 	return ret;
 }
 
+struct savefile_source_state {
+	const uint8_t *data;
+	size_t len;
+	size_t ofs;
+};
+
+/* hands out data in odd sized pieces, like a pipe would */
+static ssize_t savefile_source(void *private_data, uint8_t *buf, size_t len)
+{
+	struct savefile_source_state *src = (struct savefile_source_state *)private_data;
+	size_t n = MIN(MIN(len, 1 + random() % 7000), src->len - src->ofs);
+
+	memcpy(buf, src->data + src->ofs, n);
+	src->ofs += n;
+	return n;
+}
+
+static bool check_loadfile(struct smbcli_state *cli, struct torture_context *tctx,
+			   const char *fname, const uint8_t *data, size_t len)
+{
+	struct smb_composite_loadfile io;
+	NTSTATUS status;
+
+	io.in.fname = fname;
+	status = smb_composite_loadfile(cli->tree, tctx, &io);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) loadfile failed: %s\n", __location__, nt_errstr(status));
+		return false;
+	}
+	if (io.out.size != len) {
+		printf("(%s) wrong length in returned data - %d should be %d\n",__location__,
+		       io.out.size, (int)len);
+		return false;
+	}
+	if (memcmp(io.out.data, data, len) != 0) {
+		printf("(%s) wrong data in loadfile!\n",__location__);
+		return false;
+	}
+	talloc_free(io.out.data);
+	return true;
+}
+
+/*
+  test windowed savefile from memory and from a source callback
+*/
+static bool test_savefile_window(struct smbcli_state *cli, struct torture_context *tctx)
+{
+	const char *fname = BASEDIR "\\window.dat";
+	NTSTATUS status;
+	struct smb_composite_savefile_window io;
+	struct savefile_source_state src;
+	uint8_t *data;
+	size_t len = 200000 + random() % 300000;
+	bool ret = true;
+
+	data = talloc_array(tctx, uint8_t, len);
+	generate_random_buffer(data, len);
+
+	printf("testing windowed savefile\n");
+
+	ZERO_STRUCT(io);
+	io.in.fname = fname;
+	io.in.data  = data;
+	io.in.size  = len;
+	status = smb_composite_savefile_window(cli->tree, &io);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) savefile_window failed: %s\n", __location__, nt_errstr(status));
+		return false;
+	}
+	ret &= check_loadfile(cli, tctx, fname, data, len);
+
+	printf("testing windowed savefile from source\n");
+
+	/* shorter than before, the file has to be truncated */
+	src.data = data;
+	src.len = len / 2;
+	src.ofs = 0;
+	ZERO_STRUCT(io);
+	io.in.fname = fname;
+	io.in.source = savefile_source;
+	io.in.source_private = &src;
+	io.in.window = 3;
+	status = smb_composite_savefile_window(cli->tree, &io);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) savefile_window failed: %s\n", __location__, nt_errstr(status));
+		return false;
+	}
+	if (io.out.size != len / 2) {
+		printf("(%s) wrote %d bytes, should be %d\n", __location__,
+		       io.out.size, (int)(len / 2));
+		ret = false;
+	}
+	ret &= check_loadfile(cli, tctx, fname, data, len / 2);
+
+	talloc_free(data);
+
+	return ret;
+}
+
+struct loadfile_sink_state {
+	uint8_t *data;
+	uint64_t len;
+	bool bad_order;
+};
+
+static NTSTATUS loadfile_sink(void *private_data, uint64_t offset,
+			      const uint8_t *data, uint32_t len)
+{
+	struct loadfile_sink_state *sink = (struct loadfile_sink_state *)private_data;
+
+	if (offset != sink->len) {
+		sink->bad_order = true;
+		return NT_STATUS_INTERNAL_ERROR;
+	}
+	memcpy(sink->data + offset, data, len);
+	sink->len += len;
+	return NT_STATUS_OK;
+}
+
+/*
+  test windowed loadfile into memory and through a sink
+*/
+static bool test_loadfile_window(struct smbcli_state *cli, struct torture_context *tctx)
+{
+	const char *fname = BASEDIR "\\window.dat";
+	NTSTATUS status;
+	struct smb_composite_savefile_window io1;
+	struct smb_composite_loadfile_window io2;
+	struct loadfile_sink_state sink;
+	uint8_t *data;
+	size_t len = 200000 + random() % 300000;
+	bool ret = true;
+
+	data = talloc_array(tctx, uint8_t, len);
+	generate_random_buffer(data, len);
+
+	ZERO_STRUCT(io1);
+	io1.in.fname = fname;
+	io1.in.data  = data;
+	io1.in.size  = len;
+	status = smb_composite_savefile_window(cli->tree, &io1);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) savefile_window failed: %s\n", __location__, nt_errstr(status));
+		return false;
+	}
+
+	printf("testing windowed loadfile\n");
+
+	/* odd chunk size, so the last read is a partial one */
+	ZERO_STRUCT(io2);
+	io2.in.fname = fname;
+	io2.in.window = 4;
+	io2.in.chunk = 10007;
+	status = smb_composite_loadfile_window(cli->tree, tctx, &io2);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) loadfile_window failed: %s\n", __location__, nt_errstr(status));
+		return false;
+	}
+	if (io2.out.size != len) {
+		printf("(%s) wrong length in returned data - %d should be %d\n",__location__,
+		       (int)io2.out.size, (int)len);
+		ret = false;
+	} else if (memcmp(io2.out.data, data, len) != 0) {
+		printf("(%s) wrong data in loadfile_window!\n",__location__);
+		ret = false;
+	}
+	talloc_free(io2.out.data);
+
+	printf("testing windowed loadfile into a sink\n");
+
+	sink.data = talloc_zero_array(tctx, uint8_t, len);
+	sink.len = 0;
+	sink.bad_order = false;
+	ZERO_STRUCT(io2);
+	io2.in.fname = fname;
+	io2.in.sink = loadfile_sink;
+	io2.in.sink_private = &sink;
+	status = smb_composite_loadfile_window(cli->tree, tctx, &io2);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("(%s) loadfile_window failed: %s%s\n", __location__, nt_errstr(status),
+		       sink.bad_order ? " (chunks out of order)" : "");
+		return false;
+	}
+	if (io2.out.data != NULL) {
+		printf("(%s) loadfile_window with a sink returned data\n", __location__);
+		ret = false;
+	}
+	if (io2.out.size != len || sink.len != len) {
+		printf("(%s) wrong length through sink - %d/%d should be %d\n",__location__,
+		       (int)io2.out.size, (int)sink.len, (int)len);
+		ret = false;
+	} else if (memcmp(sink.data, data, len) != 0) {
+		printf("(%s) wrong data through sink!\n",__location__);
+		ret = false;
+	}
+
+	talloc_free(sink.data);
+	talloc_free(data);
+
+	return ret;
+}
+
 /*
   test setfileacl
 */
@@ -406,6 +608,53 @@ static bool test_fsinfo(struct smbcli_state *cli, struct torture_context *tctx)
 }
 
 
+/*
+  measure savefile throughput with growing number of writes in flight
+*/
+bool torture_bench_savefile(struct torture_context *tctx,
+			    struct smbcli_state *cli)
+{
+	const char *fname = BASEDIR "\\bench.dat";
+	int size = torture_setting_int(tctx, "savefile_size", 8*1024*1024);
+	int windows[] = { 1, 2, 4, 8, 16 };
+	struct smb_composite_savefile_window io;
+	NTSTATUS status;
+	uint8_t *data;
+	int i;
+
+	if (!torture_setup_dir(cli, BASEDIR)) {
+		return false;
+	}
+
+	data = talloc_array(tctx, uint8_t, size);
+	torture_assert(tctx, data != NULL, "no memory");
+	generate_random_buffer(data, size);
+
+	torture_comment(tctx, "savefile of %d bytes, max_mux %d\n", size,
+			cli->transport->negotiate.max_mux);
+
+	for (i=0;i<ARRAY_SIZE(windows);i++) {
+		struct timeval tv = timeval_current();
+		double secs;
+
+		ZERO_STRUCT(io);
+		io.in.fname = fname;
+		io.in.data = data;
+		io.in.size = size;
+		io.in.window = windows[i];
+		status = smb_composite_savefile_window(cli->tree, &io);
+		torture_assert_ntstatus_ok(tctx, status, "savefile_window");
+		secs = timeval_elapsed(&tv);
+		torture_comment(tctx, "window %2d: %.3f s, %.2f MB/s\n", windows[i],
+				secs, size / (1024.0 * 1024.0) / secs);
+	}
+
+	smbcli_deltree(cli->tree, BASEDIR);
+	talloc_free(data);
+
+	return true;
+}
+
 /* 
    basic testing of libcli composite calls
 */
@@ -420,6 +669,8 @@ bool torture_raw_composite(struct torture_context *tctx,
 
 	ret &= test_fetchfile(cli, tctx);
 	ret &= test_loadfile(cli, tctx);
+	ret &= test_savefile_window(cli, tctx);
+	ret &= test_loadfile_window(cli, tctx);
  	ret &= test_appendacl(cli, tctx);
 	ret &= test_fsinfo(cli, tctx);
 
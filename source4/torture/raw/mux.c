@@ -339,6 +339,111 @@ done:
 
 
 
+#define MUX_POOL_DEPTH 16
+#define MUX_POOL_ROUNDS 20
+
+/*
+  small requests in flight at once come from per-request talloc pools,
+  after the first round they must all be recycled ones
+*/
+static bool test_mux_pool(struct smbcli_state *cli, TALLOC_CTX *mem_ctx)
+{
+	struct smbcli_transport_stats *stats = &cli->transport->stats;
+	struct smbcli_transport_stats before;
+	union smb_read io[MUX_POOL_DEPTH];
+	struct smbcli_request *req[MUX_POOL_DEPTH];
+	uint8_t data[MUX_POOL_DEPTH][16];
+	uint8_t buf[MUX_POOL_DEPTH][16];
+	uint8_t *big;
+	NTSTATUS status;
+	int fnum;
+	bool ret = true;
+	int i, round;
+
+	printf("testing request pools with %d reads in flight\n", MUX_POOL_DEPTH);
+
+	fnum = smbcli_open(cli->tree, BASEDIR "\\pool.dat", O_RDWR | O_CREAT, DENY_NONE);
+	if (fnum == -1) {
+		printf("open failed in mux_pool - %s\n", smbcli_errstr(cli->tree));
+		ret = false;
+		goto done;
+	}
+
+	for (i = 0; i < MUX_POOL_DEPTH; i++) {
+		memset(data[i], i + 1, sizeof(data[i]));
+	}
+	if (smbcli_write(cli->tree, fnum, 0, data, 0, sizeof(data)) != sizeof(data)) {
+		printf("write failed in mux_pool - %s\n", smbcli_errstr(cli->tree));
+		ret = false;
+		goto done;
+	}
+
+	before = *stats;
+
+	for (round = 0; round < MUX_POOL_ROUNDS; round++) {
+		for (i = 0; i < MUX_POOL_DEPTH; i++) {
+			io[i].generic.level = RAW_READ_READX;
+			io[i].readx.in.file.fnum = fnum;
+			io[i].readx.in.offset = i * sizeof(data[i]);
+			io[i].readx.in.mincnt = sizeof(buf[i]);
+			io[i].readx.in.maxcnt = sizeof(buf[i]);
+			io[i].readx.in.remaining = 0;
+			io[i].readx.in.read_for_execute = false;
+			io[i].readx.out.data = buf[i];
+			req[i] = smb_raw_read_send(cli->tree, &io[i]);
+			if (req[i] == NULL) {
+				printf("read send failed in mux_pool\n");
+				ret = false;
+				goto done;
+			}
+		}
+		for (i = 0; i < MUX_POOL_DEPTH; i++) {
+			status = smb_raw_read_recv(req[i], &io[i]);
+			CHECK_STATUS(status, NT_STATUS_OK);
+			if (io[i].readx.out.nread != sizeof(buf[i]) ||
+			    memcmp(buf[i], data[i], sizeof(buf[i])) != 0) {
+				printf("wrong data for read %d in round %d\n", i, round);
+				ret = false;
+				goto done;
+			}
+		}
+	}
+
+	printf("%llu requests: %llu pools allocated, %llu reused, %llu freed\n",
+	       (unsigned long long)(stats->requests - before.requests),
+	       (unsigned long long)(stats->pool_allocs - before.pool_allocs),
+	       (unsigned long long)(stats->pool_reuses - before.pool_reuses),
+	       (unsigned long long)(stats->pool_frees - before.pool_frees));
+
+	if (stats->pool_allocs - before.pool_allocs > MUX_POOL_DEPTH ||
+	    stats->pool_reuses - before.pool_reuses <
+	    (MUX_POOL_ROUNDS - 1) * MUX_POOL_DEPTH) {
+		printf("request pools were not recycled\n");
+		ret = false;
+		goto done;
+	}
+
+	/* a large write does not fit a pool */
+	before = *stats;
+	big = talloc_zero_array(mem_ctx, uint8_t, SMBCLI_REQ_POOL_SIZE);
+	if (smbcli_write(cli->tree, fnum, 0, big, 0, SMBCLI_REQ_POOL_SIZE) != SMBCLI_REQ_POOL_SIZE) {
+		printf("large write failed in mux_pool - %s\n", smbcli_errstr(cli->tree));
+		ret = false;
+		goto done;
+	}
+	talloc_free(big);
+	if (stats->unpooled == before.unpooled) {
+		printf("large write was set up in a pool\n");
+		ret = false;
+		goto done;
+	}
+
+	smbcli_close(cli->tree, fnum);
+
+done:
+	return ret;
+}
+
 /* 
    basic testing of multiplexing notify
 */
@@ -353,6 +458,7 @@ bool torture_raw_mux(struct torture_context *torture, struct smbcli_state *cli)
 	ret &= test_mux_open(cli, torture);
 	ret &= test_mux_write(cli, torture);
 	ret &= test_mux_lock(cli, torture);
+	ret &= test_mux_pool(cli, torture);
 
 	smb_raw_exit(cli->session);
 	smbcli_deltree(cli->tree, BASEDIR);
@@ -63,6 +63,7 @@ NTSTATUS torture_raw_init(void)
 	torture_suite_add_suite(suite, torture_raw_streams(suite));
 	torture_suite_add_suite(suite, torture_raw_acls(suite));
 	torture_suite_add_1smb_test(suite, "COMPOSITE", torture_raw_composite);
+	torture_suite_add_1smb_test(suite, "BENCH-SAVEFILE", torture_bench_savefile);
 	torture_suite_add_simple_test(suite, "SAMBA3HIDE", torture_samba3_hide);
 	torture_suite_add_simple_test(suite, "SAMBA3CLOSEERR", torture_samba3_closeerr);
 	torture_suite_add_simple_test(suite, "SAMBA3ROOTDIRFID",
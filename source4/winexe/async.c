@@ -7,56 +7,192 @@
 #include "includes.h"
 #include "libcli/libcli.h"
 #include "libcli/raw/raw_proto.h"
+#include "libcli/smb2/smb2.h"
+#include "libcli/smb2/smb2_calls.h"
 #include "winexe.h"
+#include "winexesvc/shared.h"
 
 #define USE_OPENX_CALL
 
-void list_enqueue(struct list *l, const void *data, int size)
+/* Largest READX/WRITEX payload fitting in a single SMB */
+static int async_max_io(struct async_context *c)
 {
-	struct list_item *li =
-	    talloc_size(0, sizeof(struct list_item) + size);
-	memcpy(li->data, data, size);
-	li->size = size;
-	li->next = 0;
-	if (l->end)
-		l->end->next = li;
-	else
-		l->begin = li;
-	l->end = li;
+	if (c->tree2)
+		return ASYNC_SMB2_MAX_IO;
+	return c->tree->session->transport->negotiate.max_xmit - 100;
 }
 
-void list_dequeue(struct list *l)
+/*
+  Makes room for at least need bytes in the write ring, data is kept in
+  order starting at offset 0 of the new buffer.
+*/
+static int ring_grow(struct async_context *c, int need)
+{
+	struct async_ring *r = &c->wr;
+	int size = r->size ? r->size : ASYNC_RING_CHUNKS * async_max_io(c);
+	char *buf;
+
+	while (size - r->len < need)
+		size *= 2;
+	if (size == r->size)
+		return 1;
+	buf = talloc_size(c, size);
+	if (!buf)
+		return 0;
+	if (r->len) {
+		int first = MIN(r->len, r->size - r->head);
+		memcpy(buf, r->buf + r->head, first);
+		memcpy(buf + first, r->buf, r->len - first);
+	}
+	talloc_free(r->buf);
+	r->buf = buf;
+	r->size = size;
+	r->head = 0;
+	return 1;
+}
+
+static void async_discard2(struct smb2_request *req)
+{
+	smb2_request_destroy(req);
+}
+
+/*
+  SMB2 transport treats a reply without matching request as fatal, so
+  requests in flight are left to complete and only their callbacks dropped
+*/
+static void async_detach2(struct smb2_request *req)
 {
-	struct list_item *li = l->begin;
-	if (!li)
+	if (!req)
 		return;
-	l->begin = li->next;
-	if (!l->begin)
-		l->end = 0;
-	talloc_free(li);
+	req->async.fn = async_discard2;
+	req->async.private_data = NULL;
+}
+
+/* Drops all outstanding reads, their replies will not reach callbacks */
+static void async_read_cancel(struct async_context *c)
+{
+	int i;
+
+	for (i = 0; i < c->rs_num; ++i) {
+		if (c->rs[i].req)
+			smbcli_request_destroy(c->rs[i].req);
+		async_detach2(c->rs[i].req2);
+		c->rs[i].req = NULL;
+		c->rs[i].req2 = NULL;
+		c->rs[i].done = 0;
+	}
+	c->rs_head = 0;
+}
+
+/* Drops open/close and write requests in flight */
+static void async_cancel(struct async_context *c)
+{
+	async_read_cancel(c);
+	if (c->rreq)
+		smbcli_request_destroy(c->rreq);
+	if (c->wreq)
+		smbcli_request_destroy(c->wreq);
+	async_detach2(c->rreq2);
+	async_detach2(c->wreq2);
+	c->rreq = c->wreq = NULL;
+	c->rreq2 = c->wreq2 = NULL;
+}
+
+static int async_destructor(struct async_context *c)
+{
+	/* Don't let replies for a context that is gone reach callbacks */
+	async_cancel(c);
+	return 0;
+}
+
+static int async_read_issue(struct async_read_slot *rs);
+
+/*
+  Replies can arrive in any order, but the pipe server fills pending reads
+  in the order they were sent, so data is passed on in the issue order.
+*/
+static void async_read_done(struct async_read_slot *rs)
+{
+	struct async_context *c = rs->c;
+
+	c->wakeups++;
+	rs->done = 1;
+
+	while (c->rs_num && c->rs[c->rs_head].done) {
+		rs = &c->rs[c->rs_head];
+		rs->done = 0;
+		if (!NT_STATUS_IS_OK(rs->status)) {
+			DEBUG(1,
+			      ("ERROR: smb_raw_read_recv - %s\n",
+			       nt_errstr(rs->status)));
+			async_read_cancel(c);
+			if (c->cb_error)
+				c->cb_error(c->cb_ctx, ASYNC_READ_RECV, rs->status);
+			return;
+		}
+		c->rs_head = (c->rs_head + 1) % c->rs_num;
+		if (c->cb_read)
+			c->cb_read(c->cb_ctx, rs->data, rs->nread);
+		if (c->tree2)
+			TALLOC_FREE(rs->io2.out.data.data);
+		/* callback could close the pipe */
+		if (c->io_close || c->io_close2)
+			return;
+		/* slot stays idle until async_read_pause(c, 0) */
+		if (c->read_paused)
+			continue;
+		if (!async_read_issue(rs))
+			return;
+	}
 }
 
 static void async_read_recv(struct smbcli_request *req)
 {
-	struct async_context *c = req->async.private_data;
-	NTSTATUS status;
+	struct async_read_slot *rs = req->async.private_data;
 
-	status = smb_raw_read_recv(req, c->io_read);
-	c->rreq = NULL;
+	rs->status = smb_raw_read_recv(req, &rs->io);
+	rs->req = NULL;
+	rs->data = rs->buffer;
+	rs->nread = rs->io.readx.out.nread;
+	async_read_done(rs);
+}
+
+static void async_read_recv2(struct smb2_request *req)
+{
+	struct async_read_slot *rs = req->async.private_data;
+
+	rs->status = smb2_read_recv(req, rs->c->rs, &rs->io2);
+	rs->req2 = NULL;
+	rs->data = (char *)rs->io2.out.data.data;
+	rs->nread = rs->io2.out.data.length;
+	async_read_done(rs);
+}
+
+static int async_write_send(struct async_context *c);
+static int async_write_flush(struct async_context *c);
+
+static void async_write_done(struct async_context *c, NTSTATUS status, uint32_t n)
+{
+	c->wakeups++;
 	if (!NT_STATUS_IS_OK(status)) {
 		DEBUG(1,
-		      ("ERROR: smb_raw_read_recv - %s\n",
+		      ("ERROR: smb_raw_write_recv - %s\n",
 		       nt_errstr(status)));
+		TALLOC_FREE(c->io_write);
+		TALLOC_FREE(c->io_write2);
+		c->wr.head = c->wr.len = 0;
 		if (c->cb_error)
-			c->cb_error(c->cb_ctx, ASYNC_READ_RECV, status);
+			c->cb_error(c->cb_ctx, ASYNC_WRITE_RECV, status);
 		return;
 	}
-
-	if (c->cb_read)
-		c->cb_read(c->cb_ctx, c->buffer,
-			   c->io_read->readx.out.nread);
-
-	async_read(c);
+	c->wr.head = (c->wr.head + n) % c->wr.size;
+	c->wr.len -= n;
+	if (!c->wr.len)
+		c->wr.head = 0;
+	if (c->wr.len)
+		async_write_flush(c);
+	else if (c->cb_drain)
+		c->cb_drain(c->cb_ctx);
 }
 
 static void async_write_recv(struct smbcli_request *req)
@@ -66,20 +202,42 @@ static void async_write_recv(struct smbcli_request *req)
 
 	status = smb_raw_write_recv(req, c->io_write);
 	c->wreq = NULL;
+	async_write_done(c, status, MIN(c->io_write->writex.out.nwritten,
+					c->io_write->writex.in.count));
+}
+
+static void async_write_recv2(struct smb2_request *req)
+{
+	struct async_context *c = req->async.private_data;
+	NTSTATUS status;
+
+	status = smb2_write_recv(req, c->io_write2);
+	c->wreq2 = NULL;
+	async_write_done(c, status, MIN(c->io_write2->out.nwritten,
+					c->io_write2->in.data.length));
+}
+
+static void async_open_done(struct async_context *c, NTSTATUS status)
+{
+	c->wakeups++;
 	if (!NT_STATUS_IS_OK(status)) {
 		DEBUG(1,
-		      ("ERROR: smb_raw_write_recv - %s\n",
+		      ("ERROR: smb_raw_open_recv - %s\n",
 		       nt_errstr(status)));
-		talloc_free(c->io_write);
-		c->io_write = 0;
+		/* write and read chained to the open fail along with it */
+		async_cancel(c);
+		c->opened = 0;
+		c->wr.head = c->wr.len = 0;
 		if (c->cb_error)
-			c->cb_error(c->cb_ctx, ASYNC_WRITE_RECV, status);
+			c->cb_error(c->cb_ctx, ASYNC_OPEN_RECV, status);
 		return;
 	}
-	if (c->wq.begin) {
-		async_write(c, c->wq.begin->data, c->wq.begin->size);
-		list_dequeue(&c->wq);
-	}
+	c->opened = 1;
+	if (!async_write_flush(c))
+		return;
+	if (c->cb_open)
+		c->cb_open(c->cb_ctx);
+	async_read(c);
 }
 
 static void async_open_recv(struct smbcli_request *req)
@@ -98,34 +256,38 @@ static void async_open_recv(struct smbcli_request *req)
 #endif
 	talloc_free(c->io_open);
 	c->io_open = 0;
-	if (!NT_STATUS_IS_OK(status)) {
-		DEBUG(1,
-		      ("ERROR: smb_raw_open_recv - %s\n",
-		       nt_errstr(status)));
-		if (c->cb_error)
-			c->cb_error(c->cb_ctx, ASYNC_OPEN_RECV, status);
-		return;
-	}
-	if (c->cb_open)
-		c->cb_open(c->cb_ctx);
-	async_read(c);
+	async_open_done(c, status);
 }
 
-static void async_close_recv(struct smbcli_request *req)
+static void async_open_recv2(struct smb2_request *req)
 {
 	struct async_context *c = req->async.private_data;
 	NTSTATUS status;
 
-	status = smbcli_request_simple_recv(req);
-	talloc_free(c->io_close);
-	c->io_close = 0;
+	DEBUG(1, ("IN: async_open_recv2\n"));
+	status = smb2_create_recv(req, c, c->io_open2);
+	c->rreq2 = NULL;
+	if (NT_STATUS_IS_OK(status))
+		c->handle2 = c->io_open2->out.file.handle;
+	TALLOC_FREE(c->io_open2);
+	async_open_done(c, status);
+}
+
+static void async_close_done(struct async_context *c)
+{
+	c->wakeups++;
+	TALLOC_FREE(c->io_close);
+	TALLOC_FREE(c->io_close2);
+	TALLOC_FREE(c->io_open2);
+	TALLOC_FREE(c->io_write2);
 	if (c->io_open) {
 		talloc_free(c->io_open);
 		c->io_open = 0;
 	}
-	if (c->io_read) {
-		talloc_free(c->io_read);
-		c->io_read = 0;
+	if (c->rs) {
+		talloc_free(c->rs);
+		c->rs = 0;
+		c->rs_num = 0;
 	}
 	if (c->io_write) {
 		talloc_free(c->io_write);
@@ -135,35 +297,190 @@ static void async_close_recv(struct smbcli_request *req)
 		c->cb_close(c->cb_ctx);
 }
 
-int async_read(struct async_context *c)
+static void async_close_recv(struct smbcli_request *req)
+{
+	struct async_context *c = req->async.private_data;
+
+	smbcli_request_simple_recv(req);
+	c->rreq = NULL;
+	async_close_done(c);
+}
+
+static void async_close_recv2(struct smb2_request *req)
 {
-	if (!c->io_read) {
-		c->io_read = talloc(c->tree, union smb_read);
-		c->io_read->readx.level = RAW_READ_READX;
-		c->io_read->readx.in.file.fnum = c->fd;
-		c->io_read->readx.in.offset = 0;
-		c->io_read->readx.in.mincnt = sizeof(c->buffer);
-		c->io_read->readx.in.maxcnt = sizeof(c->buffer);
-		c->io_read->readx.in.remaining = 0;
-		c->io_read->readx.in.read_for_execute = false;
-		c->io_read->readx.out.data = (uint8_t *)c->buffer;
+	struct async_context *c = req->async.private_data;
+
+	smb2_close_recv(req, c->io_close2);
+	c->rreq2 = NULL;
+	async_close_done(c);
+}
+
+static int async_read_issue(struct async_read_slot *rs)
+{
+	struct async_context *c = rs->c;
+
+	if (c->tree2) {
+		struct smb2_transport *transport = c->tree2->session->transport;
+		int old_timeout = transport->options.request_timeout;
+
+		rs->io2.in.file.handle = c->handle2;
+		transport->options.request_timeout = 0;
+		rs->req2 = smb2_read_send(c->tree2, &rs->io2);
+		transport->options.request_timeout = old_timeout;
+		if (rs->req2) {
+			rs->req2->async.fn = async_read_recv2;
+			rs->req2->async.private_data = rs;
+			return 1;
+		}
+	} else {
+		/* pipe reads wait for output, but the transport is shared
+		   with svcctl and ADMIN$ requests that must keep timing out */
+		struct smbcli_transport *transport = c->tree->session->transport;
+		int old_timeout = transport->options.request_timeout;
+
+		transport->options.request_timeout = 0;
+		rs->req = smb_raw_read_send(c->tree, &rs->io);
+		transport->options.request_timeout = old_timeout;
 	}
-	c->rreq = smb_raw_read_send(c->tree, c->io_read);
-	if (!c->rreq) {
+	if (!rs->req && !rs->req2) {
+		async_read_cancel(c);
 		if (c->cb_error)
 			c->cb_error(c->cb_ctx, ASYNC_READ,
 				    NT_STATUS_NO_MEMORY);
 		return 0;
 	}
-	c->rreq->transport->options.request_timeout = 0;
-	c->rreq->async.fn = async_read_recv;
-	c->rreq->async.private_data = c;
+	rs->req->async.fn = async_read_recv;
+	rs->req->async.private_data = rs;
+	return 1;
+}
+
+static int async_read_alloc(struct async_context *c)
+{
+	int i, size = async_max_io(c);
+
+	if (c->read_size > 0 && c->read_size < size)
+		size = c->read_size;
+	c->rs_num = MIN(MAX(c->read_depth, 1), ASYNC_READ_MAX_DEPTH);
+	c->rs_head = 0;
+	c->rs = talloc_zero_array(c, struct async_read_slot, c->rs_num);
+	if (!c->rs)
+		return 0;
+	for (i = 0; i < c->rs_num; ++i) {
+		struct async_read_slot *rs = &c->rs[i];
+		rs->c = c;
+		/* SMB2 reads get their buffer from the reply */
+		if (!c->tree2) {
+			rs->buffer = talloc_size(c->rs, size);
+			if (!rs->buffer)
+				return 0;
+		}
+		rs->io.readx.level = RAW_READ_READX;
+		rs->io.readx.in.file.fnum = c->fd;
+		rs->io.readx.in.offset = 0;
+		rs->io.readx.in.mincnt = size;
+		rs->io.readx.in.maxcnt = size;
+		rs->io.readx.in.remaining = 0;
+		rs->io.readx.in.read_for_execute = false;
+		rs->io.readx.out.data = (uint8_t *)rs->buffer;
+		rs->io2.in.length = size;
+		rs->io2.in.offset = 0;
+		rs->io2.in.min_count = 0;
+	}
 	return 1;
 }
 
+/* Keeps read_depth reads of read_size bytes outstanding on the pipe */
+int async_read(struct async_context *c)
+{
+	int i;
+
+	if (!c->rs && !async_read_alloc(c))
+		goto failed;
+	if (c->read_paused)
+		return 1;
+	for (i = 0; i < c->rs_num; ++i) {
+		int j = (c->rs_head + i) % c->rs_num;
+		if (c->rs[j].req || c->rs[j].req2 || c->rs[j].done)
+			continue;
+		if (!async_read_issue(&c->rs[j]))
+			return 0;
+	}
+	return 1;
+      failed:
+	talloc_free(c->rs);
+	c->rs = 0;
+	c->rs_num = 0;
+	if (c->cb_error)
+		c->cb_error(c->cb_ctx, ASYNC_READ, NT_STATUS_NO_MEMORY);
+	return 0;
+}
+
+/*
+  Stops reissuing reads as their replies come in, so at most read_depth
+  reads worth of data arrives after the call. Resuming refills the pipe.
+*/
+void async_read_pause(struct async_context *c, int pause)
+{
+	c->read_paused = pause;
+	/* not before the open is done or once the pipe is being closed */
+	if (!pause && c->opened && c->rs && !c->io_open2
+	    && !c->io_close && !c->io_close2)
+		async_read(c);
+}
+
+/*
+  SMB2 has no OpenX, pipe is opened with create on IPC$. Data queued
+  before the open and the first read go in the same related compound, so
+  the whole bootstrap costs one round trip.
+*/
+static int async_open2(struct async_context *c, const char *fn)
+{
+	struct smb2_transport *transport = c->tree2->session->transport;
+
+	if (!strncasecmp(fn, "\\pipe\\", 6))
+		fn += 6;
+	if (!c->rs && !async_read_alloc(c))
+		return 0;
+	c->io_open2 = talloc_zero(c, struct smb2_create);
+	if (!c->io_open2)
+		return 0;
+	c->io_open2->in.desired_access = SEC_RIGHTS_FILE_READ | SEC_RIGHTS_FILE_WRITE;
+	c->io_open2->in.share_access = NTCREATEX_SHARE_ACCESS_READ | NTCREATEX_SHARE_ACCESS_WRITE;
+	c->io_open2->in.create_disposition = NTCREATEX_DISP_OPEN;
+	c->io_open2->in.create_options = NTCREATEX_OPTIONS_NON_DIRECTORY_FILE;
+	c->io_open2->in.impersonation_level = NTCREATEX_IMPERSONATION_IMPERSONATION;
+	c->io_open2->in.fname = talloc_strdup(c->io_open2, fn);
+	smb2_transport_compound_start(transport, c->wr.len ? 3 : 2);
+	c->rreq2 = smb2_create_send(c->tree2, c->io_open2);
+	if (!c->rreq2)
+		goto failed;
+	c->rreq2->async.fn = async_open_recv2;
+	c->rreq2->async.private_data = c;
+	/* requests chained to the create refer to its handle this way */
+	c->handle2.data[0] = UINT64_MAX;
+	c->handle2.data[1] = UINT64_MAX;
+	smb2_transport_compound_set_related(transport, true);
+	c->opened = 1;
+	if ((c->wr.len && !async_write_send(c)) || !async_read_issue(&c->rs[0]))
+		goto failed;
+	smb2_transport_compound_set_related(transport, false);
+	return 1;
+      failed:
+	smb2_transport_compound_start(transport, 0);
+	smb2_transport_compound_set_related(transport, false);
+	c->opened = 0;
+	return 0;
+}
+
 int async_open(struct async_context *c, const char *fn, int open_mode)
 {
 	DEBUG(1, ("IN: async_open(%s, %d)\n", fn, open_mode));
+	talloc_set_destructor(c, async_destructor);
+	if (c->tree2) {
+		if (async_open2(c, fn))
+			return 1;
+		goto failed;
+	}
 	c->io_open = talloc_zero(c, union smb_open);
 	if (!c->io_open)
 		goto failed;
@@ -201,60 +518,187 @@ int async_open(struct async_context *c, const char *fn, int open_mode)
 	return 0;
 }
 
-int async_write(struct async_context *c, const void *buf, int len)
+/* Sends queued data as one WRITEX, up to the end of ring or max_xmit */
+static int async_write_send(struct async_context *c)
 {
-	if (c->wreq) {
-		list_enqueue(&c->wq, buf, len);
-		return 0;
+	struct async_ring *r = &c->wr;
+
+	if (c->tree2) {
+		if (!c->io_write2) {
+			c->io_write2 = talloc_zero(c, struct smb2_write);
+			if (!c->io_write2)
+				goto failed;
+			c->io_write2->in.offset = 0;
+		}
+		c->io_write2->in.file.handle = c->handle2;
+		c->io_write2->in.data = data_blob_const(r->buf + r->head,
+				MIN(r->len, MIN(r->size - r->head, async_max_io(c))));
+		c->wreq2 = smb2_write_send(c->tree2, c->io_write2);
+		if (!c->wreq2)
+			goto failed;
+		c->wreq2->async.fn = async_write_recv2;
+		c->wreq2->async.private_data = c;
+		return 1;
 	}
 	if (!c->io_write) {
 		c->io_write = talloc_zero(c, union smb_write);
 		if (!c->io_write)
 			goto failed;
-		c->io_write->write.level = RAW_WRITE_WRITE;
-		c->io_write->write.in.remaining = 0;
-		c->io_write->write.in.file.fnum = c->fd;
-		c->io_write->write.in.offset = 0;
+		c->io_write->writex.level = RAW_WRITE_WRITEX;
+		c->io_write->writex.in.file.fnum = c->fd;
+		c->io_write->writex.in.offset = 0;
+		c->io_write->writex.in.wmode = 0;
+		c->io_write->writex.in.remaining = 0;
 	}
-	c->io_write->write.in.count = len;
-	c->io_write->write.in.data = buf;
-	struct smbcli_request *req =
-	    smb_raw_write_send(c->tree, c->io_write);
-	if (!req)
+	c->io_write->writex.in.count = MIN(r->len, MIN(r->size - r->head, async_max_io(c)));
+	c->io_write->writex.in.data = (uint8_t *)r->buf + r->head;
+	c->wreq = smb_raw_write_send(c->tree, c->io_write);
+	if (!c->wreq)
 		goto failed;
-	req->async.fn = async_write_recv;
-	req->async.private_data = c;
+	c->wreq->async.fn = async_write_recv;
+	c->wreq->async.private_data = c;
 	return 1;
       failed:
 	DEBUG(1, ("ERROR: async_write\n"));
-	talloc_free(c->io_write);
-	c->io_write = 0;
+	TALLOC_FREE(c->io_write);
+	TALLOC_FREE(c->io_write2);
 	return 0;
 }
 
+/*
+  Sends queued data unless a write is in flight. While an SMB2 create is
+  pending the handle is not known yet, data queued after the compound
+  went out waits for the open to complete.
+*/
+static int async_write_flush(struct async_context *c)
+{
+	if (!c->opened || c->io_open2 || c->wreq || c->wreq2 || !c->wr.len)
+		return 1;
+	return async_write_send(c);
+}
+
+/* Copies data to the write ring without sending it */
+static int ring_put(struct async_context *c, const void *buf, int len)
+{
+	struct async_ring *r = &c->wr;
+	int tail, first;
+
+	if (len <= 0)
+		return 1;
+	if (r->size - r->len < len && !ring_grow(c, len))
+		return 0;
+	tail = (r->head + r->len) % r->size;
+	first = MIN(len, r->size - tail);
+	memcpy(r->buf + tail, buf, first);
+	memcpy(r->buf, (const char *)buf + first, len - first);
+	r->len += len;
+	return 1;
+}
+
+/*
+  Queues data for writing, chunks written while a request is in flight
+  are coalesced into the following WRITEX. Data queued before async_open
+  is sent as soon as the pipe is open.
+*/
+int async_write(struct async_context *c, const void *buf, int len)
+{
+	if (len <= 0)
+		return 1;
+	if (!ring_put(c, buf, len))
+		return 0;
+	return async_write_flush(c);
+}
+
+/*
+  Returns contiguous free space of the write ring, so the caller can fill
+  it in place and queue it with async_write_commit
+*/
+char *async_write_space(struct async_context *c, int *len)
+{
+	struct async_ring *r = &c->wr;
+	int tail;
+
+	if (r->size == r->len && !ring_grow(c, async_max_io(c)))
+		return NULL;
+	tail = (r->head + r->len) % r->size;
+	*len = (tail < r->head ? r->head : r->size) - tail;
+	return r->buf + tail;
+}
+
+int async_write_commit(struct async_context *c, int len)
+{
+	c->wr.len += len;
+	return async_write_flush(c);
+}
+
+int async_write_queued(struct async_context *c)
+{
+	return c->wr.len;
+}
+
 int async_close(struct async_context *c)
 {
-	if (c->rreq)
-		smbcli_request_destroy(c->rreq);
-	if (c->wreq)
-		smbcli_request_destroy(c->wreq);
-	c->rreq = c->wreq = NULL;
+	async_cancel(c);
+	if (c->tree2) {
+		c->io_close2 = talloc_zero(c, struct smb2_close);
+		if (!c->io_close2)
+			goto failed;
+		c->io_close2->in.file.handle = c->handle2;
+		c->rreq2 = smb2_close_send(c->tree2, c->io_close2);
+		if (!c->rreq2)
+			goto failed;
+		c->rreq2->async.fn = async_close_recv2;
+		c->rreq2->async.private_data = c;
+		return 1;
+	}
 	c->io_close = talloc_zero(c, union smb_close);
 	if (!c->io_close)
 		goto failed;
 	c->io_close->close.level = RAW_CLOSE_CLOSE;
 	c->io_close->close.in.file.fnum = c->fd;
 	c->io_close->close.in.write_time = 0;
-	struct smbcli_request *req =
-	    smb_raw_close_send(c->tree, c->io_close);
-	if (!req)
+	c->rreq = smb_raw_close_send(c->tree, c->io_close);
+	if (!c->rreq)
 		goto failed;
-	req->async.fn = async_close_recv;
-	req->async.private_data = c;
+	c->rreq->async.fn = async_close_recv;
+	c->rreq->async.private_data = c;
 	return 1;
       failed:
 	DEBUG(1, ("ERROR: async_close\n"));
-	talloc_free(c->io_close);
-	c->io_close = 0;
+	TALLOC_FREE(c->io_close);
+	TALLOC_FREE(c->io_close2);
 	return 0;
 }
+
+/* Queues frame (type, 4 bytes length, data) for writing */
+int async_write_frame(struct async_context *c, int type, const void *buf, int len)
+{
+	uint8_t hdr[FRAMED_HDR];
+
+	hdr[0] = type;
+	SIVAL(hdr, 1, len);
+	/* header and data go out in the same WRITEX */
+	if (!ring_put(c, hdr, FRAMED_HDR) || !ring_put(c, buf, len))
+		return 0;
+	return async_write_flush(c);
+}
+
+/*
+  Calls cb for every complete frame at the start of buf, returns number of
+  bytes consumed or -1 if frame is longer than max.
+*/
+int async_frames_parse(const char *buf, int len, int max, async_cb_frame cb, void *ctx)
+{
+	int used = 0;
+
+	while (len - used >= FRAMED_HDR) {
+		uint32_t flen = IVAL(buf + used, 1);
+		if (flen > max)
+			return -1;
+		if (len - used - FRAMED_HDR < flen)
+			break;
+		cb(ctx, (uint8_t)buf[used], buf + used + FRAMED_HDR, flen);
+		used += FRAMED_HDR + flen;
+	}
+	return used;
+}
@@ -0,0 +1,688 @@
+/*
+   Copyright (C) The winexe contributors 2026
+   License: GNU General Public License version 3
+*/
+
+/*
+  Broker keeps authenticated IPC$ connections to hosts open between winexe
+  runs. Clients connect to its unix socket, send a request and exchange
+  framed stdio with the command the broker runs on their behalf.
+
+  Frame: 1 byte type, 4 bytes length (SMB byte order), data.
+*/
+
+#include "includes.h"
+#include "lib/events/events.h"
+#include "libcli/libcli.h"
+#include "libcli/raw/raw_proto.h"
+#include "libcli/composite/composite.h"
+#include "libcli/smb_composite/smb_composite.h"
+#include "libcli/resolve/resolve.h"
+#include "param/param.h"
+#include "lib/cmdline/popt_common.h"
+#include "auth/credentials/credentials.h"
+#include "lib/util/dlinklist.h"
+
+#include "winexe.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <signal.h>
+
+/* client -> broker */
+#define FRAME_REQUEST 'R'	/* flags, host, domain, user, password, cmd, runas */
+#define FRAME_INPUT 'I'		/* stdin data, empty frame is EOF */
+#define FRAME_ABORT 'A'
+/* broker -> client */
+#define FRAME_STDOUT 'O'
+#define FRAME_STDERR 'E'
+#define FRAME_EXIT 'X'		/* return code */
+
+#define FRAME_HDR 5
+#define FRAME_MAX (1024 * 1024)
+
+/* Keepalive period of unused connections */
+#define BROKER_KEEPALIVE_USEC (30 * 1000000)
+
+struct stream;
+typedef void (*stream_cb_frame) (void *ctx, int type, const char *data, int len);
+typedef void (*stream_cb_close) (void *ctx);
+typedef void (*stream_cb_drain) (void *ctx);
+
+struct stream {
+	int fd;
+	struct fd_event *fde;
+	char *in;
+	int in_len;
+	char *out;
+	int out_len;
+	void *cb_ctx;
+	stream_cb_frame cb_frame;
+	stream_cb_close cb_close;
+	stream_cb_drain cb_drain;
+};
+
+static int stream_destructor(struct stream *s)
+{
+	close(s->fd);
+	return 0;
+}
+
+static void stream_handler(struct event_context *ev, struct fd_event *fde,
+			   uint16_t flags, void *private)
+{
+	struct stream *s = talloc_get_type(private, struct stream);
+
+	if (flags & EVENT_FD_WRITE) {
+		int n = write(s->fd, s->out, s->out_len);
+		if (n < 0 && errno != EAGAIN && errno != EINTR) {
+			s->cb_close(s->cb_ctx);
+			return;
+		}
+		if (n > 0) {
+			memmove(s->out, s->out + n, s->out_len - n);
+			s->out_len -= n;
+		}
+		if (!s->out_len) {
+			EVENT_FD_NOT_WRITEABLE(fde);
+			if (s->cb_drain)
+				s->cb_drain(s->cb_ctx);
+			return;
+		}
+	}
+	if (flags & EVENT_FD_READ) {
+		char buf[16384];
+		int n = read(s->fd, buf, sizeof(buf));
+		if (n < 0 && (errno == EAGAIN || errno == EINTR))
+			return;
+		if (n <= 0) {
+			s->cb_close(s->cb_ctx);
+			return;
+		}
+		s->in = talloc_realloc(s, s->in, char, s->in_len + n);
+		if (!s->in) {
+			s->cb_close(s->cb_ctx);
+			return;
+		}
+		memcpy(s->in + s->in_len, buf, n);
+		s->in_len += n;
+		while (s->in_len >= FRAME_HDR) {
+			int type = (uint8_t)s->in[0];
+			int len = IVAL(s->in, 1);
+			if (len < 0 || len > FRAME_MAX) {
+				s->cb_close(s->cb_ctx);
+				return;
+			}
+			if (s->in_len < FRAME_HDR + len)
+				break;
+			s->cb_frame(s->cb_ctx, type, s->in + FRAME_HDR, len);
+			memmove(s->in, s->in + FRAME_HDR + len, s->in_len - FRAME_HDR - len);
+			s->in_len -= FRAME_HDR + len;
+		}
+	}
+}
+
+static struct stream *stream_init(TALLOC_CTX *mem_ctx, struct tevent_context *ev_ctx,
+				  int fd, void *cb_ctx, stream_cb_frame cb_frame,
+				  stream_cb_close cb_close)
+{
+	struct stream *s = talloc_zero(mem_ctx, struct stream);
+
+	if (!s) {
+		close(fd);
+		return NULL;
+	}
+	s->fd = fd;
+	s->cb_ctx = cb_ctx;
+	s->cb_frame = cb_frame;
+	s->cb_close = cb_close;
+	talloc_set_destructor(s, stream_destructor);
+	set_blocking(fd, false);
+	s->fde = event_add_fd(ev_ctx, s, fd, EVENT_FD_READ, stream_handler, s);
+	if (!s->fde) {
+		talloc_free(s);
+		return NULL;
+	}
+	return s;
+}
+
+static int stream_send(struct stream *s, int type, const void *data, int len)
+{
+	s->out = talloc_realloc(s, s->out, char, s->out_len + FRAME_HDR + len);
+	if (!s->out)
+		return 0;
+	s->out[s->out_len] = type;
+	SIVAL(s->out, s->out_len + 1, len);
+	memcpy(s->out + s->out_len + FRAME_HDR, data, len);
+	s->out_len += FRAME_HDR + len;
+	EVENT_FD_WRITEABLE(s->fde);
+	return 1;
+}
+
+/*
+  Broker side
+*/
+struct broker_client;
+
+struct broker {
+	struct tevent_context *ev_ctx;
+	struct program_options *args;
+	struct broker_conn *conns;
+	int fd;
+};
+
+struct broker_conn {
+	struct broker_conn *prev, *next;
+	struct broker *b;
+	char *hostname;
+	char *domain;
+	char *username;
+	char *password;
+	struct cli_credentials *credentials;
+	struct smb_composite_connect *io;
+	struct smbcli_tree *tree;
+	struct broker_client *waiting;
+	int users;
+	struct timeval last_used;
+	struct smb_echo echo;
+	struct smbcli_request *echo_req;
+};
+
+struct broker_client {
+	struct broker_client *prev, *next;
+	struct broker *b;
+	struct stream *s;
+	struct broker_conn *conn;
+	struct program_options args;
+	struct winexe_context *session;
+	int closed;
+	/* session output is not read while OUTPUT_QUEUE_MAX bytes wait for the client */
+	int paused;
+};
+
+static void broker_conn_free(struct broker_conn *conn)
+{
+	DLIST_REMOVE(conn->b->conns, conn);
+	talloc_free(conn);
+}
+
+static void broker_echo_recv(struct smbcli_request *req)
+{
+	struct broker_conn *conn = talloc_get_type(req->async.private_data, struct broker_conn);
+	NTSTATUS status;
+
+	conn->echo_req = NULL;
+	status = smb_raw_echo_recv(req, conn, &conn->echo);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(1, ("broker: keepalive to %s failed - %s\n",
+			  conn->hostname, nt_errstr(status)));
+		if (!conn->users)
+			broker_conn_free(conn);
+	}
+}
+
+/* Keeps unused connection alive, drops it when unused for too long */
+static void broker_idle(struct smbcli_transport *transport, void *private)
+{
+	struct broker_conn *conn = talloc_get_type(private, struct broker_conn);
+
+	if (conn->users || conn->echo_req)
+		return;
+	if (timeval_elapsed(&conn->last_used) > conn->b->args->broker_idle) {
+		DEBUG(1, ("broker: closing idle connection to %s\n", conn->hostname));
+		broker_conn_free(conn);
+		return;
+	}
+	conn->echo.in.repeat_count = 1;
+	conn->echo.in.size = 0;
+	conn->echo.in.data = NULL;
+	conn->echo_req = smb_raw_echo_send(transport, &conn->echo);
+	if (!conn->echo_req)
+		return;
+	conn->echo_req->async.fn = broker_echo_recv;
+	conn->echo_req->async.private_data = conn;
+}
+
+static void broker_client_free(struct broker_client *bc)
+{
+	talloc_free(bc);
+}
+
+static void broker_session_output(void *priv, int fd, const char *data, int len)
+{
+	struct broker_client *bc = talloc_get_type(priv, struct broker_client);
+
+	if (bc->closed)
+		return;
+	stream_send(bc->s, fd == 2 ? FRAME_STDERR : FRAME_STDOUT, data, len);
+	if (!bc->paused && bc->s->out_len >= OUTPUT_QUEUE_MAX && bc->session) {
+		bc->paused = 1;
+		winexe_session_pause(bc->session, 1);
+	}
+}
+
+/* Client took everything queued, read session output again */
+static void broker_client_drain(void *ctx)
+{
+	struct broker_client *bc = talloc_get_type(ctx, struct broker_client);
+
+	if (bc->paused && bc->session) {
+		bc->paused = 0;
+		winexe_session_pause(bc->session, 0);
+	}
+}
+
+static void broker_session_finish(void *priv, int return_code)
+{
+	struct broker_client *bc = talloc_get_type(priv, struct broker_client);
+	uint8_t buf[4];
+
+	bc->session = NULL;
+	bc->conn->users--;
+	bc->conn->last_used = timeval_current();
+	if (bc->closed) {
+		broker_client_free(bc);
+		return;
+	}
+	SIVAL(buf, 0, return_code);
+	stream_send(bc->s, FRAME_EXIT, buf, 4);
+}
+
+static const struct winexe_session_ops broker_session_ops = {
+	.output = broker_session_output,
+	.finish = broker_session_finish
+};
+
+static void broker_client_fail(struct broker_client *bc, const char *msg)
+{
+	uint8_t buf[4];
+
+	stream_send(bc->s, FRAME_STDERR, msg, strlen(msg));
+	SIVAL(buf, 0, 1);
+	stream_send(bc->s, FRAME_EXIT, buf, 4);
+}
+
+static void broker_client_run(struct broker_client *bc)
+{
+	struct broker_conn *conn = bc->conn;
+
+	conn->users++;
+	bc->args.credentials = conn->credentials;
+	/* session is not child of the client, it may outlive the socket */
+	bc->session = winexe_session_start(bc->b, bc->b->ev_ctx, &bc->args,
+					   conn->hostname, conn->tree,
+					   &broker_session_ops, bc);
+	if (!bc->session) {
+		conn->users--;
+		broker_client_fail(bc, "ERROR: Cannot start session\n");
+	}
+}
+
+static void broker_conn_connected(struct composite_context *creq)
+{
+	struct broker_conn *conn = talloc_get_type(creq->async.private_data, struct broker_conn);
+	struct broker_client *bc;
+	NTSTATUS status;
+
+	status = smb_composite_connect_recv(creq, conn);
+	if (!NT_STATUS_IS_OK(status)) {
+		char *msg = talloc_asprintf(conn, "ERROR: Failed to open connection to %s - %s\n",
+					    conn->hostname, nt_errstr(status));
+		DEBUG(1, ("broker: %s", msg));
+		while ((bc = conn->waiting)) {
+			DLIST_REMOVE(conn->waiting, bc);
+			bc->conn = NULL;
+			broker_client_fail(bc, msg);
+		}
+		broker_conn_free(conn);
+		return;
+	}
+	conn->tree = conn->io->out.tree;
+	conn->last_used = timeval_current();
+	smbcli_transport_idle_handler(conn->tree->session->transport, broker_idle,
+				      BROKER_KEEPALIVE_USEC, conn);
+	while ((bc = conn->waiting)) {
+		DLIST_REMOVE(conn->waiting, bc);
+		broker_client_run(bc);
+	}
+}
+
+static struct broker_conn *broker_conn_find(struct broker *b, const char *hostname,
+					    const char *domain, const char *username,
+					    const char *password)
+{
+	struct broker_conn *conn, *next;
+
+	for (conn = b->conns; conn; conn = next) {
+		next = conn->next;
+		if (strcasecmp(conn->hostname, hostname) || strcasecmp(conn->domain, domain)
+		    || strcmp(conn->username, username) || strcmp(conn->password, password))
+			continue;
+		/* transport died while unused */
+		if (conn->tree && !conn->tree->session->transport->socket->sock) {
+			if (conn->users)
+				continue;
+			broker_conn_free(conn);
+			return NULL;
+		}
+		return conn;
+	}
+	return NULL;
+}
+
+static struct broker_conn *broker_conn_new(struct broker *b, const char *hostname,
+					   const char *domain, const char *username,
+					   const char *password)
+{
+	struct broker_conn *conn;
+	struct composite_context *creq;
+
+	conn = talloc_zero(b, struct broker_conn);
+	if (!conn)
+		return NULL;
+	conn->b = b;
+	conn->hostname = talloc_strdup(conn, hostname);
+	conn->domain = talloc_strdup(conn, domain);
+	conn->username = talloc_strdup(conn, username);
+	conn->password = talloc_strdup(conn, password);
+	conn->credentials = cli_credentials_init(conn);
+	if (!conn->credentials)
+		goto failed;
+	cli_credentials_set_conf(conn->credentials, cmdline_lp_ctx);
+	cli_credentials_set_domain(conn->credentials, domain, CRED_SPECIFIED);
+	cli_credentials_set_username(conn->credentials, username, CRED_SPECIFIED);
+	cli_credentials_set_password(conn->credentials, password, CRED_SPECIFIED);
+	conn->io = svc_connect_io(conn, conn->hostname, "IPC$", conn->credentials);
+	if (!conn->io)
+		goto failed;
+	creq = smb_composite_connect_send(conn->io, conn, lp_resolve_context(cmdline_lp_ctx), b->ev_ctx);
+	if (!creq)
+		goto failed;
+	creq->async.fn = broker_conn_connected;
+	creq->async.private_data = conn;
+	DLIST_ADD(b->conns, conn);
+	return conn;
+      failed:
+	talloc_free(conn);
+	return NULL;
+}
+
+/* Splits request frame into NUL terminated strings */
+static int broker_parse_request(const char *data, int len, const char **str, int n)
+{
+	int i;
+
+	for (i = 0; i < n; ++i) {
+		const char *end = memchr(data, 0, len);
+		if (!end)
+			return 0;
+		str[i] = data;
+		len -= end - data + 1;
+		data = end + 1;
+	}
+	return 1;
+}
+
+static void broker_request(struct broker_client *bc, const char *data, int len)
+{
+	const char *str[6];
+	struct broker_conn *conn;
+
+	if (bc->conn || len < 4 || !broker_parse_request(data + 4, len - 4, str, 6)) {
+		broker_client_fail(bc, "ERROR: Bad request\n");
+		return;
+	}
+	bc->args = *bc->b->args;
+	bc->args.flags = IVAL(data, 0);
+	bc->args.cmd = talloc_strdup(bc, str[4]);
+	bc->args.runas = str[5][0] ? talloc_strdup(bc, str[5]) : NULL;
+	bc->args.broker = NULL;
+	/* pooled connections are SMB1 */
+	bc->args.smb2 = 0;
+	DEBUG(1, ("broker: request for %s\\%s@%s\n", str[1], str[2], str[0]));
+
+	conn = broker_conn_find(bc->b, str[0], str[1], str[2], str[3]);
+	if (!conn)
+		conn = broker_conn_new(bc->b, str[0], str[1], str[2], str[3]);
+	if (!conn) {
+		broker_client_fail(bc, "ERROR: Cannot connect\n");
+		return;
+	}
+	bc->conn = conn;
+	if (conn->tree)
+		broker_client_run(bc);
+	else
+		DLIST_ADD_END(conn->waiting, bc, struct broker_client *);
+}
+
+static void broker_client_frame(void *ctx, int type, const char *data, int len)
+{
+	struct broker_client *bc = talloc_get_type(ctx, struct broker_client);
+
+	switch (type) {
+	case FRAME_REQUEST:
+		broker_request(bc, data, len);
+		break;
+	case FRAME_INPUT:
+		if (bc->session)
+			winexe_session_input(bc->session, data, len);
+		break;
+	case FRAME_ABORT:
+		if (bc->session)
+			winexe_session_abort(bc->session);
+		break;
+	default:
+		DEBUG(1, ("broker: unknown frame type %d\n", type));
+	}
+}
+
+static void broker_client_close(void *ctx)
+{
+	struct broker_client *bc = talloc_get_type(ctx, struct broker_client);
+
+	if (bc->session) {
+		/* keep client until its session finishes */
+		bc->closed = 1;
+		TALLOC_FREE(bc->s);
+		/* output is dropped from now on, the session must read on to finish */
+		if (bc->paused) {
+			bc->paused = 0;
+			winexe_session_pause(bc->session, 0);
+		}
+		winexe_session_abort(bc->session);
+		return;
+	}
+	if (bc->conn && !bc->conn->tree)
+		DLIST_REMOVE(bc->conn->waiting, bc);
+	broker_client_free(bc);
+}
+
+static void broker_accept(struct event_context *ev, struct fd_event *fde,
+			  uint16_t flags, void *private)
+{
+	struct broker *b = talloc_get_type(private, struct broker);
+	struct broker_client *bc;
+	int fd;
+
+	fd = accept(b->fd, NULL, NULL);
+	if (fd < 0)
+		return;
+	bc = talloc_zero(b, struct broker_client);
+	if (!bc) {
+		close(fd);
+		return;
+	}
+	bc->b = b;
+	bc->s = stream_init(bc, b->ev_ctx, fd, bc, broker_client_frame, broker_client_close);
+	if (!bc->s) {
+		talloc_free(bc);
+		return;
+	}
+	bc->s->cb_drain = broker_client_drain;
+}
+
+static int unix_socket(const char *path, struct sockaddr_un *sa)
+{
+	int fd;
+
+	if (strlen(path) >= sizeof(sa->sun_path))
+		return -1;
+	memset(sa, 0, sizeof(*sa));
+	sa->sun_family = AF_UNIX;
+	strlcpy(sa->sun_path, path, sizeof(sa->sun_path));
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	return fd;
+}
+
+int broker_main(struct tevent_context *ev_ctx, struct program_options *args)
+{
+	struct broker *b;
+	struct sockaddr_un sa;
+	mode_t old_umask;
+	int fd;
+
+	b = talloc_zero(ev_ctx, struct broker);
+	b->ev_ctx = ev_ctx;
+	b->args = args;
+
+	fd = unix_socket(args->broker, &sa);
+	if (fd < 0) {
+		DEBUG(0, ("ERROR: Cannot create socket %s\n", args->broker));
+		return 1;
+	}
+	unlink(args->broker);
+	/* socket carries credentials, only owner may connect */
+	old_umask = umask(0077);
+	if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0 || listen(fd, 16) < 0) {
+		umask(old_umask);
+		DEBUG(0, ("ERROR: Cannot listen on %s - %s\n", args->broker, strerror(errno)));
+		close(fd);
+		return 1;
+	}
+	umask(old_umask);
+	b->fd = fd;
+	signal(SIGPIPE, SIG_IGN);
+	event_add_fd(ev_ctx, b, fd, EVENT_FD_READ, broker_accept, b);
+	DEBUG(1, ("broker: listening on %s\n", args->broker));
+	event_loop_wait(ev_ctx);
+	return 0;
+}
+
+/*
+  Client side
+*/
+struct broker_user {
+	struct tevent_context *ev_ctx;
+	struct stream *s;
+	struct fd_event *stdin_fde;
+	int abort_sent;
+};
+
+static void user_frame(void *ctx, int type, const char *data, int len)
+{
+	switch (type) {
+	case FRAME_STDOUT:
+		write(1, data, len);
+		break;
+	case FRAME_STDERR:
+		write(2, data, len);
+		break;
+	case FRAME_EXIT:
+		exit(len >= 4 ? IVAL(data, 0) : 1);
+	}
+}
+
+static void user_close(void *ctx)
+{
+	DEBUG(0, ("ERROR: Connection to broker lost\n"));
+	exit(1);
+}
+
+static void user_drain(void *ctx)
+{
+	struct broker_user *u = talloc_get_type(ctx, struct broker_user);
+
+	if (u->stdin_fde)
+		EVENT_FD_READABLE(u->stdin_fde);
+}
+
+static void user_stdin(struct event_context *ev, struct fd_event *fde,
+		       uint16_t flags, void *private)
+{
+	struct broker_user *u = talloc_get_type(private, struct broker_user);
+	char buf[16384];
+	int n;
+
+	/* wait until broker takes what is queued */
+	if (u->s->out_len >= STDIN_QUEUE_MAX) {
+		EVENT_FD_NOT_READABLE(fde);
+		return;
+	}
+	n = read(0, buf, sizeof(buf));
+	if (n < 0 && (errno == EAGAIN || errno == EINTR))
+		return;
+	if (n <= 0) {
+		stream_send(u->s, FRAME_INPUT, NULL, 0);
+		TALLOC_FREE(u->stdin_fde);
+		return;
+	}
+	stream_send(u->s, FRAME_INPUT, buf, n);
+}
+
+static void user_signal(struct tevent_context *ev, struct tevent_signal *se,
+			int signum, int count, void *siginfo, void *private)
+{
+	struct broker_user *u = talloc_get_type(private, struct broker_user);
+
+	fprintf(stderr, "Aborting...\n");
+	stream_send(u->s, FRAME_ABORT, NULL, 0);
+}
+
+static void request_add(char **req, int *len, const char *str)
+{
+	int l = strlen(str ? str : "") + 1;
+
+	*req = talloc_realloc(NULL, *req, char, *len + l);
+	memcpy(*req + *len, str ? str : "", l);
+	*len += l;
+}
+
+int broker_client_main(struct tevent_context *ev_ctx, struct program_options *args)
+{
+	struct broker_user *u;
+	struct sockaddr_un sa;
+	char *req;
+	int fd, len;
+
+	u = talloc_zero(ev_ctx, struct broker_user);
+	u->ev_ctx = ev_ctx;
+
+	fd = unix_socket(args->via_broker, &sa);
+	if (fd < 0 || connect(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+		DEBUG(0, ("ERROR: Cannot connect to broker %s\n", args->via_broker));
+		return 1;
+	}
+	u->s = stream_init(u, ev_ctx, fd, u, user_frame, user_close);
+	if (!u->s)
+		return 1;
+	u->s->cb_drain = user_drain;
+
+	len = 4;
+	req = talloc_array(u, char, len);
+	SIVAL(req, 0, args->flags);
+	request_add(&req, &len, args->hostname);
+	request_add(&req, &len, cli_credentials_get_domain(args->credentials));
+	request_add(&req, &len, cli_credentials_get_username(args->credentials));
+	request_add(&req, &len, cli_credentials_get_password(args->credentials));
+	request_add(&req, &len, args->cmd);
+	request_add(&req, &len, args->runas);
+	stream_send(u->s, FRAME_REQUEST, req, len);
+	talloc_free(req);
+
+	u->stdin_fde = event_add_fd(ev_ctx, u, 0, EVENT_FD_READ, user_stdin, u);
+	event_add_signal(ev_ctx, u, SIGINT, SA_RESETHAND, user_signal, u);
+	event_add_signal(ev_ctx, u, SIGTERM, SA_RESETHAND, user_signal, u);
+	event_loop_wait(ev_ctx);
+	return 1;
+}
@@ -0,0 +1,110 @@
+/*
+   Copyright (C) The winexe contributors 2026
+   License: GNU General Public License version 3
+*/
+
+/*
+  Per host record of the service we have installed, so that warm runs can
+  go straight to the control pipe without touching ADMIN$ or svcctl.
+
+  Record: version, 32/64bit flavour, interactive flag (4 bytes each, SMB
+  byte order) and MD5 of the embedded service binaries.
+*/
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "tdb_wrap.h"
+#include "../lib/crypto/crypto.h"
+#include "lib/events/events.h"
+#include "libcli/libcli.h"
+#include "winexe.h"
+
+#define CACHE_REC_SIZE (12 + 16)
+
+struct tdb_wrap *svc_cache_open(TALLOC_CTX *mem_ctx, const char *path)
+{
+	struct tdb_wrap *cache;
+
+	cache = tdb_wrap_open(mem_ctx, path, 0, TDB_DEFAULT, O_RDWR | O_CREAT, 0600);
+	if (cache == NULL)
+		DEBUG(1, ("svc_cache_open: Cannot open %s - %s\n", path, strerror(errno)));
+	return cache;
+}
+
+/* Identifies service binaries built into this winexe */
+void svc_cache_hash(uint8_t hash[16])
+{
+	static uint8_t digest[16];
+	static int done;
+	struct MD5Context ctx;
+
+	if (!done) {
+		MD5Init(&ctx);
+		/* compressed images identify the binaries just as well */
+		MD5Update(&ctx, winexesvc32_exe_z, winexesvc32_exe_zlen);
+		MD5Update(&ctx, winexesvc64_exe_z, winexesvc64_exe_zlen);
+		MD5Final(digest, &ctx);
+		done = 1;
+	}
+	memcpy(hash, digest, 16);
+}
+
+static TDB_DATA svc_cache_key(const char *hostname, char *buf, int size)
+{
+	TDB_DATA key;
+
+	strlcpy(buf, hostname, size);
+	strlower_m(buf);
+	key.dptr = (uint8_t *)buf;
+	key.dsize = strlen(buf);
+	return key;
+}
+
+int svc_cache_fetch(struct tdb_wrap *cache, const char *hostname, struct svc_cache_entry *e)
+{
+	char buf[256];
+	TDB_DATA data;
+
+	if (cache == NULL)
+		return 0;
+	data = tdb_fetch(cache->tdb, svc_cache_key(hostname, buf, sizeof(buf)));
+	if (data.dptr == NULL)
+		return 0;
+	if (data.dsize != CACHE_REC_SIZE) {
+		free(data.dptr);
+		return 0;
+	}
+	e->version = IVAL(data.dptr, 0);
+	e->os64bit = (int32_t)IVAL(data.dptr, 4);
+	e->interactive = IVAL(data.dptr, 8);
+	memcpy(e->hash, data.dptr + 12, 16);
+	free(data.dptr);
+	return 1;
+}
+
+void svc_cache_store(struct tdb_wrap *cache, const char *hostname, const struct svc_cache_entry *e)
+{
+	char buf[256];
+	uint8_t rec[CACHE_REC_SIZE];
+	TDB_DATA data;
+
+	if (cache == NULL)
+		return;
+	SIVAL(rec, 0, e->version);
+	SIVAL(rec, 4, e->os64bit);
+	SIVAL(rec, 8, e->interactive);
+	memcpy(rec + 12, e->hash, 16);
+	data.dptr = rec;
+	data.dsize = sizeof(rec);
+	if (tdb_store(cache->tdb, svc_cache_key(hostname, buf, sizeof(buf)), data, TDB_REPLACE) != 0)
+		DEBUG(1, ("svc_cache_store: %s\n", tdb_errorstr(cache->tdb)));
+}
+
+void svc_cache_delete(struct tdb_wrap *cache, const char *hostname)
+{
+	char buf[256];
+
+	if (cache == NULL)
+		return;
+	tdb_delete(cache->tdb, svc_cache_key(hostname, buf, sizeof(buf)));
+}
@@ -0,0 +1,15 @@
+AC_ARG_ENABLE(winexesvc-mock,
+AS_HELP_STRING([--enable-winexesvc-mock], [Build the winexesvc stand-in server service used by selftest (default=no)]))
+
+# it runs commands for any authenticated client, so only selftest
+# (socket wrapper) and developer builds get it
+if eval "test x$developer = xyes -o x$HAVE_SOCKET_WRAPPER = xyes"; then
+	enable_winexesvc_mock=yes
+fi
+
+if eval "test x$enable_winexesvc_mock = xyes"; then
+	AC_DEFINE(WINEXESVC_MOCK,1,[Build the winexesvc stand-in server service])
+	SMB_ENABLE(WINEXESVC_MOCK, YES)
+else
+	SMB_ENABLE(WINEXESVC_MOCK, NO)
+fi
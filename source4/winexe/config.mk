@@ -6,6 +6,10 @@ PRIVATE_DEPENDENCIES = \
 		POPT_SAMBA \
 		POPT_CREDENTIALS \
 		LIBPOPT \
+		TDB_WRAP \
+		LIBCLI_SMB2 \
+		ZLIB \
+		LIBCRYPTO \
 		RPC_NDR_SVCCTL
 # End BINARY winexe
 #################################
@@ -14,9 +18,26 @@ winexe_OBJ_FILES = $(addprefix winexe/, \
 		winexe.o \
 		service.o \
 		async.o \
+		broker.o \
+		cache.o \
+		trace.o \
 		winexesvc/winexesvc32_exe.o \
 		winexesvc/winexesvc64_exe.o )
 
+#################################
+# Start MODULE WINEXESVC_MOCK
+# Linux stand-in for winexesvc, enabled by adding "winexesvc" to
+# "server services" (test servers only, runs commands as samba's user).
+# Only built for selftest and developer builds, see config.m4
+[MODULE::WINEXESVC_MOCK]
+INIT_FUNCTION = server_service_winexesvc_init
+SUBSYSTEM = service
+PRIVATE_DEPENDENCIES = samba_socket LIBSECURITY_COMMON
+# End MODULE WINEXESVC_MOCK
+#################################
+
+WINEXESVC_MOCK_OBJ_FILES = winexe/mocksvc.o
+
 winexe/winexesvc/winexesvc32_exe.c: winexe/winexesvc/winexesvc.c
 	@$(MAKE) -C winexe/winexesvc
 
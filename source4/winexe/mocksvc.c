@@ -0,0 +1,820 @@
+/*
+   Copyright (C) The winexe contributors 2026
+   License: GNU General Public License version 3
+*/
+
+/*
+  Stand-in for winexesvc, run inside samba as the "winexesvc" server
+  service. It speaks the protocol from winexesvc/shared.h on the same
+  named pipes and runs commands locally with /bin/sh -c, so winexe can be
+  tested and benchmarked against a Linux server. Commands run as the user
+  samba runs as: enable it only on test servers.
+
+  Stdio pipes cannot be created on demand here, MOCKSVC_SLOTS sets of them
+  are registered at startup and handed out to runs by number.
+*/
+
+#include "includes.h"
+#include <tevent.h>
+#include "smbd/service_task.h"
+#include "smbd/service.h"
+#include "smbd/service_stream.h"
+#include "smbd/process_model.h"
+#include "lib/socket/socket.h"
+#include "lib/util/dlinklist.h"
+#include "param/param.h"
+#include "auth/session.h"
+#include "libcli/security/security.h"
+#include "system/filesys.h"
+#include "system/network.h"
+#include "system/wait.h"
+#include "system/dir.h"
+#include "winexesvc/shared.h"
+#include <sys/resource.h>
+
+/* Concurrent non-framed runs, each needs its own set of stdio pipes */
+#define MOCKSVC_SLOTS 32
+
+/* Longest command line, as in winexesvc */
+#define MOCKSVC_MAX_LINE 32768
+
+/* Bytes read from child at a time; stdin buffered before reading stops */
+#define MOCKSVC_IO_SIZE 65536
+
+/* Exit code reported for aborted commands, as in winexesvc */
+#define MOCKSVC_ABORTED 0x1234
+
+enum mocksvc_kind { MOCKSVC_STDIN, MOCKSVC_STDOUT, MOCKSVC_STDERR, MOCKSVC_CTRL };
+
+struct mocksvc_run;
+
+struct mocksvc_server {
+	struct task_server *task;
+	struct mocksvc_run *runs;
+	struct mocksvc_run *slots[MOCKSVC_SLOTS];
+};
+
+/* Private data of a registered pipe */
+struct mocksvc_pipe {
+	struct mocksvc_server *srv;
+	enum mocksvc_kind kind;
+	int slot;
+};
+
+struct mocksvc_conn {
+	struct stream_connection *conn;
+	struct mocksvc_server *srv;
+	enum mocksvc_kind kind;
+	struct mocksvc_run *run;
+	int framed;
+	int stats;
+	int dead;
+	DATA_BLOB in;
+	DATA_BLOB out;
+	size_t out_sent;
+	int shutdown_after;	/* close our direction once out is sent */
+	int close_after;	/* drop connection once out is sent */
+};
+
+struct mocksvc_run {
+	struct mocksvc_run *prev, *next;
+	struct mocksvc_server *srv;
+	struct mocksvc_conn *ctrl;
+	/* stdio pipe connections, indexed by enum mocksvc_kind */
+	struct mocksvc_conn *io[3];
+	int closed[3];
+	int slot;
+	int framed;
+	int stats;
+	pid_t pid;
+	struct timeval started;
+	int exited;
+	int aborted;
+	uint32_t ec;
+	struct timeval wall;
+	struct rusage ru;
+	int fd[3];
+	struct tevent_fd *fde[3];
+	DATA_BLOB in;
+	int in_eof;
+	int finished;
+};
+
+static void mocksvc_pump(struct mocksvc_run *run, int k);
+static void mocksvc_stdin_flush(struct mocksvc_run *run);
+
+static void mocksvc_terminate(struct mocksvc_conn *mc, const char *reason)
+{
+	if (mc->dead)
+		return;
+	mc->dead = 1;
+	stream_terminate_connection(mc->conn, reason);
+}
+
+/* Queues data for the peer, written from mocksvc_send_handler */
+static int mocksvc_send(struct mocksvc_conn *mc, const void *data, size_t len)
+{
+	if (mc->dead)
+		return 0;
+	if (mc->out_sent == mc->out.length) {
+		data_blob_free(&mc->out);
+		mc->out_sent = 0;
+	}
+	if (!data_blob_append(mc, &mc->out, data, len)) {
+		mocksvc_terminate(mc, "mocksvc: out of memory");
+		return 0;
+	}
+	TEVENT_FD_WRITEABLE(mc->conn->event.fde);
+	return 1;
+}
+
+static int mocksvc_pending(struct mocksvc_conn *mc)
+{
+	return mc->out.length - mc->out_sent;
+}
+
+static void mocksvc_printf(struct mocksvc_conn *mc, const char *fmt, ...) PRINTF_ATTRIBUTE(2,3);
+
+static void mocksvc_printf(struct mocksvc_conn *mc, const char *fmt, ...)
+{
+	va_list ap;
+	char *s;
+
+	va_start(ap, fmt);
+	s = talloc_vasprintf(mc, fmt, ap);
+	va_end(ap);
+	if (!s) {
+		mocksvc_terminate(mc, "mocksvc: out of memory");
+		return;
+	}
+	mocksvc_send(mc, s, strlen(s));
+	talloc_free(s);
+}
+
+static void mocksvc_frame(struct mocksvc_conn *mc, int type, const void *data, uint32_t len)
+{
+	uint8_t hdr[FRAMED_HDR];
+
+	hdr[0] = type;
+	SIVAL(hdr, 1, len);
+	if (mocksvc_send(mc, hdr, FRAMED_HDR) && len)
+		mocksvc_send(mc, data, len);
+}
+
+/* Sends return code once child is gone and client has taken all output */
+static void mocksvc_check_done(struct mocksvc_run *run)
+{
+	int k;
+
+	if (run->finished || !run->exited)
+		return;
+	for (k = MOCKSVC_STDOUT; k <= MOCKSVC_STDERR; ++k) {
+		if (run->fd[k] != -1)
+			return;
+		if (!run->framed && !run->closed[k])
+			return;
+	}
+	run->finished = 1;
+	if (run->framed) {
+		uint8_t ec[4];
+		SIVAL(ec, 0, run->ec);
+		mocksvc_frame(run->ctrl, FRAMED_RETURN_CODE, ec, 4);
+	} else {
+		mocksvc_printf(run->ctrl, CMD_RETURN_CODE " %08X\n", run->ec);
+	}
+	if (run->stats) {
+		char *s = talloc_asprintf(run, "wall_ms=%lu user_ms=%lu kernel_ms=%lu peak_ws_kb=%lu",
+			(unsigned long)(run->wall.tv_sec * 1000 + run->wall.tv_usec / 1000),
+			(unsigned long)(run->ru.ru_utime.tv_sec * 1000 + run->ru.ru_utime.tv_usec / 1000),
+			(unsigned long)(run->ru.ru_stime.tv_sec * 1000 + run->ru.ru_stime.tv_usec / 1000),
+			(unsigned long)run->ru.ru_maxrss);
+		if (s && run->framed)
+			mocksvc_frame(run->ctrl, FRAMED_STATS, s, strlen(s));
+		else if (s)
+			mocksvc_printf(run->ctrl, CMD_STATS " %s\n", s);
+		talloc_free(s);
+	}
+	/* winexesvc ends the connection after a run as well */
+	run->ctrl->close_after = 1;
+	if (!mocksvc_pending(run->ctrl))
+		mocksvc_terminate(run->ctrl, "mocksvc: run finished");
+}
+
+static void mocksvc_abort(struct mocksvc_run *run)
+{
+	if (run->exited || run->aborted)
+		return;
+	DEBUG(2, ("mocksvc: aborting process %d\n", (int)run->pid));
+	run->aborted = 1;
+	kill(run->pid, SIGKILL);
+}
+
+static void mocksvc_sigchld(struct tevent_context *ev, struct tevent_signal *se,
+			    int signum, int count, void *siginfo, void *private_data)
+{
+	struct mocksvc_server *srv = talloc_get_type(private_data, struct mocksvc_server);
+	struct mocksvc_run *run, *next;
+	struct timeval now;
+	int status;
+
+	for (run = srv->runs; run; run = next) {
+		next = run->next;
+		/* usage of the child, ru_maxrss is in KB on Linux as well */
+		if (run->exited || wait4(run->pid, &status, WNOHANG, &run->ru) != run->pid)
+			continue;
+		run->exited = 1;
+		now = timeval_current();
+		run->wall = timeval_until(&run->started, &now);
+		if (run->aborted)
+			run->ec = MOCKSVC_ABORTED;
+		else if (WIFEXITED(status))
+			run->ec = WEXITSTATUS(status);
+		else
+			run->ec = 128 + WTERMSIG(status);
+		DEBUG(2, ("mocksvc: process %d exited, code %u\n", (int)run->pid, run->ec));
+		mocksvc_check_done(run);
+	}
+}
+
+static int mocksvc_run_destructor(struct mocksvc_run *run)
+{
+	int k;
+
+	if (!run->exited) {
+		kill(run->pid, SIGKILL);
+		waitpid(run->pid, NULL, 0);
+	}
+	for (k = 0; k < 3; ++k) {
+		if (run->fd[k] != -1)
+			close(run->fd[k]);
+		if (run->io[k]) {
+			run->io[k]->run = NULL;
+			mocksvc_terminate(run->io[k], "mocksvc: run gone");
+		}
+	}
+	if (run->slot != -1)
+		run->srv->slots[run->slot] = NULL;
+	DLIST_REMOVE(run->srv->runs, run);
+	return 0;
+}
+
+static int mocksvc_conn_destructor(struct mocksvc_conn *mc)
+{
+	struct mocksvc_run *run = mc->run;
+
+	if (!run || mc->kind == MOCKSVC_CTRL)
+		return 0;
+	run->io[mc->kind] = NULL;
+	run->closed[mc->kind] = 1;
+	if (mc->kind == MOCKSVC_STDIN) {
+		run->in_eof = 1;
+		mocksvc_stdin_flush(run);
+	} else {
+		/* output nobody reads is drained so child does not block */
+		mocksvc_pump(run, mc->kind);
+	}
+	mocksvc_check_done(run);
+	return 0;
+}
+
+/* Where output of stream k goes, NULL if not connected yet */
+static struct mocksvc_conn *mocksvc_sink(struct mocksvc_run *run, int k)
+{
+	return run->framed ? run->ctrl : run->io[k];
+}
+
+static void mocksvc_output_eof(struct mocksvc_run *run, int k)
+{
+	struct mocksvc_conn *sink = mocksvc_sink(run, k);
+
+	TALLOC_FREE(run->fde[k]);
+	close(run->fd[k]);
+	run->fd[k] = -1;
+	if (sink && !run->framed) {
+		/* client sees end of pipe, closes it and so confirms it read all */
+		sink->shutdown_after = 1;
+		if (!mocksvc_pending(sink))
+			shutdown(socket_get_fd(sink->conn->socket), SHUT_WR);
+	}
+	mocksvc_check_done(run);
+}
+
+/* Reads child output only when the previous chunk has been sent */
+static void mocksvc_pump(struct mocksvc_run *run, int k)
+{
+	struct mocksvc_conn *sink = mocksvc_sink(run, k);
+	uint16_t flags = 0;
+
+	if (!run->fde[k])
+		return;
+	if (run->closed[k] || (sink && !mocksvc_pending(sink)))
+		flags = TEVENT_FD_READ;
+	tevent_fd_set_flags(run->fde[k], flags);
+}
+
+static void mocksvc_output_handler(struct tevent_context *ev, struct tevent_fd *fde,
+				   uint16_t flags, void *private_data)
+{
+	struct mocksvc_run *run = talloc_get_type(private_data, struct mocksvc_run);
+	struct mocksvc_conn *sink;
+	uint8_t buf[MOCKSVC_IO_SIZE];
+	int k = fde == run->fde[MOCKSVC_STDOUT] ? MOCKSVC_STDOUT : MOCKSVC_STDERR;
+	ssize_t n;
+
+	n = read(run->fd[k], buf, sizeof(buf));
+	if (n < 0 && (errno == EAGAIN || errno == EINTR))
+		return;
+	if (n <= 0) {
+		mocksvc_output_eof(run, k);
+		return;
+	}
+	sink = mocksvc_sink(run, k);
+	if (!sink || run->closed[k])
+		return;
+	if (run->framed)
+		mocksvc_frame(sink, k == MOCKSVC_STDOUT ? FRAMED_STDOUT : FRAMED_STDERR, buf, n);
+	else
+		mocksvc_send(sink, buf, n);
+	mocksvc_pump(run, k);
+}
+
+/* Stdin source is the stdin pipe, or control pipe in framed mode */
+static struct mocksvc_conn *mocksvc_stdin_source(struct mocksvc_run *run)
+{
+	return run->framed ? run->ctrl : run->io[MOCKSVC_STDIN];
+}
+
+static void mocksvc_stdin_flush(struct mocksvc_run *run)
+{
+	struct mocksvc_conn *src = mocksvc_stdin_source(run);
+	ssize_t n;
+
+	if (run->fd[MOCKSVC_STDIN] == -1) {
+		data_blob_free(&run->in);
+		return;
+	}
+	while (run->in.length) {
+		n = write(run->fd[MOCKSVC_STDIN], run->in.data, run->in.length);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0 && errno == EAGAIN)
+			break;
+		if (n <= 0) {
+			/* child closed its stdin, drop the rest */
+			data_blob_free(&run->in);
+			run->in_eof = 1;
+			break;
+		}
+		memmove(run->in.data, run->in.data + n, run->in.length - n);
+		run->in.length -= n;
+	}
+	if (!run->in.length && run->in_eof) {
+		TALLOC_FREE(run->fde[MOCKSVC_STDIN]);
+		close(run->fd[MOCKSVC_STDIN]);
+		run->fd[MOCKSVC_STDIN] = -1;
+		return;
+	}
+	tevent_fd_set_flags(run->fde[MOCKSVC_STDIN], run->in.length ? TEVENT_FD_WRITE : 0);
+	if (src && !src->dead) {
+		if (run->in.length >= MOCKSVC_IO_SIZE)
+			TEVENT_FD_NOT_READABLE(src->conn->event.fde);
+		else
+			TEVENT_FD_READABLE(src->conn->event.fde);
+	}
+}
+
+static void mocksvc_stdin_handler(struct tevent_context *ev, struct tevent_fd *fde,
+				  uint16_t flags, void *private_data)
+{
+	mocksvc_stdin_flush(talloc_get_type(private_data, struct mocksvc_run));
+}
+
+static void mocksvc_stdin(struct mocksvc_run *run, const uint8_t *data, size_t len)
+{
+	if (run->in_eof || run->fd[MOCKSVC_STDIN] == -1)
+		return;
+	if (!len) {
+		run->in_eof = 1;
+	} else if (!data_blob_append(run, &run->in, data, len)) {
+		mocksvc_abort(run);
+		return;
+	}
+	mocksvc_stdin_flush(run);
+}
+
+/* In the child: samba's sockets must not outlive their connections */
+static void mocksvc_close_fds(void)
+{
+	DIR *dir = opendir("/proc/self/fd");
+	struct dirent *de;
+	int fd;
+
+	if (!dir) {
+		for (fd = 3; fd < 1024; ++fd)
+			close(fd);
+		return;
+	}
+	while ((de = readdir(dir))) {
+		fd = atoi(de->d_name);
+		if (fd > 2 && fd != dirfd(dir))
+			close(fd);
+	}
+	closedir(dir);
+}
+
+static int mocksvc_slot_get(struct mocksvc_server *srv)
+{
+	int i;
+
+	for (i = 0; i < MOCKSVC_SLOTS; ++i)
+		if (!srv->slots[i])
+			return i;
+	return -1;
+}
+
+static void mocksvc_run_start(struct mocksvc_conn *mc, const char *cmdline)
+{
+	struct mocksvc_run *run;
+	int p[3][2], k;
+
+	run = talloc_zero(mc, struct mocksvc_run);
+	if (!run) {
+		mocksvc_terminate(mc, "mocksvc: out of memory");
+		return;
+	}
+	run->srv = mc->srv;
+	run->ctrl = mc;
+	run->framed = mc->framed;
+	run->stats = mc->stats;
+	run->slot = -1;
+	run->fd[0] = run->fd[1] = run->fd[2] = -1;
+	if (!run->framed && (run->slot = mocksvc_slot_get(mc->srv)) == -1) {
+		talloc_free(run);
+		mocksvc_printf(mc, "error Too many commands running\n");
+		return;
+	}
+	for (k = 0; k < 3; ++k) {
+		if (pipe(p[k]) == -1) {
+			mocksvc_printf(mc, "error Cannot create pipe, error 0x%08X\n", errno);
+			while (k--) {
+				close(p[k][0]);
+				close(p[k][1]);
+			}
+			talloc_free(run);
+			return;
+		}
+	}
+	run->started = timeval_current();
+	run->pid = fork();
+	if (run->pid == 0) {
+		dup2(p[0][0], 0);
+		dup2(p[1][1], 1);
+		dup2(p[2][1], 2);
+		mocksvc_close_fds();
+		signal(SIGPIPE, SIG_DFL);
+		execl("/bin/sh", "sh", "-c", cmdline, NULL);
+		_exit(127);
+	}
+	if (run->pid == -1) {
+		mocksvc_printf(mc, "error Creating process(%s) %d\n", cmdline, errno);
+		for (k = 0; k < 3; ++k) {
+			close(p[k][0]);
+			close(p[k][1]);
+		}
+		talloc_free(run);
+		return;
+	}
+	close(p[0][0]);
+	close(p[1][1]);
+	close(p[2][1]);
+	run->fd[MOCKSVC_STDIN] = p[0][1];
+	run->fd[MOCKSVC_STDOUT] = p[1][0];
+	run->fd[MOCKSVC_STDERR] = p[2][0];
+	for (k = 0; k < 3; ++k) {
+		set_blocking(run->fd[k], false);
+		/* children of later runs must not keep our ends open */
+		fcntl(run->fd[k], F_SETFD, FD_CLOEXEC);
+	}
+	DLIST_ADD(run->srv->runs, run);
+	if (run->slot != -1)
+		run->srv->slots[run->slot] = run;
+	talloc_set_destructor(run, mocksvc_run_destructor);
+	mc->run = run;
+
+	run->fde[MOCKSVC_STDIN] = tevent_add_fd(mc->conn->event.ctx, run, run->fd[MOCKSVC_STDIN],
+						0, mocksvc_stdin_handler, run);
+	for (k = MOCKSVC_STDOUT; k <= MOCKSVC_STDERR; ++k)
+		run->fde[k] = tevent_add_fd(mc->conn->event.ctx, run, run->fd[k],
+					    0, mocksvc_output_handler, run);
+	if (!run->fde[0] || !run->fde[1] || !run->fde[2]) {
+		mocksvc_terminate(mc, "mocksvc: out of memory");
+		return;
+	}
+	DEBUG(2, ("mocksvc: started process %d: %s\n", (int)run->pid, cmdline));
+	if (run->framed) {
+		mocksvc_printf(mc, CMD_FRAMED "\n");
+		mocksvc_pump(run, MOCKSVC_STDOUT);
+		mocksvc_pump(run, MOCKSVC_STDERR);
+	} else {
+		mocksvc_printf(mc, CMD_STD_IO_ERR " %08X\n", run->slot);
+	}
+}
+
+static void mocksvc_set(struct mocksvc_conn *mc, const char *line)
+{
+	if (!strncmp(line, "framed ", 7)) {
+		mc->framed = atoi(line + 7);
+	} else if (strncmp(line, "system ", 7) && strncmp(line, "implevel ", 9)
+		   && strncmp(line, "runas ", 6)) {
+		/* accepted, but commands always run as samba's user */
+		mocksvc_printf(mc, "error Unknown commad (set %s)\n", line);
+	}
+}
+
+static void mocksvc_line(struct mocksvc_conn *mc, char *line)
+{
+	DEBUG(3, ("mocksvc: retrieved line: \"%s\"\n", line));
+	if (!strcmp(line, "get version"))
+		mocksvc_printf(mc, "version 0x%04X\n", VERSION);
+	else if (!strncmp(line, "get ", 4))
+		mocksvc_printf(mc, "error Unknown argument (%s)\n", line);
+	else if (!strncmp(line, "set ", 4))
+		mocksvc_set(mc, line + 4);
+	else if (!strncmp(line, "run ", 4))
+		mocksvc_run_start(mc, line + 4);
+	else if (!strncmp(line, CMD_STATS " ", strlen(CMD_STATS) + 1))
+		mc->stats = atoi(line + strlen(CMD_STATS) + 1);
+	else
+		mocksvc_printf(mc, "error Ignoring unknown command (%s)\n", line);
+}
+
+/*
+  Consumes one unit of control pipe input: a command line before the run,
+  a frame during a framed run. Returns bytes used, 0 if more are needed,
+  -1 on protocol error.
+*/
+static ssize_t mocksvc_ctrl_parse(struct mocksvc_conn *mc, uint8_t *data, size_t len)
+{
+	struct mocksvc_run *run = mc->run;
+	uint8_t *nl;
+	uint32_t flen;
+
+	if (run && !run->framed) {
+		/* winexesvc aborts on any input while command runs */
+		mocksvc_abort(run);
+		return len;
+	}
+	if (run) {
+		if (len < FRAMED_HDR)
+			return 0;
+		flen = IVAL(data, 1);
+		if (flen > FRAMED_MAX)
+			return -1;
+		if (len < FRAMED_HDR + flen)
+			return 0;
+		if (data[0] == FRAMED_STDIN)
+			mocksvc_stdin(run, data + FRAMED_HDR, flen);
+		else if (data[0] == FRAMED_ABORT)
+			mocksvc_abort(run);
+		return FRAMED_HDR + flen;
+	}
+	nl = memchr(data, '\n', len);
+	if (!nl)
+		return len >= MOCKSVC_MAX_LINE ? -1 : 0;
+	*nl = 0;
+	mocksvc_line(mc, (char *)data);
+	return nl - data + 1;
+}
+
+static void mocksvc_ctrl_input(struct mocksvc_conn *mc)
+{
+	size_t used = 0;
+	ssize_t n;
+
+	while (!mc->dead && used < mc->in.length) {
+		n = mocksvc_ctrl_parse(mc, mc->in.data + used, mc->in.length - used);
+		if (n < 0) {
+			mocksvc_terminate(mc, "mocksvc: protocol error");
+			return;
+		}
+		if (!n)
+			break;
+		used += n;
+	}
+	memmove(mc->in.data, mc->in.data + used, mc->in.length - used);
+	mc->in.length -= used;
+}
+
+/* Client closed its end or sent data */
+static void mocksvc_recv_handler(struct stream_connection *conn, uint16_t flags)
+{
+	struct mocksvc_conn *mc = talloc_get_type(conn->private_data, struct mocksvc_conn);
+	uint8_t buf[MOCKSVC_IO_SIZE];
+	size_t nread = 0;
+	NTSTATUS status;
+
+	status = socket_recv(conn->socket, buf, sizeof(buf), &nread);
+	if (NT_STATUS_EQUAL(status, STATUS_MORE_ENTRIES))
+		return;
+	if (!NT_STATUS_IS_OK(status) || nread == 0) {
+		if (mc->kind == MOCKSVC_CTRL && mc->run)
+			mocksvc_abort(mc->run);
+		mocksvc_terminate(mc, "mocksvc: client closed pipe");
+		return;
+	}
+	switch (mc->kind) {
+	case MOCKSVC_CTRL:
+		if (!data_blob_append(mc, &mc->in, buf, nread)) {
+			mocksvc_terminate(mc, "mocksvc: out of memory");
+			return;
+		}
+		mocksvc_ctrl_input(mc);
+		break;
+	case MOCKSVC_STDIN:
+		if (mc->run)
+			mocksvc_stdin(mc->run, buf, nread);
+		break;
+	default:
+		/* nothing is expected on output pipes */
+		break;
+	}
+}
+
+static void mocksvc_send_handler(struct stream_connection *conn, uint16_t flags)
+{
+	struct mocksvc_conn *mc = talloc_get_type(conn->private_data, struct mocksvc_conn);
+	DATA_BLOB blob;
+	size_t nsent = 0;
+	NTSTATUS status;
+	int k;
+
+	blob = data_blob_const(mc->out.data + mc->out_sent, mocksvc_pending(mc));
+	status = socket_send(conn->socket, &blob, &nsent);
+	if (NT_STATUS_IS_ERR(status)) {
+		mocksvc_terminate(mc, nt_errstr(status));
+		return;
+	}
+	mc->out_sent += nsent;
+	if (mocksvc_pending(mc))
+		return;
+	TEVENT_FD_NOT_WRITEABLE(conn->event.fde);
+	data_blob_free(&mc->out);
+	mc->out_sent = 0;
+	if (mc->close_after) {
+		mocksvc_terminate(mc, "mocksvc: run finished");
+		return;
+	}
+	if (mc->shutdown_after)
+		shutdown(socket_get_fd(conn->socket), SHUT_WR);
+	if (!mc->run)
+		return;
+	if (mc->kind == MOCKSVC_CTRL) {
+		for (k = MOCKSVC_STDOUT; k <= MOCKSVC_STDERR; ++k)
+			mocksvc_pump(mc->run, k);
+	} else {
+		mocksvc_pump(mc->run, mc->kind);
+	}
+}
+
+/*
+  Stdio pipes of a slot may only be opened by the client whose control
+  connection started the run. Every pipe open carries the user and the
+  session key of the SMB session it came in on, both have to match.
+*/
+static bool mocksvc_run_owner(struct mocksvc_run *run, struct stream_connection *conn)
+{
+	struct auth_session_info *owner = run->ctrl->conn->session_info;
+	struct auth_session_info *s = conn->session_info;
+
+	if (!owner || !s || !owner->security_token || !s->security_token)
+		return false;
+	return dom_sid_equal(owner->security_token->user_sid, s->security_token->user_sid)
+		&& data_blob_cmp(&owner->session_key, &s->session_key) == 0;
+}
+
+static void mocksvc_accept(struct stream_connection *conn)
+{
+	struct mocksvc_pipe *pipe = talloc_get_type(conn->private_data, struct mocksvc_pipe);
+	struct mocksvc_conn *mc;
+	struct mocksvc_run *run = NULL;
+
+	if (pipe->kind != MOCKSVC_CTRL) {
+		run = pipe->srv->slots[pipe->slot];
+		if (!run || run->io[pipe->kind] || run->closed[pipe->kind]) {
+			stream_terminate_connection(conn, "mocksvc: no command for pipe");
+			return;
+		}
+		if (!mocksvc_run_owner(run, conn)) {
+			stream_terminate_connection(conn, "mocksvc: pipe belongs to another client");
+			return;
+		}
+	}
+	mc = talloc_zero(conn, struct mocksvc_conn);
+	if (!mc) {
+		stream_terminate_connection(conn, "mocksvc: out of memory");
+		return;
+	}
+	mc->conn = conn;
+	mc->srv = pipe->srv;
+	mc->kind = pipe->kind;
+	conn->private_data = mc;
+	talloc_set_destructor(mc, mocksvc_conn_destructor);
+	if (!run)
+		return;
+	mc->run = run;
+	run->io[mc->kind] = mc;
+	if (mc->kind == MOCKSVC_STDIN) {
+		mocksvc_stdin_flush(run);
+	} else if (run->fd[mc->kind] == -1) {
+		/* child output ended before client connected */
+		mc->shutdown_after = 1;
+		shutdown(socket_get_fd(conn->socket), SHUT_WR);
+	} else {
+		mocksvc_pump(run, mc->kind);
+	}
+}
+
+static const struct stream_server_ops mocksvc_stream_ops = {
+	.name			= "winexesvc",
+	.accept_connection	= mocksvc_accept,
+	.recv_handler		= mocksvc_recv_handler,
+	.send_handler		= mocksvc_send_handler
+};
+
+static NTSTATUS mocksvc_pipe_setup(struct mocksvc_server *srv,
+				   const struct model_ops *model_ops,
+				   enum mocksvc_kind kind, int slot,
+				   const char *name)
+{
+	struct task_server *task = srv->task;
+	struct mocksvc_pipe *pipe;
+	NTSTATUS status;
+
+	pipe = talloc(srv, struct mocksvc_pipe);
+	NT_STATUS_HAVE_NO_MEMORY(pipe);
+	pipe->srv = srv;
+	pipe->kind = kind;
+	pipe->slot = slot;
+	/* ntvfs/ipc looks pipes up by lowercased name */
+	name = strlower_talloc(pipe, name);
+	NT_STATUS_HAVE_NO_MEMORY(name);
+	status = stream_setup_named_pipe(task->event_ctx, task->lp_ctx, model_ops,
+					 &mocksvc_stream_ops, name, pipe);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(0, ("mocksvc: failed to set up pipe %s - %s\n",
+			  name, nt_errstr(status)));
+	}
+	return status;
+}
+
+/*
+  startup the winexesvc stand-in task
+*/
+static void mocksvc_task_init(struct task_server *task)
+{
+	static const char *io_names[3] = { PIPE_NAME_IN, PIPE_NAME_OUT, PIPE_NAME_ERR };
+	struct mocksvc_server *srv;
+	const struct model_ops *model_ops;
+	NTSTATUS status;
+	int slot, k;
+
+	/* all pipes of a run must be handled in the process that runs it */
+	model_ops = process_model_startup(task->event_ctx, "single");
+	if (!model_ops) {
+		DEBUG(0,("Can't find 'single' process model_ops\n"));
+		return;
+	}
+
+	task_server_set_title(task, "task[winexesvc]");
+
+	srv = talloc_zero(task, struct mocksvc_server);
+	if (srv == NULL) {
+		task_server_terminate(task, "winexesvc: out of memory", true);
+		return;
+	}
+	srv->task = task;
+
+	if (!tevent_add_signal(task->event_ctx, srv, SIGCHLD, 0, mocksvc_sigchld, srv)) {
+		task_server_terminate(task, "winexesvc: cannot handle SIGCHLD", true);
+		return;
+	}
+
+	status = mocksvc_pipe_setup(srv, model_ops, MOCKSVC_CTRL, -1, PIPE_NAME);
+	for (slot = 0; NT_STATUS_IS_OK(status) && slot < MOCKSVC_SLOTS; ++slot) {
+		for (k = 0; NT_STATUS_IS_OK(status) && k < 3; ++k) {
+			const char *name = talloc_asprintf(srv, io_names[k], slot);
+			if (!name)
+				status = NT_STATUS_NO_MEMORY;
+			else
+				status = mocksvc_pipe_setup(srv, model_ops, k, slot, name);
+		}
+	}
+	if (!NT_STATUS_IS_OK(status))
+		task_server_terminate(task, "winexesvc: cannot set up pipes", true);
+}
+
+/* called at smbd startup - register ourselves as a server service */
+NTSTATUS server_service_winexesvc_init(void)
+{
+	return register_server_service("winexesvc", mocksvc_task_init);
+}
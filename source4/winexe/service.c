@@ -9,6 +9,7 @@
 #include "libcli/resolve/resolve.h"
 #include "lib/cmdline/popt_common.h"
 #include "librpc/rpc/dcerpc.h"
+#include "librpc/rpc/dcerpc_proto.h"
 #include "librpc/gen_ndr/ndr_svcctl_c.h"
 #include "librpc/gen_ndr/ndr_security.h"
 #include "lib/events/events.h"
@@ -27,359 +28,1799 @@
 #include "system/filesys.h"
 #include "libcli/libcli.h"
 #include "libcli/smb_composite/smb_composite.h"
+#include "libcli/composite/composite.h"
+#include "libcli/raw/raw_proto.h"
+#include "libcli/smb2/smb2.h"
+#include "libcli/smb2/smb2_calls.h"
 #include "lib/util/util.h"
+#include "../lib/util/tevent_ntstatus.h"
+#include <zlib.h>
 
 #include "winexe.h"
 
-#define NT_ERR(status, lvl, args...) if (!NT_STATUS_IS_OK(status)) { DEBUG(lvl,("ERROR: " args)); DEBUG(lvl,(". %s.\n", nt_errstr(status))); return status; }
 #define NT_RES(status, werr) (NT_STATUS_IS_OK(status) ? werror_to_ntstatus(werr) : status)
+#define REQ_ERR(req, status, lvl, args...) if (!NT_STATUS_IS_OK(status)) { DEBUG(lvl,("ERROR: " args)); DEBUG(lvl,(". %s.\n", nt_errstr(status))); tevent_req_nterror(req, status); return; }
 
-NTSTATUS svc_pipe_connect(struct dcerpc_pipe **psvc_pipe,
-			  const char *hostname,
-			  struct cli_credentials *credentials)
+/* Service status polling interval, doubled after every query */
+#define SVC_WAIT_MIN_USEC 50000
+#define SVC_WAIT_MAX_USEC 1000000
+
+/* Fills in connection parameters for given share, as smbcli_full_connection does */
+struct smb_composite_connect *svc_connect_io(TALLOC_CTX *mem_ctx,
+					     const char *hostname,
+					     const char *service,
+					     struct cli_credentials *credentials)
 {
-	NTSTATUS status;
-	char *binding;
+	struct smb_composite_connect *io;
 
-	asprintf(&binding, "ncacn_np:%s%s", hostname, DEBUGLVL(9)?"[print]":"");
-	status =
-	    dcerpc_pipe_connect(NULL, psvc_pipe, binding,
-				&ndr_table_svcctl, credentials, ev_ctx, cmdline_lp_ctx);
-	free(binding);
-	return status;
+	io = talloc_zero(mem_ctx, struct smb_composite_connect);
+	if (!io)
+		return NULL;
+	io->in.dest_host = hostname;
+	io->in.dest_ports = lp_smb_ports(cmdline_lp_ctx);
+	io->in.socket_options = lp_socket_options(cmdline_lp_ctx);
+	io->in.called_name = strupper_talloc(io, hostname);
+	io->in.service = service;
+	io->in.service_type = NULL;
+	io->in.credentials = credentials;
+	io->in.fallback_to_anonymous = false;
+	io->in.workgroup = "";
+	io->in.iconv_convenience = lp_iconv_convenience(cmdline_lp_ctx);
+	io->in.gensec_settings = lp_gensec_settings(io, cmdline_lp_ctx);
+	lp_smbcli_options(cmdline_lp_ctx, &io->in.options);
+	lp_smbcli_session_options(cmdline_lp_ctx, &io->in.session_options);
+	return io;
 }
 
-NTSTATUS svc_OpenSCManager(struct dcerpc_pipe * svc_pipe,
+static struct rpc_request *svc_OpenSCManager_send(struct dcerpc_pipe * svc_pipe,
+			   TALLOC_CTX *mem_ctx,
 			   const char *hostname,
-			   struct policy_handle * pscm_handle)
+			   struct policy_handle * pscm_handle,
+			   struct svcctl_OpenSCManagerW *r)
 {
-	NTSTATUS status;
-	struct svcctl_OpenSCManagerW r;
-
-	r.in.MachineName = hostname;
-	r.in.DatabaseName = NULL;
-	r.in.access_mask = SEC_FLAG_MAXIMUM_ALLOWED;
-	r.out.handle = pscm_handle;
-	status = dcerpc_svcctl_OpenSCManagerW(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	r->in.MachineName = hostname;
+	r->in.DatabaseName = NULL;
+	r->in.access_mask = SEC_FLAG_MAXIMUM_ALLOWED;
+	r->out.handle = pscm_handle;
+	return dcerpc_svcctl_OpenSCManagerW_send(svc_pipe, mem_ctx, r);
 }
 
-NTSTATUS svc_OpenService(struct dcerpc_pipe * svc_pipe,
+static struct rpc_request *svc_OpenService_send(struct dcerpc_pipe * svc_pipe,
+			 TALLOC_CTX *mem_ctx,
 			 struct policy_handle * pscm_handle,
 			 const char *ServiceName,
-			 struct policy_handle * psvc_handle)
+			 struct policy_handle * psvc_handle,
+			 struct svcctl_OpenServiceW *r)
 {
-	NTSTATUS status;
-	struct svcctl_OpenServiceW r;
-
-	r.in.scmanager_handle = pscm_handle;
-	r.in.ServiceName = ServiceName;
-	r.in.access_mask = SERVICE_ALL_ACCESS;
-	r.out.handle = psvc_handle;
-	status = dcerpc_svcctl_OpenServiceW(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	r->in.scmanager_handle = pscm_handle;
+	r->in.ServiceName = ServiceName;
+	r->in.access_mask = SERVICE_ALL_ACCESS;
+	r->out.handle = psvc_handle;
+	return dcerpc_svcctl_OpenServiceW_send(svc_pipe, mem_ctx, r);
 }
 
-NTSTATUS svc_CreateService(struct dcerpc_pipe * svc_pipe,
+static struct rpc_request *svc_CreateService_send(struct dcerpc_pipe * svc_pipe,
+			   TALLOC_CTX *mem_ctx,
 			   struct policy_handle * pscm_handle,
 			   const char *ServiceName,
 			   uint32_t type,
 			   const char *binary_path,
-			   struct policy_handle * psvc_handle)
-{
-	NTSTATUS status;
-	struct svcctl_CreateServiceW r;
-
-	r.in.scmanager_handle = pscm_handle;
-	r.in.ServiceName = ServiceName;
-	r.in.DisplayName = NULL;
-	r.in.desired_access = SERVICE_ALL_ACCESS;
-	r.in.type = type;
-	r.in.start_type = SERVICE_DEMAND_START;
-	r.in.error_control = SERVICE_ERROR_NORMAL;
-	r.in.binary_path = binary_path;
-	r.in.LoadOrderGroupKey = NULL;
-	r.in.TagId = NULL;
-	r.in.dependencies = NULL;
-	r.in.dependencies_size = 0;
-	r.in.service_start_name = NULL;
-	r.in.password = NULL;
-	r.in.password_size = 0;
-	r.out.handle = psvc_handle;
-	r.out.TagId = NULL;
-	status = dcerpc_svcctl_CreateServiceW(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
-}
-
-NTSTATUS svc_ChangeServiceConfig(struct dcerpc_pipe * svc_pipe,
+			   struct policy_handle * psvc_handle,
+			   struct svcctl_CreateServiceW *r)
+{
+	r->in.scmanager_handle = pscm_handle;
+	r->in.ServiceName = ServiceName;
+	r->in.DisplayName = NULL;
+	r->in.desired_access = SERVICE_ALL_ACCESS;
+	r->in.type = type;
+	r->in.start_type = SERVICE_DEMAND_START;
+	r->in.error_control = SERVICE_ERROR_NORMAL;
+	r->in.binary_path = binary_path;
+	r->in.LoadOrderGroupKey = NULL;
+	r->in.TagId = NULL;
+	r->in.dependencies = NULL;
+	r->in.dependencies_size = 0;
+	r->in.service_start_name = NULL;
+	r->in.password = NULL;
+	r->in.password_size = 0;
+	r->out.handle = psvc_handle;
+	r->out.TagId = NULL;
+	return dcerpc_svcctl_CreateServiceW_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_ChangeServiceConfig_send(struct dcerpc_pipe * svc_pipe,
+			   TALLOC_CTX *mem_ctx,
                            struct policy_handle * psvc_handle,
 			   uint32_t type,
-                           const char *binary_path)
+                           const char *binary_path,
+			   struct svcctl_ChangeServiceConfigW *r)
 {
+	r->in.handle = psvc_handle;
+	r->in.type = type;
+	r->in.start_type = SERVICE_NO_CHANGE;
+	r->in.error_control = SERVICE_NO_CHANGE;
+	r->in.binary_path = binary_path;
+	r->in.load_order_group = NULL;
+	r->in.tag_id = NULL;
+	r->in.dependencies = NULL;
+	r->in.dependencies_size = 0;
+	r->in.service_start_name = NULL;
+	r->in.password = NULL;
+	r->in.password_size = 0;
+	r->in.display_name = NULL;
+	r->out.tag_id = NULL;
+	return dcerpc_svcctl_ChangeServiceConfigW_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_StartService_send(struct dcerpc_pipe * svc_pipe,
+			  TALLOC_CTX *mem_ctx,
+			  struct policy_handle * psvc_handle,
+			  struct svcctl_StartServiceW *r)
+{
+	r->in.handle = psvc_handle;
+	r->in.NumArgs = 0;
+	r->in.Arguments = NULL;
+	return dcerpc_svcctl_StartServiceW_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_ControlService_send(struct dcerpc_pipe * svc_pipe,
+			    TALLOC_CTX *mem_ctx,
+			    struct policy_handle * psvc_handle,
+			    int control, struct SERVICE_STATUS * sstatus,
+			    struct svcctl_ControlService *r)
+{
+	r->in.handle = psvc_handle;
+	r->in.control = control;
+	r->out.service_status = sstatus;
+	return dcerpc_svcctl_ControlService_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_QueryServiceStatus_send(struct dcerpc_pipe * svc_pipe,
+			    TALLOC_CTX *mem_ctx,
+			    struct policy_handle * psvc_handle,
+			    struct SERVICE_STATUS * sstatus,
+			    struct svcctl_QueryServiceStatus *r)
+{
+	r->in.handle = psvc_handle;
+	r->out.service_status = sstatus;
+	return dcerpc_svcctl_QueryServiceStatus_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_DeleteService_send(struct dcerpc_pipe * svc_pipe,
+			   TALLOC_CTX *mem_ctx,
+			   struct policy_handle * psvc_handle,
+			   struct svcctl_DeleteService *r)
+{
+	r->in.handle = psvc_handle;
+	return dcerpc_svcctl_DeleteService_send(svc_pipe, mem_ctx, r);
+}
+
+static struct rpc_request *svc_CloseServiceHandle_send(struct dcerpc_pipe * svc_pipe,
+				TALLOC_CTX *mem_ctx,
+				struct policy_handle * psvc_handle,
+				struct svcctl_CloseServiceHandle *r)
+{
+	r->in.handle = psvc_handle;
+	r->out.handle = psvc_handle;
+	return dcerpc_svcctl_CloseServiceHandle_send(svc_pipe, mem_ctx, r);
+}
+
+/* Hooks completion of rpc/smb/composite call to next step of tevent request */
+static bool svc_continue_rpc(struct tevent_req *req, struct rpc_request *rreq,
+			     void (*fn)(struct rpc_request *))
+{
+	if (tevent_req_nomem(rreq, req))
+		return false;
+	rreq->async.callback = fn;
+	rreq->async.private_data = req;
+	return true;
+}
+
+static bool svc_continue_smb(struct tevent_req *req, struct smbcli_request *sreq,
+			     void (*fn)(struct smbcli_request *))
+{
+	if (tevent_req_nomem(sreq, req))
+		return false;
+	sreq->async.fn = fn;
+	sreq->async.private_data = req;
+	return true;
+}
+
+static bool svc_continue_smb2(struct tevent_req *req, struct smb2_request *sreq,
+			      void (*fn)(struct smb2_request *))
+{
+	if (tevent_req_nomem(sreq, req))
+		return false;
+	sreq->async.fn = fn;
+	sreq->async.private_data = req;
+	return true;
+}
+
+static bool svc_continue_composite(struct tevent_req *req, struct composite_context *creq,
+				   void (*fn)(struct composite_context *))
+{
+	if (tevent_req_nomem(creq, req))
+		return false;
+	creq->async.fn = fn;
+	creq->async.private_data = req;
+	return true;
+}
+
+/*
+  Connects share as another tree of existing session
+*/
+struct svc_tcon_state {
+	struct smbcli_tree *tree;
+	union smb_tcon io;
+};
+
+static void svc_tcon_done(struct smbcli_request *sreq);
+
+static struct tevent_req *svc_tcon_send(TALLOC_CTX *mem_ctx,
+					struct tevent_context *ev_ctx,
+					struct smbcli_session *session,
+					const char *hostname,
+					const char *share)
+{
+	struct tevent_req *req;
+	struct svc_tcon_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_tcon_state);
+	if (req == NULL)
+		return NULL;
+	state->tree = smbcli_tree_init(session, state, false);
+	if (tevent_req_nomem(state->tree, req))
+		return tevent_req_post(req, ev_ctx);
+	state->io.tconx.level = RAW_TCON_TCONX;
+	state->io.tconx.in.flags = 0;
+	state->io.tconx.in.password = data_blob(NULL, 0);
+	state->io.tconx.in.path = talloc_asprintf(state, "\\\\%s\\%s", hostname, share);
+	state->io.tconx.in.device = "?????";
+	if (tevent_req_nomem(state->io.tconx.in.path, req))
+		return tevent_req_post(req, ev_ctx);
+	if (!svc_continue_smb(req, smb_raw_tcon_send(state->tree, &state->io),
+			      svc_tcon_done))
+		return tevent_req_post(req, ev_ctx);
+	return req;
+}
+
+static void svc_tcon_done(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_tcon_state *state = tevent_req_data(req, struct svc_tcon_state);
 	NTSTATUS status;
-	struct svcctl_ChangeServiceConfigW r;
 
-	r.in.handle = psvc_handle;
-	r.in.type = type;
-	r.in.start_type = SERVICE_NO_CHANGE;
-	r.in.error_control = SERVICE_NO_CHANGE;
-	r.in.binary_path = binary_path;
-	r.in.load_order_group = NULL;
-	r.in.tag_id = NULL;
-	r.in.dependencies = NULL;
-	r.in.dependencies_size = 0;
-	r.in.service_start_name = NULL;
-	r.in.password = NULL;
-	r.in.password_size = 0;
-	r.in.display_name = NULL;
-	r.out.tag_id = NULL;
-	status = dcerpc_svcctl_ChangeServiceConfigW(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	status = smb_raw_tcon_recv(sreq, state, &state->io);
+	if (tevent_req_nterror(req, status))
+		return;
+	state->tree->tid = state->io.tconx.out.tid;
+	tevent_req_done(req);
 }
 
-NTSTATUS svc_StartService(struct dcerpc_pipe * svc_pipe,
-			  struct policy_handle * psvc_handle)
+static NTSTATUS svc_tcon_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx,
+			      struct smbcli_tree **tree)
 {
+	struct svc_tcon_state *state = tevent_req_data(req, struct svc_tcon_state);
 	NTSTATUS status;
-	struct svcctl_StartServiceW r;
 
-	r.in.handle = psvc_handle;
-	r.in.NumArgs = 0;
-	r.in.Arguments = NULL;
-	status = dcerpc_svcctl_StartServiceW(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	*tree = talloc_steal(mem_ctx, state->tree);
+	return NT_STATUS_OK;
 }
 
-NTSTATUS svc_ControlService(struct dcerpc_pipe * svc_pipe,
-			    struct policy_handle * psvc_handle,
-			    int control, struct SERVICE_STATUS * sstatus)
+static void svc_tdis_done(struct smbcli_request *sreq)
+{
+	smbcli_request_destroy(sreq);
+}
+
+/* Disconnects and frees tree, reply is not waited for */
+static void svc_tree_release(struct smbcli_tree *tree)
 {
+	struct smbcli_request *sreq;
+
+	sreq = smbcli_request_setup(tree, SMBtdis, 0, 0);
+	if (sreq && smbcli_request_send(sreq)) {
+		sreq->async.fn = svc_tdis_done;
+	} else if (sreq) {
+		smbcli_request_destroy(sreq);
+	}
+	talloc_free(tree);
+}
+
+/*
+  SMB2 counterpart of svc_tcon_send
+*/
+struct svc_tcon2_state {
+	struct smb2_tree *tree;
+	struct smb2_tree_connect io;
+};
+
+static void svc_tcon2_done(struct smb2_request *sreq);
+
+static struct tevent_req *svc_tcon2_send(TALLOC_CTX *mem_ctx,
+					 struct tevent_context *ev_ctx,
+					 struct smb2_session *session,
+					 const char *hostname,
+					 const char *share)
+{
+	struct tevent_req *req;
+	struct svc_tcon2_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_tcon2_state);
+	if (req == NULL)
+		return NULL;
+	state->tree = smb2_tree_init(session, state, false);
+	if (tevent_req_nomem(state->tree, req))
+		return tevent_req_post(req, ev_ctx);
+	state->io.in.path = talloc_asprintf(state, "\\\\%s\\%s", hostname, share);
+	if (tevent_req_nomem(state->io.in.path, req))
+		return tevent_req_post(req, ev_ctx);
+	if (!svc_continue_smb2(req, smb2_tree_connect_send(state->tree, &state->io),
+			       svc_tcon2_done))
+		return tevent_req_post(req, ev_ctx);
+	return req;
+}
+
+static void svc_tcon2_done(struct smb2_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_tcon2_state *state = tevent_req_data(req, struct svc_tcon2_state);
 	NTSTATUS status;
-	struct svcctl_ControlService r;
 
-	r.in.handle = psvc_handle;
-	r.in.control = control;
-	r.out.service_status = sstatus;
-	status = dcerpc_svcctl_ControlService(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	status = smb2_tree_connect_recv(sreq, &state->io);
+	if (tevent_req_nterror(req, status))
+		return;
+	state->tree->tid = state->io.out.tid;
+	tevent_req_done(req);
 }
 
-NTSTATUS svc_QueryServiceStatus(struct dcerpc_pipe * svc_pipe,
-			    struct policy_handle * psvc_handle,
-			    struct SERVICE_STATUS * sstatus)
+static NTSTATUS svc_tcon2_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx,
+			       struct smb2_tree **tree)
 {
+	struct svc_tcon2_state *state = tevent_req_data(req, struct svc_tcon2_state);
 	NTSTATUS status;
-	struct svcctl_QueryServiceStatus r;
 
-	r.in.handle = psvc_handle;
-	r.out.service_status = sstatus;
-	status = dcerpc_svcctl_QueryServiceStatus(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	*tree = talloc_steal(mem_ctx, state->tree);
+	return NT_STATUS_OK;
+}
+
+static void svc_tdis2_done(struct smb2_request *sreq)
+{
+	smb2_request_destroy(sreq);
+}
+
+static void svc_tree2_release(struct smb2_tree *tree)
+{
+	struct smb2_request *sreq;
+
+	sreq = smb2_tdis_send(tree);
+	if (sreq)
+		sreq->async.fn = svc_tdis2_done;
+	talloc_free(tree);
+}
+
+/*
+  Starts related compound on tree, following requests refer to the file
+  created by the first one with handle returned by svc_compound2_handle
+*/
+static void svc_compound2_start(struct smb2_tree *tree, int num)
+{
+	smb2_transport_compound_start(tree->session->transport, num);
 }
 
-NTSTATUS svc_DeleteService(struct dcerpc_pipe * svc_pipe,
-			   struct policy_handle * psvc_handle)
+static void svc_compound2_related(struct smb2_tree *tree, bool related)
 {
+	smb2_transport_compound_set_related(tree->session->transport, related);
+}
+
+static struct smb2_handle svc_compound2_handle(void)
+{
+	struct smb2_handle h;
+
+	h.data[0] = UINT64_MAX;
+	h.data[1] = UINT64_MAX;
+	return h;
+}
+
+/*
+  Opens and closes file on SMB2 tree in one compound, this stands in for
+  the SMB1 open probe, chkpath and (with delete on close) unlink
+*/
+struct svc_open2_state {
+	int chained;
 	NTSTATUS status;
-	struct svcctl_DeleteService r;
+	struct smb2_create io_create;
+	struct smb2_close io_close;
+};
+
+static void svc_open2_created(struct smb2_request *sreq);
+static void svc_open2_closed(struct smb2_request *sreq);
+
+static struct tevent_req *svc_open2_send(TALLOC_CTX *mem_ctx,
+					 struct tevent_context *ev_ctx,
+					 struct smb2_tree *tree,
+					 const char *fname,
+					 uint32_t access,
+					 uint32_t options)
+{
+	struct tevent_req *req;
+	struct svc_open2_state *state;
+	bool ok;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_open2_state);
+	if (req == NULL)
+		return NULL;
+	state->io_create.in.desired_access = access;
+	state->io_create.in.share_access = NTCREATEX_SHARE_ACCESS_READ |
+		NTCREATEX_SHARE_ACCESS_WRITE | NTCREATEX_SHARE_ACCESS_DELETE;
+	state->io_create.in.create_disposition = NTCREATEX_DISP_OPEN;
+	state->io_create.in.create_options = options;
+	state->io_create.in.impersonation_level = NTCREATEX_IMPERSONATION_IMPERSONATION;
+	state->io_create.in.fname = fname;
+	state->io_close.in.file.handle = svc_compound2_handle();
+	state->chained = 2;
+	svc_compound2_start(tree, 2);
+	ok = svc_continue_smb2(req, smb2_create_send(tree, &state->io_create),
+			       svc_open2_created);
+	svc_compound2_related(tree, true);
+	ok = ok && svc_continue_smb2(req, smb2_close_send(tree, &state->io_close),
+				     svc_open2_closed);
+	svc_compound2_related(tree, false);
+	if (!ok) {
+		svc_compound2_start(tree, 0);
+		return tevent_req_post(req, ev_ctx);
+	}
+	return req;
+}
+
+/* Request is finished only when last reply of the chain is in */
+static void svc_open2_chain_done(struct tevent_req *req, NTSTATUS status)
+{
+	struct svc_open2_state *state = tevent_req_data(req, struct svc_open2_state);
+
+	if (NT_STATUS_IS_OK(state->status))
+		state->status = status;
+	if (--state->chained)
+		return;
+	if (tevent_req_nterror(req, state->status))
+		return;
+	tevent_req_done(req);
+}
 
-	r.in.handle = psvc_handle;
-	status = dcerpc_svcctl_DeleteService(svc_pipe, NULL, &r);
-	return NT_RES(status, r.out.result);
+static void svc_open2_created(struct smb2_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_open2_state *state = tevent_req_data(req, struct svc_open2_state);
+
+	svc_open2_chain_done(req, smb2_create_recv(sreq, state, &state->io_create));
 }
 
-NTSTATUS svc_CloseServiceHandle(struct dcerpc_pipe * svc_pipe,
-				struct policy_handle * psvc_handle)
+static void svc_open2_closed(struct smb2_request *sreq)
 {
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_open2_state *state = tevent_req_data(req, struct svc_open2_state);
+
+	svc_open2_chain_done(req, smb2_close_recv(sreq, &state->io_close));
+}
+
+static NTSTATUS svc_open2_recv(struct tevent_req *req)
+{
+	return tevent_req_simple_recv_ntstatus(req);
+}
+
+/*
+  Writes buffer to new file on SMB2 tree, as smb_composite_savefile does.
+  Create, first write and (if all data fit in it) close go in one compound.
+*/
+struct svc_save2_state {
+	struct smb2_tree *tree;
+	const uint8_t *data;
+	uint32_t size;
+	uint32_t offset;
+	int chained;
+	int closing;
 	NTSTATUS status;
-	struct svcctl_CloseServiceHandle r;
+	struct smb2_create io_create;
+	struct smb2_write io_write;
+	struct smb2_close io_close;
+};
+
+static void svc_save2_created(struct smb2_request *sreq);
+static void svc_save2_write(struct tevent_req *req);
+static void svc_save2_written(struct smb2_request *sreq);
+static void svc_save2_closed(struct smb2_request *sreq);
 
-	r.in.handle = psvc_handle;
-	r.out.handle = psvc_handle;
-	status = dcerpc_svcctl_CloseServiceHandle(svc_pipe, NULL, &r);
-	return status;
+static struct tevent_req *svc_save2_send(TALLOC_CTX *mem_ctx,
+					 struct tevent_context *ev_ctx,
+					 struct smb2_tree *tree,
+					 const char *fname,
+					 const uint8_t *data,
+					 uint32_t size)
+{
+	struct tevent_req *req;
+	struct svc_save2_state *state;
+	uint32_t n = MIN(size, ASYNC_SMB2_MAX_IO);
+	bool ok;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_save2_state);
+	if (req == NULL)
+		return NULL;
+	state->tree = tree;
+	state->data = data;
+	state->size = size;
+	state->io_create.in.desired_access = SEC_FILE_WRITE_DATA | SEC_FILE_WRITE_ATTRIBUTE;
+	state->io_create.in.share_access = NTCREATEX_SHARE_ACCESS_READ | NTCREATEX_SHARE_ACCESS_WRITE;
+	state->io_create.in.create_disposition = NTCREATEX_DISP_OVERWRITE_IF;
+	state->io_create.in.create_options = NTCREATEX_OPTIONS_NON_DIRECTORY_FILE;
+	state->io_create.in.impersonation_level = NTCREATEX_IMPERSONATION_IMPERSONATION;
+	state->io_create.in.fname = fname;
+	state->io_write.in.file.handle = svc_compound2_handle();
+	state->io_write.in.offset = 0;
+	state->io_write.in.data = data_blob_const(data, n);
+	state->io_close.in.file.handle = svc_compound2_handle();
+	state->closing = (n == size);
+	state->chained = state->closing ? 3 : 2;
+	svc_compound2_start(tree, state->chained);
+	ok = svc_continue_smb2(req, smb2_create_send(tree, &state->io_create),
+			       svc_save2_created);
+	svc_compound2_related(tree, true);
+	ok = ok && svc_continue_smb2(req, smb2_write_send(tree, &state->io_write),
+				     svc_save2_written);
+	if (state->closing)
+		ok = ok && svc_continue_smb2(req, smb2_close_send(tree, &state->io_close),
+					     svc_save2_closed);
+	svc_compound2_related(tree, false);
+	if (!ok) {
+		svc_compound2_start(tree, 0);
+		return tevent_req_post(req, ev_ctx);
+	}
+	return req;
 }
 
-NTSTATUS svc_UploadService(const char *hostname,
-			   struct cli_credentials * credentials, int flags)
+/* Continues with remaining data once all replies to the compound are in */
+static void svc_save2_chain_done(struct tevent_req *req, NTSTATUS status)
 {
-	struct smb_composite_savefile *io;
-	struct smbcli_state *cli;
+	struct svc_save2_state *state = tevent_req_data(req, struct svc_save2_state);
+
+	if (NT_STATUS_IS_OK(state->status))
+		state->status = status;
+	if (--state->chained)
+		return;
+	if (tevent_req_nterror(req, state->status))
+		return;
+	if (state->closing) {
+		tevent_req_done(req);
+		return;
+	}
+	state->io_write.in.file.handle = state->io_create.out.file.handle;
+	state->io_close.in.file.handle = state->io_create.out.file.handle;
+	svc_save2_write(req);
+}
+
+static void svc_save2_created(struct smb2_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_save2_state *state = tevent_req_data(req, struct svc_save2_state);
+
+	svc_save2_chain_done(req, smb2_create_recv(sreq, state, &state->io_create));
+}
+
+static void svc_save2_write(struct tevent_req *req)
+{
+	struct svc_save2_state *state = tevent_req_data(req, struct svc_save2_state);
+
+	if (state->offset >= state->size) {
+		state->closing = 1;
+		svc_continue_smb2(req, smb2_close_send(state->tree, &state->io_close),
+				  svc_save2_closed);
+		return;
+	}
+	state->io_write.in.offset = state->offset;
+	state->io_write.in.data = data_blob_const(state->data + state->offset,
+			MIN(state->size - state->offset, ASYNC_SMB2_MAX_IO));
+	svc_continue_smb2(req, smb2_write_send(state->tree, &state->io_write),
+			  svc_save2_written);
+}
+
+static void svc_save2_written(struct smb2_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_save2_state *state = tevent_req_data(req, struct svc_save2_state);
 	NTSTATUS status;
-	struct smbcli_options options;
-	struct smbcli_session_options session_options;
 
-	lp_smbcli_options(cmdline_lp_ctx, &options);
-	lp_smbcli_session_options(cmdline_lp_ctx, &session_options);
+	status = smb2_write_recv(sreq, &state->io_write);
+	if (NT_STATUS_IS_OK(status) && state->io_write.out.nwritten == 0)
+		status = NT_STATUS_DISK_FULL;
+	if (NT_STATUS_IS_OK(status))
+		state->offset += state->io_write.out.nwritten;
+	if (state->chained) {
+		svc_save2_chain_done(req, status);
+		return;
+	}
+	if (tevent_req_nterror(req, status))
+		return;
+	svc_save2_write(req);
+}
 
-	status =
-	    smbcli_full_connection(NULL, &cli, hostname, lp_smb_ports(cmdline_lp_ctx), "ADMIN$", NULL,
-				   lp_socket_options(cmdline_lp_ctx), credentials, lp_resolve_context(cmdline_lp_ctx), ev_ctx, &options, &session_options, lp_iconv_convenience(cmdline_lp_ctx), lp_gensec_settings(NULL, cmdline_lp_ctx));
-	NT_ERR(status, 1, "Failed to open ADMIN$ share");
-	if (flags & SVC_FORCE_UPLOAD) {
-		smbcli_unlink(cli->tree, "winexesvc.exe");
-	} else {
-		int fd = smbcli_open(cli->tree, "winexesvc.exe", O_RDONLY, DENY_NONE);
-		if (fd >= 0) {
-			smbcli_close(cli->tree, fd);
-			return status;
+static void svc_save2_closed(struct smb2_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_save2_state *state = tevent_req_data(req, struct svc_save2_state);
+	NTSTATUS status;
+
+	status = smb2_close_recv(sreq, &state->io_close);
+	if (state->chained) {
+		svc_save2_chain_done(req, status);
+		return;
+	}
+	if (tevent_req_nterror(req, status))
+		return;
+	tevent_req_done(req);
+}
+
+static NTSTATUS svc_save2_recv(struct tevent_req *req)
+{
+	return tevent_req_simple_recv_ntstatus(req);
+}
+
+/*
+  Opens svcctl pipe on IPC$ tree of existing session and binds to it
+*/
+struct svc_pipe_state {
+	struct dcerpc_pipe *pipe;
+};
+
+static void svc_pipe_opened(struct composite_context *creq);
+static void svc_pipe_opened2(struct composite_context *creq);
+static void svc_pipe_bound(struct composite_context *creq);
+
+/* Exactly one of ipc and ipc2 is set */
+static struct tevent_req *svc_pipe_send(TALLOC_CTX *mem_ctx,
+					struct tevent_context *ev_ctx,
+					struct smbcli_tree *ipc,
+					struct smb2_tree *ipc2)
+{
+	struct tevent_req *req;
+	struct svc_pipe_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_pipe_state);
+	if (req == NULL)
+		return NULL;
+	state->pipe = dcerpc_pipe_init(state, ev_ctx, lp_iconv_convenience(cmdline_lp_ctx));
+	if (tevent_req_nomem(state->pipe, req))
+		return tevent_req_post(req, ev_ctx);
+	if (DEBUGLVL(9))
+		state->pipe->conn->flags |= DCERPC_DEBUG_PRINT_BOTH;
+	if (ipc2) {
+		if (!svc_continue_composite(req, dcerpc_pipe_open_smb2_send(state->pipe, ipc2, "\\pipe\\svcctl"),
+					    svc_pipe_opened2))
+			return tevent_req_post(req, ev_ctx);
+		return req;
+	}
+	if (!svc_continue_composite(req, dcerpc_pipe_open_smb_send(state->pipe, ipc, "\\pipe\\svcctl"),
+				    svc_pipe_opened))
+		return tevent_req_post(req, ev_ctx);
+	return req;
+}
+
+static void svc_pipe_opened(struct composite_context *creq)
+{
+	struct tevent_req *req = talloc_get_type(creq->async.private_data, struct tevent_req);
+	struct svc_pipe_state *state = tevent_req_data(req, struct svc_pipe_state);
+	NTSTATUS status;
+
+	status = dcerpc_pipe_open_smb_recv(creq);
+	if (tevent_req_nterror(req, status))
+		return;
+	svc_continue_composite(req, dcerpc_bind_auth_none_send(state, state->pipe, &ndr_table_svcctl),
+			       svc_pipe_bound);
+}
+
+static void svc_pipe_opened2(struct composite_context *creq)
+{
+	struct tevent_req *req = talloc_get_type(creq->async.private_data, struct tevent_req);
+	struct svc_pipe_state *state = tevent_req_data(req, struct svc_pipe_state);
+	NTSTATUS status;
+
+	status = dcerpc_pipe_open_smb2_recv(creq);
+	if (tevent_req_nterror(req, status))
+		return;
+	svc_continue_composite(req, dcerpc_bind_auth_none_send(state, state->pipe, &ndr_table_svcctl),
+			       svc_pipe_bound);
+}
+
+static void svc_pipe_bound(struct composite_context *creq)
+{
+	struct tevent_req *req = talloc_get_type(creq->async.private_data, struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_bind_auth_none_recv(creq);
+	if (tevent_req_nterror(req, status))
+		return;
+	tevent_req_done(req);
+}
+
+static NTSTATUS svc_pipe_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx,
+			      struct dcerpc_pipe **pipe)
+{
+	struct svc_pipe_state *state = tevent_req_data(req, struct svc_pipe_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	*pipe = talloc_steal(mem_ctx, state->pipe);
+	return NT_STATUS_OK;
+}
+
+/*
+  Waits until service leaves pending state, polling it with increasing delay
+*/
+struct svc_wait_state {
+	struct tevent_context *ev_ctx;
+	struct dcerpc_pipe *svc_pipe;
+	struct policy_handle *svc_handle;
+	uint32_t pending;
+	uint32_t delay;
+	struct svcctl_QueryServiceStatus r;
+	struct SERVICE_STATUS s;
+};
+
+static void svc_wait_wakeup(struct tevent_req *subreq);
+static void svc_wait_queried(struct rpc_request *rreq);
+
+static struct tevent_req *svc_wait_send(TALLOC_CTX *mem_ctx,
+					struct tevent_context *ev_ctx,
+					struct dcerpc_pipe *svc_pipe,
+					struct policy_handle *svc_handle,
+					uint32_t pending)
+{
+	struct tevent_req *req, *subreq;
+	struct svc_wait_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_wait_state);
+	if (req == NULL)
+		return NULL;
+	state->ev_ctx = ev_ctx;
+	state->svc_pipe = svc_pipe;
+	state->svc_handle = svc_handle;
+	state->pending = pending;
+	state->delay = SVC_WAIT_MIN_USEC;
+
+	subreq = tevent_wakeup_send(state, ev_ctx, timeval_current_ofs(0, state->delay));
+	if (tevent_req_nomem(subreq, req))
+		return tevent_req_post(req, ev_ctx);
+	tevent_req_set_callback(subreq, svc_wait_wakeup, req);
+	return req;
+}
+
+static void svc_wait_wakeup(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_wait_state *state = tevent_req_data(req, struct svc_wait_state);
+
+	tevent_wakeup_recv(subreq);
+	TALLOC_FREE(subreq);
+	svc_continue_rpc(req, svc_QueryServiceStatus_send(state->svc_pipe, state,
+				state->svc_handle, &state->s, &state->r),
+			 svc_wait_queried);
+}
+
+static void svc_wait_queried(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_wait_state *state = tevent_req_data(req, struct svc_wait_state);
+	struct tevent_req *subreq;
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r.out.result);
+	REQ_ERR(req, status, 1, "QueryServiceStatus failed");
+	if (state->s.state != state->pending) {
+		tevent_req_done(req);
+		return;
+	}
+	state->delay = MIN(state->delay * 2, SVC_WAIT_MAX_USEC);
+	subreq = tevent_wakeup_send(state, state->ev_ctx, timeval_current_ofs(0, state->delay));
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_wait_wakeup, req);
+}
+
+static NTSTATUS svc_wait_recv(struct tevent_req *req, struct SERVICE_STATUS *s)
+{
+	struct svc_wait_state *state = tevent_req_data(req, struct svc_wait_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	*s = state->s;
+	return NT_STATUS_OK;
+}
+
+/*
+  Embedded service binaries are zlib compressed, 64bit one with 32bit one
+  as preset dictionary. They are inflated on first use and kept for the
+  life of the process, so hosts not needing an upload never pay for it.
+*/
+const uint8_t *svc_binary(int os64bit, uint32_t *len)
+{
+	static uint8_t *bin[2];
+	const uint8_t *dict = NULL;
+	uint32_t dict_len = 0;
+	z_stream zs;
+	int ret;
+
+	os64bit = os64bit ? 1 : 0;
+	*len = os64bit ? winexesvc64_exe_len : winexesvc32_exe_len;
+	if (bin[os64bit])
+		return bin[os64bit];
+	if (os64bit && !(dict = svc_binary(0, &dict_len)))
+		return NULL;
+	bin[os64bit] = talloc_size(talloc_autofree_context(), *len);
+	if (!bin[os64bit])
+		return NULL;
+
+	ZERO_STRUCT(zs);
+	if (inflateInit(&zs) != Z_OK)
+		goto failed;
+	zs.next_in = os64bit ? winexesvc64_exe_z : winexesvc32_exe_z;
+	zs.avail_in = os64bit ? winexesvc64_exe_zlen : winexesvc32_exe_zlen;
+	zs.next_out = bin[os64bit];
+	zs.avail_out = *len;
+	ret = inflate(&zs, Z_FINISH);
+	if (ret == Z_NEED_DICT && dict) {
+		if (inflateSetDictionary(&zs, dict, dict_len) != Z_OK) {
+			inflateEnd(&zs);
+			goto failed;
 		}
+		ret = inflate(&zs, Z_FINISH);
 	}
-	io = talloc_zero(cli->tree, struct smb_composite_savefile);
-	io->in.fname = "winexesvc.exe";
-	if (flags & SVC_OSCHOOSE) {
-	    status = smbcli_chkpath(cli->tree, "SysWoW64");
+	inflateEnd(&zs);
+	if (ret != Z_STREAM_END || zs.total_out != *len)
+		goto failed;
+	return bin[os64bit];
+      failed:
+	DEBUG(0, ("ERROR: Embedded winexesvc%d.exe is corrupted\n", os64bit ? 64 : 32));
+	TALLOC_FREE(bin[os64bit]);
+	return NULL;
+}
+
+struct svc_upload_state {
+	struct winexe_trace *trace;
+	int flags;
+	int os64bit;
+	struct tevent_context *ev_ctx;
+	struct smbcli_tree *tree;
+	struct smb2_tree *tree2;
+	union smb_open io_open;
+	union smb_close io_close;
+	union smb_unlink io_unlink;
+	union smb_chkpath io_chkpath;
+	struct smb_composite_savefile_window io_save;
+};
+
+static void svc_upload_connected(struct tevent_req *subreq);
+static void svc_upload_connected2(struct tevent_req *subreq);
+static void svc_upload_unlinked2(struct tevent_req *subreq);
+static void svc_upload_probed2(struct tevent_req *subreq);
+static void svc_upload_checked2(struct tevent_req *subreq);
+static void svc_upload_saved2(struct tevent_req *subreq);
+static void svc_upload_unlinked(struct smbcli_request *sreq);
+static void svc_upload_probed(struct smbcli_request *sreq);
+static void svc_upload_closed(struct smbcli_request *sreq);
+static void svc_upload_checked(struct smbcli_request *sreq);
+static void svc_upload_save(struct tevent_req *req, int os64bit);
+static void svc_upload_saved(struct composite_context *creq);
+
+/*
+  Uploads winexesvc.exe to ADMIN$ share, unless it is already there.
+  Exactly one of session and session2 is set.
+*/
+static struct tevent_req *svc_upload_send(TALLOC_CTX *mem_ctx,
+					  struct tevent_context *ev_ctx,
+					  struct smbcli_session *session,
+					  struct smb2_session *session2,
+					  const char *hostname,
+					  int flags,
+					  struct winexe_trace *trace)
+{
+	struct tevent_req *req, *subreq;
+	struct svc_upload_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_upload_state);
+	if (req == NULL)
+		return NULL;
+	state->ev_ctx = ev_ctx;
+	state->flags = flags;
+	state->os64bit = -1;
+	state->trace = trace;
+	if (session2) {
+		subreq = svc_tcon2_send(state, ev_ctx, session2, hostname, "ADMIN$");
+		if (tevent_req_nomem(subreq, req))
+			return tevent_req_post(req, ev_ctx);
+		tevent_req_set_callback(subreq, svc_upload_connected2, req);
+		return req;
 	}
-	if ((flags & SVC_OSCHOOSE && NT_STATUS_IS_OK(status)) || (flags & SVC_OS64BIT)) {
-		DEBUG(1, ("svc_UploadService: Installing 64bit winexesvc.exe\n"));
-		io->in.data = winexesvc64_exe;
-		io->in.size = winexesvc64_exe_len;
-	} else {
-		DEBUG(1, ("svc_UploadService: Installing 32bit winexesvc.exe\n"));
-		io->in.data = winexesvc32_exe;
-		io->in.size = winexesvc32_exe_len;
+	subreq = svc_tcon_send(state, ev_ctx, session, hostname, "ADMIN$");
+	if (tevent_req_nomem(subreq, req))
+		return tevent_req_post(req, ev_ctx);
+	tevent_req_set_callback(subreq, svc_upload_connected, req);
+	return req;
+}
+
+static void svc_upload_connected2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = svc_tcon2_recv(subreq, state, &state->tree2);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Failed to open ADMIN$ share");
+	trace_mark(state->trace, "admin_share_connected");
+	if (state->flags & SVC_FORCE_UPLOAD) {
+		subreq = svc_open2_send(state, state->ev_ctx, state->tree2, "winexesvc.exe",
+					SEC_STD_DELETE, NTCREATEX_OPTIONS_DELETE_ON_CLOSE);
+		if (tevent_req_nomem(subreq, req))
+			return;
+		tevent_req_set_callback(subreq, svc_upload_unlinked2, req);
+		return;
 	}
-	status = smb_composite_savefile(cli->tree, io);
-	NT_ERR(status, 1, "Failed to save ADMIN$/%s", io->in.fname);
-	talloc_free(io);
-	smbcli_tdis(cli);
-	return status;
+	subreq = svc_open2_send(state, state->ev_ctx, state->tree2, "winexesvc.exe",
+				SEC_FILE_READ_ATTRIBUTE, NTCREATEX_OPTIONS_NON_DIRECTORY_FILE);
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_upload_probed2, req);
 }
 
-/* Start, Creates, Install service if necccesary */
-NTSTATUS svc_install(const char *hostname,
-		     struct cli_credentials * credentials, int flags)
+static void svc_upload_connected(struct tevent_req *subreq)
 {
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = svc_tcon_recv(subreq, state, &state->tree);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Failed to open ADMIN$ share");
+	trace_mark(state->trace, "admin_share_connected");
+	if (state->flags & SVC_FORCE_UPLOAD) {
+		state->io_unlink.unlink.in.pattern = "winexesvc.exe";
+		state->io_unlink.unlink.in.attrib = FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_DIRECTORY;
+		svc_continue_smb(req, smb_raw_unlink_send(state->tree, &state->io_unlink),
+				 svc_upload_unlinked);
+		return;
+	}
+	state->io_open.openx.level = RAW_OPEN_OPENX;
+	state->io_open.openx.in.flags = 0;
+	state->io_open.openx.in.open_mode = DENY_NONE << OPENX_MODE_DENY_SHIFT;
+	state->io_open.openx.in.search_attrs = FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN;
+	state->io_open.openx.in.file_attrs = 0;
+	state->io_open.openx.in.write_time = 0;
+	state->io_open.openx.in.open_func = OPENX_OPEN_FUNC_OPEN;
+	state->io_open.openx.in.size = 0;
+	state->io_open.openx.in.timeout = 0;
+	state->io_open.openx.in.fname = "winexesvc.exe";
+	svc_continue_smb(req, smb_raw_open_send(state->tree, &state->io_open),
+			 svc_upload_probed);
+}
+
+static void svc_upload_check_arch(struct tevent_req *req)
+{
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+
+	if ((state->flags & SVC_OSCHOOSE) && state->tree2) {
+		struct tevent_req *subreq;
+
+		subreq = svc_open2_send(state, state->ev_ctx, state->tree2, "SysWoW64",
+					SEC_FILE_READ_ATTRIBUTE, NTCREATEX_OPTIONS_DIRECTORY);
+		if (tevent_req_nomem(subreq, req))
+			return;
+		tevent_req_set_callback(subreq, svc_upload_checked2, req);
+		return;
+	}
+	if (state->flags & SVC_OSCHOOSE) {
+		state->io_chkpath.chkpath.in.path = "SysWoW64";
+		svc_continue_smb(req, smb_raw_chkpath_send(state->tree, &state->io_chkpath),
+				 svc_upload_checked);
+		return;
+	}
+	svc_upload_save(req, state->flags & SVC_OS64BIT);
+}
+
+static void svc_upload_unlinked(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+
+	smbcli_request_simple_recv(sreq);
+	svc_upload_check_arch(req);
+}
+
+static void svc_upload_unlinked2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+
+	svc_open2_recv(subreq);
+	TALLOC_FREE(subreq);
+	svc_upload_check_arch(req);
+}
+
+static void svc_upload_probed2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = svc_open2_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (!NT_STATUS_IS_OK(status)) {
+		svc_upload_check_arch(req);
+		return;
+	}
+	trace_mark(state->trace, "svc_binary_present");
+	svc_tree2_release(state->tree2);
+	state->tree2 = NULL;
+	tevent_req_done(req);
+}
+
+static void svc_upload_checked2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = svc_open2_recv(subreq);
+	TALLOC_FREE(subreq);
+	svc_upload_save(req, NT_STATUS_IS_OK(status) || (state->flags & SVC_OS64BIT));
+}
+
+static void svc_upload_probed(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = smb_raw_open_recv(sreq, state, &state->io_open);
+	if (!NT_STATUS_IS_OK(status)) {
+		svc_upload_check_arch(req);
+		return;
+	}
+	state->io_close.close.level = RAW_CLOSE_CLOSE;
+	state->io_close.close.in.file.fnum = state->io_open.openx.out.file.fnum;
+	state->io_close.close.in.write_time = 0;
+	svc_continue_smb(req, smb_raw_close_send(state->tree, &state->io_close),
+			 svc_upload_closed);
+}
+
+static void svc_upload_closed(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+
+	smbcli_request_simple_recv(sreq);
+	trace_mark(state->trace, "svc_binary_present");
+	svc_tree_release(state->tree);
+	state->tree = NULL;
+	tevent_req_done(req);
+}
+
+static void svc_upload_checked(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = smbcli_request_simple_recv(sreq);
+	svc_upload_save(req, NT_STATUS_IS_OK(status) || (state->flags & SVC_OS64BIT));
+}
+
+static void svc_upload_save(struct tevent_req *req, int os64bit)
+{
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+
+	state->io_save.in.fname = "winexesvc.exe";
+	state->os64bit = os64bit ? 1 : 0;
+	DEBUG(1, ("svc_UploadService: Installing %dbit winexesvc.exe\n", os64bit ? 64 : 32));
+	state->io_save.in.data = svc_binary(os64bit, &state->io_save.in.size);
+	if (!state->io_save.in.data) {
+		tevent_req_nterror(req, NT_STATUS_INTERNAL_ERROR);
+		return;
+	}
+	if (state->tree2) {
+		struct tevent_req *subreq;
+
+		subreq = svc_save2_send(state, state->ev_ctx, state->tree2, state->io_save.in.fname,
+					state->io_save.in.data, state->io_save.in.size);
+		if (tevent_req_nomem(subreq, req))
+			return;
+		tevent_req_set_callback(subreq, svc_upload_saved2, req);
+		return;
+	}
+	/* several WRITEX in flight instead of one round trip per chunk */
+	svc_continue_composite(req, smb_composite_savefile_window_send(state->tree, &state->io_save),
+			       svc_upload_saved);
+}
+
+static void svc_upload_saved(struct composite_context *creq)
+{
+	struct tevent_req *req = talloc_get_type(creq->async.private_data, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = smb_composite_savefile_window_recv(creq);
+	REQ_ERR(req, status, 1, "Failed to save ADMIN$/%s", state->io_save.in.fname);
+	trace_mark(state->trace, "svc_uploaded");
+	svc_tree_release(state->tree);
+	state->tree = NULL;
+	tevent_req_done(req);
+}
+
+static void svc_upload_saved2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	status = svc_save2_recv(subreq);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Failed to save ADMIN$/%s", state->io_save.in.fname);
+	trace_mark(state->trace, "svc_uploaded");
+	svc_tree2_release(state->tree2);
+	state->tree2 = NULL;
+	tevent_req_done(req);
+}
+
+/* os64bit is set to flavour of uploaded binary, -1 if nothing was uploaded */
+static NTSTATUS svc_upload_recv(struct tevent_req *req, int *os64bit)
+{
+	struct svc_upload_state *state = tevent_req_data(req, struct svc_upload_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	*os64bit = state->os64bit;
+	return NT_STATUS_OK;
+}
+
+/*
+  Start, Creates, Install service if necccesary
+*/
+struct svc_install_state {
+	struct tevent_context *ev_ctx;
+	struct winexe_trace *trace;
+	struct smbcli_tree *ipc;
+	struct smb2_tree *ipc2;
+	const char *hostname;
+	int flags;
+	int os64bit;
+	int need_start;
+	int pending;
 	NTSTATUS status;
 	struct dcerpc_pipe *svc_pipe;
 	struct policy_handle scm_handle;
 	struct policy_handle svc_handle;
-	int need_start;
+	struct SERVICE_STATUS s;
+	struct svcctl_OpenSCManagerW r_open_scm;
+	struct svcctl_OpenServiceW r_open_svc;
+	struct svcctl_CreateServiceW r_create;
+	struct svcctl_QueryServiceStatus r_query;
+	struct svcctl_ControlService r_control;
+	struct svcctl_ChangeServiceConfigW r_change;
+	struct svcctl_StartServiceW r_start;
+	struct svcctl_DeleteService r_delete;
+	struct svcctl_CloseServiceHandle r_close;
+};
+
+static void svc_install_connected(struct tevent_req *subreq);
+static void svc_install_uploaded(struct tevent_req *subreq);
+static void svc_install_prepared(struct tevent_req *req, NTSTATUS status);
+static void svc_install_scm_opened(struct rpc_request *rreq);
+static void svc_install_svc_opened(struct rpc_request *rreq);
+static void svc_install_created(struct rpc_request *rreq);
+static void svc_install_queried(struct rpc_request *rreq);
+static void svc_install_stopped(struct rpc_request *rreq);
+static void svc_install_change(struct tevent_req *req);
+static void svc_install_changed(struct rpc_request *rreq);
+static void svc_install_waited(struct tevent_req *subreq);
+static void svc_install_start(struct tevent_req *req);
+static void svc_install_started(struct rpc_request *rreq);
+static void svc_install_running(struct tevent_req *subreq);
+static void svc_install_svc_closed(struct rpc_request *rreq);
+static void svc_install_scm_closed(struct rpc_request *rreq);
+
+struct tevent_req *svc_install_send(TALLOC_CTX *mem_ctx,
+				    struct tevent_context *ev_ctx,
+				    struct smbcli_tree *ipc,
+				    struct smb2_tree *ipc2,
+				    const char *hostname,
+				    int flags,
+				    struct winexe_trace *trace)
+{
+	struct tevent_req *req, *subreq;
+	struct svc_install_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_install_state);
+	if (req == NULL)
+		return NULL;
+	state->ev_ctx = ev_ctx;
+	state->ipc = ipc;
+	state->ipc2 = ipc2;
+	state->hostname = hostname;
+	state->flags = flags;
+	state->os64bit = -1;
+	state->trace = trace;
+
+	/* svcctl bind and upload to ADMIN$ are independent, run them together */
+	subreq = svc_pipe_send(state, ev_ctx, ipc, ipc2);
+	if (tevent_req_nomem(subreq, req))
+		return tevent_req_post(req, ev_ctx);
+	tevent_req_set_callback(subreq, svc_install_connected, req);
+	state->pending++;
+	subreq = svc_upload_send(state, ev_ctx, ipc ? ipc->session : NULL,
+				 ipc2 ? ipc2->session : NULL, hostname, flags, trace);
+	if (subreq == NULL) {
+		state->status = NT_STATUS_NO_MEMORY;
+		return req;
+	}
+	tevent_req_set_callback(subreq, svc_install_uploaded, req);
+	state->pending++;
+	return req;
+}
+
+static void svc_install_connected(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = svc_pipe_recv(subreq, state, &state->svc_pipe);
+	TALLOC_FREE(subreq);
+	if (!NT_STATUS_IS_OK(status))
+		DEBUG(1, ("ERROR: Cannot connect to svcctl pipe. %s.\n", nt_errstr(status)));
+	else
+		trace_mark(state->trace, "svcctl_bound");
+	svc_install_prepared(req, status);
+}
+
+static void svc_install_uploaded(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = svc_upload_recv(subreq, &state->os64bit);
+	TALLOC_FREE(subreq);
+	if (!NT_STATUS_IS_OK(status))
+		DEBUG(1, ("ERROR: UploadService failed. %s.\n", nt_errstr(status)));
+	svc_install_prepared(req, status);
+}
+
+/* Both svcctl bind and upload are finished */
+static void svc_install_prepared(struct tevent_req *req, NTSTATUS status)
+{
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+
+	if (NT_STATUS_IS_OK(state->status))
+		state->status = status;
+	if (--state->pending)
+		return;
+	if (tevent_req_nterror(req, state->status))
+		return;
+	svc_continue_rpc(req, svc_OpenSCManager_send(state->svc_pipe, state,
+				state->hostname, &state->scm_handle, &state->r_open_scm),
+			 svc_install_scm_opened);
+}
+
+static void svc_install_scm_opened(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
 
-	status = svc_pipe_connect(&svc_pipe, hostname, credentials);
-	NT_ERR(status, 1, "Cannot connect to svcctl pipe");
-	status = svc_UploadService(hostname, credentials, flags);
-	NT_ERR(status, 1, "UploadService failed");
-	status = svc_OpenSCManager(svc_pipe, hostname, &scm_handle);
-	NT_ERR(status, 1, "OpenSCManager failed");
-	status = svc_OpenService(svc_pipe, &scm_handle, "winexesvc",
-				 &svc_handle);
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_open_scm.out.result);
+	REQ_ERR(req, status, 1, "OpenSCManager failed");
+	trace_mark(state->trace, "scm_opened");
+	svc_continue_rpc(req, svc_OpenService_send(state->svc_pipe, state,
+				&state->scm_handle, "winexesvc", &state->svc_handle,
+				&state->r_open_svc),
+			 svc_install_svc_opened);
+}
+
+static void svc_install_svc_opened(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_open_svc.out.result);
+	trace_mark(state->trace, "service_opened");
 	if (NT_STATUS_EQUAL(status, NT_STATUS_SERVICE_DOES_NOT_EXIST)) {
-		status =
-		    svc_CreateService(svc_pipe, &scm_handle, "winexesvc",
-			SERVICE_WIN32_OWN_PROCESS | 
-			(flags & SVC_INTERACTIVE ? SERVICE_INTERACTIVE_PROCESS : 0),
-			"winexesvc.exe", &svc_handle);
-		NT_ERR(status, 1, "CreateService failed");
-		need_start = 1;
-	} else if (NT_STATUS_IS_OK(status) && !(flags & SVC_IGNORE_INTERACTIVE)) {
-		struct SERVICE_STATUS s;
-		int what, want;
-		status = svc_QueryServiceStatus(svc_pipe, &svc_handle, &s);
-		NT_ERR(status, 1, "QueryServiceStatus failed");
-		what = s.type & SERVICE_INTERACTIVE_PROCESS;
-		want = flags & SVC_INTERACTIVE;
-		if ((what && !want) || (!what && want)) {
-			need_start = 1;
-			if (s.state != SVCCTL_STOPPED) {
-				status = svc_ControlService(svc_pipe, &svc_handle,
-                                       SERVICE_CONTROL_STOP, &s);
-				NT_ERR(status, 1, "StopService failed");
-			}
-			status = svc_ChangeServiceConfig(svc_pipe, &svc_handle, 
-			    SERVICE_WIN32_OWN_PROCESS | 
-			    (want ? SERVICE_INTERACTIVE_PROCESS : 0),
-			    NULL);
-			NT_ERR(status, 1, "ChangeServiceConfig failed");
-			do {
-			    msleep(100);
-			    status = svc_QueryServiceStatus(svc_pipe, &svc_handle, &s);
-			    NT_ERR(status, 1, "QueryServiceStatus failed");
-			} while (s.state == SVCCTL_STOP_PENDING);
-		}
+		svc_continue_rpc(req, svc_CreateService_send(state->svc_pipe, state,
+					&state->scm_handle, "winexesvc",
+					SERVICE_WIN32_OWN_PROCESS |
+					(state->flags & SVC_INTERACTIVE ? SERVICE_INTERACTIVE_PROCESS : 0),
+					"winexesvc.exe", &state->svc_handle, &state->r_create),
+				 svc_install_created);
+	} else if (NT_STATUS_IS_OK(status) && !(state->flags & SVC_IGNORE_INTERACTIVE)) {
+		svc_continue_rpc(req, svc_QueryServiceStatus_send(state->svc_pipe, state,
+					&state->svc_handle, &state->s, &state->r_query),
+				 svc_install_queried);
 	} else {
-		NT_ERR(status, 1, "OpenService failed");
-	}
-	if ((flags & SVC_IGNORE_INTERACTIVE) || need_start) {
-	    status = svc_StartService(svc_pipe, &svc_handle);
-	    NT_ERR(status, 1, "StartService failed");
+		REQ_ERR(req, status, 1, "OpenService failed");
+		svc_install_start(req);
 	}
-	{
-		struct SERVICE_STATUS s;
-		do {
-			msleep(100);
-			status = svc_QueryServiceStatus(svc_pipe, &svc_handle, &s);
-			NT_ERR(status, 1, "QueryServiceStatus failed");
-		} while (s.state == SVCCTL_START_PENDING);
-		if (s.state != SVCCTL_RUNNING) {
-			DEBUG(0, ("Service cannot start, status=0x%08X\n", s.state));
-			return NT_STATUS_UNSUCCESSFUL;
+}
+
+static void svc_install_created(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_create.out.result);
+	REQ_ERR(req, status, 1, "CreateService failed");
+	trace_mark(state->trace, "service_created");
+	state->need_start = 1;
+	svc_install_start(req);
+}
+
+static void svc_install_queried(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+	int what, want;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_query.out.result);
+	REQ_ERR(req, status, 1, "QueryServiceStatus failed");
+	what = state->s.type & SERVICE_INTERACTIVE_PROCESS;
+	want = state->flags & SVC_INTERACTIVE;
+	if ((what && !want) || (!what && want)) {
+		state->need_start = 1;
+		if (state->s.state != SVCCTL_STOPPED) {
+			svc_continue_rpc(req, svc_ControlService_send(state->svc_pipe, state,
+						&state->svc_handle, SERVICE_CONTROL_STOP,
+						&state->s, &state->r_control),
+					 svc_install_stopped);
+			return;
 		}
+		svc_install_change(req);
+		return;
+	}
+	svc_install_start(req);
+}
+
+static void svc_install_stopped(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_control.out.result);
+	REQ_ERR(req, status, 1, "StopService failed");
+	svc_install_change(req);
+}
+
+static void svc_install_change(struct tevent_req *req)
+{
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	int want = state->flags & SVC_INTERACTIVE;
+
+	svc_continue_rpc(req, svc_ChangeServiceConfig_send(state->svc_pipe, state,
+				&state->svc_handle, SERVICE_WIN32_OWN_PROCESS |
+				(want ? SERVICE_INTERACTIVE_PROCESS : 0),
+				NULL, &state->r_change),
+			 svc_install_changed);
+}
+
+static void svc_install_changed(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	struct tevent_req *subreq;
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_change.out.result);
+	REQ_ERR(req, status, 1, "ChangeServiceConfig failed");
+	subreq = svc_wait_send(state, state->ev_ctx, state->svc_pipe,
+			       &state->svc_handle, SVCCTL_STOP_PENDING);
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_install_waited, req);
+}
+
+static void svc_install_waited(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = svc_wait_recv(subreq, &state->s);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "QueryServiceStatus failed");
+	svc_install_start(req);
+}
+
+static void svc_install_start(struct tevent_req *req)
+{
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	struct tevent_req *subreq;
+
+	if ((state->flags & SVC_IGNORE_INTERACTIVE) || state->need_start) {
+		svc_continue_rpc(req, svc_StartService_send(state->svc_pipe, state,
+					&state->svc_handle, &state->r_start),
+				 svc_install_started);
+		return;
+	}
+	subreq = svc_wait_send(state, state->ev_ctx, state->svc_pipe,
+			       &state->svc_handle, SVCCTL_START_PENDING);
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_install_running, req);
+}
+
+static void svc_install_started(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	struct tevent_req *subreq;
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_start.out.result);
+	REQ_ERR(req, status, 1, "StartService failed");
+	trace_mark(state->trace, "service_started");
+	subreq = svc_wait_send(state, state->ev_ctx, state->svc_pipe,
+			       &state->svc_handle, SVCCTL_START_PENDING);
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_install_running, req);
+}
+
+static void svc_install_running(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+	NTSTATUS status;
+
+	status = svc_wait_recv(subreq, &state->s);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "QueryServiceStatus failed");
+	if (state->s.state != SVCCTL_RUNNING) {
+		DEBUG(0, ("Service cannot start, status=0x%08X\n", state->s.state));
+		tevent_req_nterror(req, NT_STATUS_UNSUCCESSFUL);
+		return;
 	}
-	svc_CloseServiceHandle(svc_pipe, &svc_handle);
-	svc_CloseServiceHandle(svc_pipe, &scm_handle);
-	talloc_free(svc_pipe);
-	return status;
+	trace_mark(state->trace, "service_running");
+	svc_continue_rpc(req, svc_CloseServiceHandle_send(state->svc_pipe, state,
+				&state->svc_handle, &state->r_close),
+			 svc_install_svc_closed);
+}
+
+static void svc_install_svc_closed(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+
+	dcerpc_ndr_request_recv(rreq);
+	svc_continue_rpc(req, svc_CloseServiceHandle_send(state->svc_pipe, state,
+				&state->scm_handle, &state->r_close),
+			 svc_install_scm_closed);
 }
 
-NTSTATUS svc_uninstall(const char *hostname,
-		       struct cli_credentials * credentials)
+static void svc_install_scm_closed(struct rpc_request *rreq)
 {
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
+
+	dcerpc_ndr_request_recv(rreq);
+	trace_mark(state->trace, "installed");
+	tevent_req_done(req);
+}
+
+NTSTATUS svc_install_recv(struct tevent_req *req, int *os64bit)
+{
+	struct svc_install_state *state = tevent_req_data(req, struct svc_install_state);
 	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status))
+		return status;
+	if (os64bit)
+		*os64bit = state->os64bit;
+	return NT_STATUS_OK;
+}
+
+/*
+  Stops and deletes service, then removes winexesvc.exe from ADMIN$ share
+*/
+struct svc_uninstall_state {
+	struct tevent_context *ev_ctx;
+	struct winexe_trace *trace;
+	struct smbcli_tree *ipc;
+	struct smb2_tree *ipc2;
+	const char *hostname;
 	struct dcerpc_pipe *svc_pipe;
 	struct policy_handle scm_handle;
 	struct policy_handle svc_handle;
-	struct SERVICE_STATUS svc_status;
-	struct smbcli_options options;
-	struct smbcli_session_options session_options;
-
-	lp_smbcli_options(cmdline_lp_ctx, &options);
-	lp_smbcli_session_options(cmdline_lp_ctx, &session_options);
-
-	status = svc_pipe_connect(&svc_pipe, hostname, credentials);
-	NT_ERR(status, 1, "Cannot connect to svcctl pipe");
-	status = svc_OpenSCManager(svc_pipe, hostname, &scm_handle);
-	NT_ERR(status, 1, "OpenSCManager failed");
-	status =
-	    svc_OpenService(svc_pipe, &scm_handle, "winexesvc",
-			    &svc_handle);
-	NT_ERR(status, 1, "OpenService failed");
+	struct SERVICE_STATUS s;
+	struct smbcli_tree *tree;
+	struct smb2_tree *tree2;
+	union smb_unlink io_unlink;
+	struct svcctl_OpenSCManagerW r_open_scm;
+	struct svcctl_OpenServiceW r_open_svc;
+	struct svcctl_ControlService r_control;
+	struct svcctl_DeleteService r_delete;
+	struct svcctl_CloseServiceHandle r_close;
+};
+
+static void svc_uninstall_connected(struct tevent_req *subreq);
+static void svc_uninstall_scm_opened(struct rpc_request *rreq);
+static void svc_uninstall_svc_opened(struct rpc_request *rreq);
+static void svc_uninstall_stopped(struct rpc_request *rreq);
+static void svc_uninstall_waited(struct tevent_req *subreq);
+static void svc_uninstall_deleted(struct rpc_request *rreq);
+static void svc_uninstall_svc_closed(struct rpc_request *rreq);
+static void svc_uninstall_scm_closed(struct rpc_request *rreq);
+static void svc_uninstall_share_connected(struct tevent_req *subreq);
+static void svc_uninstall_exited(struct tevent_req *subreq);
+static void svc_uninstall_unlinked(struct smbcli_request *sreq);
+static void svc_uninstall_share_connected2(struct tevent_req *subreq);
+static void svc_uninstall_unlinked2(struct tevent_req *subreq);
+
+struct tevent_req *svc_uninstall_send(TALLOC_CTX *mem_ctx,
+				      struct tevent_context *ev_ctx,
+				      struct smbcli_tree *ipc,
+				      struct smb2_tree *ipc2,
+				      const char *hostname,
+				      struct winexe_trace *trace)
+{
+	struct tevent_req *req, *subreq;
+	struct svc_uninstall_state *state;
+
+	req = tevent_req_create(mem_ctx, &state, struct svc_uninstall_state);
+	if (req == NULL)
+		return NULL;
+	state->ev_ctx = ev_ctx;
+	state->ipc = ipc;
+	state->ipc2 = ipc2;
+	state->hostname = hostname;
+	state->trace = trace;
+
+	subreq = svc_pipe_send(state, ev_ctx, ipc, ipc2);
+	if (tevent_req_nomem(subreq, req))
+		return tevent_req_post(req, ev_ctx);
+	tevent_req_set_callback(subreq, svc_uninstall_connected, req);
+	return req;
+}
+
+static void svc_uninstall_connected(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = svc_pipe_recv(subreq, state, &state->svc_pipe);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Cannot connect to svcctl pipe");
+	trace_mark(state->trace, "uninstall_svcctl_bound");
+	svc_continue_rpc(req, svc_OpenSCManager_send(state->svc_pipe, state,
+				state->hostname, &state->scm_handle, &state->r_open_scm),
+			 svc_uninstall_scm_opened);
+}
+
+static void svc_uninstall_scm_opened(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_open_scm.out.result);
+	REQ_ERR(req, status, 1, "OpenSCManager failed");
+	svc_continue_rpc(req, svc_OpenService_send(state->svc_pipe, state,
+				&state->scm_handle, "winexesvc", &state->svc_handle,
+				&state->r_open_svc),
+			 svc_uninstall_svc_opened);
+}
+
+static void svc_uninstall_svc_opened(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_open_svc.out.result);
+	REQ_ERR(req, status, 1, "OpenService failed");
 	DEBUG(1, ("OpenService - %s\n", nt_errstr(status)));
-	if (NT_STATUS_IS_OK(status)) {
-		status =
-		    svc_ControlService(svc_pipe, &svc_handle,
-				       SERVICE_CONTROL_STOP, &svc_status);
-		{
-			struct SERVICE_STATUS s;
-			do {
-				msleep(100);
-				status = svc_QueryServiceStatus(svc_pipe, &svc_handle, &s);
-				NT_ERR(status, 1, "QueryServiceStatus failed");
-			} while (s.state == SVCCTL_STOP_PENDING);
-			if (s.state != SVCCTL_STOPPED) {
-				DEBUG(0, ("Service cannot stop, status=0x%08X\n", s.state));
-				return NT_STATUS_UNSUCCESSFUL;
-			}
-		}
-		DEBUG(1, ("StopService - %s\n", nt_errstr(status)));
-		status = svc_DeleteService(svc_pipe, &svc_handle);
-		DEBUG(1, ("DeleteService - %s\n", nt_errstr(status)));
-		status = svc_CloseServiceHandle(svc_pipe, &svc_handle);
-		DEBUG(1, ("CloseServiceHandle - %s\n", nt_errstr(status)));
+	svc_continue_rpc(req, svc_ControlService_send(state->svc_pipe, state,
+				&state->svc_handle, SERVICE_CONTROL_STOP,
+				&state->s, &state->r_control),
+			 svc_uninstall_stopped);
+}
+
+static void svc_uninstall_stopped(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	struct tevent_req *subreq;
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_control.out.result);
+	DEBUG(1, ("StopService - %s\n", nt_errstr(status)));
+	subreq = svc_wait_send(state, state->ev_ctx, state->svc_pipe,
+			       &state->svc_handle, SVCCTL_STOP_PENDING);
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_uninstall_waited, req);
+}
+
+static void svc_uninstall_waited(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = svc_wait_recv(subreq, &state->s);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "QueryServiceStatus failed");
+	if (state->s.state != SVCCTL_STOPPED) {
+		DEBUG(0, ("Service cannot stop, status=0x%08X\n", state->s.state));
+		tevent_req_nterror(req, NT_STATUS_UNSUCCESSFUL);
+		return;
 	}
-	svc_CloseServiceHandle(svc_pipe, &scm_handle);
+	trace_mark(state->trace, "service_stopped");
+	svc_continue_rpc(req, svc_DeleteService_send(state->svc_pipe, state,
+				&state->svc_handle, &state->r_delete),
+			 svc_uninstall_deleted);
+}
+
+static void svc_uninstall_deleted(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_delete.out.result);
+	DEBUG(1, ("DeleteService - %s\n", nt_errstr(status)));
+	trace_mark(state->trace, "service_deleted");
+	svc_continue_rpc(req, svc_CloseServiceHandle_send(state->svc_pipe, state,
+				&state->svc_handle, &state->r_close),
+			 svc_uninstall_svc_closed);
+}
+
+static void svc_uninstall_svc_closed(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_close.out.result);
+	DEBUG(1, ("CloseServiceHandle - %s\n", nt_errstr(status)));
+	svc_continue_rpc(req, svc_CloseServiceHandle_send(state->svc_pipe, state,
+				&state->scm_handle, &state->r_close),
+			 svc_uninstall_scm_closed);
+}
+
+static void svc_uninstall_scm_closed(struct rpc_request *rreq)
+{
+	struct tevent_req *req = talloc_get_type(rreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	struct tevent_req *subreq;
+	NTSTATUS status;
+
+	status = dcerpc_ndr_request_recv(rreq);
+	status = NT_RES(status, state->r_close.out.result);
 	DEBUG(1, ("CloseSCMHandle - %s\n", nt_errstr(status)));
+	TALLOC_FREE(state->svc_pipe);
+	if (state->ipc2) {
+		subreq = svc_tcon2_send(state, state->ev_ctx, state->ipc2->session,
+					state->hostname, "ADMIN$");
+		if (tevent_req_nomem(subreq, req))
+			return;
+		tevent_req_set_callback(subreq, svc_uninstall_share_connected2, req);
+		return;
+	}
+	subreq = svc_tcon_send(state, state->ev_ctx, state->ipc->session,
+			       state->hostname, "ADMIN$");
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_uninstall_share_connected, req);
+}
+
+static void svc_uninstall_share_connected(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
 
-	struct smbcli_state *cli;
-	status =
-	    smbcli_full_connection(NULL, &cli, hostname, lp_smb_ports(cmdline_lp_ctx), "ADMIN$", NULL,
-				   lp_socket_options(cmdline_lp_ctx), credentials, lp_resolve_context(cmdline_lp_ctx), ev_ctx, &options, &session_options, lp_iconv_convenience(cmdline_lp_ctx), lp_gensec_settings(NULL, cmdline_lp_ctx));
-	NT_ERR(status, 1, "Failed to open ADMIN$ share");
+	status = svc_tcon_recv(subreq, state, &state->tree);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Failed to open ADMIN$ share");
 	/* Give winexesvc some time to exit */
-	msleep(300);
-	status = smbcli_unlink(cli->tree, "winexesvc.exe");
+	subreq = tevent_wakeup_send(state, state->ev_ctx, timeval_current_ofs(0, 300000));
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_uninstall_exited, req);
+}
+
+static void svc_uninstall_share_connected2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = svc_tcon2_recv(subreq, state, &state->tree2);
+	TALLOC_FREE(subreq);
+	REQ_ERR(req, status, 1, "Failed to open ADMIN$ share");
+	subreq = tevent_wakeup_send(state, state->ev_ctx, timeval_current_ofs(0, 300000));
+	if (tevent_req_nomem(subreq, req))
+		return;
+	tevent_req_set_callback(subreq, svc_uninstall_exited, req);
+}
+
+static void svc_uninstall_exited(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+
+	tevent_wakeup_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (state->tree2) {
+		subreq = svc_open2_send(state, state->ev_ctx, state->tree2, "winexesvc.exe",
+					SEC_STD_DELETE, NTCREATEX_OPTIONS_DELETE_ON_CLOSE);
+		if (tevent_req_nomem(subreq, req))
+			return;
+		tevent_req_set_callback(subreq, svc_uninstall_unlinked2, req);
+		return;
+	}
+	state->io_unlink.unlink.in.pattern = "winexesvc.exe";
+	state->io_unlink.unlink.in.attrib = FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_DIRECTORY;
+	svc_continue_smb(req, smb_raw_unlink_send(state->tree, &state->io_unlink),
+			 svc_uninstall_unlinked);
+}
+
+static void svc_uninstall_unlinked(struct smbcli_request *sreq)
+{
+	struct tevent_req *req = talloc_get_type(sreq->async.private_data, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = smbcli_request_simple_recv(sreq);
+	DEBUG(1, ("Delete winexesvc.exe - %s\n", nt_errstr(status)));
+	trace_mark(state->trace, "uninstalled");
+	svc_tree_release(state->tree);
+	state->tree = NULL;
+	tevent_req_done(req);
+}
+
+static void svc_uninstall_unlinked2(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq, struct tevent_req);
+	struct svc_uninstall_state *state = tevent_req_data(req, struct svc_uninstall_state);
+	NTSTATUS status;
+
+	status = svc_open2_recv(subreq);
+	TALLOC_FREE(subreq);
 	DEBUG(1, ("Delete winexesvc.exe - %s\n", nt_errstr(status)));
-	status = smbcli_tdis(cli);
-	DEBUG(1, ("Closing ADMIN$ - %s\n", nt_errstr(status)));
-	return status;
+	trace_mark(state->trace, "uninstalled");
+	svc_tree2_release(state->tree2);
+	state->tree2 = NULL;
+	tevent_req_done(req);
+}
+
+NTSTATUS svc_uninstall_recv(struct tevent_req *req)
+{
+	return tevent_req_simple_recv_ntstatus(req);
 }
@@ -0,0 +1,214 @@
+#!/bin/sh
+# Blackbox tests of winexe against the winexesvc stand-in (winexe/mocksvc.c)
+# running in the server, followed by a benchmark of connect latency, time
+# to first output and stdio throughput over each transport.
+
+if [ $# -lt 4 ]; then
+cat <<EOF
+Usage: test_winexe_mock.sh SERVER USERNAME PASSWORD DOMAIN
+EOF
+exit 1;
+fi
+
+SERVER=$1
+USERNAME=$2
+PASSWORD=$3
+DOMAIN=$4
+shift 4
+
+. `dirname $0`/../../../testprogs/blackbox/subunit.sh
+
+samba4bindir="$BUILDDIR/bin"
+winexe="$samba4bindir/winexe$EXEEXT"
+failed=0
+
+# number of runs the latency figures are averaged over
+LATENCY_RUNS=${LATENCY_RUNS:-10}
+# stdout volume of the throughput run, in 64k blocks
+THROUGHPUT_BLOCKS=${THROUGHPUT_BLOCKS:-1024}
+
+# --interactive=2 uses the service as it is, there is no svcctl to install it
+winexe_run() {
+	$VALGRIND $winexe $CONFIGURATION --interactive=2 --no-cache -W "$DOMAIN" -U"$USERNAME%$PASSWORD" "$@"
+}
+
+# name expected command [winexe options]
+test_output() {
+	name="$1"
+	expected="$2"
+	cmd="$3"
+	shift 3
+	subunit_start_test "$name"
+	output=`winexe_run "$@" //$SERVER "$cmd" 2>/dev/null </dev/null`
+	status=$?
+	if [ x$status = x0 -a x"$output" = x"$expected" ]; then
+		subunit_pass_test "$name"
+	else
+		echo "status $status, output '$output', expected '$expected'" | subunit_fail_test "$name"
+		failed=`expr $failed + 1`
+	fi
+}
+
+for opts in "" "--framed" "--smb2" "--smb2 --framed"; do
+	desc="winexe.mock${opts:+ with $opts}"
+
+	test_output "$desc stdout" "hello" "echo hello" $opts
+	test_output "$desc stderr is kept apart" "out" "echo out; echo err >&2" $opts
+
+	subunit_start_test "$desc stdin"
+	output=`echo piped | winexe_run $opts //$SERVER "cat" 2>&1`
+	if [ x"$output" = x"piped" ]; then
+		subunit_pass_test "$desc stdin"
+	else
+		echo "$output" | subunit_fail_test "$desc stdin"
+		failed=`expr $failed + 1`
+	fi
+
+	subunit_start_test "$desc return code"
+	output=`winexe_run $opts //$SERVER "exit 3" 2>&1 </dev/null`
+	status=$?
+	if [ x$status = x3 ]; then
+		subunit_pass_test "$desc return code"
+	else
+		echo "status $status: $output" | subunit_fail_test "$desc return code"
+		failed=`expr $failed + 1`
+	fi
+
+	subunit_start_test "$desc stats"
+	output=`winexe_run --stats $opts //$SERVER "dd if=/dev/zero of=/dev/null bs=1048576 count=16 2>/dev/null" 2>&1 </dev/null`
+	if echo "$output" | grep -q "^$SERVER: wall [0-9.]* s, user [0-9.]* s, kernel [0-9.]* s, peak working set [1-9][0-9]* KB$"; then
+		subunit_pass_test "$desc stats"
+	else
+		echo "$output" | subunit_fail_test "$desc stats"
+		failed=`expr $failed + 1`
+	fi
+
+	subunit_start_test "$desc timing record"
+	output=`winexe_run --timing - $opts //$SERVER "echo x" 2>&1 >/dev/null </dev/null`
+	missing=""
+	for event in tree_connected getting_version running first_output return_code done; do
+		echo "$output" | grep -q "\"event\":\"$event\"" || missing="$missing $event"
+	done
+	csv=`winexe_run --timing - --timing-format csv $opts //$SERVER "exit 2" 2>&1 >/dev/null </dev/null`
+	if [ -z "$missing" ] && echo "$output" | grep -q '"return_code":0' \
+	   && echo "$csv" | grep -q "^$SERVER,2,running,"; then
+		subunit_pass_test "$desc timing record"
+	else
+		echo "missing:$missing; $output; $csv" | subunit_fail_test "$desc timing record"
+		failed=`expr $failed + 1`
+	fi
+
+	# depth 1 runs the commands one after another, so stdout is in order
+	subunit_start_test "$desc batch"
+	batch=`mktemp /tmp/winexe_batch.XXXXXX`
+	cat > $batch <<EOF
+echo one
+# comments and empty lines are skipped
+
+echo two; exit 2
+echo three
+EOF
+	output=`winexe_run --batch $batch --batch-depth=1 $opts //$SERVER 2>$batch.err </dev/null`
+	status=$?
+	report=`cat $batch.err`
+	if [ x$status = x2 -a x"$output" = x"one
+two
+three" ] \
+	   && echo "$report" | grep -q "^$SERVER: \[0\] return code 0, .*stdout 4, stderr 0 bytes: echo one$" \
+	   && echo "$report" | grep -q "^$SERVER: \[1\] return code 2, .*stdout 4, stderr 0 bytes: echo two; exit 2$" \
+	   && echo "$report" | grep -q "^$SERVER: \[2\] return code 0, .*stdout 6, stderr 0 bytes: echo three$" \
+	   && echo "$report" | grep -q "^$SERVER: 3 of 3 commands run in "; then
+		subunit_pass_test "$desc batch"
+	else
+		echo "status $status, output '$output'; $report" | subunit_fail_test "$desc batch"
+		failed=`expr $failed + 1`
+	fi
+	rm -f $batch $batch.err
+
+	# each of the first two commands only succeeds if it sees the other one
+	# running, the third one must still be started once they are done
+	subunit_start_test "$desc batch depth"
+	dir=`mktemp -d /tmp/winexe_batch.XXXXXX`
+	cat > $dir/batch <<EOF
+touch $dir/0; i=0; while [ ! -f $dir/1 -a \$i -lt 100 ]; do sleep 0.1; i=\$((i+1)); done; test -f $dir/1
+touch $dir/1; i=0; while [ ! -f $dir/0 -a \$i -lt 100 ]; do sleep 0.1; i=\$((i+1)); done; test -f $dir/0
+echo done
+EOF
+	output=`winexe_run --batch $dir/batch --batch-depth=2 $opts //$SERVER 2>$dir/err </dev/null`
+	status=$?
+	report=`cat $dir/err`
+	if [ x$status = x0 -a x"$output" = x"done" ] \
+	   && echo "$report" | grep -q "^$SERVER: \[1\] return code 0, " \
+	   && echo "$report" | grep -q "^$SERVER: 3 of 3 commands run in "; then
+		subunit_pass_test "$desc batch depth"
+	else
+		echo "status $status, output '$output'; $report" | subunit_fail_test "$desc batch depth"
+		failed=`expr $failed + 1`
+	fi
+	rm -rf $dir
+
+	subunit_start_test "$desc latency"
+	i=0
+	times=""
+	while [ $i -lt $LATENCY_RUNS ]; do
+		times="$times
+`winexe_run --benchmark $opts //$SERVER "echo x" 2>&1 </dev/null | grep 'first output after'`"
+		i=`expr $i + 1`
+	done
+	n=`echo "$times" | grep -c 'first output after'`
+	if [ x$n = x$LATENCY_RUNS ]; then
+		subunit_pass_test "$desc latency"
+		echo "$times" | awk -v desc="$desc" '/first output after/ {
+			open += $6; first += $11; n++ }
+			END { printf("%s: %d runs, control pipe open after %.3f s, first output after %.3f s (mean)\n", desc, n, open / n, first / n) }'
+	else
+		echo "$times" | subunit_fail_test "$desc latency"
+		failed=`expr $failed + 1`
+	fi
+
+	# more than OUTPUT_QUEUE_MAX into a pipe nobody reads for a while
+	subunit_start_test "$desc slow reader"
+	output=`winexe_run $opts //$SERVER "dd if=/dev/zero bs=65536 count=64 2>/dev/null" 2>/dev/null </dev/null | (sleep 2; wc -c)`
+	if [ x"`echo $output`" = x"4194304" ]; then
+		subunit_pass_test "$desc slow reader"
+	else
+		echo "got $output bytes" | subunit_fail_test "$desc slow reader"
+		failed=`expr $failed + 1`
+	fi
+
+	subunit_start_test "$desc throughput"
+	output=`winexe_run --benchmark $opts //$SERVER "dd if=/dev/zero bs=65536 count=$THROUGHPUT_BLOCKS 2>/dev/null" 2>&1 </dev/null`
+	expected=`expr $THROUGHPUT_BLOCKS \* 65536`
+	if echo "$output" | grep -q "stdout $expected bytes"; then
+		subunit_pass_test "$desc throughput"
+		echo "$output" | grep "MB/s" | sed "s/^[^:]*/$desc/"
+	else
+		echo "$output" | subunit_fail_test "$desc throughput"
+		failed=`expr $failed + 1`
+	fi
+done
+
+# a host that cannot be used runs nothing, commands after the first are
+# reported as not run and count as return code 99
+subunit_start_test "winexe.mock batch not run after a failure"
+batch=`mktemp /tmp/winexe_batch.XXXXXX`
+cat > $batch <<EOF
+echo one
+echo two
+echo three
+EOF
+output=`$VALGRIND $winexe $CONFIGURATION --interactive=2 --no-cache -W "$DOMAIN" -U"$USERNAME%$PASSWORD-wrong" --batch $batch //$SERVER 2>&1 </dev/null`
+status=$?
+if [ x$status = x99 ] \
+   && echo "$output" | grep -q "^$SERVER: \[0\] return code 1, .*: echo one$" \
+   && echo "$output" | grep -q "^$SERVER: \[1\] not run: echo two$" \
+   && echo "$output" | grep -q "^$SERVER: \[2\] not run: echo three$" \
+   && echo "$output" | grep -q "^$SERVER: 1 of 3 commands run in "; then
+	subunit_pass_test "winexe.mock batch not run after a failure"
+else
+	echo "status $status: $output" | subunit_fail_test "winexe.mock batch not run after a failure"
+	failed=`expr $failed + 1`
+fi
+rm -f $batch
+
+exit $failed
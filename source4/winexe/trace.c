@@ -0,0 +1,121 @@
+/*
+   Copyright (C) The winexe contributors 2026
+   License: GNU General Public License version 3
+*/
+
+/*
+  Per host timing record: every phase of a run (connect steps, service
+  install, version handshake, stdio pipe opens, ...) is marked with the
+  time it finished, and the whole list is written out when the host is
+  done, as one JSON object per line or as CSV rows.
+*/
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "lib/events/events.h"
+#include "libcli/libcli.h"
+#include "winexe.h"
+
+struct winexe_trace_event {
+	const char *name;
+	struct timeval t;
+};
+
+struct winexe_trace {
+	const char *hostname;
+	struct timeval begin;
+	struct winexe_trace_event *events;
+	int num;
+};
+
+struct winexe_trace *trace_new(TALLOC_CTX *mem_ctx, const char *hostname)
+{
+	struct winexe_trace *t;
+
+	t = talloc_zero(mem_ctx, struct winexe_trace);
+	if (!t)
+		return NULL;
+	t->hostname = talloc_strdup(t, hostname);
+	t->begin = timeval_current();
+	return t;
+}
+
+/* Event names are not copied, they must be string constants */
+void trace_mark_at(struct winexe_trace *t, const char *event, struct timeval tv)
+{
+	struct winexe_trace_event *e;
+
+	if (!t || timeval_is_zero(&tv))
+		return;
+	e = talloc_realloc(t, t->events, struct winexe_trace_event, t->num + 1);
+	if (!e)
+		return;
+	t->events = e;
+	e[t->num].name = event;
+	e[t->num].t = tv;
+	t->num++;
+}
+
+void trace_mark(struct winexe_trace *t, const char *event)
+{
+	if (t)
+		trace_mark_at(t, event, timeval_current());
+}
+
+/* Host names come from the command line or a host list, keep JSON valid */
+static void trace_json_string(FILE *fp, const char *s)
+{
+	fputc('"', fp);
+	for (; *s; ++s) {
+		if (*s == '"' || *s == '\\')
+			fputc('\\', fp);
+		if ((unsigned char)*s >= ' ')
+			fputc(*s, fp);
+	}
+	fputc('"', fp);
+}
+
+/* Opens timing output for appending, "-" is stderr */
+FILE *trace_open(const char *path, int csv)
+{
+	FILE *fp;
+
+	if (!strcmp(path, "-"))
+		fp = stderr;
+	else if (!(fp = fopen(path, "a"))) {
+		DEBUG(0, ("ERROR: Cannot open %s - %s\n", path, strerror(errno)));
+		return NULL;
+	}
+	/* header only once, records of several runs can go to one file */
+	if (csv && (fp == stderr || (fseek(fp, 0, SEEK_END) == 0 && ftell(fp) == 0)))
+		fprintf(fp, "host,return_code,event,seconds,delta\n");
+	return fp;
+}
+
+/* Times are seconds since the host was started, delta is since previous event */
+void trace_write(struct winexe_trace *t, FILE *fp, int csv, int return_code)
+{
+	struct timeval prev = t->begin;
+	int i;
+
+	if (csv) {
+		for (i = 0; i < t->num; ++i) {
+			fprintf(fp, "%s,%d,%s,%.6f,%.6f\n", t->hostname, return_code,
+				t->events[i].name,
+				timeval_elapsed2(&t->begin, &t->events[i].t),
+				timeval_elapsed2(&prev, &t->events[i].t));
+			prev = t->events[i].t;
+		}
+		fflush(fp);
+		return;
+	}
+	fprintf(fp, "{\"host\":");
+	trace_json_string(fp, t->hostname);
+	fprintf(fp, ",\"return_code\":%d,\"total\":%.6f,\"events\":[",
+		return_code, timeval_elapsed(&t->begin));
+	for (i = 0; i < t->num; ++i)
+		fprintf(fp, "%s{\"event\":\"%s\",\"t\":%.6f}", i ? "," : "",
+			t->events[i].name, timeval_elapsed2(&t->begin, &t->events[i].t));
+	fprintf(fp, "]}\n");
+	fflush(fp);
+}
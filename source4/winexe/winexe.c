@@ -15,33 +15,29 @@
 #include "libcli/resolve/resolve.h"
 #include "libcli/smb_composite/smb_composite.h"
 #include "libcli/composite/composite.h"
+#include "libcli/smb2/smb2.h"
+#include "libcli/smb2/smb2_calls.h"
 #include "auth/credentials/credentials.h"
+#include "../lib/util/tevent_ntstatus.h"
+#include "lib/util/dlinklist.h"
 
 #include "winexe.h"
 #include "winexesvc/shared.h"
 
+#include "system/filesys.h"
 #include <sys/fcntl.h>
 #include <sys/unistd.h>
 #include <sys/termios.h>
+#include <ctype.h>
 #include <signal.h>
 
 const char version_string[] = "winexe version %d.%02d\nThis program may be freely redistributed under the terms of the GNU GPLv3\n";
 
-struct program_options {
-	char *hostname;
-	char *cmd;
-	struct cli_credentials *credentials;
-	char *runas;
-	char *runas_file;
-	int flags;
-};
-
-int abort_requested = 0;
 
 void parse_args(int argc, char *argv[], struct program_options *options)
 {
 	poptContext pc;
-	int opt, i;
+	int opt;
 
 	int argc_new;
 	char **argv_new;
@@ -52,6 +48,9 @@ void parse_args(int argc, char *argv[], struct program_options *options)
 	int flag_reinstall = 0;
 	int flag_uninstall = 0;
 	int flag_system = 0;
+	int flag_prefix = 0;
+	int flag_collate = 0;
+	int max_args = 2;
 
 	struct poptOption long_options[] = {
 		POPT_AUTOHELP
@@ -73,12 +72,50 @@ void parse_args(int argc, char *argv[], struct program_options *options)
 		 "Desktop interaction: 0 - disallow, 1 - allow. If you allow use also --system switch (Win requirement). Vista do not support this option.", "0|1"},
 		{"ostype", 0, POPT_ARG_INT, &flag_ostype, 0,
 		 "OS type: 0 - 32bit, 1 - 64bit, 2 - winexe will decide. Determines which version (32bit/64bit) of service will be installed.", "0|1|2"},
+		{"hosts", 0, POPT_ARG_STRING, &options->hosts_file, 0,
+		 "Run command on every host listed in FILE (one per line, - for stdin)", "FILE"},
+		{"parallel", 0, POPT_ARG_INT, &options->parallel, 0,
+		 "Maximum number of hosts processed at the same time (default 10)", "N"},
+		{"prefix", 0, POPT_ARG_NONE, &flag_prefix, 0,
+		 "Prefix every output line with host name", NULL},
+		{"collate", 0, POPT_ARG_NONE, &flag_collate, 0,
+		 "Buffer output of every host and print it when the host finishes", NULL},
+		{"read-size", 0, POPT_ARG_INT, &options->read_size, 0,
+		 "Size of single stdout/stderr read request (default: maximum allowed by server)", "BYTES"},
+		{"read-depth", 0, POPT_ARG_INT, &options->read_depth, 0,
+		 "Number of read requests outstanding on stdout/stderr pipe (default 4)", "N"},
+		{"framed", 0, POPT_ARG_NONE, &options->framed, 0,
+		 "Carry stdin/stdout/stderr over control pipe instead of separate pipes (service 1.01 and newer)", NULL},
+		{"smb2", 0, POPT_ARG_NONE, &options->smb2, 0,
+		 "Use SMB2 for all traffic to the host (not used by --broker)", NULL},
+		{"batch", 0, POPT_ARG_STRING, &options->batch_file, 0,
+		 "Run every command listed in FILE (one per line, - for stdin) over one connection per host", "FILE"},
+		{"batch-depth", 0, POPT_ARG_INT, &options->batch_depth, 0,
+		 "Number of batch commands running at the same time on one host (default 4)", "N"},
+		{"stats", 0, POPT_ARG_NONE, &options->stats, 0,
+		 "Report wall time, CPU time and peak memory of the remote command (service 1.02 and newer)", NULL},
+		{"benchmark", 0, POPT_ARG_NONE, &options->benchmark, 0,
+		 "Discard command output and report latency and stdout/stderr throughput", NULL},
+		{"timing", 0, POPT_ARG_STRING, &options->timing_file, 0,
+		 "Append time of every connect, install and run step of each host to FILE (- for stderr)", "FILE"},
+		{"timing-format", 0, POPT_ARG_STRING, &options->timing_format, 0,
+		 "Format of --timing records (default json)", "json|csv"},
+		{"cache", 0, POPT_ARG_STRING, &options->cache_file, 0,
+		 "Cache of installed service state (default ~/.winexe_cache.tdb)", "FILE"},
+		{"no-cache", 0, POPT_ARG_NONE, &options->no_cache, 0,
+		 "Always check and upload service, do not use cache", NULL},
+		{"broker", 0, POPT_ARG_STRING, &options->broker, 0,
+		 "Run as broker keeping connections to hosts open for clients connecting to unix SOCKET", "SOCKET"},
+		{"broker-idle", 0, POPT_ARG_INT, &options->broker_idle, 0,
+		 "Seconds an unused broker connection is kept open (default 300)", "SECONDS"},
+		{"via-broker", 0, POPT_ARG_STRING, &options->via_broker, 0,
+		 "Run command through broker listening on unix SOCKET", "SOCKET"},
 		POPT_TABLEEND
 	};
 
 	pc = poptGetContext(argv[0], argc, (const char **) argv, long_options, 0);
 
-	poptSetOtherOptionHelp(pc, "//host command");
+	poptSetOtherOptionHelp(pc, "//host command | --hosts FILE command | --batch FILE //host | --broker SOCKET");
 
 	while ((opt = poptGetNextOpt(pc)) != -1) {
 		DEBUG(0, (version_string, VERSION_MAJOR, VERSION_MINOR));
@@ -88,16 +125,23 @@ void parse_args(int argc, char *argv[], struct program_options *options)
 
 	argv_new = discard_const_p(char *, poptGetArgs(pc));
 
-	argc_new = argc;
-	for (i = 0; i < argc - 1; i++) {
-		if (argv_new[i] == NULL) {
-			argc_new = i;
-			break;
-		}
-	}
+	if (options->hosts_file)
+		max_args = 1;
+	/* batch file replaces the command */
+	if (options->batch_file)
+		max_args--;
+	if (options->broker)
+		max_args = 0;
+
+	for (argc_new = 0; argv_new && argv_new[argc_new]; argc_new++)
+		;
 
-	if (argc_new != 2 || argv_new[0][0] != '/'
-	    || argv_new[0][1] != '/') {
+	if (argc_new != max_args || (!options->hosts_file && !options->broker
+	    && (argv_new[0][0] != '/' || argv_new[0][1] != '/'))
+	    || (options->via_broker && options->hosts_file)
+	    || (options->batch_file && (options->via_broker || options->broker))
+	    || (options->timing_format && strcmp(options->timing_format, "json")
+		&& strcmp(options->timing_format, "csv"))) {
 		DEBUG(0, (version_string, VERSION_MAJOR, VERSION_MINOR));
 		poptPrintUsage(pc, stdout, 0);
 		exit(1);
@@ -118,8 +162,25 @@ void parse_args(int argc, char *argv[], struct program_options *options)
 		}
 	}
 
-	options->hostname = argv_new[0] + 2;
-	options->cmd = argv_new[1];
+	if (options->broker) {
+		;
+	} else if (options->hosts_file) {
+		options->cmd = options->batch_file ? NULL : argv_new[0];
+	} else {
+		options->hostname = argv_new[0] + 2;
+		options->cmd = options->batch_file ? NULL : argv_new[1];
+	}
+	if (options->parallel <= 0)
+		options->parallel = 10;
+	if (options->read_depth <= 0)
+		options->read_depth = 4;
+	if (options->broker_idle <= 0)
+		options->broker_idle = 300;
+	if (options->batch_depth <= 0)
+		options->batch_depth = 4;
+	options->prefix = flag_prefix;
+	options->collate = flag_collate;
+	options->timing_csv = options->timing_format && !strcmp(options->timing_format, "csv");
 	
 	options->flags = flag_interactive;
 	if (flag_reinstall)
@@ -134,52 +195,247 @@ void parse_args(int argc, char *argv[], struct program_options *options)
 		options->flags |= SVC_SYSTEM;
 }
 
-enum {STATE_OPENING, STATE_GETTING_VERSION, STATE_RUNNING, STATE_CLOSING, STATE_CLOSING_FOR_REINSTALL };
+enum {STATE_OPENING, STATE_GETTING_VERSION, STATE_RUNNING, STATE_CLOSING, STATE_CLOSING_FOR_REINSTALL, STATE_DONE };
+
+static const char *state_names[] = { "opening", "getting_version", "running",
+				     "closing", "closing_for_reinstall", "done" };
+
+struct winexe_output {
+	int fd;
+	char *buf;
+	int len;
+	uint64_t bytes;
+};
+
+/* Resource usage of the remote command, see CMD_STATS */
+struct winexe_stats {
+	int valid;
+	unsigned long wall_ms;
+	unsigned long user_ms;
+	unsigned long kernel_ms;
+	unsigned long peak_ws_kb;
+};
+
+struct winexe_fanout;
+struct winexe_batch;
 
 struct winexe_context {
+	struct winexe_context *prev, *next;
 	int state;
 	struct program_options *args;
+	struct winexe_fanout *fanout;
+	const char *cmd;
+	/* set for every command of a batch, the first one owns the connection */
+	struct winexe_batch *batch;
+	int batch_index;
+	struct tevent_context *ev_ctx;
+	const char *hostname;
+	struct smb_composite_connect *io_conn;
 	struct smbcli_tree *tree;
+	struct smb2_tree *tree2;
 	struct async_context *ac_ctrl;
 	struct async_context *ac_in;
 	struct async_context *ac_out;
 	struct async_context *ac_err;
+	struct winexe_output out;
+	struct winexe_output err;
+	struct fd_event *stdin_fde;
+	unsigned int wakeups;
+	int svc_activated;
+	int framed;
+	char *ctrl_buf;
+	int ctrl_len;
+	int svc_arch;
+	int cache_hit;
+	/* service was reinstalled once already, see svc_reinstall() */
+	int reinstalled;
 	int return_code;
+	int svc_version;
+	/* 1 while "error" reply to CMD_STATS from service older than 1.02 is due */
+	int stats_refused;
+	struct winexe_stats stats;
+	/* per phase timing, NULL unless --timing is given */
+	struct winexe_trace *trace;
+	struct timeval begin;		/* connect started */
+	struct timeval start;		/* control pipe opened */
+	struct timeval first_output;
+	/* set for sessions run by broker, NULL for ones started from command line */
+	const struct winexe_session_ops *ops;
+	void *ops_priv;
+	char *in_buf;
+	int in_len;
+	int in_open;
+	int in_eof;
+	int abort_requested;
+	/* output reads held by ops owner, see winexe_session_pause() */
+	int output_paused;
+};
+
+struct winexe_batch_result {
+	int started;
+	int return_code;
+	double secs;
+	uint64_t out_bytes;
+	uint64_t err_bytes;
+};
+
+/*
+  Commands of a batch run on one host, each over its own control pipe
+  instance (and so with its own stdio pipes and return code) on the
+  session of the first command. Others are started once the first one
+  has confirmed the service is usable, so connect, authentication and
+  service checks are done once per host.
+*/
+struct winexe_batch {
+	struct winexe_context *host;
+	struct winexe_context *running;
+	struct winexe_batch_result *results;
+	struct timeval start;
+	int next;
+	int active;
+	int ready;
+	int host_done;
+};
+
+/*
+  Stdout or stderr of the process, shared by all sessions. Pipes and
+  sockets are made non-blocking so a slow reader cannot stall the event
+  loop, data it does not take at once waits here.
+*/
+struct winexe_sink {
+	struct winexe_fanout *f;
+	int fd;
+	int fl;			/* original file status flags, -1 if not changed */
+	char *buf;
+	int len;
+	struct fd_event *fde;
+};
+
+struct winexe_fanout {
+	struct program_options *args;
+	struct tevent_context *ev_ctx;
+	char **hosts;
+	int num_hosts;
+	int next_host;
+	int running;
+	int return_code;
+	struct winexe_context *sessions;
+	int signals_set;
+	int abort_requested;
+	struct winexe_sink sink[3];	/* [1] stdout, [2] stderr */
+	/* output pipes are not read while a sink holds OUTPUT_QUEUE_MAX bytes */
+	int throttled;
 };
 
 void exit_program(struct winexe_context *c);
 
+/* Every state change is a point of the timing record */
+static void set_state(struct winexe_context *c, int state)
+{
+	c->state = state;
+	trace_mark(c->trace, state_names[state]);
+}
+
+/* Service installed on the host is known to be the one we carry */
+static int cache_usable(struct winexe_context *c)
+{
+	struct svc_cache_entry e;
+	uint8_t hash[16];
+	int flags = c->args->flags;
+
+	if (flags & SVC_FORCE_UPLOAD)
+		return 0;
+	if (!svc_cache_fetch(c->args->cache, c->hostname, &e))
+		return 0;
+	svc_cache_hash(hash);
+	if (memcmp(e.hash, hash, 16) || e.version/10 != VERSION/10
+	    || (c->args->framed && e.version < VERSION_FRAMED)
+	    || e.interactive != (flags & SVC_INTERACTIVE))
+		return 0;
+	if (!(flags & SVC_OSCHOOSE) && e.os64bit != -1
+	    && e.os64bit != !!(flags & SVC_OS64BIT))
+		return 0;
+	return 1;
+}
+
+static void cache_update(struct winexe_context *c, int version)
+{
+	struct svc_cache_entry e;
+
+	if (c->cache_hit)
+		return;
+	/* keep flavour if service was already there and we did not upload it */
+	if (c->svc_arch == -1 && svc_cache_fetch(c->args->cache, c->hostname, &e))
+		c->svc_arch = e.os64bit;
+	e.version = version;
+	e.os64bit = c->svc_arch;
+	e.interactive = c->args->flags & SVC_INTERACTIVE;
+	svc_cache_hash(e.hash);
+	svc_cache_store(c->args->cache, c->hostname, &e);
+}
+
+static void ctrl_queue_commands(struct winexe_context *c);
+
+static void on_svc_installed(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+	NTSTATUS status;
+
+	status = svc_install_recv(req, &c->svc_arch);
+	talloc_free(req);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(0,
+		      ("ERROR: Failed to install service winexesvc on %s - %s\n",
+		       c->hostname, nt_errstr(status)));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	c->svc_activated = 1;
+	ctrl_queue_commands(c);
+	async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+}
+
 void on_ctrl_pipe_error(struct winexe_context *c, int func, NTSTATUS status)
 {
 	DEBUG(1, ("ERROR: on_ctrl_pipe_error - %s\n", nt_errstr(status)));
-	static int activated = 0;
-	if (!activated
-	    && NT_STATUS_EQUAL(status, NT_STATUS_OBJECT_NAME_NOT_FOUND)) {
-		status =
-		    svc_install(c->args->hostname, c->args->credentials, c->args->flags);
-		if (!NT_STATUS_IS_OK(status)) {
-			DEBUG(0,
-			      ("ERROR: Failed to install service winexesvc - %s\n",
-			       nt_errstr(status)));
+	if (!c->svc_activated
+	    && (NT_STATUS_EQUAL(status, NT_STATUS_OBJECT_NAME_NOT_FOUND)
+		|| (c->cache_hit && func == ASYNC_OPEN_RECV))) {
+		struct tevent_req *req;
+		if (c->cache_hit) {
+			DEBUG(1, ("Cached service state of %s is stale\n", c->hostname));
+			svc_cache_delete(c->args->cache, c->hostname);
+			c->cache_hit = 0;
+		}
+		req = svc_install_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->args->flags, c->trace);
+		if (req == NULL) {
 			c->return_code = 1;
 			exit_program(c);
+			return;
 		}
-		activated = 1;
-		async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+		tevent_req_set_callback(req, on_svc_installed, c);
 	} else if (func == ASYNC_OPEN_RECV) {
 		DEBUG(0,
-		      ("ERROR: Cannot open control pipe - %s\n",
-		       nt_errstr(status)));
+		      ("ERROR: Cannot open control pipe on %s - %s\n",
+		       c->hostname, nt_errstr(status)));
 		c->return_code = 1;
 		exit_program(c);
 	} else if (func == ASYNC_READ_RECV && c->state == STATE_OPENING) {
 		;
+	} else if (c->state == STATE_CLOSING_FOR_REINSTALL) {
+		/* old service may drop the pipe on commands it does not know */
+		;
 	} else
 		exit_program(c);
 }
 
 void on_in_pipe_open(struct winexe_context *c);
+void on_in_pipe_drain(struct winexe_context *c);
+static void framed_start(struct winexe_context *c);
 
+void on_out_pipe_open(struct winexe_context *c);
+void on_err_pipe_open(struct winexe_context *c);
 void on_out_pipe_read(struct winexe_context *c, const char *data, int len);
 void on_err_pipe_read(struct winexe_context *c, const char *data, int len);
 
@@ -199,104 +455,314 @@ const char *cmd_check(const char *data, const char *cmd, int len)
 	return 0;
 }
 
-void catch_alarm(int sig)
+static void send_abort(struct winexe_context *c)
 {
-	abort_requested = 1;
-	signal(sig, SIG_DFL);
+	/* in framed mode service takes only frames once process is started */
+	if (c->args->framed && !c->framed) {
+		c->abort_requested = 1;
+		return;
+	}
+	fprintf(stderr, "Aborting...\n");
+	if (c->framed)
+		async_write_frame(c->ac_ctrl, FRAMED_ABORT, NULL, 0);
+	else
+		async_write(c->ac_ctrl, "abort\n", 6);
 }
 
-static void timer(struct event_context *ev, struct timed_event *te, struct timeval t, void *private)
+/*
+  Handler is removed after first signal (SA_RESETHAND), so next one
+  kills the program as before.
+*/
+static void on_signal(struct tevent_context *ev, struct tevent_signal *se,
+		      int signum, int count, void *siginfo, void *private)
 {
-	struct winexe_context *c = talloc_get_type(private, struct winexe_context);
-	if (abort_requested) {
-		fprintf(stderr, "Aborting...\n");
-		async_write(c->ac_ctrl, "abort\n", 6);
-	} else
-		event_add_timed(c->tree->session->transport->socket->event.ctx, c, timeval_current_ofs(0, 10000), timer, c);
+	struct winexe_fanout *f = talloc_get_type(private, struct winexe_fanout);
+	struct winexe_context *c, *bc;
+
+	f->abort_requested = 1;
+	for (c = f->sessions; c; c = c->next) {
+		if (c->state == STATE_GETTING_VERSION || c->state == STATE_RUNNING)
+			send_abort(c);
+		for (bc = c->batch ? c->batch->running : NULL; bc; bc = bc->next)
+			if (bc->state == STATE_GETTING_VERSION || bc->state == STATE_RUNNING)
+				send_abort(bc);
+	}
 }
 
-void on_ctrl_pipe_open(struct winexe_context *c)
+/*
+  Version query, settings and run go out in one write. Service handles the
+  lines in order, so its version reply comes before std_io_err; if the
+  version is wrong we never open stdio pipes and the command is not started
+  before the service is reinstalled.
+*/
+/* Queued before the pipe is opened, so SMB2 can send it with the open */
+static void ctrl_queue_commands(struct winexe_context *c)
 {
-	char *str = "get version\n";
+	const char *framed = c->args->framed ? "set framed 1\n" : "";
+	const char *stats = c->args->stats ? CMD_STATS " 1\n" : "";
+	char *str;
 
+	if (c->args->runas)
+		str = talloc_asprintf(c, "get version\n%s%sset runas %s\nrun %s\n", stats, framed, c->args->runas, c->cmd);
+	else
+		str = talloc_asprintf(c, "get version\n%s%s%srun %s\n", stats, framed, (c->args->flags & SVC_SYSTEM) ? "set system 1\n" : "" , c->cmd);
 	DEBUG(1, ("CTRL: Sending command: %s", str));
-	c->state = STATE_GETTING_VERSION;
 	async_write(c->ac_ctrl, str, strlen(str));
-	signal(SIGINT, catch_alarm);
-	signal(SIGTERM, catch_alarm);
-	event_add_timed(c->tree->session->transport->socket->event.ctx, c, timeval_current_ofs(0, 10000), timer, c);
+	talloc_free(str);
 }
 
-void on_ctrl_pipe_read(struct winexe_context *c, const char *data, int len)
+void on_ctrl_pipe_open(struct winexe_context *c)
+{
+	struct winexe_fanout *f = c->fanout;
+
+	set_state(c, STATE_GETTING_VERSION);
+	c->start = timeval_current();
+	if (f && !f->signals_set) {
+		event_add_signal(c->ev_ctx, f, SIGINT, SA_RESETHAND, on_signal, f);
+		event_add_signal(c->ev_ctx, f, SIGTERM, SA_RESETHAND, on_signal, f);
+		f->signals_set = 1;
+	}
+	if ((f && f->abort_requested) || c->abort_requested)
+		send_abort(c);
+}
+
+static void on_ctrl_frame(struct winexe_context *c, int type, const char *data, int len);
+static void batch_fill(struct winexe_batch *b);
+
+/* Takes known keys of CMD_STATS text, others are left for newer clients */
+static void stats_parse(struct winexe_context *c, const char *data, int len)
+{
+	struct winexe_stats *s = &c->stats;
+	char *str, *tok, *save, *v;
+
+	str = talloc_strndup(c, data, len);
+	if (!str)
+		return;
+	for (tok = strtok_r(str, " \r\n", &save); tok; tok = strtok_r(NULL, " \r\n", &save)) {
+		if (!(v = strchr(tok, '=')))
+			continue;
+		*v++ = 0;
+		if (!strcmp(tok, "wall_ms"))
+			s->wall_ms = strtoul(v, NULL, 10);
+		else if (!strcmp(tok, "user_ms"))
+			s->user_ms = strtoul(v, NULL, 10);
+		else if (!strcmp(tok, "kernel_ms"))
+			s->kernel_ms = strtoul(v, NULL, 10);
+		else if (!strcmp(tok, "peak_ws_kb"))
+			s->peak_ws_kb = strtoul(v, NULL, 10);
+	}
+	s->valid = 1;
+	talloc_free(str);
+}
+
+/* Only the first command of a batch installs or reinstalls the service */
+static int batch_member(struct winexe_context *c)
+{
+	return c->batch && c != c->batch->host;
+}
+
+/* Output reads of pipes opened from now on start paused */
+static int session_throttled(struct winexe_context *c)
+{
+	return (c->fanout && c->fanout->throttled) || c->output_paused;
+}
+
+/*
+  Closes the control pipe to reinstall the service. Done once per host,
+  if the embedded service is too old as well reinstalling would loop.
+*/
+static void svc_reinstall(struct winexe_context *c)
+{
+	if (c->reinstalled) {
+		DEBUG(0, ("ERROR: Service on %s is not usable after reinstalling it\n",
+			  c->hostname));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	c->reinstalled = 1;
+	svc_cache_delete(c->args->cache, c->hostname);
+	c->cache_hit = 0;
+	async_close(c->ac_ctrl);
+	set_state(c, STATE_CLOSING_FOR_REINSTALL);
+}
+
+static void on_ctrl_line(struct winexe_context *c, const char *data, int len)
 {
 	const char *p;
-	if ((p = cmd_check(data, CMD_STD_IO_ERR, len))) {
+	if (c->state == STATE_CLOSING_FOR_REINSTALL || c->state == STATE_DONE) {
+		/* replies to commands sent before version check failed */
+		DEBUG(1, ("CTRL: Ignoring: %.*s", len, data));
+	} else if ((p = cmd_check(data, CMD_STD_IO_ERR, len))) {
 		DEBUG(1, ("CTRL: Recieved command: %.*s", len, data));
 		unsigned int npipe = strtoul(p, 0, 16);
 		char *fn;
+		trace_mark(c->trace, "stdio_pipes_announced");
 		// Open in
 		c->ac_in = talloc_zero(c, struct async_context);
 		c->ac_in->tree = c->tree;
+		c->ac_in->tree2 = c->tree2;
 		c->ac_in->cb_ctx = c;
 		c->ac_in->cb_open = (async_cb_open) on_in_pipe_open;
 		c->ac_in->cb_error = (async_cb_error) on_in_pipe_error;
+		c->ac_in->cb_drain = (async_cb_drain) on_in_pipe_drain;
 		fn = talloc_asprintf(c->ac_in, "\\pipe\\" PIPE_NAME_IN, npipe);
 		async_open(c->ac_in, fn, OPENX_MODE_ACCESS_RDWR);
 		// Open out
 		c->ac_out = talloc_zero(c, struct async_context);
 		c->ac_out->tree = c->tree;
+		c->ac_out->tree2 = c->tree2;
 		c->ac_out->cb_ctx = c;
+		c->ac_out->cb_open = (async_cb_open) on_out_pipe_open;
 		c->ac_out->cb_read = (async_cb_read) on_out_pipe_read;
 		c->ac_out->cb_error = (async_cb_error) on_out_pipe_error;
+		c->ac_out->read_size = c->args->read_size;
+		c->ac_out->read_depth = c->args->read_depth;
+		if (session_throttled(c))
+			async_read_pause(c->ac_out, 1);
 		fn = talloc_asprintf(c->ac_out, "\\pipe\\" PIPE_NAME_OUT, npipe);
 		async_open(c->ac_out, fn, OPENX_MODE_ACCESS_RDWR);
 		// Open err
 		c->ac_err = talloc_zero(c, struct async_context);
 		c->ac_err->tree = c->tree;
+		c->ac_err->tree2 = c->tree2;
 		c->ac_err->cb_ctx = c;
+		c->ac_err->cb_open = (async_cb_open) on_err_pipe_open;
 		c->ac_err->cb_read = (async_cb_read) on_err_pipe_read;
 		c->ac_err->cb_error = (async_cb_error) on_err_pipe_error;
+		c->ac_err->read_size = c->args->read_size;
+		c->ac_err->read_depth = c->args->read_depth;
+		if (session_throttled(c))
+			async_read_pause(c->ac_err, 1);
 		fn = talloc_asprintf(c->ac_err, "\\pipe\\" PIPE_NAME_ERR, npipe);
 		async_open(c->ac_err, fn, OPENX_MODE_ACCESS_RDWR);
+	} else if ((p = cmd_check(data, CMD_FRAMED, len))) {
+		DEBUG(1, ("CTRL: Recieved command: %.*s", len, data));
+		framed_start(c);
 	} else if ((p = cmd_check(data, CMD_RETURN_CODE, len))) {
+		trace_mark(c->trace, "return_code");
 		c->return_code = strtoul(p, 0, 16);
+	} else if ((p = cmd_check(data, CMD_STATS, len))) {
+		stats_parse(c, p, data + len - p);
 	} else if ((p = cmd_check(data, "version", len))) {
 		int ver = strtoul(p, 0, 0);
-		if (ver/10 != VERSION/10) {
+		if (!batch_member(c) && c->reinstalled && ver/10 == VERSION/10
+		    && c->args->framed && ver < VERSION_FRAMED) {
+			DEBUG(0, ("ERROR: Service on %s is %d.%02d, --framed needs %d.%02d or newer\n",
+				  c->hostname, ver/100, ver%100, VERSION_FRAMED/100, VERSION_FRAMED%100));
+			c->return_code = 1;
+			exit_program(c);
+		} else if (!batch_member(c) && (ver/10 != VERSION/10 || (c->args->framed && ver < VERSION_FRAMED))) {
 			DEBUG(1, ("CTRL: Bad version of service (is %d.%02d, expected %d.%02d), reinstalling.\n", ver/100, ver%100, VERSION/100, VERSION%100));
-			async_close(c->ac_ctrl);
-			c->state = STATE_CLOSING_FOR_REINSTALL;
+			svc_reinstall(c);
 		} else {
-			char *str;
-			if (c->args->runas)
-				str = talloc_asprintf(c, "set runas %s\nrun %s\n", c->args->runas, c->args->cmd);
-			else
-				str = talloc_asprintf(c, "%srun %s\n", (c->args->flags & SVC_SYSTEM) ? "set system 1\n" : "" , c->args->cmd);
-			DEBUG(1, ("CTRL: Sending command: %s", str));
-			async_write(c->ac_ctrl, str, strlen(str));
-			talloc_free(str);
-			c->state = STATE_RUNNING;
+			cache_update(c, ver);
+			c->svc_version = ver;
+			/* old service answers CMD_STATS with error and goes on */
+			c->stats_refused = c->args->stats && ver < VERSION_STATS;
+			set_state(c, STATE_RUNNING);
+			if (c->batch && !c->batch->ready) {
+				c->batch->ready = 1;
+				batch_fill(c->batch);
+			}
 		}
+	} else if (c->stats_refused && cmd_check(data, "error", len)) {
+		DEBUG(1, ("CTRL: Service does not report stats: %.*s", len, data));
+		c->stats_refused = 0;
 	} else if ((p = cmd_check(data, "error", len))) {
 		DEBUG(0, ("Error: %.*s", len, data));
-		if (c->state == STATE_GETTING_VERSION) {
+		if (c->state == STATE_GETTING_VERSION && !batch_member(c)) {
 			DEBUG(0, ("CTRL: Probably old version of service, reinstalling.\n"));
-			async_close(c->ac_ctrl);
-			c->state = STATE_CLOSING_FOR_REINSTALL;
+			svc_reinstall(c);
 		}
 	} else {
 		DEBUG(0, ("CTRL: Unknown command: %.*s", len, data));
 	}
 }
 
+/* Replies to pipelined commands can come in one read, handle them line by line */
+void on_ctrl_pipe_read(struct winexe_context *c, const char *data, int len)
+{
+	char *nl;
+	int n;
+
+	c->ctrl_buf = talloc_realloc(c, c->ctrl_buf, char, c->ctrl_len + len);
+	if (!c->ctrl_buf) {
+		c->ctrl_len = 0;
+		return;
+	}
+	memcpy(c->ctrl_buf + c->ctrl_len, data, len);
+	c->ctrl_len += len;
+	while (!c->framed && (nl = memchr(c->ctrl_buf, '\n', c->ctrl_len))) {
+		n = nl - c->ctrl_buf + 1;
+		on_ctrl_line(c, c->ctrl_buf, n);
+		memmove(c->ctrl_buf, c->ctrl_buf + n, c->ctrl_len - n);
+		c->ctrl_len -= n;
+	}
+	/* rest of the data after CMD_FRAMED line are frames */
+	if (c->framed) {
+		n = async_frames_parse(c->ctrl_buf, c->ctrl_len, FRAMED_MAX,
+				       (async_cb_frame) on_ctrl_frame, c);
+		if (n < 0) {
+			DEBUG(0, ("CTRL: Malformed frame from %s\n", c->hostname));
+			c->ctrl_len = 0;
+			exit_program(c);
+			return;
+		}
+		memmove(c->ctrl_buf, c->ctrl_buf + n, c->ctrl_len - n);
+		c->ctrl_len -= n;
+	}
+}
+
+static void on_svc_reinstalled(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+	NTSTATUS status;
+
+	status = svc_install_recv(req, &c->svc_arch);
+	talloc_free(req);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(0,
+		      ("ERROR: Failed to reinstall service winexesvc on %s - %s\n",
+		       c->hostname, nt_errstr(status)));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	set_state(c, STATE_OPENING);
+	c->ctrl_len = 0;
+	/* commands queued for the first open went out with it */
+	ctrl_queue_commands(c);
+	async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+}
+
+static void on_svc_uninstalled_for_reinstall(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+
+	svc_uninstall_recv(req);
+	talloc_free(req);
+	req = svc_install_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->args->flags, c->trace);
+	if (req == NULL) {
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	tevent_req_set_callback(req, on_svc_reinstalled, c);
+}
+
 void on_ctrl_pipe_close(struct winexe_context *c)
 {
 	if (c->state == STATE_CLOSING_FOR_REINSTALL) {
+		struct tevent_req *req;
 		DEBUG(1,("Reinstalling service\n"));
-		svc_uninstall(c->args->hostname, c->args->credentials);
-		svc_install(c->args->hostname, c->args->credentials, c->args->flags);
-		c->state = STATE_OPENING;
-		async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+		req = svc_uninstall_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->trace);
+		if (req == NULL) {
+			c->return_code = 1;
+			exit_program(c);
+			return;
+		}
+		tevent_req_set_callback(req, on_svc_uninstalled_for_reinstall, c);
 	}
 }
 
@@ -304,30 +770,340 @@ static void on_stdin_read_event(struct event_context *event_ctx,
 			     struct fd_event *fde, uint16_t flags,
 			     struct winexe_context *c)
 {
-	char buf[256];
+	struct async_context *ac = c->framed ? c->ac_ctrl : c->ac_in;
+	char *buf;
 	int len;
-	if ((len = read(0, &buf, sizeof(buf))) > 0) {
-		async_write(c->ac_in, buf, len);
-	} else {
-		usleep(10);
+
+	c->wakeups++;
+	/* stop reading stdin until the queued data is sent */
+	if (async_write_queued(ac) >= STDIN_QUEUE_MAX) {
+		EVENT_FD_NOT_READABLE(fde);
+		return;
+	}
+	if (c->framed) {
+		char data[16384];
+		len = read(0, data, sizeof(data));
+		if (len < 0 && (errno == EAGAIN || errno == EINTR))
+			return;
+		async_write_frame(ac, FRAMED_STDIN, data, MAX(len, 0));
+		/* empty frame closes remote stdin */
+		if (len <= 0)
+			TALLOC_FREE(c->stdin_fde);
+		return;
+	}
+	buf = async_write_space(c->ac_in, &len);
+	if (!buf) {
+		/* the ring could not grow, wait until it drains */
+		EVENT_FD_NOT_READABLE(fde);
+		return;
 	}
+	len = read(0, buf, len);
+	if (len < 0 && (errno == EAGAIN || errno == EINTR))
+		return;
+	if (len > 0) {
+		async_write_commit(c->ac_in, len);
+		return;
+	}
+	/* EOF or error, remote stdin is closed once the queue is sent */
+	TALLOC_FREE(c->stdin_fde);
+	c->in_eof = 1;
+	if (!async_write_queued(c->ac_in))
+		async_close(c->ac_in);
 }
 
-void on_in_pipe_open(struct winexe_context *c)
+void on_in_pipe_drain(struct winexe_context *c)
+{
+	if (c->in_eof && !c->framed)
+		async_close(c->ac_in);
+	if (c->stdin_fde)
+		EVENT_FD_READABLE(c->stdin_fde);
+}
+
+static void stdin_start(struct winexe_context *c)
 {
-	event_add_fd(c->tree->session->transport->socket->event.ctx,
-		     c->tree, 0, EVENT_FD_READ,
-		     (event_fd_handler_t) on_stdin_read_event, c);
 	struct termios term;
+
+	c->stdin_fde = event_add_fd(c->ev_ctx, c, 0, EVENT_FD_READ,
+		     (event_fd_handler_t) on_stdin_read_event, c);
 	tcgetattr(0, &term);
 	term.c_lflag &= ~ICANON;
 	tcsetattr(0, TCSANOW, &term);
 	setbuf(stdin, NULL);
 }
 
+void on_in_pipe_open(struct winexe_context *c)
+{
+	trace_mark(c->trace, "stdin_open");
+	if (c->ops) {
+		c->in_open = 1;
+		/* pass input which came before the pipe was open */
+		async_write(c->ac_in, c->in_buf, c->in_len);
+		TALLOC_FREE(c->in_buf);
+		c->in_len = 0;
+		if (c->in_eof && !async_write_queued(c->ac_in))
+			async_close(c->ac_in);
+		return;
+	}
+	if (c->args->hosts_file || c->batch) {
+		/* stdin is not shared between hosts or commands, remote side gets EOF */
+		async_close(c->ac_in);
+		return;
+	}
+	stdin_start(c);
+}
+
+/* Sends stdin data in frames small enough for the service, len 0 is EOF */
+static void framed_input(struct winexe_context *c, const char *data, int len)
+{
+	do {
+		int l = MIN(len, FRAMED_MAX);
+		async_write_frame(c->ac_ctrl, FRAMED_STDIN, data, l);
+		data += l;
+		len -= l;
+	} while (len > 0);
+}
+
+/* Process is started, from now on its stdio goes over control pipe */
+static void framed_start(struct winexe_context *c)
+{
+	struct winexe_fanout *f = c->fanout;
+
+	trace_mark(c->trace, "framed");
+	c->framed = 1;
+	c->ac_ctrl->cb_drain = (async_cb_drain) on_in_pipe_drain;
+	if (session_throttled(c))
+		async_read_pause(c->ac_ctrl, 1);
+	if (c->ops) {
+		c->in_open = 1;
+		if (c->in_len)
+			framed_input(c, c->in_buf, c->in_len);
+		TALLOC_FREE(c->in_buf);
+		c->in_len = 0;
+		if (c->in_eof)
+			framed_input(c, NULL, 0);
+	} else if (c->args->hosts_file || c->batch) {
+		framed_input(c, NULL, 0);
+	} else {
+		stdin_start(c);
+	}
+	if ((f && f->abort_requested) || c->abort_requested)
+		send_abort(c);
+}
+
+/* Output of a paused session piles up on the server until it is resumed */
+static void session_read_pause(struct winexe_context *c, int pause)
+{
+	if (c->ac_out)
+		async_read_pause(c->ac_out, pause);
+	if (c->ac_err)
+		async_read_pause(c->ac_err, pause);
+	if (c->framed)
+		async_read_pause(c->ac_ctrl, pause);
+}
+
+/* Half of the limit must be written before reading starts again */
+static void sink_throttle(struct winexe_fanout *f)
+{
+	struct winexe_context *c, *bc;
+	int queued = MAX(f->sink[1].len, f->sink[2].len);
+	int pause;
+
+	if (!f->throttled && queued >= OUTPUT_QUEUE_MAX)
+		pause = 1;
+	else if (f->throttled && queued < OUTPUT_QUEUE_MAX / 2)
+		pause = 0;
+	else
+		return;
+	DEBUG(1, ("%s output pipes, %d bytes queued\n", pause ? "Pausing" : "Resuming", queued));
+	f->throttled = pause;
+	for (c = f->sessions; c; c = c->next) {
+		session_read_pause(c, pause);
+		for (bc = c->batch ? c->batch->running : NULL; bc; bc = bc->next)
+			session_read_pause(bc, pause);
+	}
+}
+
+/* Writes as much as fd takes without blocking, returns number of bytes written */
+static int sink_try_write(struct winexe_sink *s, const char *data, int len)
+{
+	int n = 0, w;
+
+	while (n < len) {
+		w = write(s->fd, data + n, len - n);
+		if (w < 0 && errno == EINTR)
+			continue;
+		if (w < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+			/* reader is gone, nothing will ever take the rest */
+			DEBUG(1, ("Cannot write to fd %d - %s\n", s->fd, strerror(errno)));
+			return len;
+		}
+		if (w <= 0)
+			break;
+		n += w;
+	}
+	return n;
+}
+
+static void sink_flush(struct winexe_sink *s)
+{
+	int n = sink_try_write(s, s->buf, s->len);
+
+	memmove(s->buf, s->buf + n, s->len - n);
+	s->len -= n;
+	if (s->len)
+		EVENT_FD_WRITEABLE(s->fde);
+	else
+		EVENT_FD_NOT_WRITEABLE(s->fde);
+	sink_throttle(s->f);
+}
+
+static void on_sink_writable(struct event_context *ev, struct fd_event *fde,
+			     uint16_t flags, struct winexe_sink *s)
+{
+	sink_flush(s);
+}
+
+static void sink_write(struct winexe_sink *s, const char *data, int len)
+{
+	char *buf;
+	int n = 0;
+
+	/* queued data goes first */
+	if (!s->len)
+		n = sink_try_write(s, data, len);
+	if (n == len)
+		return;
+	buf = talloc_realloc(s->f, s->buf, char, s->len + len - n);
+	if (!buf)
+		return;
+	s->buf = buf;
+	memcpy(s->buf + s->len, data + n, len - n);
+	s->len += len - n;
+	EVENT_FD_WRITEABLE(s->fde);
+	sink_throttle(s->f);
+}
+
+static void sink_init(struct winexe_fanout *f, int fd)
+{
+	struct winexe_sink *s = &f->sink[fd];
+	struct stat st;
+
+	s->f = f;
+	s->fd = fd;
+	s->fl = -1;
+	/* terminals and files are left alone, writes to them do not stall for long */
+	if (fstat(fd, &st) == 0 && (S_ISFIFO(st.st_mode) || S_ISSOCK(st.st_mode))) {
+		s->fl = fcntl(fd, F_GETFL);
+		if (s->fl != -1)
+			fcntl(fd, F_SETFL, s->fl | O_NONBLOCK);
+	}
+	s->fde = event_add_fd(f->ev_ctx, f, fd, 0,
+			      (event_fd_handler_t) on_sink_writable, s);
+}
+
+/* Writes out everything still queued, blocking, and exits */
+static void fanout_exit(struct winexe_fanout *f, int return_code)
+{
+	int fd;
+
+	for (fd = 1; fd <= 2; ++fd) {
+		struct winexe_sink *s = &f->sink[fd];
+
+		if (s->fl != -1)
+			fcntl(fd, F_SETFL, s->fl);
+		if (s->len)
+			write(fd, s->buf, s->len);
+	}
+	exit(return_code);
+}
+
+/*
+  Appends data to output buffer, prefixing each line with host name if
+  needed. Output is dropped if the buffer cannot grow.
+*/
+static void output_append(struct winexe_context *c, struct winexe_output *o,
+			  const char *data, int len)
+{
+	while (len > 0) {
+		const char *nl = memchr(data, '\n', len);
+		int l = nl ? nl - data + 1 : len;
+		if (c->args->prefix && (!o->len || o->buf[o->len - 1] == '\n')) {
+			int lh = strlen(c->hostname);
+			o->buf = talloc_realloc(c, o->buf, char, o->len + lh + 2);
+			if (!o->buf) {
+				o->len = 0;
+				return;
+			}
+			memcpy(o->buf + o->len, c->hostname, lh);
+			memcpy(o->buf + o->len + lh, ": ", 2);
+			o->len += lh + 2;
+		}
+		o->buf = talloc_realloc(c, o->buf, char, o->len + l);
+		if (!o->buf) {
+			o->len = 0;
+			return;
+		}
+		memcpy(o->buf + o->len, data, l);
+		o->len += l;
+		data += l;
+		len -= l;
+	}
+}
+
+static void output_flush(struct winexe_context *c, struct winexe_output *o, int all)
+{
+	int len = o->len;
+	if (!all)
+		while (len > 0 && o->buf[len - 1] != '\n')
+			--len;
+	if (len > 0) {
+		sink_write(&c->fanout->sink[o->fd], o->buf, len);
+		memmove(o->buf, o->buf + len, o->len - len);
+		o->len -= len;
+	}
+	if (all && o->len) {
+		sink_write(&c->fanout->sink[o->fd], "\n", 1);
+		o->len = 0;
+	}
+}
+
+static void output_write(struct winexe_context *c, struct winexe_output *o,
+			 const char *data, int len)
+{
+	if (!c->out.bytes && !c->err.bytes && len > 0) {
+		c->first_output = timeval_current();
+		trace_mark_at(c->trace, "first_output", c->first_output);
+	}
+	o->bytes += len;
+	if (c->args->benchmark)
+		return;
+	if (c->ops) {
+		c->ops->output(c->ops_priv, o->fd, data, len);
+		return;
+	}
+	if (!c->args->prefix && !c->args->collate) {
+		sink_write(&c->fanout->sink[o->fd], data, len);
+		return;
+	}
+	output_append(c, o, data, len);
+	/* prefixed output is written line by line so hosts don't mix */
+	if (!c->args->collate)
+		output_flush(c, o, 0);
+}
+
+void on_out_pipe_open(struct winexe_context *c)
+{
+	trace_mark(c->trace, "stdout_open");
+}
+
+void on_err_pipe_open(struct winexe_context *c)
+{
+	trace_mark(c->trace, "stderr_open");
+}
+
 void on_out_pipe_read(struct winexe_context *c, const char *data, int len)
 {
-	write(1, data, len);
+	output_write(c, &c->out, data, len);
 }
 
 void on_in_pipe_error(struct winexe_context *c, int func, NTSTATUS status)
@@ -342,7 +1118,7 @@ void on_out_pipe_error(struct winexe_context *c, int func, NTSTATUS status)
 
 void on_err_pipe_read(struct winexe_context *c, const char *data, int len)
 {
-	write(2, data, len);
+	output_write(c, &c->err, data, len);
 }
 
 void on_err_pipe_error(struct winexe_context *c, int func, NTSTATUS status)
@@ -350,138 +1126,672 @@ void on_err_pipe_error(struct winexe_context *c, int func, NTSTATUS status)
 	async_close(c->ac_err);
 }
 
+static void on_ctrl_frame(struct winexe_context *c, int type, const char *data, int len)
+{
+	switch (type) {
+	case FRAMED_STDOUT:
+		output_write(c, &c->out, data, len);
+		break;
+	case FRAMED_STDERR:
+		output_write(c, &c->err, data, len);
+		break;
+	case FRAMED_RETURN_CODE:
+		trace_mark(c->trace, "return_code");
+		if (len >= 4)
+			c->return_code = IVAL(data, 0);
+		break;
+	case FRAMED_STATS:
+		stats_parse(c, data, len);
+		break;
+	default:
+		DEBUG(0, ("CTRL: Unknown frame type %d\n", type));
+	}
+}
+
+void fanout_next(struct winexe_fanout *f);
+
+/* Pipes go first, their pending requests live on the tree */
+static void session_free(struct winexe_context *c)
+{
+	struct winexe_context *bc;
+
+	for (bc = c->batch ? c->batch->running : NULL; bc; bc = bc->next)
+		session_free(bc);
+	TALLOC_FREE(c->ac_in);
+	TALLOC_FREE(c->ac_out);
+	TALLOC_FREE(c->ac_err);
+	TALLOC_FREE(c->ac_ctrl);
+}
+
+static void host_cleanup(struct event_context *ev, struct timed_event *te, struct timeval t, void *private)
+{
+	struct winexe_context *c = talloc_get_type(private, struct winexe_context);
+	struct winexe_fanout *f = c->fanout;
+
+	session_free(c);
+	if (f)
+		DLIST_REMOVE(f->sessions, c);
+	talloc_free(c);
+	if (!f)
+		return;
+	f->running--;
+	fanout_next(f);
+}
+
+static void finish_host(struct winexe_context *c)
+{
+	struct winexe_fanout *f = c->fanout;
+
+	output_flush(c, &c->out, 1);
+	output_flush(c, &c->err, 1);
+	if (c->trace)
+		trace_write(c->trace, c->args->timing, c->args->timing_csv, c->return_code);
+	if (c->ops) {
+		c->ops->finish(c->ops_priv, c->return_code);
+		event_add_timed(c->ev_ctx, c->ev_ctx, timeval_zero(), host_cleanup, c);
+		return;
+	}
+	if (!c->args->hosts_file)
+		fanout_exit(f, c->return_code);
+	fprintf(stderr, "%s: return code %d\n", c->hostname, c->return_code);
+	if (c->return_code > f->return_code)
+		f->return_code = c->return_code;
+	/* context can still be referenced by the caller, free it later */
+	event_add_timed(c->ev_ctx, f, timeval_zero(), host_cleanup, c);
+}
+
+/* Reports amount of command output and its rate since "run" was sent */
+static void report_throughput(struct winexe_context *c)
+{
+	double secs = timeval_elapsed(&c->start);
+	uint64_t total = c->out.bytes + c->err.bytes;
+
+	if (!c->start.tv_sec)
+		return;
+	if (c->begin.tv_sec)
+		fprintf(stderr, "%s: control pipe open after %.3f s, first output after %.3f s\n",
+			c->hostname, timeval_elapsed2(&c->begin, &c->start),
+			c->first_output.tv_sec ? timeval_elapsed2(&c->begin, &c->first_output) : 0.0);
+	fprintf(stderr, "%s: stdout %llu bytes, stderr %llu bytes in %.3f s, %.2f MB/s\n",
+		c->hostname, (unsigned long long)c->out.bytes,
+		(unsigned long long)c->err.bytes, secs,
+		secs > 0 ? total / secs / (1024 * 1024) : 0.0);
+	if (c->tree) {
+		struct smbcli_transport_stats *st = &c->tree->session->transport->stats;
+		fprintf(stderr, "%s: %llu SMB requests, %llu request pools allocated, %llu reused, %llu unpooled\n",
+			c->hostname, (unsigned long long)st->requests,
+			(unsigned long long)st->pool_allocs,
+			(unsigned long long)st->pool_reuses,
+			(unsigned long long)st->unpooled);
+	}
+}
+
+static void report_stats(struct winexe_context *c)
+{
+	struct winexe_stats *s = &c->stats;
+
+	if (c->batch)
+		fprintf(stderr, "%s: [%d] ", c->hostname, c->batch_index);
+	else
+		fprintf(stderr, "%s: ", c->hostname);
+	if (!s->valid) {
+		if (c->svc_version && c->svc_version < VERSION_STATS)
+			fprintf(stderr, "no resource usage, service %d.%02d does not report it\n",
+				c->svc_version / 100, c->svc_version % 100);
+		else
+			fprintf(stderr, "no resource usage\n");
+		return;
+	}
+	fprintf(stderr, "wall %.3f s, user %.3f s, kernel %.3f s, peak working set %lu KB\n",
+		s->wall_ms / 1000.0, s->user_ms / 1000.0, s->kernel_ms / 1000.0, s->peak_ws_kb);
+}
+
+/* Number of times the event loop woke up on behalf of this session */
+static unsigned int session_wakeups(struct winexe_context *c)
+{
+	unsigned int n = c->wakeups;
+
+	if (c->ac_ctrl)
+		n += c->ac_ctrl->wakeups;
+	if (c->ac_in)
+		n += c->ac_in->wakeups;
+	if (c->ac_out)
+		n += c->ac_out->wakeups;
+	if (c->ac_err)
+		n += c->ac_err->wakeups;
+	return n;
+}
+
+static void on_svc_uninstalled(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+
+	svc_uninstall_recv(req);
+	talloc_free(req);
+	finish_host(c);
+}
+
+static void host_exit(struct winexe_context *c);
+static void ctrl_open(struct winexe_context *c);
+
+static void batch_cleanup(struct event_context *ev, struct timed_event *te, struct timeval t, void *private)
+{
+	struct winexe_context *c = talloc_get_type(private, struct winexe_context);
+
+	session_free(c);
+	talloc_free(c);
+}
+
+/* Starts queued commands while there is room and the host is usable */
+static void batch_fill(struct winexe_batch *b)
+{
+	struct winexe_context *h = b->host;
+	struct winexe_context *c;
+
+	while (b->ready && b->active < h->args->batch_depth
+	       && b->next < h->args->batch_num && !h->abort_requested
+	       && !(h->fanout && h->fanout->abort_requested)) {
+		c = talloc_zero(b, struct winexe_context);
+		if (!c)
+			return;
+		c->args = h->args;
+		c->fanout = h->fanout;
+		c->ev_ctx = h->ev_ctx;
+		c->hostname = h->hostname;
+		c->tree = h->tree;
+		c->tree2 = h->tree2;
+		c->batch = b;
+		c->batch_index = b->next++;
+		c->cmd = h->args->batch_cmds[c->batch_index];
+		c->out.fd = 1;
+		c->err.fd = 2;
+		c->return_code = 99;
+		c->svc_arch = -1;
+		/* service is known to be there, nothing to install or cache */
+		c->svc_activated = 1;
+		c->cache_hit = 1;
+		b->results[c->batch_index].started = 1;
+		b->active++;
+		DLIST_ADD(b->running, c);
+		ctrl_open(c);
+	}
+}
+
+static void batch_report(struct winexe_batch *b)
+{
+	struct winexe_context *h = b->host;
+	int i;
+
+	for (i = 0; i < h->args->batch_num; ++i) {
+		struct winexe_batch_result *r = &b->results[i];
+
+		if (!r->started) {
+			fprintf(stderr, "%s: [%d] not run: %s\n", h->hostname, i, h->args->batch_cmds[i]);
+			h->return_code = MAX(h->return_code, 99);
+			continue;
+		}
+		fprintf(stderr, "%s: [%d] return code %d, %.3f s, stdout %llu, stderr %llu bytes: %s\n",
+			h->hostname, i, r->return_code, r->secs,
+			(unsigned long long)r->out_bytes, (unsigned long long)r->err_bytes,
+			h->args->batch_cmds[i]);
+		h->return_code = MAX(h->return_code, r->return_code);
+	}
+	fprintf(stderr, "%s: %d of %d commands run in %.3f s\n", h->hostname,
+		b->next, h->args->batch_num, timeval_elapsed(&b->start));
+}
+
+/*
+  Records result of a batch command. Returns 1 if exit of the host must
+  wait for commands still running, finished commands other than the
+  first are freed here.
+*/
+static int batch_done(struct winexe_context *c)
+{
+	struct winexe_batch *b = c->batch;
+	struct winexe_batch_result *r = &b->results[c->batch_index];
+	struct winexe_context *h = b->host;
+
+	r->return_code = c->return_code;
+	r->secs = c->start.tv_sec ? timeval_elapsed(&c->start) : 0;
+	r->out_bytes = c->out.bytes;
+	r->err_bytes = c->err.bytes;
+	b->active--;
+	if (c == h) {
+		b->host_done = 1;
+		h->return_code = 0;
+	} else {
+		output_flush(c, &c->out, 1);
+		output_flush(c, &c->err, 1);
+		DLIST_REMOVE(b->running, c);
+		event_add_timed(c->ev_ctx, b, timeval_zero(), batch_cleanup, c);
+	}
+	/* the session of the first command outlives it, keep the queue going */
+	batch_fill(b);
+	/* first command ends the batch only after it has started the rest */
+	if (!b->host_done || b->active)
+		return 1;
+	batch_report(b);
+	if (c != h)
+		host_exit(h);
+	return c != h;
+}
+
 void exit_program(struct winexe_context *c)
 {
-	if (c->args->flags & SVC_UNINSTALL)
-		svc_uninstall(c->args->hostname, c->args->credentials);
-	exit(c->return_code);
+	if (c->state == STATE_DONE)
+		return;
+	set_state(c, STATE_DONE);
+	if (c->args->benchmark)
+		report_throughput(c);
+	if (c->args->stats)
+		report_stats(c);
+	DEBUG(1, ("%s: %u event loop wakeups\n", c->hostname, session_wakeups(c)));
+	if (c->batch && batch_done(c))
+		return;
+	host_exit(c);
+}
+
+/* Uninstalls service if requested, then finishes the host */
+static void host_exit(struct winexe_context *c)
+{
+	if ((c->args->flags & SVC_UNINSTALL) && (c->tree || c->tree2)) {
+		struct tevent_req *req;
+		svc_cache_delete(c->args->cache, c->hostname);
+		req = svc_uninstall_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->trace);
+		if (req) {
+			tevent_req_set_callback(req, on_svc_uninstalled, c);
+			return;
+		}
+	}
+	finish_host(c);
+}
+
+static void ctrl_open(struct winexe_context *c)
+{
+	c->ac_ctrl = talloc_zero(c, struct async_context);
+	c->ac_ctrl->tree = c->tree;
+	c->ac_ctrl->tree2 = c->tree2;
+	c->ac_ctrl->cb_ctx = c;
+	c->ac_ctrl->cb_open = (async_cb_open) on_ctrl_pipe_open;
+	c->ac_ctrl->cb_read = (async_cb_read) on_ctrl_pipe_read;
+	c->ac_ctrl->cb_error = (async_cb_error) on_ctrl_pipe_error;
+	c->ac_ctrl->cb_close = (async_cb_close) on_ctrl_pipe_close;
+	set_state(c, STATE_OPENING);
+	ctrl_queue_commands(c);
+	async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+}
+
+static void on_start_installed(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+
+	svc_install_recv(req, &c->svc_arch);
+	talloc_free(req);
+	ctrl_open(c);
+}
+
+/* Installs service (unless it should be done on demand) before opening control pipe */
+static void host_install(struct winexe_context *c)
+{
+	struct tevent_req *req;
+
+	if (c->args->flags & SVC_IGNORE_INTERACTIVE) {
+		ctrl_open(c);
+		return;
+	}
+	/* warm run, falls back to install if control pipe cannot be opened */
+	if (cache_usable(c)) {
+		DEBUG(1, ("Service on %s is up to date according to cache\n", c->hostname));
+		c->cache_hit = 1;
+		ctrl_open(c);
+		return;
+	}
+	req = svc_install_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->args->flags, c->trace);
+	if (req == NULL) {
+		ctrl_open(c);
+		return;
+	}
+	tevent_req_set_callback(req, on_start_installed, c);
+}
+
+static void on_start_uninstalled(struct tevent_req *req)
+{
+	struct winexe_context *c = tevent_req_callback_data(req, struct winexe_context);
+
+	svc_uninstall_recv(req);
+	talloc_free(req);
+	host_install(c);
 }
 
-struct tevent_context *ev_ctx;
+/*
+  All traffic to the host (upload to ADMIN$, svcctl and our pipes on IPC$)
+  goes through this one session.
+*/
+static void host_start(struct winexe_context *c);
+
+static void on_connect(struct composite_context *creq)
+{
+	struct winexe_context *c = talloc_get_type(creq->async.private_data, struct winexe_context);
+	NTSTATUS status;
+
+	status = smb_composite_connect_recv(creq, c);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(0,
+		      ("ERROR: Failed to open connection to %s - %s\n",
+		       c->hostname, nt_errstr(status)));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	trace_mark_at(c->trace, "resolved", c->io_conn->out.resolved);
+	trace_mark_at(c->trace, "tcp_connected", c->io_conn->out.connected);
+	trace_mark_at(c->trace, "negotiated", c->io_conn->out.negotiated);
+	trace_mark_at(c->trace, "session_setup", c->io_conn->out.session_setup);
+	trace_mark(c->trace, "tree_connected");
+	c->tree = c->io_conn->out.tree;
+	host_start(c);
+}
 
-struct composite_context *smbcli_tree_full_connection_send(TALLOC_CTX *parent_ctx,
-				     const char *dest_host, const char **dest_ports,
-				     const char *service, const char *service_type,
-					 const char *socket_options,
-				     struct cli_credentials *credentials,
-				     struct resolve_context *resolve_ctx,
-				     struct tevent_context *ev,
-				     struct smbcli_options *options,
-				     struct smbcli_session_options *session_options,
-					 struct smb_iconv_convenience *iconv_convenience,
-					 struct gensec_settings *gensec_settings)
+static void on_connect2(struct composite_context *creq)
 {
-	struct smb_composite_connect *io;
+	struct winexe_context *c = talloc_get_type(creq->async.private_data, struct winexe_context);
 	NTSTATUS status;
-	io = talloc_zero(parent_ctx, struct smb_composite_connect);
-	if (!io) {
+
+	status = smb2_connect_recv(creq, c, &c->tree2);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(0,
+		      ("ERROR: Failed to open SMB2 connection to %s - %s\n",
+		       c->hostname, nt_errstr(status)));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	/* smb2_connect does not report its steps, only the end of all of them */
+	trace_mark(c->trace, "tree_connected");
+	/* pipe reads are parked on the server, keep a credit for each */
+	smb2_transport_credits_ask_num(c->tree2->session->transport, 4 * ASYNC_READ_MAX_DEPTH);
+	host_start(c);
+}
+
+static void host_start(struct winexe_context *c)
+{
+	struct tevent_req *req;
+
+	if (c->args->flags & SVC_FORCE_UPLOAD) {
+		req = svc_uninstall_send(c, c->ev_ctx, c->tree, c->tree2, c->hostname, c->trace);
+		if (req) {
+			tevent_req_set_callback(req, on_start_uninstalled, c);
+			return;
+		}
+	}
+	host_install(c);
+}
+
+static void start_host(struct winexe_fanout *f, const char *hostname)
+{
+	struct winexe_context *c;
+	struct composite_context *creq;
+
+	c = talloc_zero(f, struct winexe_context);
+	if (c == NULL) {
+		DEBUG(0,
+		      ("ERROR: Failed to allocate struct winexe_context\n"));
+		exit(1);
+	}
+	f->running++;
+	DLIST_ADD(f->sessions, c);
+	c->fanout = f;
+	c->args = f->args;
+	c->ev_ctx = f->ev_ctx;
+	c->hostname = talloc_strdup(c, hostname);
+	c->cmd = c->args->cmd;
+	c->out.fd = 1;
+	c->err.fd = 2;
+	c->return_code = 99;
+	c->svc_arch = -1;
+	if (c->args->timing)
+		c->trace = trace_new(c, c->hostname);
+	set_state(c, STATE_OPENING);
+	c->begin = timeval_current();
+	if (c->args->batch_num) {
+		c->batch = talloc_zero(c, struct winexe_batch);
+		c->batch->results = talloc_zero_array(c->batch, struct winexe_batch_result,
+						      c->args->batch_num);
+		if (!c->batch->results) {
+			DEBUG(0,
+			      ("ERROR: Failed to allocate struct winexe_batch\n"));
+			exit(1);
+		}
+		c->batch->host = c;
+		c->batch->start = timeval_current();
+		c->batch->results[0].started = 1;
+		c->batch->next = 1;
+		c->batch->active = 1;
+		c->cmd = c->args->batch_cmds[0];
+	}
+
+	if (c->args->smb2) {
+		struct smbcli_options options;
+
+		lp_smbcli_options(cmdline_lp_ctx, &options);
+		creq = smb2_connect_send(c, c->hostname, lp_smb_ports(cmdline_lp_ctx), "IPC$",
+					 lp_resolve_context(cmdline_lp_ctx), c->args->credentials,
+					 c->ev_ctx, &options, lp_socket_options(cmdline_lp_ctx),
+					 lp_gensec_settings(c, cmdline_lp_ctx));
+		if (creq) {
+			creq->async.fn = on_connect2;
+			creq->async.private_data = c;
+			return;
+		}
+		DEBUG(0,
+		      ("ERROR: Failed to open connection to %s\n", c->hostname));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	c->io_conn = svc_connect_io(c, c->hostname, "IPC$", c->args->credentials);
+	if (c->io_conn)
+		creq = smb_composite_connect_send(c->io_conn, c, lp_resolve_context(cmdline_lp_ctx), c->ev_ctx);
+	else
+		creq = NULL;
+	if (creq == NULL) {
+		DEBUG(0,
+		      ("ERROR: Failed to open connection to %s\n", c->hostname));
+		c->return_code = 1;
+		exit_program(c);
+		return;
+	}
+	creq->async.fn = on_connect;
+	creq->async.private_data = c;
+}
+
+struct winexe_context *winexe_session_start(TALLOC_CTX *mem_ctx,
+					    struct tevent_context *ev_ctx,
+					    struct program_options *args,
+					    const char *hostname,
+					    struct smbcli_tree *tree,
+					    const struct winexe_session_ops *ops,
+					    void *priv)
+{
+	struct winexe_context *c;
+
+	c = talloc_zero(mem_ctx, struct winexe_context);
+	if (c == NULL)
 		return NULL;
+	c->args = args;
+	c->ev_ctx = ev_ctx;
+	c->hostname = talloc_strdup(c, hostname);
+	c->cmd = args->cmd;
+	c->tree = tree;
+	c->ops = ops;
+	c->ops_priv = priv;
+	c->out.fd = 1;
+	c->err.fd = 2;
+	c->return_code = 99;
+	c->svc_arch = -1;
+	set_state(c, STATE_OPENING);
+	host_install(c);
+	return c;
+}
+
+/* Feeds remote stdin, len == 0 means end of input */
+void winexe_session_input(struct winexe_context *c, const char *data, int len)
+{
+	if (!len) {
+		c->in_eof = 1;
+		if (c->in_open && c->framed)
+			framed_input(c, NULL, 0);
+		else if (c->in_open && !async_write_queued(c->ac_in))
+			async_close(c->ac_in);
+		return;
+	}
+	if (c->in_eof)
+		return;
+	if (c->in_open) {
+		if (c->framed)
+			framed_input(c, data, len);
+		else
+			async_write(c->ac_in, data, len);
+		return;
 	}
+	c->in_buf = talloc_realloc(c, c->in_buf, char, c->in_len + len);
+	if (!c->in_buf)
+		return;
+	memcpy(c->in_buf + c->in_len, data, len);
+	c->in_len += len;
+}
 
-	io->in.dest_host = dest_host;
-	io->in.dest_ports = dest_ports;
-	io->in.socket_options = socket_options;
-	io->in.called_name = strupper_talloc(io, dest_host);
-	io->in.service = service;
-	io->in.service_type = service_type;
-	io->in.credentials = credentials;
-	io->in.gensec_settings = gensec_settings;
-	io->in.fallback_to_anonymous = false;
+/*
+  Stops or restarts reading command output of a broker session, for a
+  client that does not take it as fast as it comes
+*/
+void winexe_session_pause(struct winexe_context *c, int pause)
+{
+	if (c->output_paused == pause)
+		return;
+	c->output_paused = pause;
+	session_read_pause(c, pause);
+}
 
-	io->in.workgroup = "";
-	io->in.options = *options;
-	io->in.session_options = *session_options;
-	io->in.iconv_convenience = iconv_convenience;
-	return smb_composite_connect_send(io, io, resolve_ctx, ev);
+void winexe_session_abort(struct winexe_context *c)
+{
+	c->abort_requested = 1;
+	if (c->state == STATE_GETTING_VERSION || c->state == STATE_RUNNING)
+		send_abort(c);
 }
 
-NTSTATUS smbcli_tree_full_connection_recv(struct composite_context *c, TALLOC_CTX *parent_ctx, struct smbcli_tree **ret_tree)
+void fanout_next(struct winexe_fanout *f)
 {
-	struct smb_composite_connect *io;
-	NTSTATUS status;
-	
-	status = smb_composite_connect_recv(c, parent_ctx);
-	if (!NT_STATUS_IS_OK(status))
-		return status;
+	while (!f->abort_requested && f->running < f->args->parallel && f->next_host < f->num_hosts)
+		start_host(f, f->hosts[f->next_host++]);
+	if (!f->running)
+		fanout_exit(f, f->return_code);
+}
 
-//	io = talloc_get_type(c->private_data, struct smb_composite_connect);
-	io = c->private_data;
-	
-	*ret_tree = io->out.tree;
-	talloc_steal(parent_ctx, *ret_tree);
-	
-	return status;
+/* Reads host list, empty lines and lines starting with # are skipped */
+static int load_hosts(struct winexe_fanout *f, const char *fname)
+{
+	char **lines;
+	int i, n;
+
+	if (!strcmp(fname, "-"))
+		lines = fd_lines_load(0, &n, 0, f);
+	else
+		lines = file_lines_load(fname, &n, 0, f);
+	if (!lines)
+		return 0;
+	f->hosts = talloc_array(f, char *, n);
+	f->num_hosts = 0;
+	for (i = 0; i < n; ++i) {
+		char *p = lines[i];
+		while (isspace(*p))
+			++p;
+		if (!*p || *p == '#')
+			continue;
+		if (p[0] == '/' && p[1] == '/')
+			p += 2;
+		p[strcspn(p, " \t\r")] = 0;
+		f->hosts[f->num_hosts++] = p;
+	}
+	return 1;
+}
+
+/* Reads batch commands, empty lines and lines starting with # are skipped */
+static int load_batch(struct program_options *options, TALLOC_CTX *mem_ctx)
+{
+	char **lines;
+	int i, n;
+
+	if (!strcmp(options->batch_file, "-"))
+		lines = fd_lines_load(0, &n, 0, mem_ctx);
+	else
+		lines = file_lines_load(options->batch_file, &n, 0, mem_ctx);
+	if (!lines)
+		return 0;
+	options->batch_cmds = talloc_array(mem_ctx, char *, n);
+	options->batch_num = 0;
+	for (i = 0; i < n; ++i) {
+		char *p = lines[i];
+		while (isspace(*p))
+			++p;
+		if (!*p || *p == '#')
+			continue;
+		options->batch_cmds[options->batch_num++] = p;
+	}
+	return options->batch_num > 0;
 }
 
 int main(int argc, char *argv[])
 {
-	NTSTATUS status;
-	struct smbcli_tree *cli_tree;
 	struct program_options options;
+	struct winexe_fanout *f;
 
 	parse_args(argc, argv, &options);
 	DEBUG(1, (version_string, VERSION_MAJOR, VERSION_MINOR));
-	ev_ctx = s4_event_context_init(talloc_autofree_context());
+
+	f = talloc_zero(talloc_autofree_context(), struct winexe_fanout);
+	f->ev_ctx = s4_event_context_init(f);
 
 	dcerpc_init(cmdline_lp_ctx);
 
-	if (options.flags & SVC_FORCE_UPLOAD)
-		svc_uninstall(options.hostname, cmdline_credentials);
-
-	if (!(options.flags & SVC_IGNORE_INTERACTIVE)) {
-		svc_install(options.hostname, cmdline_credentials, options.flags);
-	}
-
-	struct smbcli_options smb_options;
-	struct smbcli_session_options session_options;
-
-	lp_smbcli_options(cmdline_lp_ctx, &smb_options);
-	lp_smbcli_session_options(cmdline_lp_ctx, &session_options);
-
-#if 0
-	struct composite_context *cc;
-	cc =
-	    smbcli_tree_full_connection_send(NULL, options.hostname, lp_smb_ports(cmdline_lp_ctx), "IPC$",
-				   NULL, lp_socket_options(cmdline_lp_ctx), cmdline_credentials, lp_resolve_context(cmdline_lp_ctx), ev_ctx, 
-				   &smb_options, &session_options, lp_iconv_convenience(cmdline_lp_ctx), lp_gensec_settings(NULL, cmdline_lp_ctx));
-	status = smbcli_tree_full_connection_recv(cc, NULL, &cli_tree);
-#else
-	struct smbcli_state *cli_state;
-	status = smbcli_full_connection(NULL, &cli_state, options.hostname, lp_smb_ports(cmdline_lp_ctx), "IPC$",
-	                            NULL, lp_socket_options(cmdline_lp_ctx), cmdline_credentials, lp_resolve_context(cmdline_lp_ctx), ev_ctx,
-	            		    &smb_options, &session_options, lp_iconv_convenience(cmdline_lp_ctx), lp_gensec_settings(NULL, cmdline_lp_ctx));
-	if (cli_state)
-		cli_tree = cli_state->tree;
-#endif
-	if (!NT_STATUS_IS_OK(status)) {
-		DEBUG(0,
-		      ("ERROR: Failed to open connection - %s\n",
-		       nt_errstr(status)));
-		return 1;
+	f->args = &options;
+	f->args->credentials = cmdline_credentials;
+	if (!options.no_cache && !options.via_broker) {
+		const char *home = getenv("HOME");
+		if (options.cache_file)
+			options.cache = svc_cache_open(f, options.cache_file);
+		else if (home)
+			options.cache = svc_cache_open(f, talloc_asprintf(f, "%s/.winexe_cache.tdb", home));
 	}
-
-	struct winexe_context *c =
-	    talloc_zero(NULL, struct winexe_context);
-	if (c == NULL) {
+	if (options.timing_file && !options.broker && !options.via_broker)
+		options.timing = trace_open(options.timing_file, options.timing_csv);
+	if (options.broker)
+		return broker_main(f->ev_ctx, &options);
+	if (options.via_broker)
+		return broker_client_main(f->ev_ctx, &options);
+	if (options.batch_file && !load_batch(&options, f)) {
 		DEBUG(0,
-		      ("ERROR: Failed to allocate struct winexe_context\n"));
+		      ("ERROR: Cannot read commands from %s\n",
+		       options.batch_file));
 		return 1;
 	}
+	if (options.hosts_file) {
+		if (!load_hosts(f, options.hosts_file)) {
+			DEBUG(0,
+			      ("ERROR: Cannot read host list from %s\n",
+			       options.hosts_file));
+			return 1;
+		}
+	} else {
+		f->hosts = &options.hostname;
+		f->num_hosts = 1;
+		options.parallel = 1;
+	}
 
-	c->tree = cli_tree;
-	c->ac_ctrl = talloc_zero(NULL, struct async_context);
-	c->ac_ctrl->tree = cli_tree;
-	c->ac_ctrl->cb_ctx = c;
-	c->ac_ctrl->cb_open = (async_cb_open) on_ctrl_pipe_open;
-	c->ac_ctrl->cb_read = (async_cb_read) on_ctrl_pipe_read;
-	c->ac_ctrl->cb_error = (async_cb_error) on_ctrl_pipe_error;
-	c->ac_ctrl->cb_close = (async_cb_close) on_ctrl_pipe_close;
-	c->args = &options;
-	c->args->credentials = cmdline_credentials;
-	c->return_code = 99;
-	c->state = STATE_OPENING;
-	async_open(c->ac_ctrl, "\\pipe\\" PIPE_NAME, OPENX_MODE_ACCESS_RDWR);
+	sink_init(f, 1);
+	sink_init(f, 2);
+	fanout_next(f);
 
-	event_loop_wait(cli_tree->session->transport->socket->event.ctx);
+	event_loop_wait(f->ev_ctx);
 	return 0;
 }
@@ -13,11 +13,120 @@
 #define SVC_UNINSTALL 32
 #define SVC_SYSTEM 64
 
+struct program_options {
+	char *hostname;
+	char *cmd;
+	struct cli_credentials *credentials;
+	char *runas;
+	char *runas_file;
+	int flags;
+	char *hosts_file;
+	int parallel;
+	int prefix;
+	int collate;
+	int read_size;
+	int read_depth;
+	int benchmark;
+	int stats;
+	char *broker;
+	char *via_broker;
+	int broker_idle;
+	int framed;
+	int smb2;
+	char *batch_file;
+	int batch_depth;
+	char **batch_cmds;
+	int batch_num;
+	char *cache_file;
+	int no_cache;
+	struct tdb_wrap *cache;
+	char *timing_file;
+	char *timing_format;
+	int timing_csv;
+	FILE *timing;
+};
+
+/* Stdin data queued for the remote side before we stop reading it */
+#define STDIN_QUEUE_MAX (1024 * 1024)
+
+/* Stdout/stderr data queued locally before we stop reading output pipes */
+#define OUTPUT_QUEUE_MAX (1024 * 1024)
+
+/* winexe.c - sessions run on behalf of broker clients */
+struct winexe_context;
+
+struct winexe_session_ops {
+	void (*output)(void *priv, int fd, const char *data, int len);
+	void (*finish)(void *priv, int return_code);
+};
+
+struct winexe_context *winexe_session_start(TALLOC_CTX *mem_ctx,
+					    struct tevent_context *ev_ctx,
+					    struct program_options *args,
+					    const char *hostname,
+					    struct smbcli_tree *tree,
+					    const struct winexe_session_ops *ops,
+					    void *priv);
+void winexe_session_input(struct winexe_context *c, const char *data, int len);
+void winexe_session_pause(struct winexe_context *c, int pause);
+void winexe_session_abort(struct winexe_context *c);
+
+/* broker.c */
+int broker_main(struct tevent_context *ev_ctx, struct program_options *args);
+int broker_client_main(struct tevent_context *ev_ctx, struct program_options *args);
+
+/* cache.c */
+struct tdb_wrap;
+
+struct svc_cache_entry {
+	int version;
+	int os64bit;		/* -1 if not known */
+	int interactive;
+	uint8_t hash[16];
+};
+
+struct tdb_wrap *svc_cache_open(TALLOC_CTX *mem_ctx, const char *path);
+void svc_cache_hash(uint8_t hash[16]);
+int svc_cache_fetch(struct tdb_wrap *cache, const char *hostname, struct svc_cache_entry *e);
+void svc_cache_store(struct tdb_wrap *cache, const char *hostname, const struct svc_cache_entry *e);
+void svc_cache_delete(struct tdb_wrap *cache, const char *hostname);
+
+/* trace.c */
+struct winexe_trace;
+
+struct winexe_trace *trace_new(TALLOC_CTX *mem_ctx, const char *hostname);
+void trace_mark(struct winexe_trace *t, const char *event);
+void trace_mark_at(struct winexe_trace *t, const char *event, struct timeval tv);
+FILE *trace_open(const char *path, int csv);
+void trace_write(struct winexe_trace *t, FILE *fp, int csv, int return_code);
+
 /* service.c */
-NTSTATUS svc_install(const char *hostname,
-		     struct cli_credentials *credentials, int flags);
-NTSTATUS svc_uninstall(const char *hostname,
-		       struct cli_credentials *credentials);
+struct smb_composite_connect *svc_connect_io(TALLOC_CTX *mem_ctx,
+					     const char *hostname,
+					     const char *service,
+					     struct cli_credentials *credentials);
+struct smb2_tree;
+
+/*
+  svc_install_send/svc_uninstall_send take either ipc or ipc2 (SMB2),
+  steps are marked in trace if it is not NULL
+*/
+struct tevent_req *svc_install_send(TALLOC_CTX *mem_ctx,
+				    struct tevent_context *ev_ctx,
+				    struct smbcli_tree *ipc,
+				    struct smb2_tree *ipc2,
+				    const char *hostname,
+				    int flags,
+				    struct winexe_trace *trace);
+NTSTATUS svc_install_recv(struct tevent_req *req, int *os64bit);
+struct tevent_req *svc_uninstall_send(TALLOC_CTX *mem_ctx,
+				      struct tevent_context *ev_ctx,
+				      struct smbcli_tree *ipc,
+				      struct smb2_tree *ipc2,
+				      const char *hostname,
+				      struct winexe_trace *trace);
+NTSTATUS svc_uninstall_recv(struct tevent_req *req);
+const uint8_t *svc_binary(int os64bit, uint32_t *len);
 
 /* async.c */
 enum { ASYNC_OPEN, ASYNC_OPEN_RECV, ASYNC_READ, ASYNC_READ_RECV,
@@ -26,49 +135,95 @@ typedef void (*async_cb_open) (void *ctx);
 typedef void (*async_cb_read) (void *ctx, const char *data, int len);
 typedef void (*async_cb_close) (void *ctx);
 typedef void (*async_cb_error) (void *ctx, int func, NTSTATUS status);
+typedef void (*async_cb_drain) (void *ctx);
+typedef void (*async_cb_frame) (void *ctx, int type, const char *data, int len);
 
-struct list_item {
-	struct list_item *next;
+/* Initial write ring size, in units of max WRITEX payload */
+#define ASYNC_RING_CHUNKS 4
+
+struct async_ring {
+	char *buf;
 	int size;
-	char data[0];
+	int head;
+	int len;
 };
 
-struct list {
-	struct list_item *begin;
-	struct list_item *end;
+/* Upper limit of reads outstanding on one pipe */
+#define ASYNC_READ_MAX_DEPTH 16
+
+/* Largest SMB2 read/write, SMB 2.002 servers do not allow more */
+#define ASYNC_SMB2_MAX_IO 65536
+
+struct async_context;
+struct smb2_request;
+
+struct async_read_slot {
+	struct async_context *c;
+	struct smbcli_request *req;
+	union smb_read io;
+	struct smb2_request *req2;
+	struct smb2_read io2;
+	NTSTATUS status;
+	int done;
+	char *buffer;
+	char *data;
+	int nread;
 };
 
 struct async_context {
-/* Public - must be initialized by client */
+/* Public - must be initialized by client, either tree or tree2 (SMB2) */
 	struct smbcli_tree *tree;
+	struct smb2_tree *tree2;
 	void *cb_ctx;
 	async_cb_open cb_open;
 	async_cb_read cb_read;
 	async_cb_close cb_close;
 	async_cb_error cb_error;
+/* Public - optional, called when all queued data has been written */
+	async_cb_drain cb_drain;
+/* Public - optional, zero means default */
+	int read_size;		/* bytes per READX, capped by negotiated max_xmit */
+	int read_depth;		/* number of READX requests kept in flight */
+/* Public - read only, number of replies handled */
+	unsigned int wakeups;
 /* Private - internal usage, initialize to zeros */
 	int fd;
+	int opened;
 	union smb_open *io_open;
-	union smb_read *io_read;
 	union smb_write *io_write;
 	union smb_close *io_close;
 	struct smbcli_request *rreq;
 	struct smbcli_request *wreq;
-	struct list wq;
-	char buffer[256];
+	struct smb2_handle handle2;
+	struct smb2_create *io_open2;
+	struct smb2_write *io_write2;
+	struct smb2_close *io_close2;
+	struct smb2_request *rreq2;
+	struct smb2_request *wreq2;
+	struct async_ring wr;
+	struct async_read_slot *rs;
+	int rs_num;
+	int rs_head;
+	int read_paused;
 };
 
 int async_open(struct async_context *c, const char *fn, int open_mode);
 int async_read(struct async_context *c);
+void async_read_pause(struct async_context *c, int pause);
 int async_write(struct async_context *c, const void *buf, int len);
+char *async_write_space(struct async_context *c, int *len);
+int async_write_commit(struct async_context *c, int len);
+int async_write_queued(struct async_context *c);
 int async_close(struct async_context *c);
+int async_write_frame(struct async_context *c, int type, const void *buf, int len);
+int async_frames_parse(const char *buf, int len, int max, async_cb_frame cb, void *ctx);
 
-struct tevent_context *ev_ctx;
-
-/* winexesvc32_exe.c */
+/* winexesvc32_exe.c - zlib compressed, see svc_binary */
 extern unsigned int winexesvc32_exe_len;
-extern unsigned char winexesvc32_exe[];
+extern unsigned int winexesvc32_exe_zlen;
+extern unsigned char winexesvc32_exe_z[];
 
-/* winexesvc32_exe.c */
+/* winexesvc64_exe.c - compressed with winexesvc32.exe as preset dictionary */
 extern unsigned int winexesvc64_exe_len;
-extern unsigned char winexesvc64_exe[];
+extern unsigned int winexesvc64_exe_zlen;
+extern unsigned char winexesvc64_exe_z[];
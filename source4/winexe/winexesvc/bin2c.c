@@ -7,29 +7,121 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <zlib.h>
+
+/*
+  Reads whole file into malloc'ed buffer
+*/
+static unsigned char *load(const char *fn, unsigned long *len)
+{
+	unsigned char *buf;
+	FILE *fp;
+
+	if (!(fp = fopen(fn, "rb"))) {
+		fputs("Cannot open ", stderr);
+		perror(fn);
+		return NULL;
+	}
+	fseek(fp, 0, SEEK_END);
+	*len = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	buf = malloc(*len ? *len : 1);
+	if (buf && fread(buf, 1, *len, fp) != *len) {
+		perror(fn);
+		free(buf);
+		buf = NULL;
+	}
+	fclose(fp);
+	return buf;
+}
+
+/*
+  Deflates data, with dict (if any) as preset dictionary so sections
+  shared with it cost only back references
+*/
+static unsigned char *pack(const unsigned char *data, unsigned long len,
+			   const unsigned char *dict, unsigned long dict_len,
+			   unsigned long *zlen)
+{
+	z_stream zs;
+	unsigned char *buf;
+
+	memset(&zs, 0, sizeof(zs));
+	if (deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15, 9,
+			 Z_DEFAULT_STRATEGY) != Z_OK)
+		return NULL;
+	if (dict && deflateSetDictionary(&zs, dict, dict_len) != Z_OK)
+		return NULL;
+	*zlen = deflateBound(&zs, len);
+	buf = malloc(*zlen);
+	if (!buf)
+		return NULL;
+	zs.next_in = (unsigned char *) data;
+	zs.avail_in = len;
+	zs.next_out = buf;
+	zs.avail_out = *zlen;
+	if (deflate(&zs, Z_FINISH) != Z_STREAM_END) {
+		free(buf);
+		return NULL;
+	}
+	*zlen = zs.total_out;
+	deflateEnd(&zs);
+	return buf;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "Usage: %s [-z [-d dictfile]] varname file\n"
+		"  -z  emit zlib compressed varname_z[] and varname_zlen\n"
+		"  -d  use dictfile as preset dictionary\n", prog);
+}
 
 int main(int argc, char **argv)
 {
 	char buf[256], s[100];
-	int c;
-	FILE *fp;
-	if (argc != 3) {
-		fprintf(stderr, "Usage: %s varname file\n", *argv);
+	unsigned char *data, *dict = NULL;
+	unsigned long len, dict_len = 0, i;
+	const char *prog = *argv, *suffix = "";
+	int z = 0;
+
+	while (argc > 1 && argv[1][0] == '-') {
+		if (!strcmp(argv[1], "-z")) {
+			z = 1;
+		} else if (!strcmp(argv[1], "-d") && argc > 2) {
+			if (!(dict = load(argv[2], &dict_len)))
+				return 1;
+			++argv, --argc;
+		} else {
+			usage(prog);
+			return 1;
+		}
+		++argv, --argc;
+	}
+	if (argc != 3 || (dict && !z)) {
+		usage(prog);
 		return 1;
 	}
-	if (!(fp = fopen(argv[2], "rb"))) {
-		fputs("Cannot open ", stderr);
-		perror(argv[2]);
+	if (!(data = load(argv[2], &len)))
 		return 1;
+	printf("unsigned int %s_len = %lu;\n", argv[1], len);
+	if (z) {
+		unsigned long zlen;
+		unsigned char *zdata = pack(data, len, dict, dict_len, &zlen);
+
+		if (!zdata) {
+			fprintf(stderr, "Cannot compress %s\n", argv[2]);
+			return 1;
+		}
+		free(data);
+		data = zdata;
+		len = zlen;
+		suffix = "_z";
+		printf("unsigned int %s_zlen = %lu;\n", argv[1], len);
 	}
-	fseek(fp, 0, SEEK_END);
-	long len = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	printf("unsigned int %s_len = %u;\nunsigned char %s[] = {\n",
-	       argv[1], len, argv[1]);
+	printf("unsigned char %s%s[] = {\n", argv[1], suffix);
 	strcpy(buf, "  ");
-	while ((c = getc(fp)) != EOF) {
-		sprintf(s, "%u,", (unsigned char) c);
+	for (i = 0; i < len; ++i) {
+		sprintf(s, "%u,", data[i]);
 		if (strlen(s) + strlen(buf) >= 80)
 			puts(buf), strcpy(buf, "  ");
 		strcat(buf, s);
@@ -37,6 +129,6 @@ int main(int argc, char **argv)
 	if (*buf)
 		strcat(buf, "\n");
 	printf("%s};\n", buf);
-	fprintf(stderr, "%s_len = %u\n", argv[1], len);
+	fprintf(stderr, "%s%s_len = %lu\n", argv[1], z ? "_z" : "", len);
 	return 0;
 }
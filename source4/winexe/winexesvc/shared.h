@@ -5,7 +5,7 @@
 */
 
 #define VERSION_MAJOR 1
-#define VERSION_MINOR 0
+#define VERSION_MINOR 2
 
 #define VERSION (VERSION_MAJOR * 100 + VERSION_MINOR)
 
@@ -18,3 +18,35 @@
 
 #define CMD_STD_IO_ERR "std_io_err"
 #define CMD_RETURN_CODE "return_code"
+
+/*
+  Framed mode ("set framed 1", since 1.01): after CMD_FRAMED line the control
+  pipe carries frames in both directions instead of using separate stdio
+  pipes. Frame: 1 byte type, 4 bytes length (little endian), data.
+*/
+#define VERSION_FRAMED 101
+#define CMD_FRAMED "framed"
+
+#define FRAMED_HDR 5
+#define FRAMED_MAX 65536
+
+#define FRAMED_STDIN 'I'	/* empty frame closes stdin */
+#define FRAMED_ABORT 'A'
+#define FRAMED_STDOUT 'O'
+#define FRAMED_STDERR 'E'
+#define FRAMED_RETURN_CODE 'X'	/* 4 bytes, little endian */
+
+/*
+  Resource usage of the command ("stats 1" before "run", since 1.02): the
+  return code is followed by "stats <text>" line, or FRAMED_STATS frame
+  with <text>, where <text> is space separated key=value pairs, unknown
+  keys are to be ignored. Keys: wall_ms, user_ms, kernel_ms (process
+  lifetime and CPU time in milliseconds), peak_ws_kb (peak working set
+  in KB). It is a command of its own, not "set stats 1",
+  because older services drop the connection on unknown set or get but
+  only answer "error" to unknown commands.
+*/
+#define VERSION_STATS 102
+#define CMD_STATS "stats"
+
+#define FRAMED_STATS 'S'	/* <text> */
@@ -6,6 +6,7 @@
 
 #include <windows.h>
 #include <aclapi.h>
+#include <psapi.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -146,6 +147,9 @@ typedef struct {
 	int system;
 	char *runas;
 	int conn_number;
+	int framed;
+	int stats;
+	CRITICAL_SECTION wlock;
 } connection_context;
 
 typedef int CMD_FUNC(connection_context *);
@@ -160,6 +164,7 @@ int cmd_set(connection_context *c)
 	static const char* var_system = "system";
 	static const char* var_implevel = "implevel";
 	static const char* var_runas = "runas";
+	static const char* var_framed = "framed";
 	char *cmdline;
 	int res = 0;
 
@@ -178,6 +183,9 @@ int cmd_set(connection_context *c)
 	} else if ((strstr(cmdline, var_runas) == cmdline) &&
             (cmdline[l = strlen(var_runas)] == ' ')) {
 		c->runas = strdup(cmdline + l + 1);
+	} else if ((strstr(cmdline, var_framed) == cmdline) &&
+            (cmdline[l = strlen(var_framed)] == ' ')) {
+		c->framed = atoi(cmdline + l + 1);
 	} else {
 	    hprintf(c->pipe, "error Unknown commad (%s)\n", c->cmd);
 	    goto finish;
@@ -187,6 +195,37 @@ finish:
 	return res;
 }
 
+int cmd_stats(connection_context *c)
+{
+	c->stats = atoi(c->cmd + strlen(CMD_STATS));
+	return 1;
+}
+
+static ULONGLONG filetime_ms(const FILETIME *ft)
+{
+	return (((ULONGLONG) ft->dwHighDateTime << 32) | ft->dwLowDateTime) / 10000;
+}
+
+/* Resource usage of finished process as CMD_STATS text */
+static void process_stats(HANDLE process, char *buf, int size)
+{
+	FILETIME ct, et, kt, ut;
+	PROCESS_MEMORY_COUNTERS pmc;
+	ULONGLONG wall = 0, user = 0, kernel = 0;
+	SIZE_T peak = 0;
+
+	if (GetProcessTimes(process, &ct, &et, &kt, &ut)) {
+		wall = filetime_ms(&et) - filetime_ms(&ct);
+		user = filetime_ms(&ut);
+		kernel = filetime_ms(&kt);
+	}
+	if (GetProcessMemoryInfo(process, &pmc, sizeof(pmc)))
+		peak = pmc.PeakWorkingSetSize / 1024;
+	snprintf(buf, size, "wall_ms=%lu user_ms=%lu kernel_ms=%lu peak_ws_kb=%lu",
+		 (unsigned long) wall, (unsigned long) user,
+		 (unsigned long) kernel, (unsigned long) peak);
+}
+
 int cmd_get(connection_context *c)
 {
 	static const char* var_version = "version";
@@ -289,6 +328,223 @@ finish:
 	return res;
 }
 
+static int write_all(HANDLE h, OVERLAPPED *o, const char *buf, DWORD len)
+{
+	DWORD n;
+
+	while (len) {
+		if (!WriteFile(h, buf, len, NULL, o) && GetLastError() != ERROR_IO_PENDING)
+			return 0;
+		if (!GetOverlappedResult(h, o, &n, TRUE) || !n)
+			return 0;
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+/* Sends frame over control pipe, may be called from several threads */
+int frame_write(connection_context *c, int type, const char *data, DWORD len)
+{
+	char hdr[FRAMED_HDR];
+	OVERLAPPED o;
+	int res;
+
+	hdr[0] = type;
+	hdr[1] = len & 0xff;
+	hdr[2] = (len >> 8) & 0xff;
+	hdr[3] = (len >> 16) & 0xff;
+	hdr[4] = (len >> 24) & 0xff;
+	ZeroMemory(&o, sizeof(OVERLAPPED));
+	o.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+	if (!o.hEvent)
+		return 0;
+	EnterCriticalSection(&c->wlock);
+	res = write_all(c->pipe->h, &o, hdr, FRAMED_HDR)
+	    && (!len || write_all(c->pipe->h, &o, data, len));
+	LeaveCriticalSection(&c->wlock);
+	CloseHandle(o.hEvent);
+	return res;
+}
+
+typedef struct {
+	connection_context *c;
+	HANDLE h;
+	int type;
+} frame_pump;
+
+/* Passes child output to client until child closes its end */
+DWORD WINAPI frame_pump_loop(LPVOID lpParameter)
+{
+	frame_pump *fp = (frame_pump *) lpParameter;
+	char buf[4096];
+	DWORD n;
+
+	while (ReadFile(fp->h, buf, sizeof(buf), &n, NULL) && n)
+		if (!frame_write(fp->c, fp->type, buf, n))
+			break;
+	return 0;
+}
+
+/* Reads exactly len bytes from control pipe, returns 0 if process ended first, -1 on error */
+static int ctrl_read(connection_context *c, char *buf, DWORD len, HANDLE process)
+{
+	HANDLE hlist[2] = {c->pipe->o.hEvent, process};
+	DWORD n;
+
+	while (len) {
+		if (!ResetEvent(c->pipe->o.hEvent))
+			return -1;
+		if (!ReadFile(c->pipe->h, buf, len, NULL, &c->pipe->o) && GetLastError() != ERROR_IO_PENDING)
+			return -1;
+		if (WaitForMultipleObjects(2, hlist, FALSE, INFINITE) != WAIT_OBJECT_0) {
+			CancelIo(c->pipe->h);
+			GetOverlappedResult(c->pipe->h, &c->pipe->o, &n, TRUE);
+			return 0;
+		}
+		if (!GetOverlappedResult(c->pipe->h, &c->pipe->o, &n, FALSE) || !n)
+			return -1;
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+/*
+  Runs process with stdio on anonymous pipes multiplexed as frames over
+  the control pipe, so client needs single open instead of four.
+*/
+int run_framed(connection_context *c, char *cmdline)
+{
+	HANDLE in_r, in_w, out_r, out_w, err_r, err_w;
+	HANDLE threads[2];
+	frame_pump pumps[2];
+	SECURITY_ATTRIBUTES sattr;
+	PROCESS_INFORMATION pi;
+	STARTUPINFO si;
+	char hdr[FRAMED_HDR];
+	char *data;
+	DWORD ec, len, n;
+	int res, i;
+
+	sattr.nLength = sizeof(SECURITY_ATTRIBUTES);
+	sattr.bInheritHandle = TRUE;
+	sattr.lpSecurityDescriptor = NULL;
+
+	if (!CreatePipe(&in_r, &in_w, &sattr, 0)) {
+		hprintf(c->pipe, "error Cannot create in pipe, error 0x%08X\n", GetLastError());
+		goto finish;
+	}
+	if (!CreatePipe(&out_r, &out_w, &sattr, 0)) {
+		hprintf(c->pipe, "error Cannot create out pipe, error 0x%08X\n", GetLastError());
+		goto finishClosePin;
+	}
+	if (!CreatePipe(&err_r, &err_w, &sattr, 0)) {
+		hprintf(c->pipe, "error Cannot create err pipe, error 0x%08X\n", GetLastError());
+		goto finishClosePout;
+	}
+	/* our ends must not be inherited, otherwise child never sees EOF */
+	SetHandleInformation(in_w, HANDLE_FLAG_INHERIT, 0);
+	SetHandleInformation(out_r, HANDLE_FLAG_INHERIT, 0);
+	SetHandleInformation(err_r, HANDLE_FLAG_INHERIT, 0);
+
+	ZeroMemory(&pi, sizeof(PROCESS_INFORMATION));
+	ZeroMemory(&si, sizeof(STARTUPINFO));
+	si.cb = sizeof(STARTUPINFO);
+	si.hStdInput = in_r;
+	si.hStdOutput = out_w;
+	si.hStdError = err_w;
+	si.dwFlags |= STARTF_USESTDHANDLES;
+
+	if (!CreateProcessAsUser(c->token, NULL, cmdline, NULL, NULL, TRUE, 0,
+				 NULL, NULL, &si, &pi)) {
+		hprintf(c->pipe, "error Creating process(%s) %d\n", cmdline, GetLastError());
+		goto finishClosePerr;
+	}
+	CloseHandle(in_r);
+	CloseHandle(out_w);
+	CloseHandle(err_w);
+	in_r = out_w = err_w = NULL;
+
+	hprintf(c->pipe, CMD_FRAMED "\n");
+	InitializeCriticalSection(&c->wlock);
+	pumps[0].c = pumps[1].c = c;
+	pumps[0].h = out_r;
+	pumps[0].type = FRAMED_STDOUT;
+	pumps[1].h = err_r;
+	pumps[1].type = FRAMED_STDERR;
+	for (i = 0; i < 2; ++i)
+		threads[i] = CreateThread(NULL, 0, frame_pump_loop, &pumps[i], 0, NULL);
+
+	data = malloc(FRAMED_MAX);
+	for (;;) {
+		res = ctrl_read(c, hdr, FRAMED_HDR, pi.hProcess);
+		if (res <= 0)
+			break;
+		len = (hdr[1] & 0xff) | ((hdr[2] & 0xff) << 8)
+		    | ((hdr[3] & 0xff) << 16) | ((hdr[4] & 0xff) << 24);
+		if (!data || len > FRAMED_MAX) {
+			res = -1;
+			break;
+		}
+		res = ctrl_read(c, data, len, pi.hProcess);
+		if (res <= 0)
+			break;
+		if (hdr[0] == FRAMED_STDIN) {
+			if (!len) {
+				if (in_w)
+					CloseHandle(in_w);
+				in_w = NULL;
+			} else if (in_w && !WriteFile(in_w, data, len, &n, NULL)) {
+				SvcDebugOut("WriteFile(stdin) error - %d\n", GetLastError());
+			}
+		} else if (hdr[0] == FRAMED_ABORT) {
+			TerminateProcess(pi.hProcess, 0x1234);
+		}
+	}
+	free(data);
+	/* client is gone */
+	if (res < 0)
+		TerminateProcess(pi.hProcess, 0x1234);
+	WaitForSingleObject(pi.hProcess, INFINITE);
+	if (!GetExitCodeProcess(pi.hProcess, &ec))
+		ec = 0x1234;
+	for (i = 0; i < 2; ++i)
+		if (threads[i]) {
+			WaitForSingleObject(threads[i], INFINITE);
+			CloseHandle(threads[i]);
+		}
+	hdr[0] = ec & 0xff;
+	hdr[1] = (ec >> 8) & 0xff;
+	hdr[2] = (ec >> 16) & 0xff;
+	hdr[3] = (ec >> 24) & 0xff;
+	frame_write(c, FRAMED_RETURN_CODE, hdr, 4);
+	if (c->stats) {
+		char stats[128];
+		process_stats(pi.hProcess, stats, sizeof(stats));
+		frame_write(c, FRAMED_STATS, stats, strlen(stats));
+	}
+	DeleteCriticalSection(&c->wlock);
+	CloseHandle(pi.hProcess);
+	CloseHandle(pi.hThread);
+
+finishClosePerr:
+	if (err_w)
+		CloseHandle(err_w);
+	CloseHandle(err_r);
+finishClosePout:
+	if (out_w)
+		CloseHandle(out_w);
+	CloseHandle(out_r);
+finishClosePin:
+	if (in_r)
+		CloseHandle(in_r);
+	if (in_w)
+		CloseHandle(in_w);
+finish:
+	return 0;
+}
+
 int cmd_run(connection_context *c)
 {
 	char buf[256];
@@ -306,6 +562,11 @@ int cmd_run(connection_context *c)
 	if (!get_token(c))
 		return 0;
 
+	if (c->framed) {
+		res = run_framed(c, cmdline);
+		goto finishCloseToken;
+	}
+
 	pipe_nr = (GetCurrentProcessId() << 16) + (DWORD) c->conn_number;
 
 	sprintf(buf, "\\\\.\\pipe\\" PIPE_NAME_IN, pipe_nr);
@@ -426,9 +687,13 @@ int cmd_run(connection_context *c)
 			TerminateProcess(pi.hProcess, ec = 0x1234);
 		FlushFileBuffers(c->pout);
 		FlushFileBuffers(c->perr);
+		hprintf(c->pipe, CMD_RETURN_CODE " %08X\n", ec);
+		if (c->stats) {
+			process_stats(pi.hProcess, buf, sizeof(buf));
+			hprintf(c->pipe, CMD_STATS " %s\n", buf);
+		}
 		CloseHandle(pi.hProcess);
 		CloseHandle(pi.hThread);
-		hprintf(c->pipe, CMD_RETURN_CODE " %08X\n", ec);
 	} else {
 		hprintf(c->pipe, "error Creating process(%s) %d\n", cmdline, GetLastError());
 	}
@@ -454,6 +719,7 @@ CMD_ITEM cmd_table[] = {
 	{"run", cmd_run},
 	{"set", cmd_set},
 	{"get", cmd_get},
+	{CMD_STATS, cmd_stats},
 	{NULL, NULL}
 };
 
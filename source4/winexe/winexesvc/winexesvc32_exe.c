@@ -1,1313 +1,798 @@
 unsigned int winexesvc32_exe_len = 31232;
-unsigned char winexesvc32_exe[] = {
-  77,90,144,0,3,0,0,0,4,0,0,0,255,255,0,0,184,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,14,31,186,14,
-  0,180,9,205,33,184,1,76,205,33,84,104,105,115,32,112,114,111,103,114,97,109,
-  32,99,97,110,110,111,116,32,98,101,32,114,117,110,32,105,110,32,68,79,83,32,
-  109,111,100,101,46,13,13,10,36,0,0,0,0,0,0,0,80,69,0,0,76,1,5,0,81,55,249,77,
-  0,0,0,0,0,0,0,0,224,0,15,3,11,1,2,56,0,98,0,0,0,118,0,0,0,12,0,0,48,17,0,0,0,
-  16,0,0,0,128,0,0,0,0,64,0,0,16,0,0,0,2,0,0,4,0,0,0,1,0,0,0,4,0,0,0,0,0,0,0,0,
-  192,0,0,0,4,0,0,43,121,1,0,3,0,0,0,0,0,32,0,0,16,0,0,0,0,16,0,0,16,0,0,0,0,0,
-  0,16,0,0,0,0,0,0,0,0,0,0,0,0,176,0,0,44,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,116,101,120,116,0,0,0,36,96,0,0,
-  0,16,0,0,0,98,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,80,96,46,100,97,116,
-  97,0,0,0,72,0,0,0,0,128,0,0,0,2,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,
-  48,192,46,114,100,97,116,97,0,0,64,7,0,0,0,144,0,0,0,8,0,0,0,104,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,64,0,96,64,46,98,115,115,0,0,0,0,80,10,0,0,0,160,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,64,192,46,105,100,97,116,97,0,0,44,9,0,
-  0,0,176,0,0,0,10,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,48,192,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,139,13,172,178,64,0,137,
-  229,93,255,225,141,116,38,0,85,139,13,164,178,64,0,137,229,93,255,225,141,
-  116,38,0,85,137,229,83,131,236,32,104,80,17,64,0,232,211,91,0,0,131,196,12,
-  232,167,19,0,0,232,194,20,0,0,131,236,12,141,69,244,199,69,244,0,0,0,0,80,
-  141,69,248,139,29,32,128,64,0,83,80,104,4,160,64,0,104,0,160,64,0,232,10,91,
-  0,0,161,12,160,64,0,131,196,32,133,192,117,68,232,9,91,0,0,139,21,36,128,64,
-  0,137,16,232,140,20,0,0,131,228,240,232,68,21,0,0,232,255,90,0,0,83,139,8,81,
-  139,21,4,160,64,0,82,161,0,160,64,0,80,232,17,17,0,0,137,195,232,234,90,0,0,
-  137,28,36,232,86,91,0,0,139,29,160,178,64,0,163,36,128,64,0,81,81,80,139,83,
-  16,82,232,171,90,0,0,131,196,16,131,251,224,116,25,80,80,161,12,160,64,0,80,
-  139,67,48,80,232,146,90,0,0,131,196,16,131,251,192,116,132,80,80,161,12,160,
-  64,0,80,139,67,80,80,232,121,90,0,0,131,196,16,233,107,255,255,255,137,246,
-  141,188,39,0,0,0,0,85,137,229,131,236,20,106,2,255,21,148,178,64,0,232,253,
-  254,255,255,141,182,0,0,0,0,141,188,39,0,0,0,0,85,137,229,131,236,20,106,1,
-  255,21,148,178,64,0,232,221,254,255,255,141,182,0,0,0,0,141,188,39,0,0,0,0,
-  85,137,229,83,131,236,4,139,69,8,139,0,139,0,61,145,0,0,192,119,59,61,141,0,
-  0,192,114,75,187,1,0,0,0,80,80,106,0,106,8,232,12,90,0,0,131,196,16,131,248,
-  1,15,132,214,0,0,0,133,192,15,133,144,0,0,0,49,192,139,93,252,201,194,4,0,
-  141,180,38,0,0,0,0,61,148,0,0,192,116,73,61,150,0,0,192,116,23,61,147,0,0,
-  192,117,219,235,181,61,5,0,0,192,116,57,61,29,0,0,192,117,203,80,80,106,0,
-  106,4,232,184,89,0,0,131,196,16,131,248,1,116,90,133,192,116,180,131,236,12,
-  106,4,255,208,131,200,255,131,196,16,235,167,144,141,116,38,0,49,219,233,122,
-  255,255,255,80,80,106,0,106,11,232,134,89,0,0,131,196,16,131,248,1,116,62,
-  133,192,116,130,131,236,12,106,11,255,208,131,200,255,131,196,16,233,114,255,
-  255,255,131,236,12,106,8,255,208,131,200,255,131,196,16,233,96,255,255,255,
-  80,80,106,1,106,4,232,75,89,0,0,131,200,255,131,196,16,233,74,255,255,255,80,
-  80,106,1,106,11,232,53,89,0,0,131,200,255,131,196,16,233,52,255,255,255,80,
-  80,106,1,106,8,232,31,89,0,0,131,196,16,131,200,255,133,219,15,132,27,255,
-  255,255,232,132,18,0,0,131,200,255,233,14,255,255,255,144,144,144,144,144,
-  144,144,144,144,144,144,144,85,137,229,131,236,24,161,68,128,64,0,133,192,
-  116,55,199,4,36,0,144,64,0,232,105,89,0,0,137,194,184,0,0,0,0,81,133,210,116,
-  18,137,20,36,199,68,36,4,13,144,64,0,232,85,89,0,0,82,82,133,192,116,9,199,4,
-  36,68,128,64,0,255,208,201,195,144,141,180,38,0,0,0,0,85,137,229,93,195,144,
-  144,144,144,144,144,144,144,144,144,144,85,137,229,86,83,131,236,16,139,117,
-  8,139,93,12,199,68,36,4,47,0,0,0,137,52,36,232,154,88,0,0,133,192,117,20,199,
-  68,36,4,92,0,0,0,137,52,36,232,134,88,0,0,133,192,116,9,198,0,0,64,137,115,4,
-  235,9,199,67,4,36,144,64,0,137,240,137,3,199,68,36,4,37,0,0,0,137,4,36,232,
-  94,88,0,0,133,192,116,4,198,0,0,64,137,67,8,131,196,16,184,1,0,0,0,91,94,93,
-  195,85,137,229,87,86,83,131,236,76,49,246,139,125,16,139,69,12,72,139,93,8,
-  137,69,212,141,71,4,137,69,208,235,108,139,69,208,199,68,36,12,0,0,0,0,137,
-  68,36,16,199,68,36,8,1,0,0,0,137,92,36,4,139,7,137,4,36,232,174,88,0,0,131,
-  236,20,133,192,117,12,232,242,88,0,0,61,229,3,0,0,117,57,141,69,228,199,68,
-  36,12,1,0,0,0,137,68,36,8,139,69,208,137,68,36,4,139,7,137,4,36,232,211,88,0,
-  0,131,236,16,133,192,116,18,131,125,228,0,116,12,128,59,10,116,7,70,67,255,
-  77,212,121,143,198,3,0,141,101,244,137,240,91,94,95,93,195,85,137,229,87,86,
-  83,129,236,76,4,0,0,141,69,16,139,93,8,141,181,228,251,255,255,137,68,36,12,
-  139,69,12,137,68,36,8,199,68,36,4,0,4,0,0,137,52,36,232,206,17,0,0,141,67,4,
-  131,201,255,137,133,212,251,255,255,137,247,49,192,242,174,247,209,73,139,
-  133,212,251,255,255,137,68,36,16,199,68,36,12,0,0,0,0,137,76,36,8,137,116,36,
-  4,139,3,137,4,36,232,185,87,0,0,131,236,20,133,192,117,50,232,45,88,0,0,61,
-  229,3,0,0,117,38,141,69,228,199,68,36,12,1,0,0,0,137,68,36,8,139,133,212,251,
-  255,255,137,68,36,4,139,3,137,4,36,232,11,88,0,0,131,236,16,139,3,137,4,36,
-  232,198,87,0,0,80,139,69,228,141,101,244,91,94,95,93,195,85,137,229,87,86,83,
-  131,236,92,139,117,8,199,4,36,0,128,0,0,232,238,86,0,0,139,22,137,195,133,
-  192,117,21,199,68,36,4,38,144,64,0,137,20,36,232,21,255,255,255,233,248,0,0,
-  0,49,192,185,0,32,0,0,137,223,243,171,141,77,192,137,77,180,185,10,0,0,0,139,
-  125,180,243,171,139,70,4,137,85,192,137,93,196,137,69,228,137,52,36,232,170,
-  86,0,0,139,69,192,199,68,36,4,0,128,0,0,137,68,36,8,137,28,36,232,44,254,255,
-  255,133,192,126,68,190,0,128,64,0,235,40,137,124,36,4,137,28,36,232,108,86,0,
-  0,57,216,117,21,49,192,131,201,255,242,174,247,209,138,68,11,255,60,32,116,
-  15,132,192,116,11,131,198,8,139,62,133,255,117,210,235,91,141,77,192,137,12,
-  36,255,86,4,133,192,117,161,139,69,192,139,0,137,4,36,232,234,86,0,0,139,69,
-  192,87,139,0,137,4,36,232,228,86,0,0,139,69,192,86,139,0,137,4,36,232,22,87,
-  0,0,139,69,192,81,139,64,20,137,4,36,232,7,87,0,0,139,69,192,82,137,4,36,232,
-  7,86,0,0,137,28,36,232,255,85,0,0,235,28,139,69,192,137,92,36,8,199,68,36,4,
-  84,144,64,0,137,4,36,232,29,254,255,255,233,55,255,255,255,141,101,244,91,94,
-  95,93,195,85,137,229,86,83,131,236,48,139,93,8,139,67,32,133,192,15,132,162,
-  0,0,0,141,85,232,137,4,36,137,84,36,4,232,220,252,255,255,133,192,117,23,199,
-  68,36,4,121,144,64,0,139,3,137,4,36,232,213,253,255,255,233,189,1,0,0,141,67,
-  20,199,68,36,16,0,0,0,0,137,68,36,20,139,69,240,137,68,36,8,139,69,236,137,
-  68,36,4,139,69,232,199,68,36,12,2,0,0,0,137,4,36,232,173,86,0,0,190,1,0,0,0,
-  131,236,24,133,192,15,133,127,1,0,0,102,49,246,232,45,86,0,0,137,68,36,20,
-  139,69,240,137,68,36,16,139,69,236,137,68,36,12,139,69,232,137,68,36,8,199,
-  68,36,4,156,144,64,0,139,3,137,4,36,232,93,253,255,255,233,71,1,0,0,131,123,
-  28,0,116,61,232,122,85,0,0,141,85,244,137,84,36,8,199,68,36,4,255,0,15,0,137,
-  4,36,232,75,86,0,0,131,236,12,133,192,15,133,135,0,0,0,232,203,85,0,0,199,68,
-  36,4,193,144,64,0,137,68,36,8,233,248,0,0,0,139,3,139,0,137,4,36,232,38,86,0,
-  0,133,192,82,117,22,232,164,85,0,0,199,68,36,4,227,144,64,0,137,68,36,8,233,
-  209,0,0,0,232,30,85,0,0,141,85,244,137,84,36,12,199,68,36,8,0,0,0,0,199,68,
-  36,4,255,0,15,0,137,4,36,232,239,85,0,0,131,236,16,133,192,117,31,232,99,85,
-  0,0,199,68,36,4,15,145,64,0,137,68,36,8,49,246,139,3,137,4,36,232,166,252,
-  255,255,235,103,141,67,20,199,68,36,16,1,0,0,0,137,68,36,20,190,1,0,0,0,139,
-  67,24,199,68,36,8,0,0,0,0,137,68,36,12,139,69,244,199,68,36,4,0,0,0,2,137,4,
-  36,232,155,85,0,0,131,236,24,133,192,117,30,102,49,246,232,4,85,0,0,199,68,
-  36,4,48,145,64,0,137,68,36,8,139,3,137,4,36,232,73,252,255,255,139,69,244,
-  137,4,36,232,251,84,0,0,80,131,123,28,0,117,38,232,103,85,0,0,133,192,117,29,
-  232,206,84,0,0,199,68,36,4,81,145,64,0,137,68,36,8,139,3,137,4,36,232,19,252,
-  255,255,49,246,141,101,248,137,240,91,94,93,195,85,137,229,87,86,83,129,236,
-  188,1,0,0,139,93,8,199,68,36,4,32,0,0,0,139,67,4,137,4,36,232,143,83,0,0,137,
-  133,116,254,255,255,133,192,15,132,220,4,0,0,137,28,36,232,192,253,255,255,
-  133,192,15,132,204,4,0,0,232,0,84,0,0,141,181,132,254,255,255,137,199,193,
-  231,16,3,123,36,199,68,36,4,111,145,64,0,137,124,36,8,137,52,36,232,66,83,0,
-  0,199,68,36,28,240,169,64,0,199,68,36,24,0,0,0,0,199,68,36,20,0,1,0,0,199,68,
-  36,16,0,1,0,0,199,68,36,12,1,0,0,0,199,68,36,8,0,0,0,0,199,68,36,4,3,0,0,0,
-  137,52,36,232,246,83,0,0,131,236,32,137,67,8,64,117,36,232,248,83,0,0,137,
-  116,36,8,137,68,36,12,199,68,36,4,137,145,64,0,139,3,137,4,36,232,57,251,255,
-  255,233,44,4,0,0,137,124,36,8,199,68,36,4,184,145,64,0,137,52,36,232,193,82,
-  0,0,199,68,36,28,240,169,64,0,199,68,36,24,0,0,0,0,199,68,36,20,0,1,0,0,199,
-  68,36,16,0,1,0,0,199,68,36,12,1,0,0,0,199,68,36,8,0,0,0,0,199,68,36,4,3,0,0,
-  0,137,52,36,232,117,83,0,0,131,236,32,137,67,12,64,117,36,232,119,83,0,0,137,
-  116,36,8,137,68,36,12,199,68,36,4,211,145,64,0,139,3,137,4,36,232,184,250,
-  255,255,233,159,3,0,0,137,124,36,8,199,68,36,4,3,146,64,0,137,52,36,232,64,
-  82,0,0,199,68,36,28,240,169,64,0,199,68,36,24,0,0,0,0,199,68,36,20,0,1,0,0,
-  199,68,36,16,0,1,0,0,199,68,36,12,1,0,0,0,199,68,36,8,0,0,0,0,199,68,36,4,3,
-  0,0,0,137,52,36,232,244,82,0,0,131,236,32,137,67,16,64,117,36,232,246,82,0,0,
-  137,116,36,8,137,68,36,12,199,68,36,4,30,146,64,0,139,3,137,4,36,232,55,250,
-  255,255,233,18,3,0,0,137,124,36,8,199,68,36,4,78,146,64,0,139,3,137,4,36,232,
-  28,250,255,255,199,68,36,4,0,0,0,0,139,67,8,137,4,36,232,166,82,0,0,133,192,
-  86,86,117,35,232,163,82,0,0,61,23,2,0,0,116,23,199,68,36,4,95,146,64,0,139,3,
-  137,4,36,232,229,249,255,255,233,180,2,0,0,199,68,36,4,0,0,0,0,139,67,12,137,
-  4,36,232,106,82,0,0,133,192,81,81,117,35,232,103,82,0,0,61,23,2,0,0,116,23,
-  199,68,36,4,124,146,64,0,139,3,137,4,36,232,169,249,255,255,233,108,2,0,0,
-  199,68,36,4,0,0,0,0,139,67,16,137,4,36,232,46,82,0,0,133,192,82,82,117,35,
-  232,43,82,0,0,61,23,2,0,0,116,23,199,68,36,4,154,146,64,0,139,3,137,4,36,232,
-  109,249,255,255,233,36,2,0,0,139,133,116,254,255,255,199,68,36,8,1,0,0,0,64,
-  199,68,36,4,1,0,0,0,137,133,116,254,255,255,139,67,8,137,4,36,232,133,81,0,0,
-  131,236,12,141,117,200,137,247,199,68,36,8,1,0,0,0,199,68,36,4,1,0,0,0,139,
-  67,12,137,4,36,232,98,81,0,0,131,236,12,199,68,36,8,1,0,0,0,199,68,36,4,1,0,
-  0,0,139,67,16,137,4,36,232,68,81,0,0,49,192,185,4,0,0,0,243,171,141,85,132,
-  177,17,137,215,131,236,12,243,171,139,67,8,199,69,132,68,0,0,0,137,69,188,
-  139,67,12,137,69,192,139,67,16,137,116,36,40,137,69,196,139,133,116,254,255,
-  255,137,84,36,36,199,68,36,32,0,0,0,0,199,68,36,28,0,0,0,0,199,68,36,24,0,0,
-  0,0,199,68,36,20,1,0,0,0,199,68,36,16,0,0,0,0,199,68,36,12,0,0,0,0,137,68,36,
-  8,199,68,36,4,0,0,0,0,139,67,20,129,77,176,0,1,0,0,137,4,36,232,178,81,0,0,
-  131,236,44,133,192,15,132,245,0,0,0,139,3,139,80,20,137,85,216,139,85,200,
-  137,85,220,139,64,20,137,4,36,232,158,80,0,0,87,139,3,199,68,36,12,0,0,0,0,
-  199,68,36,8,1,0,0,0,141,80,4,137,84,36,16,141,85,231,137,84,36,4,139,0,137,4,
-  36,232,123,80,0,0,131,236,20,133,192,117,5,232,191,80,0,0,141,69,216,199,68,
-  36,12,255,255,255,255,199,68,36,8,0,0,0,0,137,68,36,4,199,4,36,2,0,0,0,232,
-  84,80,0,0,131,236,16,137,69,224,133,192,139,69,200,116,17,141,85,224,137,4,
-  36,137,84,36,4,232,64,80,0,0,235,23,199,69,224,52,18,0,0,199,68,36,4,52,18,0,
-  0,137,4,36,232,47,80,0,0,86,86,139,67,12,137,4,36,232,42,80,0,0,81,139,67,16,
-  137,4,36,232,30,80,0,0,139,69,200,82,137,4,36,232,90,80,0,0,80,139,69,204,
-  137,4,36,232,78,80,0,0,139,69,224,87,137,68,36,8,199,68,36,4,184,146,64,0,
-  139,3,137,4,36,232,119,247,255,255,235,37,232,21,80,0,0,199,68,36,4,202,146,
-  64,0,137,68,36,12,139,133,116,254,255,255,137,68,36,8,139,3,137,4,36,232,80,
-  247,255,255,139,67,16,137,4,36,232,194,79,0,0,86,139,67,12,137,4,36,232,182,
-  79,0,0,81,139,67,8,137,4,36,232,170,79,0,0,82,139,67,16,137,4,36,232,222,79,
-  0,0,80,139,67,12,137,4,36,232,210,79,0,0,87,139,67,8,137,4,36,232,198,79,0,0,
-  86,139,67,20,137,4,36,232,186,79,0,0,81,141,101,244,49,192,91,94,95,93,195,
-  85,137,229,87,86,83,131,236,28,139,93,8,139,115,4,199,68,36,4,32,0,0,0,137,
-  52,36,232,124,78,0,0,137,199,49,192,133,255,116,103,71,161,88,147,64,0,137,
-  68,36,4,137,60,36,232,114,78,0,0,137,194,57,248,117,55,49,192,131,201,255,
-  139,61,88,147,64,0,242,174,247,209,128,124,10,255,0,117,33,199,68,36,8,100,0,
-  0,0,199,68,36,4,233,146,64,0,139,3,137,4,36,232,131,246,255,255,184,1,0,0,0,
-  235,24,137,116,36,8,199,68,36,4,249,146,64,0,139,3,137,4,36,232,102,246,255,
-  255,49,192,131,196,28,91,94,95,93,195,85,137,229,87,86,83,131,236,44,139,117,
-  8,139,70,4,199,68,36,4,32,0,0,0,137,4,36,137,69,224,232,227,77,0,0,137,69,
-  228,49,192,131,125,228,0,15,132,204,0,0,0,139,93,228,139,61,128,147,64,0,67,
-  137,124,36,4,137,28,36,232,206,77,0,0,137,194,57,216,117,32,49,192,131,201,
-  255,242,174,247,209,128,124,10,255,32,117,16,141,12,10,137,12,36,232,165,77,
-  0,0,137,70,28,235,110,139,61,116,147,64,0,137,28,36,137,124,36,4,232,150,77,
-  0,0,57,216,117,34,49,192,131,201,255,242,174,139,69,228,247,209,128,60,8,32,
-  117,16,141,12,11,137,12,36,232,109,77,0,0,137,70,24,235,54,139,61,100,147,64,
-  0,137,28,36,137,124,36,4,232,94,77,0,0,57,216,117,39,49,192,131,201,255,242,
-  174,139,69,228,247,209,128,60,8,32,117,21,141,12,11,137,12,36,232,117,7,0,0,
-  137,70,32,184,1,0,0,0,235,27,139,69,224,199,68,36,4,22,147,64,0,137,68,36,8,
-  139,6,137,4,36,232,97,245,255,255,49,192,131,196,44,91,94,95,93,195,85,137,
-  229,83,131,236,100,141,69,244,199,69,244,0,0,0,0,137,68,36,40,141,69,234,199,
-  69,240,0,0,0,0,198,69,234,0,198,69,235,0,198,69,236,0,198,69,237,0,198,69,
-  238,0,198,69,239,5,199,68,36,36,0,0,0,0,199,68,36,32,0,0,0,0,199,68,36,28,0,
-  0,0,0,199,68,36,24,0,0,0,0,199,68,36,20,0,0,0,0,199,68,36,16,0,0,0,0,199,68,
-  36,12,32,2,0,0,199,68,36,8,32,0,0,0,199,68,36,4,2,0,0,0,137,4,36,232,21,78,0,
-  0,131,236,44,133,192,15,132,203,0,0,0,139,69,244,199,69,200,255,1,31,0,137,
-  69,228,141,69,240,137,68,36,12,141,69,200,199,69,204,2,0,0,0,199,69,208,0,0,
-  0,0,199,69,220,0,0,0,0,199,69,224,2,0,0,0,199,68,36,8,0,0,0,0,137,68,36,4,
-  199,4,36,1,0,0,0,232,199,77,0,0,131,236,16,133,192,117,121,199,68,36,4,20,0,
-  0,0,199,4,36,64,0,0,0,232,228,76,0,0,137,195,133,192,81,81,116,93,199,68,36,
-  4,1,0,0,0,137,4,36,232,156,77,0,0,133,192,82,82,116,71,139,69,240,199,68,36,
-  12,0,0,0,0,137,68,36,8,199,68,36,4,1,0,0,0,137,28,36,232,127,77,0,0,131,236,
-  16,133,192,116,33,199,5,240,169,64,0,12,0,0,0,137,29,244,169,64,0,199,5,248,
-  169,64,0,0,0,0,0,184,1,0,0,0,235,2,49,192,139,93,252,201,195,85,137,229,87,
-  86,83,131,236,60,232,142,254,255,255,137,194,131,200,255,133,210,15,132,135,
-  1,0,0,199,4,36,24,0,0,0,232,141,75,0,0,185,5,0,0,0,137,195,141,112,4,49,192,
-  137,247,243,171,199,68,36,12,0,0,0,0,199,68,36,8,1,0,0,0,199,68,36,4,1,0,0,0,
-  199,4,36,0,0,0,0,232,37,76,0,0,131,236,16,137,67,20,199,68,36,28,240,169,64,
-  0,199,68,36,24,0,0,0,0,199,68,36,20,0,1,0,0,199,68,36,16,0,1,0,0,199,68,36,
-  12,255,0,0,0,199,68,36,8,0,0,0,0,199,68,36,4,3,0,0,64,199,4,36,49,147,64,0,
-  232,227,75,0,0,131,236,32,137,3,131,248,255,117,27,139,67,20,137,4,36,232,
-  246,75,0,0,81,137,28,36,232,249,74,0,0,49,192,233,216,0,0,0,137,116,36,4,137,
-  4,36,232,186,75,0,0,133,192,82,82,15,133,158,0,0,0,232,179,75,0,0,61,23,2,0,
-  0,116,47,61,229,3,0,0,15,133,135,0,0,0,141,69,228,199,68,36,12,1,0,0,0,137,
-  68,36,8,139,3,137,116,36,4,137,4,36,232,140,75,0,0,131,236,16,133,192,116,99,
-  199,4,36,8,0,0,0,232,141,74,0,0,139,21,8,160,64,0,66,137,24,137,21,8,160,64,
-  0,137,80,4,199,68,36,20,0,0,0,0,199,68,36,16,0,0,0,0,137,68,36,12,199,68,36,
-  8,186,20,64,0,199,68,36,4,0,0,0,0,199,4,36,0,0,0,0,232,63,75,0,0,131,236,24,
-  133,192,116,14,137,4,36,232,56,75,0,0,80,233,157,254,255,255,139,3,137,4,36,
-  232,40,75,0,0,139,67,20,87,137,4,36,232,28,75,0,0,86,137,28,36,232,31,74,0,0,
-  233,121,254,255,255,141,101,244,91,94,95,93,194,4,0,141,76,36,4,131,228,240,
-  255,113,252,85,137,229,87,86,81,131,236,44,141,125,216,232,253,3,0,0,190,144,
-  147,64,0,185,4,0,0,0,141,69,216,243,165,137,4,36,232,122,75,0,0,80,141,101,
-  244,89,49,192,94,95,93,141,97,252,195,85,137,229,131,236,24,139,69,8,131,248,
-  2,116,10,131,248,3,116,17,72,117,66,235,24,199,5,4,170,64,0,7,0,0,0,235,52,
-  199,5,4,170,64,0,4,0,0,0,235,40,199,5,12,170,64,0,0,0,0,0,199,5,4,170,64,0,1,
-  0,0,0,199,5,20,170,64,0,0,0,0,0,199,5,24,170,64,0,0,0,0,0,161,32,170,64,0,
-  199,68,36,4,0,170,64,0,137,4,36,232,15,75,0,0,133,192,82,82,117,5,232,52,74,
-  0,0,201,194,4,0,85,137,229,131,236,40,199,68,36,20,0,0,0,0,199,68,36,16,0,0,
-  0,0,199,68,36,12,0,0,0,0,199,68,36,8,12,32,64,0,199,68,36,4,0,0,0,0,199,4,36,
-  0,0,0,0,232,6,74,0,0,137,194,131,236,24,184,1,0,0,0,133,210,116,11,137,20,36,
-  232,248,73,0,0,49,192,81,201,195,85,137,229,131,236,40,199,5,0,170,64,0,48,0,
-  0,0,199,5,4,170,64,0,2,0,0,0,199,5,8,170,64,0,3,0,0,0,199,5,12,170,64,0,0,0,
-  0,0,199,5,16,170,64,0,0,0,0,0,199,5,20,170,64,0,0,0,0,0,199,5,24,170,64,0,0,
-  0,0,0,199,68,36,4,248,33,64,0,199,4,36,132,147,64,0,232,67,74,0,0,163,32,170,
-  64,0,133,192,82,82,15,132,155,0,0,0,141,69,244,137,68,36,8,139,69,12,137,68,
-  36,4,139,69,8,137,4,36,232,35,255,255,255,139,21,32,170,64,0,133,192,116,63,
-  163,12,170,64,0,139,69,244,199,5,4,170,64,0,1,0,0,0,199,5,20,170,64,0,0,0,0,
-  0,199,5,24,170,64,0,0,0,0,0,163,16,170,64,0,199,68,36,4,0,170,64,0,137,20,36,
-  232,222,73,0,0,81,81,235,57,137,20,36,199,5,4,170,64,0,4,0,0,0,199,5,20,170,
-  64,0,0,0,0,0,199,5,24,170,64,0,0,0,0,0,199,68,36,4,0,170,64,0,232,172,73,0,0,
-  133,192,82,82,117,5,232,209,72,0,0,201,194,8,0,144,0,0,0,0,0,0,0,0,85,137,
-  229,83,156,156,90,137,208,129,242,0,0,32,0,82,157,156,90,157,49,208,169,0,0,
-  32,0,15,132,225,0,0,0,49,192,15,162,133,192,15,132,213,0,0,0,184,1,0,0,0,15,
-  162,246,198,1,116,15,139,29,16,160,64,0,131,203,1,137,29,16,160,64,0,102,133,
-  210,121,13,161,16,160,64,0,131,200,2,163,16,160,64,0,247,194,0,0,128,0,116,
-  13,161,16,160,64,0,131,200,4,163,16,160,64,0,247,194,0,0,0,1,116,13,161,16,
-  160,64,0,131,200,8,163,16,160,64,0,247,194,0,0,0,2,116,13,161,16,160,64,0,
-  131,200,16,163,16,160,64,0,129,226,0,0,0,4,116,13,161,16,160,64,0,131,200,32,
-  163,16,160,64,0,246,193,1,116,13,161,16,160,64,0,131,200,64,163,16,160,64,0,
-  128,229,32,116,15,139,29,16,160,64,0,128,203,128,137,29,16,160,64,0,184,0,0,
-  0,128,15,162,61,0,0,0,128,118,32,184,1,0,0,128,15,162,133,210,120,24,129,226,
-  0,0,0,64,116,13,161,16,160,64,0,128,204,2,163,16,160,64,0,91,93,195,139,13,
-  16,160,64,0,128,205,1,137,13,16,160,64,0,235,215,144,144,144,144,144,144,144,
-  144,144,144,85,137,229,219,227,93,195,144,144,144,144,144,144,144,144,144,85,
-  185,64,151,64,0,137,229,129,249,64,151,64,0,115,24,139,81,4,139,1,129,194,0,
-  0,64,0,131,193,8,1,2,129,249,64,151,64,0,114,232,93,195,144,144,144,144,144,
-  144,85,137,229,131,236,8,161,40,128,64,0,139,0,133,192,116,21,255,208,161,40,
-  128,64,0,131,192,4,163,40,128,64,0,139,0,133,192,117,235,201,195,144,141,180,
-  38,0,0,0,0,85,161,16,112,64,0,137,229,131,248,255,86,83,116,48,133,192,116,
-  21,141,52,133,16,112,64,0,137,195,141,116,38,0,255,22,131,238,4,75,117,248,
-  131,236,12,104,64,37,64,0,232,91,234,255,255,131,196,16,141,101,248,91,94,93,
-  195,49,192,235,2,137,208,141,80,1,139,12,149,16,112,64,0,133,201,117,240,235,
-  186,141,116,38,0,141,188,39,0,0,0,0,85,161,24,160,64,0,137,229,133,192,116,4,
-  93,195,102,144,199,5,24,160,64,0,1,0,0,0,93,235,131,144,144,144,255,37,116,
-  178,64,0,144,144,0,0,0,0,0,0,0,0,86,83,131,236,4,139,68,36,20,139,116,36,16,
-  139,76,36,24,139,84,36,28,133,192,117,23,131,236,12,82,81,106,0,86,106,0,232,
-  184,19,0,0,131,196,32,90,91,94,195,144,131,236,12,141,88,255,82,81,83,86,106,
-  0,232,159,19,0,0,131,196,32,137,194,57,216,119,8,198,4,50,0,90,91,94,195,137,
-  218,198,4,50,0,235,244,144,144,144,144,144,144,83,137,195,131,236,40,139,68,
-  36,48,137,68,36,8,139,68,36,52,137,68,36,12,139,68,36,56,137,68,36,16,139,68,
-  36,60,137,68,36,20,219,108,36,8,217,229,155,223,224,221,216,37,255,255,0,0,
-  246,196,1,116,26,246,196,4,15,132,124,0,0,0,15,191,84,36,16,49,192,199,68,36,
-  36,3,0,0,0,235,20,246,196,4,117,71,15,191,84,36,16,199,68,36,36,0,0,0,0,49,
-  192,129,226,0,128,0,0,137,193,139,68,36,72,137,16,141,68,36,32,141,84,36,36,
-  80,139,68,36,72,80,139,68,36,72,80,83,82,141,68,36,28,80,81,104,44,128,64,0,
-  232,180,28,0,0,131,196,72,91,195,246,196,64,116,42,15,191,84,36,16,184,195,
-  191,255,255,199,68,36,36,2,0,0,0,235,175,141,182,0,0,0,0,49,210,49,201,199,
-  68,36,36,4,0,0,0,235,163,102,144,15,191,84,36,16,137,208,199,68,36,36,1,0,0,
-  0,37,255,127,0,0,45,62,64,0,0,233,123,255,255,255,102,144,83,137,211,131,236,
-  8,137,193,139,82,4,246,198,32,117,8,139,67,28,59,67,24,126,13,128,230,16,117,
-  19,139,19,139,67,24,136,12,2,139,75,24,65,137,75,24,88,90,91,195,80,80,139,3,
-  80,81,232,81,68,0,0,139,75,24,65,131,196,16,137,75,24,88,90,91,195,141,180,
-  38,0,0,0,0,85,137,229,87,86,83,131,236,28,137,198,131,120,16,253,15,132,141,
-  0,0,0,102,131,126,20,0,116,100,139,70,16,137,101,224,131,192,30,131,224,240,
-  232,175,69,0,0,199,69,236,0,0,0,0,141,124,36,15,80,141,69,236,131,231,240,80,
-  139,70,20,37,255,255,0,0,80,87,232,113,52,0,0,131,196,16,137,69,220,133,192,
-  126,59,49,219,144,141,116,38,0,15,190,4,59,137,242,67,232,68,255,255,255,59,
-  93,220,117,239,139,101,224,141,101,244,91,94,95,93,195,141,116,38,0,137,242,
-  184,46,0,0,0,232,36,255,255,255,141,101,244,91,94,95,93,195,137,242,184,46,0,
-  0,0,232,16,255,255,255,235,207,199,69,236,0,0,0,0,232,158,67,0,0,141,85,236,
-  82,106,16,139,0,80,141,69,242,80,232,240,49,0,0,131,196,16,137,194,133,192,
-  126,8,102,139,69,242,102,137,70,20,137,86,16,233,60,255,255,255,141,180,38,0,
-  0,0,0,85,87,86,83,131,236,12,137,195,137,215,137,205,139,116,36,32,133,201,
-  15,142,218,1,0,0,139,70,8,57,193,15,140,175,0,0,0,199,70,8,255,255,255,255,
-  199,70,8,255,255,255,255,133,219,15,133,39,1,0,0,139,70,4,246,196,1,15,133,
-  156,1,0,0,168,64,15,133,185,1,0,0,139,86,8,133,210,126,19,139,70,4,37,0,6,0,
-  0,61,0,2,0,0,15,132,62,1,0,0,133,237,15,142,97,1,0,0,137,235,138,23,184,48,0,
-  0,0,132,210,116,4,15,190,194,71,137,242,232,72,254,255,255,75,117,231,49,237,
-  139,86,12,133,210,15,142,218,0,0,0,137,240,232,129,254,255,255,133,237,121,
-  27,233,220,0,0,0,138,23,184,48,0,0,0,132,210,116,4,15,190,194,71,137,242,232,
-  18,254,255,255,139,86,12,133,210,141,66,255,137,70,12,127,221,131,196,12,91,
-  94,95,93,195,41,200,137,70,8,133,192,15,136,75,255,255,255,139,86,12,57,194,
-  15,141,64,255,255,255,41,208,137,70,8,133,192,15,142,58,255,255,255,139,78,
-  12,133,201,15,142,21,1,0,0,72,137,70,8,133,192,15,132,35,255,255,255,133,219,
-  117,11,139,86,4,247,194,192,1,0,0,116,15,72,137,70,8,133,192,15,132,8,255,
-  255,255,139,86,4,128,230,6,15,133,252,254,255,255,139,70,8,72,137,70,8,141,
-  118,0,137,242,184,32,0,0,0,232,132,253,255,255,139,86,8,141,66,255,133,210,
-  137,70,8,127,231,133,219,15,132,217,254,255,255,137,242,184,45,0,0,0,232,99,
-  253,255,255,233,220,254,255,255,246,70,5,8,15,133,28,255,255,255,133,237,15,
-  137,58,255,255,255,139,70,12,137,235,1,232,49,237,137,70,12,137,242,184,48,0,
-  0,0,67,232,51,253,255,255,57,235,117,239,233,24,255,255,255,141,66,255,137,
-  70,8,141,116,38,0,137,242,184,48,0,0,0,232,20,253,255,255,139,86,8,141,66,
-  255,133,210,137,70,8,127,231,133,237,15,143,159,254,255,255,137,242,184,48,0,
-  0,0,232,243,252,255,255,233,171,254,255,255,137,242,184,43,0,0,0,232,226,252,
-  255,255,233,91,254,255,255,139,70,8,133,192,15,142,218,254,255,255,72,137,70,
-  8,233,209,254,255,255,137,242,184,32,0,0,0,232,189,252,255,255,233,54,254,
-  255,255,246,70,5,8,15,132,237,254,255,255,233,220,254,255,255,137,246,141,
-  188,39,0,0,0,0,85,137,229,87,86,83,131,236,44,131,248,111,137,69,224,137,85,
-  208,15,149,192,49,210,137,77,212,136,194,37,255,0,0,0,131,194,3,139,77,8,131,
-  125,224,111,141,52,197,7,0,0,0,139,121,12,15,148,192,37,255,0,0,0,137,101,
-  228,72,137,85,232,131,224,250,137,251,131,192,24,133,255,15,136,196,1,0,0,
-  139,85,8,1,216,139,90,8,57,216,125,2,137,216,131,192,30,131,224,240,232,95,
-  66,0,0,139,69,208,141,76,36,15,139,85,212,131,225,240,9,194,137,77,220,15,
-  132,197,1,0,0,138,85,224,137,247,131,226,32,137,206,136,85,219,138,93,208,33,
-  251,141,67,48,136,6,70,60,57,126,9,141,67,55,10,69,219,136,70,255,138,77,232,
-  139,85,212,139,69,208,15,173,208,211,234,246,193,32,116,4,137,208,49,210,137,
-  85,212,137,69,208,9,194,117,199,59,117,220,15,132,112,1,0,0,139,93,8,139,123,
-  12,133,255,15,142,22,1,0,0,137,240,139,85,220,41,208,137,249,41,193,133,201,
-  15,142,3,1,0,0,137,240,141,20,49,141,182,0,0,0,0,198,0,48,64,57,208,117,248,
-  141,52,49,59,117,220,15,132,74,1,0,0,139,93,8,137,240,139,125,220,139,83,8,
-  41,248,57,194,15,142,172,0,0,0,137,215,41,199,137,123,8,133,255,126,40,131,
-  125,224,111,116,20,139,85,8,246,66,5,8,116,11,131,239,2,133,255,15,142,153,0,
-  0,0,139,77,8,139,89,12,133,219,15,136,195,0,0,0,131,125,224,111,116,9,139,93,
-  8,246,67,5,8,117,124,133,255,126,42,139,85,8,246,66,5,4,117,33,141,79,255,49,
-  219,137,77,236,139,85,8,184,32,0,0,0,67,232,18,251,255,255,57,251,117,238,
-  139,93,236,41,251,137,223,137,243,59,117,220,118,18,15,190,67,255,139,85,8,
-  75,232,243,250,255,255,57,93,220,114,238,133,255,126,20,49,219,139,85,8,184,
-  32,0,0,0,67,232,218,250,255,255,57,251,117,238,139,101,228,141,101,244,91,94,
-  95,93,195,139,69,8,131,207,255,199,64,8,255,255,255,255,233,117,255,255,255,
-  138,69,224,198,70,1,48,136,6,131,198,2,233,115,255,255,255,131,125,224,111,
-  15,133,9,255,255,255,139,69,8,246,64,5,8,15,132,252,254,255,255,198,6,48,70,
-  233,243,254,255,255,49,219,233,53,254,255,255,139,65,4,37,0,6,0,0,61,0,2,0,0,
-  15,133,42,255,255,255,79,79,198,6,48,70,141,71,1,133,192,127,244,233,24,255,
-  255,255,139,85,8,139,122,12,139,77,8,139,117,220,139,89,4,128,231,247,137,89,
-  4,233,124,254,255,255,139,85,8,139,66,12,133,192,15,132,168,254,255,255,139,
-  77,220,137,206,70,198,1,48,233,154,254,255,255,141,182,0,0,0,0,85,87,86,83,
-  131,236,48,137,207,137,211,137,68,36,12,141,68,36,44,80,106,0,141,84,36,36,
-  82,232,16,47,0,0,139,87,12,131,196,16,133,210,120,8,57,211,15,143,171,0,0,0,
-  139,71,8,57,195,15,141,151,0,0,0,41,216,137,71,8,133,192,126,32,246,71,5,4,
-  117,26,72,137,71,8,184,32,0,0,0,137,250,232,196,249,255,255,139,71,8,72,137,
-  71,8,64,117,234,137,221,133,237,126,83,86,141,68,36,44,80,139,84,36,16,102,
-  139,2,37,255,255,0,0,80,141,68,36,36,80,232,167,46,0,0,131,196,16,137,198,
-  133,192,126,45,49,219,15,190,68,28,24,137,250,67,232,127,249,255,255,57,243,
-  117,239,139,68,36,8,77,131,192,2,137,68,36,8,235,181,137,250,184,32,0,0,0,
-  232,97,249,255,255,139,87,8,133,210,141,66,255,137,71,8,127,231,131,196,44,
-  91,94,95,93,195,199,71,8,255,255,255,255,235,137,137,211,233,78,255,255,255,
-  141,182,0,0,0,0,141,191,0,0,0,0,87,86,83,137,215,139,81,12,137,195,137,206,
-  133,210,120,4,57,215,127,98,139,70,8,57,199,125,82,41,248,137,70,8,133,192,
-  126,6,246,70,5,4,116,80,133,255,116,46,1,223,15,190,3,137,242,67,232,245,248,
-  255,255,57,251,117,241,139,86,8,133,210,141,66,255,137,70,8,126,29,141,116,
-  38,0,137,242,184,32,0,0,0,232,212,248,255,255,139,86,8,133,210,141,66,255,
-  137,70,8,127,231,91,94,95,195,199,70,8,255,255,255,255,235,180,137,215,235,
-  154,72,137,70,8,102,144,184,32,0,0,0,137,242,232,164,248,255,255,139,70,8,72,
-  137,70,8,64,117,234,235,146,144,141,180,38,0,0,0,0,85,87,86,83,131,236,28,
-  137,214,137,207,199,65,12,255,255,255,255,133,192,116,90,198,68,36,24,45,141,
-  84,36,24,141,108,36,25,139,65,4,137,84,36,8,136,194,138,6,131,226,32,131,224,
-  223,9,208,141,78,1,136,69,0,141,93,1,190,2,0,0,0,138,1,65,131,224,223,9,208,
-  136,3,67,78,117,242,139,68,36,8,141,85,3,41,194,137,249,141,68,36,24,232,250,
-  254,255,255,131,196,28,91,94,95,93,195,102,144,139,65,4,246,196,1,116,19,141,
-  84,36,24,141,108,36,25,198,68,36,24,43,137,84,36,8,235,159,168,64,116,19,141,
-  84,36,24,141,108,36,25,198,68,36,24,32,137,84,36,8,235,136,141,84,36,24,137,
-  213,137,84,36,8,233,121,255,255,255,235,13,144,144,144,144,144,144,144,144,
-  144,144,144,144,144,86,83,131,236,36,137,198,139,72,12,133,201,15,136,185,0,
-  0,0,139,68,36,48,139,84,36,52,139,76,36,56,139,94,12,137,68,36,8,137,84,36,
-  12,137,76,36,16,82,141,68,36,32,80,141,68,36,32,80,83,139,68,36,36,80,139,68,
-  36,36,80,139,68,36,36,80,139,68,36,36,80,184,3,0,0,0,232,137,246,255,255,139,
-  76,36,56,137,195,131,196,32,129,249,0,128,255,255,116,71,131,236,12,137,218,
-  139,68,36,40,86,232,137,248,255,255,139,86,8,141,66,255,131,196,16,137,70,8,
-  133,210,126,25,137,242,184,32,0,0,0,232,61,247,255,255,139,86,8,141,66,255,
-  133,210,137,70,8,127,231,131,236,12,83,232,151,46,0,0,131,196,52,91,94,195,
-  139,68,36,28,137,241,137,218,232,132,254,255,255,131,236,12,83,232,123,46,0,
-  0,131,196,52,91,94,195,199,64,12,6,0,0,0,233,59,255,255,255,137,246,141,188,
-  39,0,0,0,0,85,137,229,87,86,83,131,236,12,137,214,139,81,12,137,195,137,207,
-  137,101,236,137,208,133,210,15,136,178,1,0,0,131,192,23,139,79,8,57,200,125,
-  2,137,200,131,192,30,131,224,240,232,230,60,0,0,141,68,36,15,131,224,240,137,
-  69,232,139,71,4,132,192,121,13,133,246,15,136,197,1,0,0,36,127,137,71,4,139,
-  69,232,137,69,240,137,240,9,216,116,53,106,0,106,10,86,83,232,229,60,0,0,139,
-  85,240,131,192,48,131,196,16,136,2,66,137,85,240,106,0,106,10,86,83,232,219,
-  61,0,0,137,195,137,208,131,196,16,137,214,9,216,117,206,139,87,12,133,210,
-  126,39,139,77,232,139,69,240,41,200,137,209,41,193,133,201,126,23,139,69,240,
-  141,20,1,144,198,0,48,64,57,208,117,248,139,85,240,1,209,137,77,240,139,93,
-  232,57,93,240,15,132,84,1,0,0,139,87,8,133,210,15,142,195,0,0,0,139,69,240,
-  139,117,232,41,240,41,194,137,208,137,87,8,133,210,15,142,172,0,0,0,139,79,4,
-  247,193,192,1,0,0,116,4,72,137,71,8,139,95,12,133,219,15,136,208,0,0,0,246,
-  197,4,116,103,132,201,15,137,144,0,0,0,139,85,240,198,2,45,66,137,85,240,139,
-  85,240,57,85,232,115,53,137,211,141,180,38,0,0,0,0,15,190,67,255,137,250,75,
-  232,180,245,255,255,57,93,232,114,239,139,87,8,133,210,141,66,255,137,71,8,
-  126,27,102,144,137,250,184,32,0,0,0,232,148,245,255,255,139,87,8,133,210,141,
-  66,255,137,71,8,127,231,139,101,236,141,101,244,91,94,95,93,195,139,87,8,133,
-  210,141,66,255,137,71,8,126,140,137,250,184,32,0,0,0,232,99,245,255,255,139,
-  87,8,141,66,255,133,210,137,71,8,127,231,139,79,4,132,201,15,136,112,255,255,
-  255,246,197,1,116,15,139,93,240,198,3,43,67,137,93,240,233,102,255,255,255,
-  131,225,64,15,132,93,255,255,255,139,69,240,198,0,32,64,137,69,240,233,78,
-  255,255,255,49,192,233,71,254,255,255,137,200,37,0,6,0,0,61,0,2,0,0,15,133,
-  30,255,255,255,139,87,8,133,210,141,66,255,137,71,8,15,142,18,255,255,255,
-  139,69,240,198,0,48,64,139,87,8,137,69,240,133,210,141,66,255,137,71,8,127,
-  233,235,134,247,219,131,214,0,247,222,233,52,254,255,255,139,71,12,133,192,
-  15,132,161,254,255,255,198,3,48,67,137,93,240,233,149,254,255,255,137,246,
-  141,188,39,0,0,0,0,85,87,86,83,131,236,76,139,68,36,96,139,108,36,112,137,68,
-  36,24,139,68,36,100,137,68,36,28,139,68,36,104,137,68,36,32,139,125,12,139,
-  68,36,108,131,255,14,137,68,36,36,15,135,239,0,0,0,139,84,36,28,139,68,36,24,
-  133,210,120,18,15,164,194,1,1,192,133,210,121,246,137,68,36,24,137,84,36,28,
-  185,14,0,0,0,137,214,41,249,137,195,193,225,2,184,4,0,0,0,49,210,15,172,243,
-  1,15,165,194,209,238,211,224,246,193,32,116,4,137,194,49,192,1,195,17,214,
-  137,92,36,24,137,116,36,28,133,246,15,136,90,3,0,0,15,164,222,1,1,219,137,
-  116,36,28,137,92,36,24,185,15,0,0,0,139,116,36,28,41,249,139,92,36,24,193,
-  225,2,15,173,243,211,238,246,193,32,116,4,137,243,49,246,137,240,137,92,36,
-  24,137,116,36,28,9,216,117,102,141,68,36,54,139,85,4,137,68,36,4,137,84,36,
-  16,133,255,15,142,42,3,0,0,141,84,36,56,198,68,36,54,46,141,68,36,55,137,84,
-  36,20,198,0,48,139,93,8,133,219,15,143,52,1,0,0,139,84,36,16,190,2,0,0,0,132,
-  210,15,137,159,1,0,0,137,234,184,45,0,0,0,232,143,243,255,255,233,160,1,0,0,
-  139,116,36,28,139,92,36,24,137,240,9,216,116,154,141,84,36,54,137,84,36,4,
-  137,84,36,20,139,85,4,137,84,36,16,131,226,32,136,84,36,15,235,64,139,68,36,
-  20,57,68,36,4,114,7,139,69,12,133,192,120,14,141,71,48,139,84,36,20,136,2,66,
-  137,84,36,20,139,116,36,28,139,92,36,24,15,172,243,4,193,238,4,137,92,36,24,
-  137,240,137,116,36,28,9,216,15,132,143,0,0,0,137,223,137,241,131,231,15,137,
-  250,137,248,193,250,31,49,216,49,209,9,193,116,29,139,69,12,133,192,126,4,72,
-  137,69,12,133,255,116,155,131,255,9,126,167,141,71,55,10,68,36,15,235,161,
-  139,68,36,20,57,68,36,4,114,13,246,69,5,8,117,7,139,69,12,133,192,126,12,139,
-  84,36,20,198,2,46,66,137,84,36,20,131,124,36,28,0,119,7,131,124,36,24,1,118,
-  189,139,92,36,24,139,116,36,28,141,116,38,0,15,172,243,1,209,238,137,92,36,
-  24,102,255,76,36,32,137,116,36,28,131,254,0,119,232,131,251,1,119,227,235,
-  146,139,84,36,20,57,84,36,4,15,132,218,1,0,0,139,93,8,133,219,15,142,204,254,
-  255,255,139,84,36,20,139,124,36,4,139,69,12,41,250,139,116,36,32,133,192,126,
-  2,1,194,139,69,4,37,192,1,0,0,131,248,1,25,192,15,191,254,141,76,2,6,137,248,
-  186,103,102,102,102,190,2,0,0,0,247,234,193,255,31,193,250,2,41,250,137,215,
-  116,28,141,118,0,137,248,186,103,102,102,102,247,234,193,255,31,65,193,250,2,
-  70,41,250,137,215,133,210,117,231,57,203,15,143,249,0,0,0,199,69,8,255,255,
-  255,255,139,84,36,16,132,210,15,136,97,254,255,255,246,198,1,15,133,30,1,0,0,
-  131,226,64,15,133,48,1,0,0,137,234,184,48,0,0,0,232,222,241,255,255,139,69,4,
-  131,224,32,137,234,131,200,88,232,206,241,255,255,139,69,8,133,192,126,35,
-  246,69,5,2,116,29,72,137,69,8,137,234,184,48,0,0,0,232,177,241,255,255,139,
-  85,8,141,66,255,133,210,137,69,8,127,231,139,84,36,20,57,84,36,4,115,55,137,
-  211,235,23,141,182,0,0,0,0,15,190,192,137,234,232,134,241,255,255,75,57,92,
-  36,4,115,28,138,67,255,60,46,117,232,137,232,232,193,241,255,255,235,233,137,
-  234,184,48,0,0,0,232,99,241,255,255,139,85,12,133,210,141,66,255,137,69,12,
-  127,231,139,69,4,137,234,131,224,32,131,200,80,232,70,241,255,255,139,93,4,
-  15,191,198,139,117,8,129,203,192,1,0,0,1,198,137,93,4,137,117,8,137,233,15,
-  191,68,36,32,137,194,193,250,31,232,46,250,255,255,131,196,76,91,94,95,93,
-  195,41,203,139,84,36,16,137,93,8,246,198,6,15,133,0,255,255,255,141,67,255,
-  133,219,137,69,8,15,142,242,254,255,255,137,234,184,32,0,0,0,232,234,240,255,
-  255,139,85,8,141,66,255,133,210,137,69,8,127,231,139,85,4,233,209,254,255,
-  255,137,234,184,43,0,0,0,232,201,240,255,255,233,218,254,255,255,102,255,68,
-  36,32,233,170,252,255,255,137,234,184,32,0,0,0,232,174,240,255,255,233,191,
-  254,255,255,139,125,12,233,206,252,255,255,246,69,5,8,15,133,204,252,255,255,
-  141,68,36,55,137,68,36,20,141,68,36,54,233,204,252,255,255,141,182,0,0,0,0,
-  85,87,86,83,131,236,12,141,121,255,137,213,186,103,102,102,102,137,68,36,8,
-  137,248,247,234,137,248,139,92,36,32,193,250,2,185,1,0,0,0,193,248,31,137,
-  214,41,198,116,24,137,240,186,103,102,102,102,247,234,193,254,31,65,193,250,
-  2,41,242,137,214,133,210,117,232,139,83,32,137,200,57,209,125,2,137,208,139,
-  83,8,141,112,2,57,242,126,85,41,242,137,83,8,131,236,12,185,1,0,0,0,137,234,
-  83,139,68,36,24,232,58,241,255,255,139,67,32,137,67,12,139,67,4,13,192,1,0,0,
-  137,218,137,67,4,131,224,32,131,200,69,232,236,239,255,255,139,67,8,72,137,
-  250,1,240,137,217,193,250,31,137,67,8,131,196,28,137,248,91,94,95,93,233,222,
-  248,255,255,199,67,8,255,255,255,255,235,167,144,141,116,38,0,87,86,83,137,
-  195,131,236,32,139,112,12,131,254,0,15,140,14,1,0,0,15,132,247,0,0,0,139,68,
-  36,48,139,84,36,52,139,76,36,56,137,68,36,8,137,84,36,12,137,76,36,16,81,141,
-  68,36,32,80,141,68,36,32,80,86,139,84,36,36,82,139,68,36,36,80,139,68,36,36,
-  80,139,68,36,36,80,184,2,0,0,0,232,116,238,255,255,139,116,36,56,137,199,131,
-  196,32,129,254,0,128,255,255,15,132,2,1,0,0,131,254,252,126,106,139,67,12,57,
-  198,127,99,246,67,5,8,15,132,190,0,0,0,41,240,137,67,12,131,236,12,137,250,
-  137,241,139,68,36,40,83,232,83,240,255,255,139,83,8,141,66,255,131,196,16,
-  137,67,8,133,210,126,84,141,118,0,137,218,184,32,0,0,0,232,4,239,255,255,139,
-  83,8,141,66,255,133,210,137,67,8,127,231,131,236,12,87,232,94,38,0,0,131,196,
-  48,91,94,95,195,141,180,38,0,0,0,0,246,67,5,8,116,77,139,67,12,72,137,67,12,
-  131,236,12,137,241,137,250,139,68,36,40,83,232,66,254,255,255,131,196,16,131,
-  236,12,87,232,38,38,0,0,131,196,48,91,94,95,195,190,1,0,0,0,199,64,12,1,0,0,
-  0,233,248,254,255,255,190,6,0,0,0,199,64,12,6,0,0,0,233,231,254,255,255,131,
-  236,12,87,232,40,51,0,0,131,196,16,72,137,67,12,235,168,131,236,12,87,232,22,
-  51,0,0,41,240,131,196,16,137,67,12,133,192,15,137,46,255,255,255,139,83,8,
-  133,210,15,142,35,255,255,255,1,208,137,67,8,233,25,255,255,255,139,68,36,28,
-  137,217,137,250,232,176,245,255,255,131,236,12,87,232,167,37,0,0,131,196,48,
-  91,94,95,195,86,83,131,236,36,137,198,139,64,12,133,192,15,136,158,0,0,0,139,
-  68,36,48,139,76,36,56,139,84,36,52,139,94,12,137,68,36,8,137,76,36,16,137,84,
-  36,12,80,141,68,36,32,67,80,141,68,36,32,80,83,139,68,36,36,80,139,68,36,36,
-  80,139,68,36,36,80,184,2,0,0,0,139,92,36,36,83,232,232,236,255,255,139,76,36,
-  56,137,195,131,196,32,129,249,0,128,255,255,116,39,131,236,12,137,218,139,68,
-  36,40,86,232,56,253,255,255,131,196,16,131,236,12,83,232,28,37,0,0,131,196,
-  52,91,94,195,141,182,0,0,0,0,139,68,36,28,137,241,137,218,232,3,245,255,255,
-  131,236,12,83,232,250,36,0,0,131,196,52,91,94,195,141,116,38,0,199,70,12,6,0,
-  0,0,233,86,255,255,255,141,116,38,0,85,87,86,83,131,236,120,139,132,36,140,0,
-  0,0,139,180,36,152,0,0,0,37,0,48,0,0,139,172,36,156,0,0,0,137,68,36,32,104,
-  160,147,64,0,232,193,49,0,0,131,196,16,133,192,15,132,214,0,0,0,15,190,0,131,
-  232,48,131,248,2,15,135,199,0,0,0,186,2,0,0,0,139,132,36,132,0,0,0,139,76,36,
-  20,137,68,36,28,139,132,36,136,0,0,0,137,76,36,32,199,68,36,36,255,255,255,
-  255,199,68,36,40,255,255,255,255,199,68,36,44,253,255,255,255,102,199,68,36,
-  48,0,0,199,68,36,52,0,0,0,0,137,68,36,56,137,84,36,60,138,14,141,180,38,0,0,
-  0,0,132,201,15,132,152,0,0,0,141,126,1,128,249,37,117,119,139,68,36,20,199,
-  68,36,40,255,255,255,255,137,68,36,32,199,68,36,36,255,255,255,255,141,68,36,
-  36,138,78,1,49,210,137,254,199,68,36,12,0,0,0,0,137,68,36,16,132,201,116,93,
-  141,65,224,70,15,190,217,60,90,118,98,131,250,3,119,9,131,251,57,15,142,125,
-  5,0,0,141,84,36,28,184,37,0,0,0,232,102,236,255,255,137,254,138,15,235,144,
-  232,227,48,0,0,186,3,0,0,0,168,1,15,132,44,255,255,255,233,34,255,255,255,15,
-  190,193,141,84,36,28,232,61,236,255,255,138,78,1,132,201,137,254,15,133,104,
-  255,255,255,139,68,36,52,131,196,108,91,94,95,93,195,141,116,38,0,37,255,0,0,
-  0,255,36,133,216,147,64,0,199,68,36,12,2,0,0,0,128,62,108,117,9,70,199,68,36,
-  12,3,0,0,0,139,68,36,32,186,4,0,0,0,131,200,4,137,68,36,32,138,14,233,86,255,
-  255,255,139,68,36,32,131,200,32,137,68,36,32,246,68,36,32,4,15,133,50,2,0,0,
-  131,236,16,141,93,8,221,69,0,219,60,36,141,68,36,44,137,221,232,250,251,255,
-  255,138,14,131,196,16,233,224,254,255,255,139,68,36,32,131,200,32,137,68,36,
-  32,246,68,36,32,4,15,133,230,1,0,0,131,236,16,141,93,8,221,69,0,219,60,36,
-  141,68,36,44,137,221,232,179,243,255,255,138,14,131,196,16,233,169,254,255,
-  255,139,68,36,32,131,200,32,137,68,36,32,246,68,36,32,4,15,133,154,1,0,0,131,
-  236,16,141,93,8,221,69,0,219,60,36,141,68,36,44,137,221,232,28,253,255,255,
-  138,14,131,196,16,233,114,254,255,255,139,68,36,32,131,200,32,137,68,36,32,
-  139,84,36,32,137,232,246,194,4,15,132,158,0,0,0,219,40,131,197,12,217,192,
-  219,124,36,80,217,229,155,223,224,37,0,69,0,0,61,0,1,0,0,15,132,72,5,0,0,139,
-  76,36,88,137,203,129,227,0,128,0,0,116,7,128,202,128,137,84,36,32,217,229,
-  155,223,224,221,216,37,0,69,0,0,61,0,5,0,0,15,132,206,6,0,0,137,202,129,226,
-  255,127,0,0,102,133,210,102,137,84,36,88,117,10,139,68,36,80,11,68,36,84,116,
-  11,141,130,1,192,255,255,102,137,68,36,88,131,236,12,141,84,36,40,82,139,68,
-  36,108,80,139,68,36,108,80,139,68,36,108,80,139,68,36,108,80,232,228,245,255,
-  255,138,14,131,196,32,233,186,253,255,255,221,0,131,197,8,221,84,36,64,217,
-  229,155,223,224,37,0,69,0,0,61,0,1,0,0,15,132,172,4,0,0,102,139,92,36,70,137,
-  223,129,231,0,128,0,0,116,7,128,202,128,137,84,36,32,131,236,16,221,28,36,
-  232,107,34,0,0,131,196,16,61,0,5,0,0,15,132,96,6,0,0,139,68,36,64,139,84,36,
-  68,137,217,15,164,194,8,102,193,233,4,137,84,36,68,193,224,8,129,225,255,7,0,
-  0,102,129,100,36,70,255,15,102,137,76,36,72,137,68,36,64,102,133,201,15,133,
-  221,4,0,0,139,68,36,64,11,68,36,68,116,7,102,199,68,36,72,1,252,131,236,12,
-  141,76,36,40,81,139,124,36,92,87,139,92,36,92,83,139,76,36,92,81,139,84,36,
-  92,82,232,35,245,255,255,138,14,131,196,32,233,249,252,255,255,80,141,93,12,
-  139,125,8,87,139,77,4,81,139,85,0,82,233,93,254,255,255,80,141,93,12,139,69,
-  8,80,139,69,4,80,139,69,0,80,233,17,254,255,255,87,141,93,12,139,77,8,81,139,
-  85,4,82,139,69,0,80,233,197,253,255,255,139,68,36,12,131,232,2,131,248,1,15,
-  135,84,3,0,0,139,93,0,133,219,15,132,140,4,0,0,131,236,12,131,197,4,83,232,
-  247,45,0,0,141,76,36,44,137,194,137,216,232,54,239,255,255,138,14,131,196,16,
-  233,124,252,255,255,138,14,128,249,54,15,133,73,3,0,0,128,126,1,52,15,133,72,
-  3,0,0,131,198,2,138,14,186,4,0,0,0,199,68,36,12,3,0,0,0,233,143,252,255,255,
-  138,14,128,249,104,15,132,172,3,0,0,186,4,0,0,0,199,68,36,12,1,0,0,0,233,114,
-  252,255,255,137,232,131,124,36,12,4,15,132,101,3,0,0,131,124,36,12,1,15,132,
-  73,4,0,0,131,124,36,12,2,116,11,131,124,36,12,3,15,132,226,4,0,0,139,16,139,
-  68,36,52,131,197,4,137,2,138,14,233,247,251,255,255,139,76,36,32,128,201,128,
-  137,76,36,32,131,124,36,12,3,15,132,50,3,0,0,131,124,36,12,2,15,132,23,4,0,0,
-  139,69,0,141,93,4,137,194,137,68,36,96,193,250,31,137,84,36,100,131,124,36,
-  12,1,15,132,27,4,0,0,131,124,36,12,4,15,132,65,4,0,0,141,76,36,28,139,68,36,
-  96,139,84,36,100,137,221,232,122,241,255,255,138,14,233,147,251,255,255,138,
-  14,186,4,0,0,0,199,68,36,12,2,0,0,0,233,190,251,255,255,137,232,131,124,36,
-  12,3,15,132,156,2,0,0,131,124,36,12,2,15,132,127,3,0,0,139,16,131,197,4,137,
-  84,36,96,199,68,36,100,0,0,0,0,131,124,36,12,1,15,132,197,3,0,0,131,124,36,
-  12,4,15,132,235,3,0,0,128,249,117,15,132,0,3,0,0,131,236,12,137,216,141,76,
-  36,40,81,139,76,36,116,139,84,36,112,232,80,235,255,255,138,14,131,196,16,
-  233,22,251,255,255,139,68,36,12,137,234,131,232,2,199,68,36,40,255,255,255,
-  255,131,248,1,118,42,139,2,141,76,36,28,136,68,36,96,186,1,0,0,0,141,68,36,
-  96,131,197,4,232,133,238,255,255,138,14,233,222,250,255,255,199,68,36,40,255,
-  255,255,255,139,69,0,141,76,36,28,37,255,255,0,0,186,1,0,0,0,137,68,36,96,
-  141,68,36,96,199,68,36,100,0,0,0,0,232,96,237,255,255,141,93,4,138,14,137,
-  221,233,164,250,255,255,133,210,15,133,234,250,255,255,139,76,36,32,128,205,
-  2,137,76,36,32,138,14,233,201,250,255,255,131,250,1,15,134,253,1,0,0,138,14,
-  186,4,0,0,0,233,180,250,255,255,139,84,36,32,137,232,128,206,8,49,201,137,84,
-  36,32,131,197,4,139,16,137,76,36,100,137,84,36,96,131,236,12,141,68,36,40,80,
-  184,120,0,0,0,232,119,234,255,255,138,14,131,196,16,233,61,250,255,255,133,
-  210,117,72,139,68,36,32,128,204,8,137,68,36,32,138,14,233,102,250,255,255,
-  131,251,47,15,142,122,250,255,255,133,210,15,133,174,1,0,0,178,1,139,68,36,
-  16,133,192,116,27,139,76,36,16,139,1,133,192,15,136,223,1,0,0,141,4,128,139,
-  76,36,16,141,68,67,208,137,1,138,14,233,41,250,255,255,133,210,117,245,139,
-  92,36,32,131,203,64,137,92,36,32,138,14,233,19,250,255,255,133,210,117,223,
-  139,68,36,32,128,204,4,137,68,36,32,138,14,233,253,249,255,255,133,210,117,
-  201,139,68,36,32,128,204,1,137,68,36,32,138,14,233,231,249,255,255,139,68,36,
-  16,133,192,15,132,27,255,255,255,133,210,15,148,193,15,133,132,0,0,0,139,69,
-  0,141,93,4,139,108,36,16,133,192,137,69,0,15,136,134,2,0,0,138,14,137,221,
-  199,68,36,16,0,0,0,0,233,170,249,255,255,141,84,36,28,184,37,0,0,0,232,45,
-  230,255,255,138,14,233,86,249,255,255,139,93,0,133,219,15,132,164,1,0,0,131,
-  236,12,131,197,4,83,232,179,42,0,0,131,196,16,137,194,137,216,141,76,36,28,
-  232,207,236,255,255,138,14,233,40,249,255,255,128,249,51,15,132,22,1,0,0,186,
-  4,0,0,0,199,68,36,12,2,0,0,0,233,76,249,255,255,131,250,2,15,132,115,255,255,
-  255,138,14,186,4,0,0,0,199,68,36,16,0,0,0,0,233,47,249,255,255,221,216,141,
-  76,36,28,186,205,147,64,0,102,49,192,232,29,237,255,255,138,14,233,214,248,
-  255,255,139,80,4,131,197,8,139,0,137,84,36,100,137,68,36,96,233,129,253,255,
-  255,139,16,139,68,36,52,131,197,4,136,2,138,14,233,175,248,255,255,139,69,0,
-  139,85,4,141,93,8,137,68,36,96,137,84,36,100,233,236,252,255,255,70,186,4,0,
-  0,0,138,14,199,68,36,12,4,0,0,0,233,195,248,255,255,199,68,36,40,0,0,0,0,141,
-  68,36,40,138,14,186,2,0,0,0,137,68,36,16,233,167,248,255,255,131,250,2,15,
-  133,75,254,255,255,178,3,233,68,254,255,255,141,129,1,252,255,255,102,131,
-  248,130,102,137,68,36,72,15,142,31,251,255,255,102,129,68,36,70,0,16,233,19,
-  251,255,255,141,76,36,28,139,68,36,96,139,84,36,100,232,6,238,255,255,138,14,
-  233,31,248,255,255,141,67,208,137,1,138,14,233,82,248,255,255,187,184,147,64,
-  0,233,106,251,255,255,128,126,1,50,15,133,224,254,255,255,131,198,2,186,4,0,
-  0,0,138,14,199,68,36,12,2,0,0,0,233,39,248,255,255,139,16,131,197,4,137,84,
-  36,96,199,68,36,100,0,0,0,0,233,146,252,255,255,139,16,139,68,36,52,131,197,
-  4,102,137,2,138,14,233,191,247,255,255,139,69,0,141,93,4,137,197,137,68,36,
-  96,193,253,31,137,108,36,100,233,250,251,255,255,187,198,147,64,0,233,82,254,
-  255,255,15,191,68,36,96,137,193,137,68,36,96,193,249,31,137,76,36,100,233,
-  217,251,255,255,139,68,36,96,199,68,36,100,0,0,0,0,37,255,255,0,0,137,68,36,
-  96,233,44,252,255,255,15,190,68,36,96,137,197,137,68,36,96,193,253,31,137,
-  108,36,100,233,168,251,255,255,49,192,199,68,36,100,0,0,0,0,138,68,36,96,137,
-  68,36,96,233,254,251,255,255,141,76,36,28,186,209,147,64,0,137,216,232,110,
-  235,255,255,138,14,233,39,247,255,255,139,16,139,68,36,52,137,193,131,197,4,
-  193,249,31,137,2,137,74,4,138,14,233,13,247,255,255,141,76,36,28,186,209,147,
-  64,0,137,248,232,61,235,255,255,138,14,233,246,246,255,255,132,201,116,20,
-  247,92,36,36,139,68,36,32,128,204,4,137,68,36,32,233,98,253,255,255,199,68,
-  36,40,255,255,255,255,233,85,253,255,255,144,85,87,86,83,129,236,140,0,0,0,
-  139,132,36,172,0,0,0,199,68,36,88,0,0,0,0,139,56,131,231,207,137,56,137,248,
-  131,224,7,131,248,4,15,135,178,6,0,0,255,36,133,88,149,64,0,83,83,141,132,36,
-  140,0,0,0,80,139,76,36,76,81,232,23,36,0,0,139,68,36,108,139,84,36,32,221,
-  156,36,136,0,0,0,139,156,36,140,0,0,0,141,76,16,255,129,227,255,255,15,0,137,
-  202,129,203,0,0,240,63,137,140,36,148,0,0,0,193,250,31,137,156,36,140,0,0,0,
-  221,132,36,136,0,0,0,216,37,132,149,64,0,81,137,208,49,200,220,13,136,149,64,
-  0,41,208,45,53,4,0,0,220,5,144,149,64,0,219,4,36,220,13,152,149,64,0,131,196,
-  20,133,192,222,193,126,15,80,219,4,36,220,13,160,149,64,0,131,196,4,222,193,
-  217,124,36,102,102,139,68,36,102,180,12,102,137,68,36,100,217,108,36,100,219,
-  84,36,40,217,108,36,102,217,238,221,233,223,224,246,196,69,15,132,150,10,0,0,
-  221,216,137,200,199,68,36,44,1,0,0,0,193,224,20,1,216,137,68,36,124,131,124,
-  36,40,22,119,37,139,84,36,40,199,68,36,44,0,0,0,0,221,68,36,120,221,4,213,96,
-  150,64,0,218,233,223,224,246,196,69,117,5,74,137,84,36,40,139,68,36,16,41,
-  200,72,15,136,142,10,0,0,137,68,36,56,199,68,36,20,0,0,0,0,139,68,36,40,133,
-  192,15,136,85,10,0,0,139,84,36,40,139,68,36,56,1,208,137,84,36,60,137,68,36,
-  56,199,68,36,24,0,0,0,0,131,188,36,176,0,0,0,9,15,134,62,7,0,0,199,132,36,
-  176,0,0,0,0,0,0,0,190,1,0,0,0,85,49,219,219,4,36,220,13,168,149,64,0,131,196,
-  4,199,132,36,180,0,0,0,0,0,0,0,199,68,36,32,255,255,255,255,217,108,36,100,
-  219,92,36,96,217,108,36,102,199,68,36,36,255,255,255,255,199,68,36,48,1,0,0,
-  0,139,68,36,96,131,192,3,137,132,36,132,0,0,0,131,236,12,139,140,36,144,0,0,
-  0,81,232,67,25,0,0,139,148,36,176,0,0,0,137,68,36,104,139,74,12,73,137,76,36,
-  68,131,196,16,131,249,0,116,30,125,8,199,68,36,52,2,0,0,0,131,231,8,116,15,
-  139,84,36,52,184,3,0,0,0,41,208,137,68,36,52,132,219,15,132,105,1,0,0,137,
-  240,132,192,15,132,95,1,0,0,139,84,36,52,11,84,36,40,15,133,81,1,0,0,221,68,
-  36,120,139,68,36,40,199,132,36,132,0,0,0,0,0,0,0,221,84,36,80,133,192,139,92,
-  36,80,139,116,36,84,15,142,107,14,0,0,139,68,36,40,191,2,0,0,0,131,224,15,
-  221,4,197,96,150,64,0,139,68,36,40,193,248,4,168,16,15,132,33,12,0,0,217,201,
-  220,53,0,150,64,0,131,224,15,102,191,3,0,221,84,36,120,221,92,36,8,139,92,36,
-  8,139,116,36,12,137,92,36,8,137,116,36,12,221,68,36,8,133,192,116,43,221,216,
-  186,224,149,64,0,49,201,168,1,116,3,220,10,71,65,131,194,8,209,248,117,241,
-  137,92,36,8,137,116,36,12,137,140,36,132,0,0,0,221,68,36,8,139,68,36,44,133,
-  192,15,132,88,9,0,0,217,5,176,149,64,0,221,233,223,224,246,196,69,15,133,69,
-  9,0,0,139,68,36,32,133,192,15,142,57,9,0,0,139,116,36,36,133,246,15,142,143,
-  15,0,0,216,13,180,149,64,0,139,116,36,40,78,71,139,84,36,36,221,84,36,120,
-  141,76,36,112,87,219,4,36,216,201,131,196,4,216,5,184,149,64,0,221,92,36,112,
-  139,89,4,129,235,0,0,64,3,133,210,137,89,4,15,133,107,10,0,0,221,217,216,37,
-  188,149,64,0,221,84,36,120,221,68,36,112,217,201,221,225,223,224,246,196,69,
-  15,132,77,13,0,0,217,201,217,224,218,233,223,224,246,196,69,15,132,205,8,0,0,
-  221,68,36,80,221,92,36,120,139,68,36,92,133,192,120,11,131,124,36,40,14,15,
-  142,90,5,0,0,139,68,36,48,133,192,15,133,44,8,0,0,139,124,36,20,139,116,36,
-  24,199,68,36,72,0,0,0,0,133,255,126,47,139,92,36,56,133,219,126,39,139,68,36,
-  56,57,248,126,2,137,248,139,76,36,20,139,84,36,56,41,193,41,194,137,132,36,
-  132,0,0,0,137,76,36,20,41,199,137,84,36,56,139,68,36,24,133,192,126,78,139,
-  68,36,48,133,192,15,132,254,10,0,0,133,246,126,50,80,80,86,139,108,36,84,85,
-  232,66,31,0,0,137,68,36,88,89,91,139,84,36,72,82,80,232,177,28,0,0,93,139,76,
-  36,76,137,195,81,232,84,25,0,0,137,92,36,80,131,196,16,139,68,36,24,41,240,
-  15,133,160,11,0,0,131,236,12,106,1,232,247,29,0,0,137,68,36,92,131,196,16,
-  139,76,36,60,133,201,126,20,82,82,139,108,36,68,85,80,232,235,30,0,0,137,68,
-  36,92,131,196,16,131,188,36,176,0,0,0,1,15,142,65,5,0,0,49,219,139,76,36,60,
-  186,1,0,0,0,133,201,15,133,21,9,0,0,139,76,36,56,141,4,10,186,28,0,0,0,131,
-  224,31,15,132,181,6,0,0,178,32,41,194,137,148,36,132,0,0,0,131,250,4,15,142,
-  152,6,0,0,141,66,252,139,84,36,20,1,194,1,193,137,132,36,132,0,0,0,137,84,36,
-  20,1,199,137,76,36,56,139,76,36,20,133,201,126,24,82,82,139,68,36,28,80,139,
-  68,36,76,80,232,229,26,0,0,137,68,36,80,131,196,16,139,68,36,56,133,192,126,
-  24,80,80,139,68,36,64,80,139,68,36,88,80,232,197,26,0,0,137,68,36,92,131,196,
-  16,139,108,36,44,133,237,15,133,30,8,0,0,139,108,36,32,133,237,15,142,238,9,
-  0,0,139,68,36,48,133,192,15,132,74,7,0,0,133,255,126,20,85,85,87,139,116,36,
-  84,86,232,137,26,0,0,137,68,36,88,131,196,16,139,68,36,72,133,219,15,133,112,
-  13,0,0,139,76,36,72,199,132,36,132,0,0,0,1,0,0,0,137,76,36,68,137,68,36,72,
-  139,124,36,88,80,80,139,68,36,84,80,139,68,36,76,80,232,90,19,0,0,131,192,48,
-  137,68,36,44,94,93,189,1,0,0,0,139,92,36,76,83,139,76,36,76,81,232,45,22,0,0,
-  137,198,88,90,139,68,36,80,80,139,68,36,88,80,232,170,24,0,0,137,195,131,196,
-  16,139,64,12,133,192,15,132,181,4,0,0,131,236,12,83,232,177,23,0,0,131,196,
-  16,139,132,36,176,0,0,0,9,232,117,22,139,148,36,168,0,0,0,139,2,131,224,1,11,
-  68,36,52,15,132,11,14,0,0,133,246,15,136,128,11,0,0,11,180,36,176,0,0,0,117,
-  16,139,148,36,168,0,0,0,246,2,1,15,132,103,11,0,0,133,237,15,142,228,3,0,0,
-  131,124,36,52,2,15,132,217,3,0,0,131,124,36,28,57,15,132,184,13,0,0,138,68,
-  36,28,141,95,1,64,190,32,0,0,0,136,7,131,236,12,139,68,36,88,80,232,50,23,0,
-  0,131,196,16,139,68,36,72,133,192,116,50,139,68,36,68,133,192,116,26,139,76,
-  36,72,57,76,36,68,116,16,131,236,12,139,68,36,80,80,232,8,23,0,0,131,196,16,
-  131,236,12,139,108,36,84,85,232,248,22,0,0,131,196,16,131,236,12,139,124,36,
-  76,87,232,232,22,0,0,198,3,0,139,68,36,56,139,148,36,200,0,0,0,131,196,16,64,
-  137,2,139,140,36,188,0,0,0,133,201,116,9,139,140,36,188,0,0,0,137,25,139,132,
-  36,172,0,0,0,139,16,9,242,137,16,141,118,0,139,68,36,88,129,196,140,0,0,0,91,
-  94,95,93,195,139,132,36,160,0,0,0,49,210,139,40,131,253,32,126,12,184,32,0,0,
-  0,1,192,66,57,197,127,249,131,236,12,82,232,188,22,0,0,137,68,36,80,141,69,
-  255,139,148,36,184,0,0,0,139,116,36,80,193,248,5,131,198,20,137,241,131,196,
-  16,141,28,130,139,2,131,194,4,137,1,131,193,4,57,211,115,242,137,202,139,76,
-  36,64,41,242,193,250,2,141,68,145,20,139,72,252,74,133,201,15,133,7,1,0,0,
-  131,232,4,133,210,117,237,139,68,36,64,199,68,36,16,0,0,0,0,199,64,16,0,0,0,
-  0,131,236,12,139,68,36,76,80,232,236,31,0,0,137,132,36,148,0,0,0,131,196,16,
-  133,192,139,148,36,164,0,0,0,137,84,36,92,15,133,235,0,0,0,139,68,36,64,139,
-  80,16,133,210,15,133,133,248,255,255,131,236,12,80,232,215,21,0,0,131,196,16,
-  139,148,36,184,0,0,0,199,2,1,0,0,0,87,106,1,139,180,36,196,0,0,0,86,104,85,
-  149,64,0,232,146,19,0,0,137,68,36,104,131,196,16,139,68,36,88,129,196,140,0,
-  0,0,91,94,95,93,195,139,140,36,184,0,0,0,199,1,0,128,255,255,86,106,3,139,
-  156,36,196,0,0,0,83,104,81,149,64,0,232,90,19,0,0,137,68,36,104,131,196,16,
-  139,68,36,88,129,196,140,0,0,0,91,94,95,93,195,139,148,36,184,0,0,0,199,2,0,
-  128,255,255,85,106,8,139,188,36,196,0,0,0,87,104,72,149,64,0,232,34,19,0,0,
-  137,68,36,104,131,196,16,139,68,36,88,129,196,140,0,0,0,91,94,95,93,195,139,
-  76,36,64,141,66,1,137,65,16,193,224,5,137,68,36,16,15,189,68,145,20,139,84,
-  36,16,131,240,31,41,194,137,84,36,16,233,235,254,255,255,86,86,80,139,92,36,
-  76,83,232,7,30,0,0,139,132,36,148,0,0,0,139,140,36,180,0,0,0,1,193,137,76,36,
-  108,139,76,36,32,41,193,137,76,36,32,131,196,16,233,226,254,255,255,131,188,
-  36,176,0,0,0,5,15,143,228,0,0,0,184,1,0,0,0,190,1,0,0,0,131,188,36,176,0,0,0,
-  5,15,134,189,1,0,0,179,1,199,68,36,32,0,0,0,0,199,68,36,36,0,0,0,0,199,68,36,
-  48,1,0,0,0,233,217,248,255,255,139,68,36,40,221,4,197,96,150,64,0,139,132,36,
-  180,0,0,0,133,192,15,136,116,6,0,0,217,124,36,102,102,139,68,36,102,180,12,
-  139,92,36,88,199,132,36,132,0,0,0,1,0,0,0,102,137,68,36,100,235,36,144,139,
-  132,36,132,0,0,0,57,68,36,32,15,132,102,5,0,0,216,13,180,149,64,0,64,137,132,
-  36,132,0,0,0,221,92,36,120,221,68,36,120,217,192,216,242,217,108,36,100,219,
-  92,36,96,217,108,36,102,139,84,36,96,82,219,4,36,216,202,131,196,4,141,66,48,
-  222,233,221,92,36,120,136,3,67,221,68,36,120,217,238,217,201,221,225,223,224,
-  221,217,128,228,69,128,244,64,117,154,221,216,221,216,49,246,233,234,252,255,
-  255,139,132,36,176,0,0,0,49,246,131,232,4,137,132,36,176,0,0,0,49,192,233,12,
-  255,255,255,131,124,36,16,1,15,133,180,250,255,255,139,148,36,160,0,0,0,139,
-  66,4,64,57,132,36,164,0,0,0,15,142,156,250,255,255,139,92,36,56,139,116,36,
-  20,67,70,137,92,36,56,187,1,0,0,0,137,116,36,20,233,130,250,255,255,141,182,
-  0,0,0,0,138,84,36,28,136,23,71,139,76,36,32,57,140,36,132,0,0,0,15,132,209,2,
-  0,0,83,106,0,106,10,139,76,36,76,81,232,57,24,0,0,137,68,36,80,131,196,16,
-  139,68,36,72,57,68,36,68,15,132,247,0,0,0,80,106,0,106,10,139,108,36,80,85,
-  232,21,24,0,0,137,68,36,84,131,196,12,106,0,106,10,139,116,36,84,86,232,0,24,
-  0,0,137,68,36,88,131,196,16,139,156,36,132,0,0,0,67,137,156,36,132,0,0,0,233,
-  250,250,255,255,85,85,83,139,76,36,76,81,232,72,17,0,0,131,196,16,137,197,
-  233,52,251,255,255,139,148,36,176,0,0,0,255,36,149,108,149,64,0,199,68,36,48,
-  1,0,0,0,139,68,36,40,139,148,36,180,0,0,0,141,68,16,1,137,68,36,32,137,132,
-  36,132,0,0,0,139,92,36,32,72,137,68,36,36,133,219,15,142,170,7,0,0,131,124,
-  36,32,14,15,150,195,233,237,246,255,255,199,68,36,48,1,0,0,0,139,132,36,180,
-  0,0,0,133,192,15,142,150,7,0,0,139,140,36,180,0,0,0,131,249,14,137,140,36,
-  132,0,0,0,15,150,195,137,76,36,32,137,76,36,36,233,181,246,255,255,199,68,36,
-  48,0,0,0,0,235,134,199,68,36,48,0,0,0,0,235,188,137,198,233,78,246,255,255,
-  82,106,0,106,10,80,232,34,23,0,0,137,68,36,88,137,68,36,84,131,196,16,233,25,
-  255,255,255,15,132,126,249,255,255,131,194,28,139,108,36,20,139,116,36,56,1,
-  213,1,214,1,215,137,148,36,132,0,0,0,137,108,36,20,137,116,36,56,233,89,249,
-  255,255,219,68,36,40,218,233,223,224,128,228,69,128,244,64,139,84,36,40,15,
-  149,192,37,255,0,0,0,41,194,137,84,36,40,233,71,245,255,255,139,76,36,40,139,
-  68,36,20,41,200,199,68,36,60,0,0,0,0,247,217,137,68,36,20,137,76,36,24,233,
-  164,245,255,255,247,216,137,68,36,20,199,68,36,56,0,0,0,0,233,107,245,255,
-  255,131,188,36,176,0,0,0,1,15,142,80,5,0,0,139,68,36,32,72,57,68,36,24,15,
-  140,207,3,0,0,139,116,36,24,41,198,139,68,36,32,139,124,36,20,137,132,36,132,
-  0,0,0,133,192,15,136,156,6,0,0,139,132,36,132,0,0,0,139,84,36,20,139,108,36,
-  56,1,194,1,197,137,84,36,20,137,108,36,56,131,236,12,106,1,232,15,22,0,0,137,
-  68,36,88,131,196,16,233,121,247,255,255,139,84,36,32,139,116,36,40,233,218,
-  246,255,255,221,216,199,68,36,72,0,0,0,0,199,68,36,76,0,0,0,0,139,148,36,180,
-  0,0,0,139,92,36,88,131,242,255,190,16,0,0,0,137,84,36,40,199,68,36,68,0,0,0,
-  0,233,193,249,255,255,139,124,36,88,199,132,36,132,0,0,0,1,0,0,0,235,37,80,
-  106,0,106,10,139,68,36,76,80,232,192,21,0,0,137,68,36,80,139,132,36,148,0,0,
-  0,64,137,132,36,148,0,0,0,131,196,16,81,81,139,84,36,84,82,139,68,36,76,80,
-  232,25,12,0,0,131,192,48,137,68,36,44,131,196,16,136,7,71,139,84,36,32,59,
-  148,36,132,0,0,0,127,176,199,68,36,68,0,0,0,0,139,68,36,52,133,192,15,132,47,
-  5,0,0,131,124,36,52,2,15,132,92,5,0,0,139,76,36,64,131,121,16,1,15,142,14,7,
-  0,0,79,138,7,60,57,15,133,161,5,0,0,59,124,36,88,117,239,139,68,36,40,190,32,
-  0,0,0,64,137,68,36,40,139,68,36,88,137,195,67,198,0,49,233,5,249,255,255,86,
-  86,139,76,36,84,81,139,84,36,76,82,232,131,14,0,0,131,196,16,133,192,15,137,
-  198,247,255,255,80,106,0,106,10,139,68,36,76,80,232,249,20,0,0,137,68,36,80,
-  131,196,16,139,68,36,48,133,192,116,22,80,106,0,106,10,139,68,36,84,80,232,
-  219,20,0,0,137,68,36,88,131,196,16,139,68,36,40,72,137,68,36,40,139,68,36,36,
-  137,68,36,32,233,124,247,255,255,139,76,36,76,178,32,139,65,16,15,189,68,129,
-  16,131,240,31,41,194,233,211,246,255,255,139,68,36,48,133,192,15,132,50,2,0,
-  0,221,216,217,192,217,124,36,102,216,13,192,149,64,0,102,139,68,36,102,180,
-  12,139,92,36,88,199,132,36,132,0,0,0,0,0,0,0,102,137,68,36,100,220,52,213,88,
-  150,64,0,220,100,36,112,221,92,36,112,235,62,217,194,216,226,217,201,221,225,
-  223,224,221,217,246,196,69,15,132,12,3,0,0,139,132,36,132,0,0,0,64,137,132,
-  36,132,0,0,0,57,194,15,142,113,4,0,0,217,5,180,149,64,0,220,201,217,201,221,
-  25,222,201,221,92,36,120,221,68,36,120,217,192,216,242,217,108,36,100,219,92,
-  36,96,217,108,36,102,139,68,36,96,80,131,192,48,219,4,36,216,202,131,196,4,
-  222,233,221,92,36,120,136,3,67,221,68,36,120,221,1,221,225,223,224,246,196,
-  69,117,134,221,216,221,217,217,238,217,201,218,233,223,224,128,228,69,128,
-  244,64,15,132,97,5,0,0,137,116,36,40,190,16,0,0,0,233,235,247,255,255,221,
-  217,233,247,243,255,255,139,68,36,52,133,192,15,132,57,2,0,0,221,216,221,216,
-  131,124,36,52,1,116,14,190,16,0,0,0,233,195,247,255,255,221,216,221,216,75,
-  138,3,60,57,117,26,59,92,36,88,117,243,139,68,36,40,139,84,36,88,64,137,211,
-  137,68,36,40,198,2,48,176,48,64,190,32,0,0,0,136,3,67,233,144,247,255,255,85,
-  85,139,116,36,32,86,139,92,36,76,83,232,68,20,0,0,137,68,36,80,131,196,16,
-  233,39,245,255,255,131,188,36,176,0,0,0,2,15,142,4,246,255,255,139,124,36,32,
-  133,255,15,136,42,253,255,255,86,106,0,106,5,139,92,36,88,83,232,31,19,0,0,
-  137,68,36,92,90,89,80,139,68,36,76,80,232,126,12,0,0,131,196,16,133,192,15,
-  142,255,252,255,255,139,76,36,88,190,32,0,0,0,137,203,198,1,49,67,139,68,36,
-  40,199,68,36,68,0,0,0,0,64,137,68,36,40,233,191,246,255,255,131,124,36,32,0,
-  15,143,129,249,255,255,15,140,183,252,255,255,216,13,188,149,64,0,221,68,36,
-  120,217,201,218,233,223,224,246,196,5,15,132,160,252,255,255,199,68,36,72,0,
-  0,0,0,199,68,36,76,0,0,0,0,235,159,139,116,36,24,139,92,36,60,41,240,139,76,
-  36,24,1,195,1,193,49,246,137,92,36,60,137,76,36,24,233,22,252,255,255,82,82,
-  80,139,68,36,76,80,232,100,19,0,0,137,68,36,80,131,196,16,233,71,244,255,255,
-  221,68,36,112,217,124,36,102,220,12,213,88,150,64,0,102,139,68,36,102,180,12,
-  139,92,36,88,199,132,36,132,0,0,0,1,0,0,0,102,137,68,36,100,221,92,36,112,
-  235,54,80,219,4,36,216,202,131,196,4,222,233,221,92,36,120,131,192,48,136,3,
-  67,139,132,36,132,0,0,0,57,208,116,50,217,5,180,149,64,0,220,76,36,120,64,
-  137,132,36,132,0,0,0,221,84,36,120,217,192,216,242,217,108,36,100,219,92,36,
-  96,217,108,36,102,139,68,36,96,133,192,117,178,221,216,235,189,216,13,192,
-  149,64,0,221,68,36,120,221,1,217,192,216,195,217,202,221,226,223,224,221,218,
-  246,196,69,15,132,134,0,0,0,222,234,217,201,221,233,223,224,246,196,69,116,7,
-  221,216,233,208,242,255,255,75,128,59,48,116,250,67,233,195,253,255,255,221,
-  216,221,216,137,116,36,40,233,228,254,255,255,221,216,139,84,36,40,247,218,
-  15,133,48,2,0,0,221,68,36,80,191,2,0,0,0,217,5,176,149,64,0,217,201,233,237,
-  241,255,255,217,192,222,193,221,84,36,120,221,225,223,224,246,196,69,15,132,
-  199,253,255,255,217,201,218,233,223,224,128,228,69,128,244,64,15,133,171,253,
-  255,255,131,226,1,15,133,176,253,255,255,233,157,253,255,255,221,216,221,216,
-  221,216,137,116,36,40,233,156,253,255,255,137,232,139,108,36,16,41,232,139,
-  148,36,160,0,0,0,139,74,4,141,80,1,137,148,36,132,0,0,0,139,84,36,92,41,194,
-  57,202,125,24,139,124,36,92,41,207,137,124,36,92,139,76,36,92,141,65,1,137,
-  132,36,132,0,0,0,139,124,36,20,139,116,36,24,233,145,250,255,255,139,68,36,
-  52,133,192,15,132,230,1,0,0,139,76,36,64,131,121,16,1,15,142,205,1,0,0,131,
-  124,36,52,2,117,70,190,16,0,0,0,138,68,36,28,141,95,1,136,7,233,146,244,255,
-  255,137,68,36,68,80,106,0,106,10,71,139,108,36,76,85,232,157,16,0,0,137,68,
-  36,80,89,94,139,84,36,84,82,80,232,12,7,0,0,137,92,36,88,131,192,48,137,68,
-  36,44,131,196,16,80,80,139,68,36,80,80,139,68,36,88,80,232,221,9,0,0,131,196,
-  16,133,192,15,142,211,1,0,0,138,68,36,28,136,7,80,106,0,106,10,139,68,36,84,
-  80,232,77,16,0,0,131,196,16,137,195,139,84,36,72,57,84,36,68,117,145,235,139,
-  85,85,106,1,139,116,36,76,86,232,158,13,0,0,137,68,36,80,89,91,139,84,36,84,
-  82,80,232,141,9,0,0,131,196,16,131,248,0,15,143,191,250,255,255,117,11,246,
-  68,36,28,1,15,133,178,250,255,255,139,84,36,64,131,122,16,1,15,142,196,1,0,0,
-  190,16,0,0,0,79,128,63,48,116,250,141,95,1,233,196,243,255,255,199,132,36,
-  132,0,0,0,1,0,0,0,233,70,248,255,255,199,132,36,180,0,0,0,1,0,0,0,233,90,248,
-  255,255,221,216,221,216,221,216,233,215,240,255,255,41,199,199,132,36,132,0,
-  0,0,0,0,0,0,233,82,249,255,255,64,141,95,1,190,32,0,0,0,136,7,233,119,243,
-  255,255,131,236,12,139,68,36,84,139,88,4,83,232,230,10,0,0,139,84,36,88,252,
-  139,74,16,141,120,12,141,114,12,141,12,141,8,0,0,0,193,233,2,243,165,90,89,
-  106,1,80,232,210,12,0,0,131,196,16,233,84,242,255,255,137,208,131,224,15,221,
-  68,36,80,220,12,197,96,150,64,0,137,208,193,248,4,221,84,36,120,15,132,49,1,
-  0,0,221,216,186,224,149,64,0,191,2,0,0,0,49,201,168,1,116,11,221,68,36,120,
-  220,10,71,221,92,36,120,65,131,194,8,209,248,117,233,221,68,36,120,217,5,176,
-  149,64,0,217,201,137,140,36,132,0,0,0,233,119,239,255,255,139,65,20,133,192,
-  15,133,40,254,255,255,49,246,133,237,126,64,85,85,106,1,139,116,36,76,86,232,
-  79,12,0,0,137,68,36,80,89,91,139,84,36,84,82,80,232,62,8,0,0,131,196,16,131,
-  248,0,15,142,162,0,0,0,139,68,36,28,64,137,68,36,28,131,124,36,28,58,116,60,
-  190,32,0,0,0,139,76,36,64,131,121,16,1,15,143,219,253,255,255,139,105,20,133,
-  237,15,132,213,253,255,255,233,203,253,255,255,139,68,36,28,190,32,0,0,0,64,
-  137,68,36,28,131,124,36,28,58,15,133,183,253,255,255,198,7,57,71,233,27,249,
-  255,255,137,116,36,40,49,246,233,141,242,255,255,131,124,36,28,57,116,229,
-  133,246,126,95,139,68,36,28,190,32,0,0,0,64,137,68,36,28,233,133,253,255,255,
-  139,65,20,133,192,15,133,231,248,255,255,49,246,233,65,254,255,255,139,66,20,
-  133,192,15,133,49,254,255,255,49,246,233,47,254,255,255,15,133,104,255,255,
-  255,246,68,36,28,1,15,132,93,255,255,255,233,72,255,255,255,191,2,0,0,0,217,
-  5,176,149,64,0,217,201,233,113,238,255,255,139,76,36,64,131,121,16,1,15,143,
-  38,253,255,255,139,81,20,49,246,133,210,15,132,30,253,255,255,233,20,253,255,
-  255,144,144,144,144,144,144,144,144,87,86,83,137,211,131,236,16,49,210,137,
-  198,137,207,133,219,117,14,131,196,16,137,208,91,94,95,195,144,141,116,38,0,
-  186,254,255,255,255,133,201,116,233,139,84,36,32,139,2,137,68,36,12,199,2,0,
-  0,0,0,138,3,132,192,117,9,49,210,102,199,6,0,0,235,202,131,124,36,40,1,118,
-  65,128,124,36,12,0,116,122,136,68,36,13,81,81,106,1,86,106,2,141,68,36,32,80,
-  106,8,139,92,36,64,83,232,2,20,0,0,90,133,192,89,186,2,0,0,0,117,149,232,42,
-  19,0,0,131,202,255,199,0,42,0,0,0,235,133,141,118,0,139,68,36,36,133,192,117,
-  17,49,192,186,1,0,0,0,138,3,102,137,6,233,105,255,255,255,87,87,106,1,86,106,
-  1,83,106,8,139,92,36,64,83,232,183,19,0,0,90,133,192,89,186,1,0,0,0,15,133,
-  70,255,255,255,235,175,102,144,37,255,0,0,0,82,82,80,139,68,36,48,80,232,154,
-  19,0,0,90,133,192,89,116,168,131,255,1,118,13,87,87,106,1,86,106,2,83,233,
-  108,255,255,255,139,84,36,32,138,3,136,2,186,254,255,255,255,233,6,255,255,
-  255,141,116,38,0,85,87,86,83,131,236,28,139,68,36,60,139,92,36,48,139,124,36,
-  52,199,68,36,4,64,160,64,0,133,192,116,4,137,68,36,4,161,132,178,64,0,133,
-  255,139,0,137,68,36,8,161,136,178,64,0,139,40,116,100,139,23,133,210,116,94,
-  133,219,116,102,139,68,36,56,49,246,133,192,117,22,235,78,144,139,15,137,194,
-  1,202,1,198,137,23,57,116,36,56,118,51,131,195,2,80,139,76,36,60,85,139,68,
-  36,16,41,241,80,139,68,36,16,80,137,216,232,116,254,255,255,131,196,16,133,
-  192,127,205,59,116,36,56,115,10,133,192,117,6,199,7,0,0,0,0,131,196,28,137,
-  240,91,94,95,93,195,49,246,131,196,28,137,240,91,94,95,93,195,139,92,36,56,
-  49,246,133,219,116,224,141,92,36,26,102,199,68,36,26,0,0,235,16,139,15,137,
-  194,1,202,1,198,137,23,57,116,36,56,118,195,80,85,139,68,36,16,137,233,80,
-  139,68,36,16,80,137,216,232,11,254,255,255,131,196,16,133,192,127,212,235,
-  165,102,144,83,131,236,24,139,92,36,32,139,84,36,44,133,219,116,51,161,136,
-  178,64,0,133,210,139,8,161,132,178,64,0,139,0,116,46,102,199,68,36,22,0,0,
-  131,236,4,81,80,82,137,216,139,76,36,56,139,84,36,52,232,194,253,255,255,131,
-  196,40,91,195,141,92,36,22,235,199,141,180,38,0,0,0,0,186,80,160,64,0,235,
-  203,137,246,141,188,39,0,0,0,0,83,131,236,24,161,136,178,64,0,139,84,36,40,
-  139,24,161,132,178,64,0,133,210,139,8,116,38,102,199,68,36,22,0,0,80,141,68,
-  36,26,83,81,82,139,76,36,52,139,84,36,48,232,106,253,255,255,131,196,40,91,
-  195,144,141,116,38,0,186,48,160,64,0,235,211,144,144,144,144,144,144,144,144,
-  144,83,137,195,131,236,24,133,201,102,137,84,36,4,117,19,102,129,250,255,0,
-  119,60,136,19,184,1,0,0,0,131,196,24,91,195,141,68,36,20,199,68,36,20,0,0,0,
-  0,80,106,0,139,68,36,40,80,83,106,1,141,68,36,24,80,106,0,81,232,142,17,0,0,
-  133,192,116,8,139,84,36,20,133,210,116,203,232,165,16,0,0,199,0,42,0,0,0,131,
-  200,255,131,196,24,91,195,141,116,38,0,141,188,39,0,0,0,0,85,87,86,83,131,
-  236,28,49,255,161,132,178,64,0,139,92,36,48,139,0,137,68,36,8,161,136,178,64,
-  0,139,40,139,68,36,52,139,48,133,246,116,76,133,219,116,119,139,68,36,56,133,
-  192,116,74,49,255,235,26,141,180,38,0,0,0,0,1,195,1,199,128,123,255,0,116,69,
-  131,198,2,57,124,36,56,118,44,131,236,12,102,139,22,129,226,255,255,0,0,137,
-  216,85,139,76,36,24,232,37,255,255,255,131,196,16,133,192,127,206,131,207,
-  255,131,196,28,137,248,91,94,95,93,195,139,68,36,52,137,48,131,196,28,137,
-  248,91,94,95,93,195,139,68,36,52,79,199,0,0,0,0,0,131,196,28,137,248,91,94,
-  95,93,195,139,68,36,56,133,192,116,62,49,255,141,92,36,26,235,18,1,199,128,
-  124,4,25,0,116,42,57,124,36,56,118,178,131,198,2,131,236,12,102,139,22,129,
-  226,255,255,0,0,137,216,85,139,76,36,24,232,178,254,255,255,131,196,16,133,
-  192,127,207,235,139,79,235,139,49,255,235,135,102,144,83,131,236,24,139,92,
-  36,32,139,68,36,36,133,219,116,38,137,194,161,136,178,64,0,131,236,12,129,
-  226,255,255,0,0,139,0,80,161,132,178,64,0,139,8,137,216,232,111,254,255,255,
-  131,196,40,91,195,141,92,36,22,235,212,144,144,144,144,85,87,86,83,131,236,
-  76,139,68,36,100,139,76,36,96,139,80,16,49,192,59,81,16,15,143,31,1,0,0,74,
-  139,68,36,100,131,193,20,137,84,36,48,141,68,144,20,137,76,36,52,137,68,36,
-  28,139,76,36,100,139,68,36,96,139,92,36,100,139,116,145,20,131,195,20,139,84,
-  144,20,70,137,208,49,210,247,246,137,92,36,68,137,68,36,16,137,68,36,24,133,
-  192,15,133,221,0,0,0,85,85,139,124,36,108,87,139,116,36,108,86,232,120,2,0,0,
-  131,196,16,133,192,15,136,181,0,0,0,139,76,36,16,139,108,36,52,65,49,246,137,
-  76,36,24,49,255,199,68,36,56,0,0,0,0,199,68,36,60,0,0,0,0,139,92,36,68,49,
-  210,139,3,3,68,36,56,19,84,36,60,131,195,4,137,92,36,68,137,211,137,193,137,
-  217,137,76,36,56,49,219,139,77,0,49,210,137,92,36,60,49,219,41,193,25,211,41,
-  241,25,251,137,200,137,218,139,92,36,68,137,208,49,255,137,198,49,210,131,
-  230,1,137,77,0,131,197,4,57,92,36,28,115,171,139,68,36,48,139,84,36,96,139,
-  92,130,20,133,219,117,47,141,68,130,16,57,68,36,52,114,20,235,24,139,84,36,
-  48,131,232,4,74,57,68,36,52,137,84,36,48,115,6,139,8,133,201,116,232,139,92,
-  36,96,139,76,36,48,137,75,16,139,68,36,24,131,196,76,91,94,95,93,195,139,84,
-  36,52,137,68,36,40,199,68,36,44,0,0,0,0,137,84,36,20,139,108,36,68,49,246,49,
-  255,199,68,36,32,0,0,0,0,199,68,36,36,0,0,0,0,139,69,0,139,76,36,44,15,175,
-  200,247,100,36,40,3,68,36,32,141,20,17,137,68,36,8,19,84,36,36,131,197,4,137,
-  208,137,84,36,12,137,68,36,32,139,68,36,20,49,210,49,219,139,8,139,68,36,8,
-  137,84,36,36,49,210,41,193,25,211,41,241,25,251,137,200,137,218,49,255,137,
-  208,49,210,139,84,36,20,137,198,131,230,1,137,10,131,194,4,137,84,36,20,57,
-  108,36,28,115,152,139,76,36,48,139,92,36,96,139,116,139,20,133,246,15,133,
-  123,254,255,255,141,68,139,16,57,68,36,52,114,20,235,24,139,84,36,48,131,232,
-  4,74,57,68,36,52,137,84,36,48,115,6,139,8,133,201,116,232,139,84,36,96,139,
-  68,36,48,137,66,16,233,71,254,255,255,139,68,36,4,139,72,252,141,80,252,184,
-  1,0,0,0,211,224,137,74,4,137,66,8,137,84,36,4,233,96,2,0,0,83,49,219,131,236,
-  8,139,76,36,16,131,249,19,118,15,186,4,0,0,0,1,210,67,141,66,16,57,200,118,
-  246,131,236,12,83,232,121,2,0,0,137,24,131,192,4,131,196,24,91,195,235,13,
-  144,144,144,144,144,144,144,144,144,144,144,144,144,87,86,83,139,116,36,16,
-  139,124,36,20,131,236,12,139,68,36,36,80,232,168,255,255,255,137,195,138,6,
-  131,196,16,137,217,136,3,132,192,116,20,137,242,141,180,38,0,0,0,0,65,138,66,
-  1,66,132,192,136,1,117,245,133,255,116,2,137,15,137,216,91,94,95,195,144,144,
-  144,144,144,144,144,144,144,221,68,36,4,217,229,155,223,224,221,216,37,0,69,
-  0,0,195,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,87,86,83,
-  139,76,36,16,139,124,36,20,139,65,16,139,87,16,137,198,41,214,117,43,141,4,
-  149,16,0,0,0,141,89,20,141,84,1,4,141,76,7,4,141,180,38,0,0,0,0,139,65,252,
-  57,66,252,117,16,131,234,4,131,233,4,57,211,114,238,137,240,91,94,95,195,25,
-  246,91,131,206,1,137,240,94,95,195,141,182,0,0,0,0,141,188,39,0,0,0,0,139,84,
-  36,8,139,76,36,4,138,2,136,1,132,192,116,11,65,138,66,1,66,132,192,136,1,117,
-  245,137,200,195,102,144,86,83,131,236,4,137,198,161,96,160,64,0,131,248,2,
-  116,112,133,192,117,20,235,32,131,236,12,106,1,232,171,12,0,0,161,96,160,64,
-  0,131,196,12,131,248,1,116,233,131,248,2,116,78,88,91,94,195,83,83,106,1,104,
-  96,160,64,0,232,143,12,0,0,90,133,192,89,117,80,187,112,160,64,0,131,236,12,
-  83,232,131,12,0,0,131,195,24,131,196,12,129,251,160,160,64,0,117,233,131,236,
-  12,104,208,96,64,0,232,124,175,255,255,199,5,96,160,64,0,2,0,0,0,131,196,16,
-  141,4,118,131,236,12,141,4,197,112,160,64,0,80,232,80,12,0,0,131,196,12,88,
-  91,94,195,131,248,2,116,7,161,96,160,64,0,235,130,199,5,96,160,64,0,2,0,0,0,
-  235,206,141,182,0,0,0,0,141,188,39,0,0,0,0,83,131,236,16,106,3,104,96,160,64,
-  0,232,4,12,0,0,89,131,248,2,91,116,9,88,90,91,195,144,141,116,38,0,187,112,
-  160,64,0,131,236,12,83,232,254,11,0,0,131,195,24,131,196,12,129,251,160,160,
-  64,0,117,233,88,90,91,195,131,236,12,131,61,96,160,64,0,2,116,4,131,196,12,
-  195,141,4,64,131,236,12,141,4,197,112,160,64,0,80,232,209,11,0,0,131,196,12,
-  131,196,12,195,141,182,0,0,0,0,83,131,236,8,139,92,36,16,133,219,116,36,49,
-  192,232,189,254,255,255,139,83,4,139,4,149,160,160,64,0,137,3,49,192,137,28,
-  149,160,160,64,0,89,91,91,235,163,141,118,0,88,90,91,195,141,182,0,0,0,0,141,
-  191,0,0,0,0,87,86,83,49,192,139,116,36,16,232,130,254,255,255,139,28,181,160,
-  160,64,0,133,219,116,39,139,3,137,4,181,160,160,64,0,49,192,232,103,255,255,
-  255,199,67,16,0,0,0,0,199,67,12,0,0,0,0,137,216,91,94,95,195,141,118,0,137,
-  241,191,1,0,0,0,211,231,139,13,64,128,64,0,137,200,141,20,189,27,0,0,0,193,
-  234,3,45,224,160,64,0,193,248,3,141,4,2,61,32,1,0,0,119,18,141,4,209,137,203,
-  163,64,128,64,0,137,115,4,137,123,8,235,163,131,236,12,141,4,213,0,0,0,0,80,
-  232,177,9,0,0,131,196,16,137,195,235,225,141,118,0,141,188,39,0,0,0,0,85,87,
-  86,83,131,236,44,139,116,36,64,139,124,36,68,87,86,232,90,253,255,255,93,131,
-  248,0,90,15,132,9,1,0,0,15,140,46,1,0,0,49,237,131,236,12,139,94,4,83,232,43,
-  255,255,255,137,68,36,32,141,87,20,137,104,12,139,70,16,137,68,36,36,141,110,
-  20,141,116,134,20,139,71,16,139,76,36,32,137,116,36,40,141,68,135,20,131,193,
-  20,137,84,36,44,137,68,36,48,137,76,36,52,49,246,49,255,131,196,16,139,92,36,
-  28,139,69,0,49,210,139,11,49,219,41,200,139,76,36,28,25,218,41,240,25,250,
-  131,193,4,137,211,137,76,36,28,137,193,137,217,137,206,139,76,36,36,49,219,
-  139,92,36,28,137,1,131,193,4,131,197,4,131,230,1,49,255,137,76,36,36,57,92,
-  36,32,119,183,59,108,36,24,115,46,139,69,0,49,210,41,240,25,250,137,193,137,
-  211,131,197,4,137,217,49,255,137,206,139,76,36,36,49,219,131,230,1,137,1,131,
-  193,4,137,76,36,36,57,108,36,24,119,210,139,92,36,36,139,123,252,133,255,117,
-  25,137,218,141,116,38,0,139,116,36,20,139,66,248,78,131,234,4,137,116,36,20,
-  133,192,116,237,139,84,36,16,139,68,36,20,137,66,16,139,68,36,16,131,196,44,
-  91,94,95,93,195,131,236,12,106,0,232,44,254,255,255,137,68,36,32,131,196,16,
-  199,64,16,1,0,0,0,199,64,20,0,0,0,0,139,68,36,16,131,196,44,91,94,95,93,195,
-  137,248,189,1,0,0,0,137,247,137,198,233,196,254,255,255,141,116,38,0,141,188,
-  39,0,0,0,0,85,87,86,83,131,236,12,139,68,36,32,139,108,36,36,137,193,137,235,
-  193,251,5,139,80,4,139,64,16,64,141,52,24,139,65,8,57,198,126,7,1,192,66,57,
-  198,127,249,131,236,12,82,232,185,253,255,255,137,68,36,20,131,192,20,137,68,
-  36,16,131,196,16,133,219,126,38,49,192,144,141,116,38,0,139,20,36,64,199,2,0,
-  0,0,0,131,194,4,137,20,36,57,216,117,236,139,76,36,4,141,92,153,20,137,28,36,
-  139,92,36,32,139,84,36,32,131,194,20,131,229,31,139,67,16,137,108,36,8,141,
-  124,131,20,116,89,139,92,36,8,189,32,0,0,0,41,221,49,219,139,2,138,76,36,8,
-  211,224,9,195,139,4,36,137,233,137,24,131,192,4,139,26,131,194,4,211,235,137,
-  4,36,57,215,119,222,137,24,133,219,116,1,70,139,84,36,4,131,236,12,141,70,
-  255,137,66,16,139,76,36,44,81,232,217,252,255,255,139,68,36,20,131,196,28,91,
-  94,95,93,195,139,28,36,139,2,131,194,4,137,3,131,195,4,137,28,36,57,215,119,
-  236,235,199,141,180,38,0,0,0,0,85,87,86,83,131,236,60,139,116,36,80,139,68,
-  36,84,139,126,16,139,88,16,57,223,125,12,137,116,36,84,137,198,137,216,137,
-  251,137,199,141,20,59,59,86,8,137,84,36,20,15,159,192,139,86,4,131,236,12,37,
-  255,0,0,0,1,208,80,232,171,252,255,255,139,76,36,36,137,194,131,194,20,137,
-  68,36,32,141,76,136,20,137,76,36,40,131,196,16,57,202,115,17,137,208,199,0,0,
-  0,0,0,131,192,4,57,68,36,24,119,241,139,68,36,84,139,108,36,84,141,124,190,
-  20,131,197,20,141,92,152,20,137,124,36,28,137,92,36,32,57,221,15,131,145,0,0,
-  0,131,198,20,137,84,36,36,137,116,36,12,139,69,0,131,197,4,133,192,116,102,
-  139,124,36,12,137,68,36,48,199,68,36,52,0,0,0,0,139,116,36,36,199,68,36,40,0,
-  0,0,0,199,68,36,44,0,0,0,0,102,144,139,7,139,76,36,52,15,175,200,247,100,36,
-  48,49,219,141,20,17,139,14,1,193,17,211,3,76,36,40,19,92,36,44,137,200,137,
-  218,131,199,4,137,208,49,210,137,14,137,68,36,40,131,198,4,137,84,36,44,57,
-  124,36,28,119,194,137,6,57,108,36,32,118,16,139,68,36,36,131,192,4,137,68,36,
-  36,233,122,255,255,255,139,124,36,20,133,255,126,34,139,84,36,24,139,114,252,
-  133,246,116,17,235,21,144,141,116,38,0,139,66,248,131,234,4,133,192,117,6,
-  255,76,36,20,117,240,139,68,36,16,139,76,36,20,137,72,16,131,196,60,91,94,95,
-  93,195,141,182,0,0,0,0,141,188,39,0,0,0,0,131,236,24,106,1,232,118,251,255,
-  255,139,84,36,32,137,80,20,199,64,16,1,0,0,0,131,196,28,195,141,116,38,0,85,
-  87,86,83,131,236,28,49,237,139,68,36,48,139,92,36,48,131,195,20,139,64,16,
-  137,68,36,12,139,68,36,56,137,194,137,68,36,16,193,250,31,139,68,36,52,137,
-  193,137,84,36,20,193,249,31,137,4,36,137,76,36,4,141,116,38,0,139,3,139,76,
-  36,4,15,175,200,247,36,36,3,68,36,16,141,20,17,137,198,19,84,36,20,69,137,
-  215,137,3,137,254,49,255,131,195,4,137,116,36,16,137,124,36,20,57,108,36,12,
-  127,205,9,247,116,39,139,68,36,48,139,124,36,12,59,120,8,125,38,139,124,36,
-  12,139,68,36,48,139,84,36,16,139,76,36,48,137,84,184,20,137,248,64,137,65,16,
-  139,68,36,48,131,196,28,91,94,95,93,195,131,236,12,139,84,36,60,139,66,4,64,
-  80,232,165,250,255,255,139,116,36,64,137,195,252,139,78,16,141,120,12,131,
-  198,12,141,12,141,8,0,0,0,193,233,2,243,165,94,139,76,36,60,81,232,62,250,
-  255,255,137,92,36,64,131,196,16,235,153,144,141,116,38,0,85,87,86,83,131,236,
-  12,139,92,36,36,139,108,36,32,137,216,131,224,3,117,114,137,223,193,255,2,
-  116,67,139,53,224,169,64,0,133,246,116,124,247,199,1,0,0,0,117,21,144,209,
-  255,116,44,139,30,133,219,116,48,137,222,247,199,1,0,0,0,116,236,80,80,86,85,
-  232,51,253,255,255,137,44,36,137,195,232,217,249,255,255,131,196,16,137,221,
-  209,255,117,212,131,196,12,137,232,91,94,95,93,195,184,1,0,0,0,232,140,248,
-  255,255,139,30,133,219,116,76,184,1,0,0,0,137,222,232,122,249,255,255,235,
-  180,139,4,133,20,151,64,0,82,106,0,80,85,232,119,254,255,255,131,196,16,137,
-  197,233,115,255,255,255,184,1,0,0,0,232,83,248,255,255,139,53,224,169,64,0,
-  133,246,116,39,184,1,0,0,0,232,63,249,255,255,233,97,255,255,255,80,80,86,86,
-  232,177,252,255,255,131,196,16,137,195,137,6,199,0,0,0,0,0,235,156,131,236,
-  12,104,113,2,0,0,232,5,254,255,255,131,196,16,137,198,163,224,169,64,0,199,0,
-  0,0,0,0,235,186,141,118,0,85,87,86,83,131,236,36,139,68,36,56,139,80,16,141,
-  104,20,141,124,144,16,137,254,139,31,15,189,195,131,240,31,137,68,36,4,184,
-  32,0,0,0,139,84,36,4,41,208,139,84,36,60,131,124,36,4,10,137,2,127,69,139,68,
-  36,4,186,11,0,0,0,41,194,137,216,136,209,141,124,36,24,211,232,13,0,0,240,63,
-  137,68,36,28,49,192,57,245,15,130,180,0,0,0,139,76,36,4,131,193,21,211,227,9,
-  216,137,7,221,7,131,196,36,91,94,95,93,195,141,182,0,0,0,0,199,68,36,12,0,0,
-  0,0,57,253,114,84,139,68,36,4,131,232,11,137,68,36,4,116,94,186,32,0,0,0,138,
-  76,36,4,41,194,139,68,36,12,211,227,136,209,129,203,0,0,240,63,211,232,9,195,
-  141,124,36,24,49,192,137,92,36,28,57,238,119,93,138,76,36,4,211,100,36,12,
-  139,76,36,12,9,200,137,7,221,7,131,196,36,91,94,95,93,195,102,144,139,68,36,
-  4,131,238,4,139,127,252,131,232,11,137,124,36,12,137,68,36,4,117,162,141,124,
-  36,24,129,203,0,0,240,63,139,68,36,12,137,92,36,28,137,68,36,24,221,7,131,
-  196,36,91,94,95,93,195,139,70,252,211,232,233,66,255,255,255,139,70,252,211,
-  232,138,76,36,4,211,100,36,12,139,76,36,12,9,200,137,7,235,156,144,141,180,
-  38,0,0,0,0,85,87,86,83,131,236,40,139,68,36,60,139,108,36,68,137,68,36,28,
-  139,68,36,64,137,68,36,32,106,1,232,14,248,255,255,137,199,139,68,36,36,137,
-  195,37,255,255,255,127,137,68,36,36,129,227,255,255,15,0,131,196,16,193,232,
-  20,116,6,129,203,0,0,16,0,139,84,36,16,133,210,116,84,15,188,242,137,241,211,
-  234,137,84,36,12,133,246,15,133,126,0,0,0,139,84,36,12,137,87,20,131,251,1,
-  137,95,24,25,219,131,195,2,133,192,137,95,16,117,67,141,134,206,251,255,255,
-  137,218,193,226,5,137,69,0,15,189,68,159,16,131,240,31,41,194,139,68,36,60,
-  137,16,131,196,28,137,248,91,94,95,93,195,15,188,203,211,235,137,95,20,199,
-  71,16,1,0,0,0,141,113,32,187,1,0,0,0,133,192,116,189,141,132,6,205,251,255,
-  255,139,76,36,60,137,69,0,184,53,0,0,0,41,240,137,1,131,196,28,137,248,91,94,
-  95,93,195,144,185,32,0,0,0,137,218,41,241,211,226,137,209,139,84,36,12,9,209,
-  137,79,20,137,241,211,235,233,106,255,255,255,144,85,87,86,83,131,236,12,139,
-  108,36,32,139,76,36,36,193,249,5,141,69,20,137,68,36,4,137,195,139,69,16,57,
-  193,125,110,141,116,133,20,139,124,36,36,141,68,141,16,131,231,31,141,80,4,
-  15,132,129,0,0,0,199,68,36,8,32,0,0,0,131,192,8,139,84,36,8,137,4,36,41,250,
-  137,84,36,8,139,84,141,20,137,249,211,234,57,198,118,39,102,144,139,12,36,
-  139,1,138,76,36,8,211,224,9,194,139,4,36,137,19,137,249,139,16,131,192,4,131,
-  195,4,137,4,36,211,234,57,198,119,219,137,19,133,210,117,54,144,141,116,38,0,
-  137,216,139,84,36,4,41,208,193,248,2,137,69,16,133,192,117,7,199,69,20,0,0,0,
-  0,131,196,12,91,94,95,93,195,139,2,131,194,4,137,3,131,195,4,57,214,119,242,
-  235,207,131,195,4,235,202,141,118,0,141,188,39,0,0,0,0,86,83,139,92,36,12,49,
-  246,139,67,16,141,83,20,141,76,131,20,57,202,115,26,139,67,20,133,192,116,9,
-  235,22,144,139,2,133,192,117,18,131,194,4,131,198,32,57,209,119,240,137,240,
-  91,94,195,139,67,20,15,188,192,1,198,137,240,91,94,195,144,144,144,144,144,
-  144,144,144,144,144,144,144,144,144,255,37,128,178,64,0,144,144,255,37,168,
-  178,64,0,144,144,255,37,144,178,64,0,144,144,255,37,200,178,64,0,144,144,255,
-  37,140,178,64,0,144,144,255,37,152,178,64,0,144,144,255,37,204,178,64,0,144,
-  144,255,37,208,178,64,0,144,144,255,37,176,178,64,0,144,144,255,37,216,178,
-  64,0,144,144,255,37,196,178,64,0,144,144,255,37,184,178,64,0,144,144,255,37,
-  188,178,64,0,144,144,49,192,195,144,255,37,180,178,64,0,144,144,255,37,220,
-  178,64,0,144,144,255,37,192,178,64,0,144,144,255,37,212,178,64,0,144,144,255,
-  37,156,178,64,0,144,144,255,37,84,178,64,0,144,144,255,37,8,178,64,0,144,144,
-  255,37,36,178,64,0,144,144,255,37,44,178,64,0,144,144,255,37,104,178,64,0,
-  144,144,255,37,16,178,64,0,144,144,255,37,24,178,64,0,144,144,255,37,20,178,
-  64,0,144,144,255,37,80,178,64,0,144,144,255,37,76,178,64,0,144,144,255,37,72,
-  178,64,0,144,144,255,37,96,178,64,0,144,144,255,37,28,178,64,0,144,144,255,
-  37,92,178,64,0,144,144,255,37,12,178,64,0,144,144,255,37,0,178,64,0,144,144,
-  255,37,64,178,64,0,144,144,255,37,240,177,64,0,144,144,255,37,244,177,64,0,
-  144,144,255,37,236,177,64,0,144,144,255,37,32,178,64,0,144,144,255,37,40,178,
-  64,0,144,144,255,37,248,177,64,0,144,144,255,37,232,177,64,0,144,144,255,37,
-  68,178,64,0,144,144,255,37,56,178,64,0,144,144,255,37,100,178,64,0,144,144,
-  255,37,88,178,64,0,144,144,255,37,52,178,64,0,144,144,255,37,48,178,64,0,144,
-  144,255,37,4,178,64,0,144,144,255,37,252,177,64,0,144,144,255,37,60,178,64,0,
-  144,144,255,37,188,177,64,0,144,144,255,37,192,177,64,0,144,144,255,37,180,
-  177,64,0,144,144,255,37,196,177,64,0,144,144,255,37,176,177,64,0,144,144,255,
-  37,204,177,64,0,144,144,255,37,172,177,64,0,144,144,255,37,168,177,64,0,144,
-  144,255,37,208,177,64,0,144,144,255,37,184,177,64,0,144,144,255,37,212,177,
-  64,0,144,144,255,37,220,177,64,0,144,144,255,37,200,177,64,0,144,144,255,37,
-  216,177,64,0,144,144,81,141,76,36,8,61,0,16,0,0,114,21,129,233,0,16,0,0,131,
-  9,0,45,0,16,0,0,61,0,16,0,0,119,235,41,193,131,9,0,137,224,137,204,139,8,139,
-  64,4,80,195,144,144,144,85,137,229,87,86,83,131,236,28,139,85,8,139,125,20,
-  139,93,16,137,208,137,209,139,117,12,133,255,117,20,57,243,118,55,137,242,
-  247,243,131,196,28,137,208,91,49,210,94,95,93,195,57,247,119,62,15,189,215,
-  131,242,31,137,85,228,117,64,57,195,15,135,186,0,0,0,41,217,25,254,131,196,
-  28,137,242,137,200,91,94,95,93,195,133,219,117,11,184,1,0,0,0,49,210,247,243,
-  137,195,137,240,49,210,247,243,137,200,247,243,235,178,131,196,28,137,208,91,
-  137,242,94,95,93,195,144,138,77,228,139,85,228,211,231,137,125,224,191,32,0,
-  0,0,41,215,137,218,137,249,211,234,139,77,224,9,202,138,77,228,211,227,137,
-  93,220,137,249,137,243,137,85,224,211,235,138,77,228,137,194,211,230,137,249,
-  211,234,9,242,138,77,228,137,198,137,208,137,218,247,117,224,137,211,211,230,
-  247,101,220,57,211,114,40,57,198,114,32,138,77,228,41,198,25,211,211,238,137,
-  216,137,249,211,224,137,218,138,77,228,131,196,28,9,240,211,234,91,94,95,93,
-  195,57,211,117,220,43,69,220,27,85,224,235,212,57,247,15,130,62,255,255,255,
-  233,61,255,255,255,144,85,137,229,87,86,83,131,236,44,139,69,20,139,85,8,139,
-  93,16,137,85,228,139,117,12,133,192,117,52,57,243,119,96,133,219,117,11,184,
-  1,0,0,0,49,210,247,243,137,195,139,125,228,137,240,131,196,44,49,210,247,243,
-  137,198,137,248,247,243,137,199,137,242,137,248,91,94,95,93,195,141,116,38,0,
-  57,240,119,28,15,189,208,131,242,31,137,85,212,117,57,59,93,228,15,134,152,0,
-  0,0,57,240,15,130,144,0,0,0,49,246,49,255,131,196,44,137,248,137,242,91,94,
-  95,93,195,137,215,131,196,44,137,242,137,248,49,246,247,243,137,199,137,242,
-  137,248,91,94,95,93,195,137,199,186,32,0,0,0,139,69,212,138,77,212,41,194,
-  137,216,211,231,136,209,211,232,9,248,138,77,212,137,223,137,243,211,231,136,
-  209,137,69,224,211,235,138,77,212,139,69,228,211,230,136,209,137,218,211,232,
-  9,198,137,240,247,117,224,137,211,137,198,247,231,57,211,114,48,139,125,228,
-  138,77,212,211,231,57,199,115,4,57,211,116,32,137,247,49,246,233,123,255,255,
-  255,141,180,38,0,0,0,0,49,246,191,1,0,0,0,233,104,255,255,255,141,116,38,0,
-  131,196,44,141,126,255,49,246,137,248,137,242,91,94,95,93,195,144,144,144,
-  144,144,144,144,144,144,144,144,144,144,144,144,85,137,229,131,236,24,232,
-  149,162,255,255,199,4,36,224,18,64,0,232,249,159,255,255,201,195,144,144,144,
-  144,144,144,144,255,255,255,255,240,111,64,0,0,0,0,0,255,255,255,255,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,147,64,0,247,23,64,0,69,147,64,0,
-  163,29,64,0,73,147,64,0,13,29,64,0,0,0,0,0,0,0,0,0,255,255,255,255,0,64,0,0,
-  32,112,64,0,64,0,0,0,195,191,255,255,192,63,0,0,1,0,0,0,0,0,0,0,224,160,64,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,105,98,103,99,106,95,
-  115,46,100,108,108,0,95,74,118,95,82,101,103,105,115,116,101,114,67,108,97,
-  115,115,101,115,0,0,0,0,46,0,101,114,114,111,114,58,32,117,110,97,98,108,101,
-  32,116,111,32,97,108,108,111,99,97,116,101,32,98,117,102,102,101,114,32,102,
-  111,114,32,99,111,109,109,97,110,100,10,0,101,114,114,111,114,32,73,103,110,
-  111,114,105,110,103,32,117,110,107,110,111,119,110,32,99,111,109,109,97,110,
-  100,32,40,37,115,41,10,0,101,114,114,111,114,32,73,110,99,111,114,114,101,99,
-  116,32,114,117,110,97,115,32,99,114,101,100,101,110,116,105,97,108,115,10,0,
-  101,114,114,111,114,32,67,97,110,110,111,116,32,76,111,103,111,110,85,115,
-  101,114,40,37,115,44,37,115,44,37,115,41,32,37,100,10,0,101,114,114,111,114,
-  32,67,97,110,110,111,116,32,79,112,101,110,80,114,111,99,101,115,115,84,111,
-  107,101,110,32,37,100,10,0,101,114,114,111,114,32,67,97,110,110,111,116,32,
-  73,109,112,101,114,115,111,110,97,116,101,78,97,109,101,100,80,105,112,101,
-  67,108,105,101,110,116,32,37,100,10,0,101,114,114,111,114,32,67,97,110,110,
-  111,116,32,79,112,101,110,84,104,114,101,97,100,84,111,107,101,110,32,37,100,
-  10,0,101,114,114,111,114,32,67,97,110,110,111,116,32,68,117,112,108,105,99,
-  97,116,101,32,84,111,107,101,110,32,37,100,10,0,101,114,114,111,114,32,67,97,
-  110,110,111,116,32,82,101,118,101,114,116,84,111,83,101,108,102,32,37,100,10,
-  0,92,92,46,92,112,105,112,101,92,97,104,101,120,101,99,95,115,116,100,105,
-  110,37,48,56,88,0,101,114,114,111,114,32,67,97,110,110,111,116,32,99,114,101,
-  97,116,101,32,105,110,32,112,105,112,101,40,37,115,41,44,32,101,114,114,111,
-  114,32,48,120,37,48,56,88,10,0,92,92,46,92,112,105,112,101,92,97,104,101,120,
-  101,99,95,115,116,100,111,117,116,37,48,56,88,0,101,114,114,111,114,32,67,97,
-  110,110,111,116,32,99,114,101,97,116,101,32,111,117,116,32,112,105,112,101,
-  40,37,115,41,44,32,101,114,114,111,114,32,48,120,37,48,56,88,10,0,92,92,46,
-  92,112,105,112,101,92,97,104,101,120,101,99,95,115,116,100,101,114,114,37,48,
-  56,88,0,101,114,114,111,114,32,67,97,110,110,111,116,32,99,114,101,97,116,
-  101,32,101,114,114,32,112,105,112,101,40,37,115,41,44,32,101,114,114,111,114,
-  32,48,120,37,48,56,120,10,0,115,116,100,95,105,111,95,101,114,114,32,37,48,
-  56,88,10,0,101,114,114,111,114,32,67,111,110,110,101,99,116,78,97,109,101,
-  100,80,105,112,101,40,112,105,110,41,10,0,101,114,114,111,114,32,67,111,110,
-  110,101,99,116,78,97,109,101,100,80,105,112,101,40,112,111,117,116,41,10,0,
-  101,114,114,111,114,32,67,111,110,110,101,99,116,78,97,109,101,100,80,105,
-  112,101,40,112,101,114,114,41,10,0,114,101,116,117,114,110,95,99,111,100,101,
-  32,37,48,56,88,10,0,101,114,114,111,114,32,67,114,101,97,116,105,110,103,32,
-  112,114,111,99,101,115,115,40,37,115,41,32,37,100,10,0,118,101,114,115,105,
-  111,110,32,48,120,37,48,52,88,10,0,101,114,114,111,114,32,85,110,107,110,111,
-  119,110,32,97,114,103,117,109,101,110,116,32,40,37,115,41,10,0,101,114,114,
-  111,114,32,85,110,107,110,111,119,110,32,99,111,109,109,97,100,32,40,37,115,
-  41,10,0,92,92,46,92,112,105,112,101,92,97,104,101,120,101,99,0,114,117,110,0,
-  115,101,116,0,103,101,116,0,118,101,114,115,105,111,110,0,0,0,0,77,147,64,0,
-  114,117,110,97,115,0,0,0,92,147,64,0,105,109,112,108,101,118,101,108,0,0,0,0,
-  104,147,64,0,115,121,115,116,101,109,0,0,120,147,64,0,119,105,110,101,120,
-  101,115,118,99,0,0,0,132,147,64,0,201,34,64,0,0,0,0,0,0,0,0,0,80,82,73,78,84,
-  70,95,69,88,80,79,78,69,78,84,95,68,73,71,73,84,83,0,0,40,0,110,0,117,0,108,
-  0,108,0,41,0,0,0,40,110,117,108,108,41,0,78,97,78,0,73,110,102,0,0,0,0,150,
-  64,64,0,206,58,64,0,206,58,64,0,67,64,64,0,206,58,64,0,21,65,64,0,206,58,64,
-  0,206,58,64,0,206,58,64,0,206,58,64,0,216,64,64,0,194,64,64,0,206,58,64,0,
-  172,64,64,0,246,63,64,0,206,58,64,0,220,63,64,0,206,58,64,0,206,58,64,0,206,
-  58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,
-  64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,
-  206,58,64,0,25,60,64,0,206,58,64,0,162,63,64,0,206,58,64,0,226,59,64,0,171,
-  59,64,0,116,59,64,0,206,58,64,0,4,62,64,0,206,58,64,0,206,58,64,0,82,59,64,0,
-  206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,214,
-  61,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,1,63,64,0,206,58,64,
-  0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,206,58,64,0,
-  206,58,64,0,14,60,64,0,206,58,64,0,106,63,64,0,137,62,64,0,215,59,64,0,160,
-  59,64,0,105,59,64,0,48,62,64,0,137,62,64,0,28,62,64,0,206,58,64,0,60,59,64,0,
-  206,58,64,0,77,62,64,0,1,63,64,0,11,64,64,0,206,58,64,0,206,58,64,0,198,61,
-  64,0,237,62,64,0,1,63,64,0,206,58,64,0,206,58,64,0,1,63,64,0,206,58,64,0,237,
-  62,64,0,0,0,0,0,73,110,102,105,110,105,116,121,0,78,97,78,0,48,0,0,108,75,64,
-  0,159,74,64,0,159,74,64,0,220,75,64,0,164,75,64,0,236,78,64,0,236,78,64,0,
-  226,78,64,0,216,78,64,0,160,78,64,0,96,78,64,0,0,0,192,63,97,67,111,99,167,
-  135,210,63,179,200,96,139,40,138,198,63,251,121,159,80,19,68,211,63,4,250,
-  125,157,22,45,148,60,50,90,71,85,19,68,211,63,0,0,128,63,0,0,32,65,0,0,224,
-  64,0,0,160,64,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,128,224,55,121,195,65,67,23,110,5,181,181,184,147,70,245,249,63,233,3,79,
-  56,77,50,29,48,249,72,119,130,90,60,191,115,127,221,79,21,117,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,137,216,151,178,210,156,60,51,167,168,
-  213,35,246,73,57,61,167,244,68,253,15,165,50,157,151,140,207,8,186,91,37,67,
-  111,172,100,40,6,200,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,240,63,0,0,0,0,0,0,36,64,0,0,0,0,0,0,89,64,0,0,0,0,0,64,143,64,0,0,0,
-  0,0,136,195,64,0,0,0,0,0,106,248,64,0,0,0,0,128,132,46,65,0,0,0,0,208,18,99,
-  65,0,0,0,0,132,215,151,65,0,0,0,0,101,205,205,65,0,0,0,32,95,160,2,66,0,0,0,
-  232,118,72,55,66,0,0,0,162,148,26,109,66,0,0,64,229,156,48,162,66,0,0,144,30,
-  196,188,214,66,0,0,52,38,245,107,12,67,0,128,224,55,121,195,65,67,0,160,216,
-  133,87,52,118,67,0,200,78,103,109,193,171,67,0,61,145,96,228,88,225,67,64,
-  140,181,120,29,175,21,68,80,239,226,214,228,26,75,68,146,213,77,6,207,240,
-  128,68,5,0,0,0,25,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,104,176,0,0,0,0,0,0,0,0,0,0,12,184,0,0,168,177,0,0,168,176,
-  0,0,0,0,0,0,0,0,0,0,160,184,0,0,232,177,0,0,52,177,0,0,0,0,0,0,0,0,0,0,180,
-  184,0,0,116,178,0,0,64,177,0,0,0,0,0,0,0,0,0,0,32,185,0,0,128,178,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,228,178,0,0,0,179,0,0,24,179,0,0,
-  44,179,0,0,74,179,0,0,106,179,0,0,120,179,0,0,140,179,0,0,158,179,0,0,188,
-  179,0,0,204,179,0,0,224,179,0,0,252,179,0,0,16,180,0,0,0,0,0,0,0,0,0,0,46,
-  180,0,0,60,180,0,0,80,180,0,0,96,180,0,0,116,180,0,0,132,180,0,0,156,180,0,0,
-  178,180,0,0,202,180,0,0,216,180,0,0,236,180,0,0,0,181,0,0,22,181,0,0,42,181,
-  0,0,64,181,0,0,80,181,0,0,100,181,0,0,122,181,0,0,140,181,0,0,168,181,0,0,
-  190,181,0,0,210,181,0,0,234,181,0,0,248,181,0,0,14,182,0,0,26,182,0,0,40,182,
-  0,0,64,182,0,0,94,182,0,0,102,182,0,0,122,182,0,0,148,182,0,0,170,182,0,0,0,
-  0,0,0,0,0,0,0,182,182,0,0,0,0,0,0,0,0,0,0,192,182,0,0,208,182,0,0,224,182,0,
-  0,240,182,0,0,0,183,0,0,14,183,0,0,32,183,0,0,42,183,0,0,52,183,0,0,60,183,0,
-  0,70,183,0,0,82,183,0,0,92,183,0,0,100,183,0,0,108,183,0,0,116,183,0,0,126,
-  183,0,0,140,183,0,0,150,183,0,0,160,183,0,0,170,183,0,0,180,183,0,0,190,183,
-  0,0,200,183,0,0,0,0,0,0,0,0,0,0,228,178,0,0,0,179,0,0,24,179,0,0,44,179,0,0,
-  74,179,0,0,106,179,0,0,120,179,0,0,140,179,0,0,158,179,0,0,188,179,0,0,204,
-  179,0,0,224,179,0,0,252,179,0,0,16,180,0,0,0,0,0,0,0,0,0,0,46,180,0,0,60,180,
-  0,0,80,180,0,0,96,180,0,0,116,180,0,0,132,180,0,0,156,180,0,0,178,180,0,0,
-  202,180,0,0,216,180,0,0,236,180,0,0,0,181,0,0,22,181,0,0,42,181,0,0,64,181,0,
-  0,80,181,0,0,100,181,0,0,122,181,0,0,140,181,0,0,168,181,0,0,190,181,0,0,210,
-  181,0,0,234,181,0,0,248,181,0,0,14,182,0,0,26,182,0,0,40,182,0,0,64,182,0,0,
-  94,182,0,0,102,182,0,0,122,182,0,0,148,182,0,0,170,182,0,0,0,0,0,0,0,0,0,0,
-  182,182,0,0,0,0,0,0,0,0,0,0,192,182,0,0,208,182,0,0,224,182,0,0,240,182,0,0,
-  0,183,0,0,14,183,0,0,32,183,0,0,42,183,0,0,52,183,0,0,60,183,0,0,70,183,0,0,
-  82,183,0,0,92,183,0,0,100,183,0,0,108,183,0,0,116,183,0,0,126,183,0,0,140,
-  183,0,0,150,183,0,0,160,183,0,0,170,183,0,0,180,183,0,0,190,183,0,0,200,183,
-  0,0,0,0,0,0,26,0,65,108,108,111,99,97,116,101,65,110,100,73,110,105,116,105,
-  97,108,105,122,101,83,105,100,0,0,86,0,67,114,101,97,116,101,80,114,111,99,
-  101,115,115,65,115,85,115,101,114,65,0,0,140,0,68,117,112,108,105,99,97,116,
-  101,84,111,107,101,110,69,120,0,0,251,0,73,109,112,101,114,115,111,110,97,
-  116,101,78,97,109,101,100,80,105,112,101,67,108,105,101,110,116,0,0,254,0,73,
-  110,105,116,105,97,108,105,122,101,83,101,99,117,114,105,116,121,68,101,115,
-  99,114,105,112,116,111,114,0,0,12,1,76,111,103,111,110,85,115,101,114,65,0,0,
-  101,1,79,112,101,110,80,114,111,99,101,115,115,84,111,107,101,110,0,0,106,1,
-  79,112,101,110,84,104,114,101,97,100,84,111,107,101,110,0,185,1,82,101,103,
-  105,115,116,101,114,83,101,114,118,105,99,101,67,116,114,108,72,97,110,100,
-  108,101,114,65,0,195,1,82,101,118,101,114,116,84,111,83,101,108,102,0,0,199,
-  1,83,101,116,69,110,116,114,105,101,115,73,110,65,99,108,65,0,0,213,1,83,101,
-  116,83,101,99,117,114,105,116,121,68,101,115,99,114,105,112,116,111,114,68,
-  97,99,108,0,223,1,83,101,116,83,101,114,118,105,99,101,83,116,97,116,117,115,
-  0,0,229,1,83,116,97,114,116,83,101,114,118,105,99,101,67,116,114,108,68,105,
-  115,112,97,116,99,104,101,114,65,0,38,0,67,108,111,115,101,72,97,110,100,108,
-  101,0,46,0,67,111,110,110,101,99,116,78,97,109,101,100,80,105,112,101,0,0,64,
-  0,67,114,101,97,116,101,69,118,101,110,116,65,0,0,82,0,67,114,101,97,116,101,
-  78,97,109,101,100,80,105,112,101,65,0,0,91,0,67,114,101,97,116,101,84,104,
-  114,101,97,100,0,0,107,0,68,101,108,101,116,101,67,114,105,116,105,99,97,108,
-  83,101,99,116,105,111,110,0,118,0,68,105,115,99,111,110,110,101,99,116,78,97,
-  109,101,100,80,105,112,101,0,126,0,69,110,116,101,114,67,114,105,116,105,99,
-  97,108,83,101,99,116,105,111,110,0,0,156,0,69,120,105,116,80,114,111,99,101,
-  115,115,0,204,0,70,108,117,115,104,70,105,108,101,66,117,102,102,101,114,115,
-  0,0,27,1,71,101,116,67,117,114,114,101,110,116,80,114,111,99,101,115,115,0,
-  28,1,71,101,116,67,117,114,114,101,110,116,80,114,111,99,101,115,115,73,100,
-  0,29,1,71,101,116,67,117,114,114,101,110,116,84,104,114,101,97,100,0,0,50,1,
-  71,101,116,69,120,105,116,67,111,100,101,80,114,111,99,101,115,115,0,0,69,1,
-  71,101,116,76,97,115,116,69,114,114,111,114,0,0,81,1,71,101,116,77,111,100,
-  117,108,101,72,97,110,100,108,101,65,0,0,96,1,71,101,116,79,118,101,114,108,
-  97,112,112,101,100,82,101,115,117,108,116,0,108,1,71,101,116,80,114,111,99,
-  65,100,100,114,101,115,115,0,0,236,1,73,110,105,116,105,97,108,105,122,101,
-  67,114,105,116,105,99,97,108,83,101,99,116,105,111,110,0,241,1,73,110,116,
-  101,114,108,111,99,107,101,100,69,120,99,104,97,110,103,101,0,0,2,73,115,68,
-  66,67,83,76,101,97,100,66,121,116,101,69,120,0,0,11,2,76,101,97,118,101,67,
-  114,105,116,105,99,97,108,83,101,99,116,105,111,110,0,0,18,2,76,111,99,97,
-  108,65,108,108,111,99,0,0,48,2,77,117,108,116,105,66,121,116,101,84,111,87,
-  105,100,101,67,104,97,114,0,104,2,82,101,97,100,70,105,108,101,0,0,126,2,82,
-  101,115,101,116,69,118,101,110,116,0,0,198,2,83,101,116,72,97,110,100,108,
-  101,73,110,102,111,114,109,97,116,105,111,110,0,0,227,2,83,101,116,85,110,
-  104,97,110,100,108,101,100,69,120,99,101,112,116,105,111,110,70,105,108,116,
-  101,114,0,239,2,83,108,101,101,112,0,247,2,84,101,114,109,105,110,97,116,101,
-  80,114,111,99,101,115,115,0,0,40,3,87,97,105,116,70,111,114,77,117,108,116,
-  105,112,108,101,79,98,106,101,99,116,115,0,0,46,3,87,105,100,101,67,104,97,
-  114,84,111,77,117,108,116,105,66,121,116,101,0,59,3,87,114,105,116,101,70,
-  105,108,101,0,80,0,95,115,116,114,100,117,112,0,55,0,95,95,103,101,116,109,
-  97,105,110,97,114,103,115,0,61,0,95,95,108,99,95,99,111,100,101,112,97,103,
-  101,0,65,0,95,95,109,98,95,99,117,114,95,109,97,120,0,0,77,0,95,95,112,95,95,
-  101,110,118,105,114,111,110,0,0,79,0,95,95,112,95,95,102,109,111,100,101,0,0,
-  99,0,95,95,115,101,116,95,97,112,112,95,116,121,112,101,0,0,147,0,95,99,101,
-  120,105,116,0,0,182,0,95,101,114,114,110,111,0,0,10,1,95,105,111,98,0,0,127,
-  1,95,111,110,101,120,105,116,0,170,1,95,115,101,116,109,111,100,101,0,0,78,2,
-  97,116,101,120,105,116,0,0,80,2,97,116,111,105,0,0,108,2,102,112,117,116,99,
-  0,113,2,102,114,101,101,0,0,125,2,103,101,116,101,110,118,0,0,159,2,108,111,
-  99,97,108,101,99,111,110,118,0,0,164,2,109,97,108,108,111,99,0,0,194,2,115,
-  105,103,110,97,108,0,0,197,2,115,112,114,105,110,116,102,0,202,2,115,116,114,
-  99,104,114,0,0,209,2,115,116,114,108,101,110,0,0,216,2,115,116,114,115,116,
-  114,0,0,249,2,119,99,115,108,101,110,0,0,0,0,0,176,0,0,0,176,0,0,0,176,0,0,0,
-  176,0,0,0,176,0,0,0,176,0,0,0,176,0,0,0,176,0,0,0,176,0,0,0,176,0,0,0,176,0,
-  0,0,176,0,0,0,176,0,0,0,176,0,0,65,68,86,65,80,73,51,50,46,68,76,76,0,0,0,0,
-  20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,
-  20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,
-  20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,
-  20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,
-  20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,20,176,0,0,75,69,82,78,69,76,51,
-  50,46,100,108,108,0,0,0,0,40,176,0,0,109,115,118,99,114,116,46,100,108,108,0,
-  0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,
-  0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,
-  0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,0,60,176,0,
-  0,60,176,0,0,60,176,0,0,60,176,0,0,109,115,118,99,114,116,46,100,108,108,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+unsigned int winexesvc32_exe_zlen = 16842;
+unsigned char winexesvc32_exe_z[] = {
+  120,218,237,125,11,120,20,69,182,112,207,164,3,19,24,232,81,6,8,26,101,118,
+  119,208,68,17,51,110,86,153,37,232,64,50,33,64,2,147,39,207,8,145,36,16,12,
+  73,54,233,225,161,16,130,51,163,41,154,193,232,234,238,222,189,236,138,143,
+  253,101,213,123,87,89,220,69,174,226,36,129,36,136,98,32,40,129,16,141,138,
+  210,195,0,6,208,188,120,204,127,78,85,247,100,2,186,247,191,255,243,251,239,
+  119,3,149,234,174,170,115,234,212,169,83,231,156,58,93,221,73,95,88,203,69,
+  112,28,199,67,10,6,57,110,55,199,126,108,220,191,255,83,13,105,228,248,61,35,
+  185,93,81,31,253,100,183,38,237,163,159,100,175,40,174,52,149,87,148,45,175,
+  200,95,101,90,150,95,90,90,38,154,30,41,52,85,56,75,77,197,165,166,228,185,
+  89,166,85,101,5,133,147,70,140,24,102,86,112,56,236,28,151,166,137,228,50,30,
+  232,75,87,241,118,114,66,196,112,141,118,50,247,8,220,172,134,164,231,184,
+  248,155,32,55,40,157,34,117,120,173,101,116,107,20,250,233,143,143,221,220,
+  189,78,67,199,197,113,38,214,22,127,25,88,19,67,248,32,222,228,184,137,81,
+  220,255,245,159,73,98,225,90,17,114,243,82,133,160,71,194,7,193,126,150,114,
+  142,165,147,10,242,197,124,184,78,85,25,14,99,230,138,6,183,179,113,241,190,
+  73,21,172,161,109,40,20,212,66,210,65,90,113,125,187,165,182,73,143,84,86,82,
+  190,15,131,95,219,127,108,94,109,190,73,197,12,31,229,13,240,136,195,246,229,
+  55,246,203,253,215,207,255,215,63,57,210,136,55,118,218,56,242,117,94,240,11,
+  175,120,7,222,191,50,232,158,124,157,229,58,107,90,225,184,201,198,201,173,
+  139,56,206,181,79,47,191,58,138,227,228,122,35,220,156,213,123,237,223,53,
+  217,191,163,34,229,181,247,74,183,153,170,109,92,150,99,5,191,221,6,226,7,
+  191,228,97,0,244,162,30,174,92,251,76,30,159,51,89,142,130,2,105,180,25,218,
+  17,131,188,5,177,156,234,146,147,71,3,202,224,66,142,203,146,116,25,210,104,
+  4,207,124,17,225,29,242,77,176,244,73,131,124,6,42,73,140,89,206,69,240,219,
+  182,3,145,47,35,142,140,12,135,148,101,200,148,95,95,136,180,25,92,151,59,
+  197,113,14,7,237,208,33,37,197,59,228,103,213,10,159,232,30,168,112,56,228,
+  117,172,194,255,104,48,24,36,221,222,119,239,164,252,32,95,187,206,26,87,106,
+  131,163,159,131,30,228,171,215,130,65,239,223,176,98,112,189,70,169,239,248,
+  129,122,224,23,47,217,117,18,39,113,83,159,1,133,180,102,202,84,47,100,21,
+  179,255,13,21,149,195,177,146,91,169,147,245,10,85,189,26,193,253,41,20,123,
+  124,130,7,151,173,197,39,229,93,57,80,207,115,222,93,119,32,190,169,207,1,
+  168,56,115,234,111,48,27,59,245,215,144,57,219,3,111,79,141,196,123,235,212,
+  219,240,254,32,197,201,203,187,23,168,56,197,133,30,159,184,11,102,103,37,31,
+  108,113,53,7,161,52,240,106,45,206,167,165,221,255,24,140,151,66,12,151,159,
+  28,128,120,16,32,158,64,136,225,42,132,191,2,26,98,137,46,84,178,148,129,106,
+  160,179,217,8,202,74,103,169,165,195,229,95,12,148,38,168,165,58,121,188,210,
+  77,115,208,211,46,184,111,133,10,217,125,51,109,232,31,9,55,181,97,63,148,
+  191,209,47,38,195,204,2,65,15,52,241,102,174,22,248,92,12,24,72,61,53,78,25,
+  158,35,226,205,196,104,110,74,54,243,35,176,46,7,234,50,51,161,117,20,180,70,
+  192,96,203,129,134,90,133,127,128,47,175,97,48,254,92,152,32,131,228,212,73,
+  121,122,196,113,47,180,34,9,102,249,247,243,113,22,156,70,44,91,172,148,61,
+  73,203,196,168,70,80,118,164,146,15,68,53,37,241,102,232,147,116,145,8,108,
+  55,1,219,241,102,249,97,214,142,167,237,146,116,48,214,221,56,215,139,30,206,
+  107,128,14,231,97,143,105,150,110,105,131,65,178,235,83,165,60,29,177,31,245,
+  206,224,137,189,37,80,34,217,91,0,147,30,105,37,201,102,3,92,235,16,148,44,
+  54,243,210,80,196,253,175,243,113,157,25,129,52,189,124,17,174,167,126,13,
+  118,205,105,245,218,79,33,156,134,193,233,0,13,100,10,72,43,5,49,0,69,55,187,
+  54,156,226,68,125,245,148,97,226,208,148,164,96,250,209,117,79,55,70,112,222,
+  194,239,72,215,162,135,151,168,212,109,58,155,6,166,199,107,55,0,105,222,183,
+  79,93,134,245,0,168,129,86,196,140,227,68,203,132,252,56,4,75,209,155,196,
+  187,14,4,137,231,40,54,235,177,248,46,254,107,207,225,153,18,187,101,3,96,
+  131,73,51,235,136,8,20,69,32,69,239,204,83,7,113,159,124,79,104,16,119,92,63,
+  8,21,139,2,53,156,141,131,221,52,2,10,135,100,63,5,196,135,145,238,58,187,24,
+  166,18,197,4,140,163,124,62,23,116,195,24,210,0,253,140,70,186,239,192,185,
+  50,154,229,209,32,101,254,94,186,188,222,65,135,128,124,126,233,117,111,186,
+  143,164,239,122,7,237,154,180,97,215,165,215,165,20,158,228,248,72,222,62,98,
+  63,133,99,125,13,113,217,125,116,248,213,140,62,84,63,19,97,197,123,124,85,
+  201,123,57,144,180,64,44,89,111,230,177,184,4,90,91,219,156,163,45,62,96,14,
+  178,100,115,242,240,96,162,73,20,220,62,113,184,171,81,39,61,232,9,58,143,4,
+  22,97,175,122,115,48,151,7,18,95,4,244,18,149,159,51,172,175,121,236,238,20,
+  187,203,101,119,99,230,209,187,12,201,102,196,219,161,236,54,147,94,231,50,
+  149,24,204,225,184,64,12,148,130,212,208,249,202,198,113,67,131,219,128,88,
+  255,3,48,248,48,166,33,207,226,97,162,165,36,80,199,130,251,37,212,93,57,50,
+  180,38,217,102,94,62,121,5,135,231,28,139,88,214,1,22,198,251,79,174,2,158,
+  247,52,56,249,184,62,12,138,180,26,37,123,23,19,190,179,116,210,236,50,206,
+  166,86,89,20,255,2,212,237,197,169,133,5,141,234,109,35,92,23,89,186,229,123,
+  114,195,129,13,12,24,164,77,86,165,109,91,168,223,60,236,119,6,192,185,30,
+  143,225,196,169,242,99,57,72,236,119,64,41,109,24,228,4,218,211,236,92,106,
+  138,176,147,167,160,63,249,32,52,195,250,58,100,3,32,165,83,47,69,48,126,222,
+  145,139,107,53,211,57,70,126,69,105,246,149,218,236,48,2,223,30,234,3,213,3,
+  186,81,92,120,95,223,230,40,107,203,57,94,94,166,32,16,158,97,8,96,137,83,
+  178,255,27,48,49,176,92,225,149,34,220,70,202,10,41,41,90,69,202,6,253,29,
+  149,47,112,235,16,238,159,115,20,102,57,111,71,70,241,10,250,120,5,61,67,62,
+  19,144,3,28,94,94,206,134,37,129,172,113,222,33,47,207,161,234,235,54,249,80,
+  54,131,202,24,4,53,10,160,44,221,222,194,94,92,248,3,235,254,93,32,10,100,1,
+  219,155,40,121,60,54,126,58,11,200,243,136,84,210,5,247,73,158,73,153,239,42,
+  187,255,16,238,101,14,122,241,190,237,134,38,164,169,238,180,33,226,113,170,
+  143,203,176,207,245,176,80,96,253,76,207,162,116,196,116,253,217,134,121,180,
+  194,72,35,186,235,84,134,88,78,23,127,56,163,35,20,221,219,157,133,204,48,
+  129,58,181,57,205,114,47,146,36,2,230,100,58,45,60,121,70,149,17,43,168,12,
+  255,68,164,113,61,147,138,221,72,4,32,168,203,252,95,35,192,169,18,160,71,2,
+  214,92,71,64,107,136,128,221,253,64,192,11,17,3,4,68,60,203,8,176,253,47,18,
+  240,93,166,66,128,1,9,232,206,28,76,192,237,207,170,4,60,128,4,220,28,70,192,
+  156,80,85,12,84,41,18,6,147,171,163,194,153,137,130,146,155,235,252,153,252,
+  50,92,78,29,11,235,85,164,235,125,73,8,236,235,62,192,184,75,203,200,97,176,
+  122,44,95,73,97,51,50,0,118,249,96,216,245,33,216,63,35,108,201,32,88,3,150,
+  79,162,176,153,153,0,123,247,96,216,223,135,96,87,33,172,25,42,36,42,125,170,
+  49,180,97,43,186,142,104,177,50,16,79,6,115,64,157,205,164,71,109,169,54,84,
+  232,125,132,53,185,177,150,82,148,156,65,13,2,18,9,230,32,199,253,214,77,228,
+  24,180,6,83,144,164,107,178,187,147,177,67,251,187,136,10,244,52,128,136,230,
+  88,98,223,199,72,3,245,128,18,111,82,230,44,70,201,67,115,172,116,103,80,238,
+  85,251,174,27,96,138,113,83,250,155,40,1,72,201,78,74,231,68,92,93,223,51,85,
+  229,48,146,156,54,41,167,153,228,156,84,20,255,31,29,28,55,79,138,80,145,169,
+  99,242,58,120,160,197,224,205,57,141,250,155,169,184,199,29,170,181,141,148,
+  223,119,160,101,111,67,48,176,3,193,48,237,195,131,213,68,93,45,103,211,230,
+  6,98,239,244,248,36,123,179,120,147,55,167,83,181,7,54,168,11,140,109,178,
+  119,38,220,204,248,135,57,246,113,47,84,228,230,42,124,190,11,110,50,20,174,
+  222,238,64,3,213,76,13,212,66,7,181,217,31,226,245,28,90,222,57,79,229,194,
+  238,208,172,175,233,1,117,57,65,30,237,96,61,124,240,172,141,41,71,198,232,
+  144,10,115,244,224,212,211,62,234,231,66,231,74,223,127,155,75,251,166,34,
+  241,26,92,103,42,109,62,155,139,125,179,54,71,230,34,239,88,155,70,6,75,121,
+  186,7,97,193,54,90,124,131,92,138,24,52,143,149,188,170,21,113,45,174,159,3,
+  121,147,197,231,9,138,203,103,188,56,255,215,148,68,158,36,154,229,10,172,
+  169,183,246,58,31,160,182,95,154,138,149,232,1,84,175,31,22,228,156,63,65,
+  142,23,40,194,231,15,141,217,213,29,12,82,31,49,16,141,139,26,43,251,66,149,
+  69,80,9,200,246,197,12,162,106,34,250,172,41,3,84,193,12,217,59,229,175,210,
+  81,74,79,65,115,240,244,64,57,163,248,228,157,146,166,86,3,21,73,170,119,114,
+  40,157,210,216,230,52,133,252,19,164,206,228,52,120,245,195,192,31,145,255,
+  132,13,82,98,2,165,210,84,17,199,22,99,70,80,249,55,233,212,171,249,169,2,5,
+  222,23,0,38,234,40,220,112,132,91,69,225,162,3,247,75,83,11,194,224,30,102,
+  112,119,222,0,55,90,129,115,14,69,56,19,227,192,173,32,22,56,170,49,191,86,
+  44,214,16,100,66,254,247,140,9,19,85,38,0,11,10,6,118,155,208,48,214,107,63,
+  211,100,239,194,187,70,251,25,72,1,72,103,33,157,131,116,30,210,183,145,128,
+  214,172,172,150,31,93,170,220,117,75,213,196,116,151,206,164,76,154,234,207,
+  140,158,19,90,164,7,145,203,72,74,115,80,51,30,217,239,165,190,12,108,134,
+  155,155,236,31,34,64,147,189,133,226,179,159,100,89,167,54,76,201,43,139,15,
+  7,47,55,165,171,254,196,58,236,12,169,129,42,12,191,201,167,210,112,227,139,
+  250,86,204,11,105,64,32,100,91,58,211,164,226,12,112,161,174,87,46,180,17,76,
+  249,70,21,175,248,147,166,72,180,64,216,138,220,246,29,218,162,200,222,63,
+  179,248,30,227,191,150,109,58,67,130,150,40,111,197,133,87,143,251,181,35,
+  130,251,41,13,37,9,249,37,123,103,115,220,59,145,136,169,193,91,206,91,124,
+  164,231,210,235,215,107,36,149,10,116,202,17,102,66,26,83,47,212,29,250,119,
+  141,97,240,70,99,104,3,76,22,144,13,249,171,217,204,32,70,184,122,131,206,91,
+  149,53,220,13,133,25,56,226,190,89,168,206,253,109,28,181,147,212,145,217,51,
+  155,113,74,240,252,17,41,249,235,108,213,238,220,75,55,32,204,93,188,126,19,
+  18,161,66,111,153,173,178,112,25,80,160,163,227,159,133,177,11,221,118,27,55,
+  157,68,19,122,65,28,252,245,82,164,152,104,221,30,163,45,100,5,85,110,60,52,
+  91,241,241,196,145,216,199,100,184,117,248,255,128,86,141,46,253,216,217,212,
+  54,204,163,198,27,174,115,113,100,227,161,87,255,186,107,33,55,30,195,3,105,
+  102,222,117,170,43,248,171,43,116,214,50,64,48,189,27,218,228,171,48,170,189,
+  181,192,43,106,213,64,239,95,250,19,98,122,12,123,1,224,5,22,31,128,123,243,
+  175,52,176,125,182,100,215,185,122,181,226,48,87,111,132,120,83,170,115,122,
+  32,186,41,146,127,205,198,97,16,49,144,192,174,17,81,32,182,41,82,255,26,147,
+  25,86,74,39,56,210,24,42,139,86,174,94,52,189,166,140,249,53,182,5,17,148,41,
+  0,83,148,0,195,192,208,6,237,59,246,135,150,158,42,70,122,211,141,140,27,50,
+  11,117,24,16,77,133,214,115,68,28,142,59,187,222,153,56,233,25,7,26,20,164,
+  145,216,111,124,136,76,186,234,34,117,112,21,65,175,6,6,97,8,93,221,56,8,236,
+  186,247,39,54,236,218,141,114,151,4,93,191,140,3,163,178,228,254,103,202,218,
+  239,216,206,71,207,118,62,212,180,252,12,12,172,52,154,53,20,31,122,25,59,67,
+  45,241,15,25,246,178,33,156,97,48,162,207,96,68,25,25,1,43,134,56,66,19,240,
+  99,84,34,144,252,198,204,16,139,15,167,34,139,117,52,2,204,169,241,168,109,
+  219,22,146,150,77,23,49,20,158,249,135,109,11,255,96,105,249,51,94,11,238,47,
+  232,142,88,120,9,85,218,39,170,58,16,94,234,110,212,136,130,116,155,1,99,118,
+  7,53,132,94,20,121,142,172,27,241,34,45,106,214,190,140,121,79,61,70,138,69,
+  181,144,15,21,114,154,80,161,110,160,80,27,42,52,208,194,77,95,98,192,59,84,
+  104,162,133,221,117,3,176,54,90,82,253,181,73,165,165,250,96,53,163,5,195,64,
+  213,194,75,83,49,91,77,109,8,220,121,142,172,141,166,56,109,10,134,234,15,25,
+  157,139,242,26,164,17,180,224,35,13,161,23,129,99,131,226,65,237,95,133,69,
+  136,114,222,177,253,22,195,159,155,250,48,175,140,150,50,120,73,179,169,30,
+  131,221,174,58,157,70,203,202,43,100,21,132,138,157,238,197,216,106,152,106,
+  156,245,209,193,22,122,227,242,241,47,171,133,206,64,88,60,234,69,67,57,226,
+  7,13,150,155,37,198,35,132,55,193,67,203,26,48,62,23,28,227,58,207,207,118,
+  246,130,31,186,194,54,1,38,119,209,153,32,134,211,96,231,134,251,54,139,47,
+  160,37,45,94,135,70,210,63,143,64,158,3,206,174,192,30,4,84,227,143,47,70,
+  163,78,250,26,163,81,121,13,69,181,32,46,219,153,240,229,5,92,64,111,112,130,
+  184,211,198,213,134,228,35,151,70,43,113,55,46,194,86,60,205,28,45,101,155,
+  99,48,0,0,4,100,102,172,228,114,87,114,242,238,81,24,190,51,45,92,244,112,67,
+  45,58,220,243,131,153,25,89,88,241,2,171,64,207,98,141,174,145,191,143,195,
+  38,228,4,94,5,190,99,252,201,34,13,176,44,161,131,120,186,92,146,205,9,212,
+  181,75,54,79,166,123,255,100,115,34,238,141,219,75,204,186,227,95,255,243,
+  231,157,29,109,19,240,41,84,247,62,141,120,75,247,62,94,112,175,71,137,124,
+  31,28,92,11,70,98,204,184,138,3,70,168,113,206,160,165,170,125,183,248,96,
+  238,49,74,83,7,40,83,137,193,11,246,222,11,46,186,3,111,217,175,172,76,40,
+  140,113,100,172,152,8,211,34,239,138,65,210,83,23,53,116,239,179,137,119,81,
+  92,187,27,222,167,254,49,117,138,3,127,97,97,93,203,17,203,1,44,163,90,240,
+  229,162,90,218,146,96,200,142,154,239,9,193,141,28,119,207,131,176,32,253,
+  143,195,226,47,130,241,182,130,60,0,25,153,124,119,163,9,28,182,164,152,41,
+  73,209,85,35,170,191,49,56,71,73,163,96,255,95,163,215,74,179,163,167,145,
+  217,209,243,23,46,106,112,56,164,8,71,134,156,1,155,13,44,133,153,86,42,6,
+  226,151,204,37,37,141,174,181,134,171,130,219,139,207,127,92,85,70,78,44,144,
+  82,12,164,176,211,229,187,221,213,217,37,255,197,142,110,198,89,26,138,94,
+  111,22,28,94,251,89,215,233,46,135,148,98,164,28,117,204,147,127,149,64,163,
+  176,196,126,210,227,171,154,98,105,167,241,96,97,47,63,133,92,76,146,147,129,
+  250,41,121,39,157,223,74,133,157,106,176,8,235,201,197,221,147,80,251,154,
+  195,130,72,106,153,1,202,2,31,43,157,202,127,76,194,184,201,217,204,149,6,9,
+  31,5,92,116,200,93,22,214,97,61,244,167,43,146,236,23,139,72,138,145,228,26,
+  252,137,136,76,25,31,29,157,158,52,144,99,228,35,144,65,147,231,128,176,245,
+  4,70,37,82,116,214,58,97,203,95,80,209,165,232,232,214,133,101,158,118,193,
+  115,39,109,192,131,152,8,158,109,112,189,195,38,120,222,193,178,92,157,231,
+  72,213,40,168,154,192,13,1,91,143,250,95,112,63,8,53,158,115,194,214,124,220,
+  109,5,54,143,221,141,246,193,125,68,228,133,189,245,51,200,69,57,21,44,235,
+  108,231,105,203,57,41,87,15,14,207,214,19,104,194,187,228,77,24,255,56,183,
+  238,86,63,186,112,55,66,221,140,54,27,1,188,211,131,36,69,191,177,195,181,79,
+  79,217,19,215,76,82,116,160,82,107,102,7,105,11,107,189,224,181,193,101,92,
+  11,43,223,250,75,44,159,163,199,145,142,6,146,82,89,177,251,103,116,112,206,
+  225,82,46,223,83,239,131,10,81,80,171,116,20,19,95,253,205,16,193,115,5,251,
+  77,209,97,149,119,53,206,15,250,169,178,251,42,182,208,1,45,158,35,80,179,
+  241,52,70,218,143,163,27,119,113,247,61,216,96,25,134,210,78,66,65,119,74,
+  164,78,240,196,96,103,231,4,66,105,73,209,147,128,70,182,156,131,97,64,115,
+  28,103,146,252,115,104,111,13,56,191,245,71,227,100,225,16,117,138,60,96,189,
+  108,188,161,191,115,194,211,47,176,254,104,131,75,87,160,191,215,89,193,221,
+  88,240,37,22,44,98,196,35,23,78,192,37,14,194,127,152,53,162,195,120,15,27,
+  221,175,82,233,62,119,77,33,58,252,249,12,219,12,185,122,203,96,251,67,114,
+  90,132,231,125,150,35,36,253,104,77,253,4,244,29,93,245,17,82,186,206,181,
+  161,179,204,155,176,31,253,24,105,157,94,120,206,71,235,72,225,169,84,146,35,
+  187,58,251,201,101,151,47,218,19,20,106,246,161,212,228,232,52,109,210,66,
+  157,181,109,131,150,180,41,235,105,201,116,116,241,91,192,207,18,164,156,163,
+  174,47,186,162,234,73,250,73,193,189,31,0,54,195,254,184,199,245,165,137,28,
+  170,201,105,223,156,215,242,147,203,222,164,248,154,33,41,137,214,170,40,111,
+  210,3,195,236,237,53,41,193,205,233,50,0,2,10,225,95,90,90,207,116,215,153,
+  68,158,180,0,165,57,71,137,189,37,170,222,217,52,197,9,232,202,89,0,78,122,
+  92,15,212,108,29,131,18,218,37,229,156,4,89,233,139,171,67,9,137,160,69,94,
+  163,133,233,163,70,46,222,102,109,113,246,122,19,44,20,126,22,131,7,160,13,
+  39,165,44,93,92,47,72,219,214,55,112,172,199,226,154,200,227,58,79,176,42,22,
+  153,33,26,97,148,221,211,35,117,226,112,215,183,90,236,235,159,144,55,233,58,
+  105,129,30,68,165,166,1,89,135,237,162,0,91,119,82,164,206,185,30,64,239,98,
+  64,188,243,39,222,185,65,75,59,73,63,11,5,116,166,146,228,155,47,131,128,92,
+  118,158,151,242,206,198,93,38,159,147,75,64,207,234,155,133,189,73,65,104,51,
+  91,190,212,15,213,121,39,43,206,3,26,163,165,125,0,238,68,191,2,87,24,10,229,
+  163,27,250,113,176,201,70,215,183,223,9,191,54,219,59,27,83,52,192,83,87,163,
+  214,95,137,207,161,128,54,193,19,133,210,106,215,117,219,80,56,112,33,52,14,
+  137,79,241,95,130,11,75,187,255,23,40,91,211,194,87,190,231,46,104,63,119,46,
+  54,242,206,208,120,124,27,191,163,210,12,180,72,143,233,113,236,206,147,210,
+  2,190,250,116,15,89,192,251,215,95,99,53,211,49,142,236,222,129,119,233,39,
+  201,161,148,70,77,188,255,247,161,199,124,76,95,197,147,143,73,43,221,240,37,
+  155,39,58,86,114,104,106,50,101,195,189,192,209,121,122,80,121,224,140,232,
+  172,173,194,211,175,35,143,103,232,172,13,130,247,183,112,25,215,70,102,128,
+  236,87,153,186,103,0,79,111,73,133,59,202,20,210,47,239,235,131,254,102,232,
+  176,200,230,60,67,58,60,231,170,178,114,41,118,48,200,134,34,73,203,180,56,
+  148,152,29,242,171,147,152,98,109,4,92,247,88,218,133,189,201,49,209,164,63,
+  73,222,8,72,172,151,64,135,131,169,77,119,249,180,104,114,3,111,147,126,182,
+  182,242,177,139,121,58,166,176,102,192,146,85,247,214,77,51,40,227,3,132,180,
+  250,231,4,67,15,52,223,199,223,48,92,114,76,202,64,5,125,8,70,197,91,143,109,
+  124,4,85,115,211,134,204,184,94,170,157,170,134,192,90,229,69,135,39,40,78,
+  210,124,46,236,141,64,115,242,125,47,157,228,11,84,33,51,237,81,117,155,162,
+  63,40,49,71,123,169,254,80,43,55,158,6,74,26,20,13,31,216,69,142,5,126,143,
+  186,161,168,150,241,231,162,252,74,111,72,235,1,127,2,207,214,14,178,31,49,
+  228,83,242,113,211,52,26,225,2,207,103,97,35,108,48,239,129,73,137,246,150,
+  152,199,129,76,224,3,131,154,250,205,67,96,205,186,58,63,143,106,241,206,209,
+  212,216,57,111,158,102,47,218,250,205,154,105,180,180,38,34,105,142,243,34,
+  50,207,155,19,17,87,79,250,128,219,209,114,255,53,116,192,88,40,166,168,22,
+  144,161,115,50,74,69,142,61,221,141,232,3,47,236,176,13,46,54,209,226,26,44,
+  34,159,224,181,127,29,14,110,68,248,227,206,90,164,222,76,26,165,84,52,7,53,
+  239,160,188,128,175,4,115,158,0,206,216,100,233,97,250,8,14,159,69,144,52,
+  179,1,61,24,147,131,254,202,146,146,153,119,19,254,107,55,186,71,50,233,6,86,
+  1,48,120,94,251,76,155,250,184,234,96,80,156,129,54,246,4,52,138,205,149,73,
+  175,170,186,81,134,82,208,98,142,83,167,101,106,207,117,106,29,224,178,228,
+  223,82,121,75,0,231,14,48,196,144,11,228,132,140,145,127,90,247,120,168,174,
+  201,166,135,149,199,249,167,4,127,64,95,235,201,167,76,138,62,38,133,103,73,
+  11,152,217,154,157,248,92,199,55,86,154,171,179,54,131,226,109,86,20,239,55,
+  137,32,123,201,102,1,174,137,93,150,102,240,110,223,186,17,158,110,161,6,53,
+  175,121,35,153,129,207,153,136,189,139,116,69,181,137,191,88,201,173,28,150,
+  155,37,127,157,136,106,188,203,229,139,135,49,213,104,167,147,156,46,165,166,
+  125,42,6,43,72,11,142,245,211,168,54,231,33,88,161,48,226,59,37,80,207,246,
+  46,176,213,135,81,207,86,141,133,27,175,81,83,171,234,87,64,166,57,76,210,
+  187,164,60,217,154,215,37,184,179,81,207,226,226,17,182,54,208,224,79,151,
+  228,148,227,186,64,74,90,8,43,70,165,43,205,229,123,234,168,233,230,113,37,
+  75,75,168,110,197,72,80,247,126,94,92,238,62,32,16,244,188,1,121,163,246,30,
+  36,18,174,172,57,114,229,47,72,171,34,207,168,63,73,255,108,121,215,247,168,
+  62,229,138,111,195,86,108,213,173,69,181,234,98,126,238,251,235,22,179,84,
+  120,54,164,78,195,64,182,168,0,203,24,0,155,89,10,48,151,7,122,106,202,97,
+  182,186,247,227,134,47,175,171,49,226,238,36,146,215,229,47,66,133,251,133,
+  77,112,231,81,125,219,213,200,153,108,192,113,170,28,44,62,255,12,52,200,205,
+  225,122,246,246,224,32,106,132,173,55,171,128,241,54,40,7,216,16,161,254,192,
+  147,61,237,174,79,185,158,207,252,9,168,99,103,80,117,251,34,234,242,136,120,
+  218,251,243,131,236,61,123,120,14,114,183,84,42,49,151,195,106,136,134,235,2,
+  200,99,32,95,1,185,73,218,128,251,137,18,87,112,36,220,153,133,167,190,69,14,
+  103,211,250,104,80,89,55,11,175,212,107,52,62,216,191,118,35,52,172,165,152,
+  119,70,162,82,249,52,174,143,52,212,125,161,221,205,83,63,95,120,227,146,70,
+  248,83,253,225,243,173,157,204,88,215,91,124,154,134,155,62,37,139,205,24,
+  162,141,65,17,92,136,65,163,87,62,211,104,218,177,4,107,222,17,176,55,184,
+  137,235,147,224,22,208,9,255,114,169,245,60,195,112,201,210,77,186,84,120,
+  144,189,34,144,235,251,165,28,158,134,142,65,173,163,25,190,11,80,130,138,
+  152,12,26,227,254,73,80,255,0,84,24,129,111,96,134,65,118,158,78,208,208,193,
+  24,168,162,114,31,17,200,11,232,15,156,97,62,221,211,151,192,92,110,215,48,2,
+  176,123,186,38,126,15,232,238,199,224,61,98,194,222,0,28,20,95,77,182,89,8,
+  216,112,171,103,133,238,43,134,74,118,224,252,218,145,222,25,168,109,140,184,
+  102,178,233,46,144,34,2,102,240,117,231,121,74,123,23,163,94,112,63,141,92,
+  251,156,92,112,157,22,72,63,233,173,235,31,111,105,179,28,142,170,19,111,163,
+  184,170,64,230,33,15,138,255,236,10,70,85,189,234,157,241,192,48,88,198,129,
+  23,67,93,142,232,182,131,95,193,58,174,210,99,175,141,218,73,180,91,215,122,
+  115,12,183,102,40,100,209,154,213,239,33,1,72,8,221,159,192,172,28,62,143,
+  116,20,5,211,204,38,36,197,117,141,91,35,187,46,107,214,124,21,120,22,145,88,
+  97,168,130,251,4,115,132,128,103,91,63,68,185,194,193,172,199,200,140,62,174,
+  159,238,43,124,85,90,77,189,100,231,39,224,250,116,245,106,198,249,132,247,
+  175,121,211,180,67,72,239,158,229,69,69,69,148,195,61,103,234,130,227,235,
+  250,181,113,253,228,152,24,131,254,53,171,164,229,211,160,34,5,107,60,71,156,
+  167,173,7,133,167,251,104,104,151,218,44,156,35,152,158,154,124,244,93,27,97,
+  91,114,59,246,242,37,236,75,226,217,132,81,167,248,179,11,184,44,120,87,167,
+  137,156,113,53,207,151,15,209,123,52,162,63,3,222,104,197,219,128,131,58,181,
+  241,91,23,168,67,194,86,172,29,87,172,50,216,202,7,72,107,96,44,179,210,194,
+  94,31,57,35,63,9,77,103,91,23,67,85,204,230,164,96,226,36,167,76,100,185,14,
+  10,3,126,21,219,50,138,77,217,174,216,245,128,205,206,3,17,157,38,87,179,67,
+  78,193,202,60,94,120,191,81,114,234,54,29,68,14,105,26,73,30,79,156,58,226,
+  23,222,135,69,70,234,97,186,229,73,253,104,11,211,216,54,231,32,142,153,128,
+  183,216,8,187,18,14,253,134,36,216,191,0,165,194,214,139,184,132,207,48,197,
+  115,166,235,250,97,228,240,204,231,63,195,54,6,7,160,129,31,119,3,69,65,232,
+  200,255,218,149,1,216,127,197,170,247,113,58,55,232,253,135,160,2,37,72,240,
+  124,8,87,116,169,128,100,225,146,242,211,130,48,255,76,239,93,23,36,159,208,
+  153,163,246,179,183,231,12,233,5,177,50,193,12,226,62,145,171,235,29,15,235,
+  191,81,4,233,86,231,247,26,157,223,184,139,228,83,152,94,89,202,50,145,102,
+  235,97,176,75,45,224,86,123,203,181,214,139,85,57,80,153,165,3,236,20,5,57,
+  131,54,56,90,254,37,242,46,9,31,19,75,73,252,8,100,29,57,65,146,120,202,89,
+  187,124,246,91,250,188,50,149,244,107,186,200,113,224,33,61,30,20,67,122,145,
+  135,254,207,192,20,55,37,49,167,135,157,207,66,127,171,193,117,214,36,149,
+  235,65,206,133,45,35,53,184,131,237,185,206,47,8,119,10,50,6,156,130,92,9,
+  253,208,235,157,2,250,140,79,60,15,116,136,0,217,132,78,193,53,116,10,4,183,
+  22,101,244,218,149,170,149,82,146,222,218,184,113,25,250,253,130,123,47,122,
+  170,93,48,30,180,218,253,228,2,122,13,89,114,22,78,99,150,234,53,36,161,215,
+  144,141,235,227,4,155,41,254,91,181,26,102,57,137,57,14,243,228,135,239,64,
+  231,32,30,125,59,197,190,97,23,98,58,244,151,170,116,112,129,244,179,14,166,
+  83,63,203,64,225,238,24,128,163,199,38,192,181,192,204,223,11,109,246,14,97,
+  5,212,215,56,205,220,144,121,114,236,207,169,75,140,88,3,59,104,201,152,159,
+  227,48,40,177,104,98,200,164,32,165,16,77,53,238,180,53,45,64,166,127,28,22,
+  162,79,115,28,124,240,55,191,87,144,189,58,33,212,189,234,159,217,16,71,205,
+  31,213,121,64,223,12,231,66,241,207,96,26,112,58,232,44,36,253,176,131,70,
+  167,1,68,208,156,37,203,103,111,116,208,238,12,115,208,38,95,85,57,145,37,
+  199,76,80,221,43,38,223,33,7,44,226,123,197,1,235,55,135,90,128,252,52,165,
+  48,198,228,226,122,196,243,155,116,61,172,149,220,230,45,8,189,203,252,59,
+  140,90,97,132,92,122,195,188,141,61,171,48,173,216,142,81,238,58,22,174,65,
+  115,252,41,213,44,156,75,142,119,245,106,133,167,154,224,118,15,165,223,109,
+  118,99,150,102,54,82,11,236,54,215,176,163,94,38,12,136,41,207,151,99,149,
+  124,226,85,140,136,193,69,60,141,85,39,40,79,70,38,3,167,18,55,143,84,228,1,
+  92,16,55,146,228,173,210,84,247,77,112,174,65,99,161,226,64,210,84,188,184,
+  241,217,60,71,3,251,231,107,225,199,229,220,7,196,60,239,180,206,20,97,239,
+  241,196,133,171,31,113,245,71,172,137,114,93,182,10,91,55,68,82,179,26,179,
+  27,143,232,201,69,192,113,114,109,179,16,168,149,191,2,106,246,160,159,188,
+  67,35,184,39,226,126,243,167,240,75,216,91,135,173,229,169,208,16,186,113,31,
+  32,215,4,207,10,38,28,9,174,125,37,161,120,24,141,35,4,205,158,182,95,211,
+  168,61,61,236,84,253,96,137,51,42,5,239,34,216,12,153,246,160,75,225,106,70,
+  67,111,218,60,146,78,6,22,187,154,77,88,210,13,137,23,60,247,105,233,227,37,
+  111,158,174,195,206,181,39,154,113,183,71,58,228,126,216,87,111,30,137,39,40,
+  59,175,253,16,216,55,154,31,4,251,235,37,21,236,207,63,8,246,251,31,6,139,
+  185,170,130,85,12,6,3,241,54,17,185,187,30,76,43,74,125,123,172,107,191,254,
+  184,175,125,189,217,65,3,181,19,56,59,122,127,84,59,165,70,82,145,152,79,14,
+  110,250,10,131,176,226,208,234,15,170,97,150,77,106,72,151,181,141,196,182,
+  135,64,58,201,7,155,190,196,184,105,145,231,72,17,52,155,239,28,6,253,58,134,
+  39,155,179,197,225,222,39,52,62,144,26,160,96,62,170,241,108,115,44,234,179,
+  18,199,117,191,228,83,223,51,186,77,254,61,48,130,14,206,181,95,215,145,109,
+  182,221,64,219,27,48,19,69,176,236,82,200,231,155,78,15,34,14,152,209,17,99,
+  150,31,253,41,149,122,133,188,165,67,232,4,218,96,244,201,228,56,120,142,186,
+  162,58,63,122,80,201,117,157,186,77,95,4,135,2,182,77,5,230,148,160,80,4,82,
+  159,10,100,218,138,96,227,230,233,224,25,28,12,34,89,28,138,66,159,170,185,
+  130,3,72,51,199,102,128,31,178,120,30,208,176,56,11,184,180,56,3,112,47,206,
+  148,127,22,26,64,31,24,47,135,55,79,47,109,208,205,147,210,249,12,41,135,203,
+  244,231,93,83,10,237,58,7,88,106,72,156,195,127,19,20,206,195,194,116,29,180,
+  226,51,105,225,254,171,116,222,244,46,89,139,167,137,159,202,142,64,71,136,
+  195,248,223,22,158,30,127,113,237,231,179,228,30,240,24,129,154,137,164,158,
+  180,201,247,127,171,206,250,250,43,120,85,221,119,191,224,153,9,128,213,85,
+  154,4,193,147,10,87,174,70,237,230,145,84,142,85,193,246,63,173,180,93,1,108,
+  133,130,80,37,85,205,21,104,182,101,240,224,244,32,49,133,136,0,46,97,137,
+  205,228,217,165,86,28,142,89,132,224,254,18,121,101,160,11,107,63,79,160,23,
+  127,207,101,170,16,77,213,7,170,81,151,40,237,238,83,144,104,5,247,88,4,193,
+  13,59,120,229,192,243,165,104,71,179,205,5,74,23,183,42,93,64,199,211,120,58,
+  202,24,186,95,128,22,32,225,143,93,64,170,253,191,166,203,42,68,51,174,91,
+  255,222,203,42,205,208,221,54,109,168,187,141,200,66,3,82,151,109,94,10,173,
+  241,248,134,58,158,253,17,161,206,2,200,176,62,167,224,198,135,139,168,191,
+  219,216,116,167,153,69,232,187,92,118,4,84,46,143,185,204,230,8,28,46,89,171,
+  170,55,152,173,213,119,73,90,36,183,6,200,221,67,79,243,192,5,244,43,123,206,
+  83,162,63,235,31,208,168,56,126,104,74,227,64,123,148,135,213,75,177,189,74,
+  160,188,244,28,232,201,60,126,243,72,210,225,127,5,32,193,212,121,206,244,43,
+  172,253,72,139,172,5,156,7,208,135,235,215,8,79,94,197,72,38,227,136,127,87,
+  63,117,97,97,197,87,31,210,89,14,208,245,177,159,151,12,0,83,128,76,64,81,6,
+  58,28,187,215,98,71,107,206,168,3,155,74,187,113,166,162,226,168,254,80,167,
+  232,187,34,236,226,242,189,194,214,199,20,42,254,21,186,218,169,129,70,248,
+  48,253,86,160,199,32,105,208,158,126,142,71,74,249,106,44,240,38,39,181,16,
+  13,0,199,49,148,223,163,187,230,58,104,3,215,31,81,142,98,165,159,179,142,84,
+  197,122,181,143,150,30,96,165,26,165,244,116,31,229,54,181,100,120,216,28,40,
+  120,174,78,240,80,203,69,133,8,118,146,80,73,236,156,80,243,164,22,153,64,58,
+  212,167,208,254,215,0,120,192,112,220,243,13,157,135,92,196,200,214,212,43,
+  154,129,53,245,215,187,148,7,28,116,230,99,228,143,207,210,214,177,208,186,
+  186,239,231,130,27,195,185,131,37,46,173,15,153,15,34,134,49,205,1,113,100,
+  93,223,11,149,29,20,211,158,143,192,188,20,89,124,242,109,231,40,198,79,49,
+  100,227,224,65,201,73,28,10,62,78,189,127,19,46,124,117,29,213,224,58,250,75,
+  47,21,19,80,13,160,230,177,13,182,245,159,133,149,153,66,123,218,60,18,9,161,
+  19,222,208,203,36,139,99,66,23,11,180,104,21,155,234,127,181,151,17,233,153,
+  13,250,102,103,132,63,25,163,159,155,52,128,166,200,213,251,4,234,230,84,97,
+  235,120,16,233,162,77,201,230,20,206,224,31,5,215,225,171,78,30,194,196,119,
+  124,47,110,10,216,180,102,194,245,191,237,134,97,249,87,66,107,208,51,247,9,
+  30,52,112,160,103,194,104,163,76,186,19,135,113,253,242,243,63,123,37,108,
+  184,69,84,111,188,223,195,150,5,168,133,253,84,45,92,29,79,74,96,196,104,66,
+  255,173,17,251,202,132,30,112,255,178,148,212,209,6,125,227,81,162,253,199,
+  217,122,12,33,167,139,138,50,117,226,21,116,6,16,96,16,198,29,151,49,242,161,
+  54,223,140,245,216,250,154,50,240,61,135,241,232,82,155,92,74,87,188,255,206,
+  30,149,84,82,7,196,98,175,90,50,11,22,166,127,68,79,56,64,175,60,149,1,116,
+  119,7,131,224,202,24,123,192,63,12,147,112,255,35,87,7,214,191,63,7,110,106,
+  115,232,177,221,45,204,23,123,131,73,207,124,234,24,78,118,157,254,152,76,38,
+  189,174,206,161,174,94,94,120,106,231,16,234,168,204,127,222,198,101,101,121,
+  153,255,231,128,149,150,150,33,143,53,83,107,85,130,43,190,99,27,245,225,164,
+  109,180,129,55,205,16,220,244,21,176,0,141,244,65,142,235,122,136,108,49,63,
+  135,27,38,208,184,172,73,7,115,250,218,38,184,1,115,6,105,177,52,159,28,81,3,
+  151,113,45,247,252,2,38,242,100,100,45,220,180,243,230,147,35,126,247,60,190,
+  244,99,244,248,62,171,171,18,28,180,104,59,45,226,63,171,59,190,222,92,84,4,
+  52,20,237,210,163,64,21,28,7,46,183,131,181,135,188,232,248,249,14,255,231,
+  157,221,251,236,130,251,55,195,160,195,54,210,140,238,36,221,183,117,26,53,
+  109,208,126,61,168,224,216,49,107,38,192,8,240,32,201,68,228,64,71,178,121,
+  109,7,255,201,210,223,216,184,19,12,222,25,57,11,68,8,159,62,27,226,154,83,
+  133,154,173,195,152,7,170,30,61,65,119,27,213,80,206,48,26,100,193,134,147,
+  97,95,144,77,31,74,79,86,79,41,185,222,53,227,11,112,81,194,147,15,130,249,
+  111,114,211,59,252,161,91,147,28,75,59,29,217,14,54,50,168,222,165,84,227,
+  153,51,156,56,58,180,197,230,165,56,180,48,55,57,94,195,40,88,234,242,69,16,
+  230,87,131,94,145,182,152,49,66,152,33,39,141,131,218,231,104,95,64,204,10,
+  105,150,126,38,136,110,50,238,11,250,56,241,246,13,120,216,43,1,151,139,235,
+  180,78,20,112,51,66,163,191,113,248,26,72,130,27,20,85,49,125,112,228,6,29,
+  184,132,197,144,18,134,195,16,5,79,134,134,177,10,7,223,196,250,165,220,203,
+  54,59,60,62,80,186,14,216,38,102,11,91,31,29,201,248,243,62,237,163,83,232,
+  224,247,35,103,177,168,174,151,223,97,16,220,63,1,47,252,248,129,147,191,224,
+  160,24,26,20,189,31,129,72,214,118,44,54,235,36,76,34,216,187,197,244,37,16,
+  61,244,167,3,205,127,119,71,219,158,78,224,147,229,192,14,141,24,113,114,216,
+  140,105,174,122,221,225,94,231,5,181,29,8,155,155,205,36,30,21,160,71,237,
+  230,71,65,47,145,111,2,148,42,20,30,123,20,243,178,241,41,162,53,138,70,191,
+  204,158,110,97,235,211,2,136,229,136,93,208,20,74,98,231,204,192,221,48,82,4,
+  11,174,124,30,76,82,219,1,152,160,182,200,221,136,107,177,185,92,90,192,111,
+  10,112,156,45,2,118,172,11,192,67,126,20,101,237,120,219,132,119,177,30,7,
+  146,108,46,63,126,160,227,11,69,20,211,71,224,112,143,119,158,80,101,243,35,
+  29,165,212,1,184,144,153,139,61,190,181,232,226,196,142,20,182,46,140,100,
+  251,68,124,35,97,34,52,3,15,16,67,107,120,246,159,190,200,233,9,86,221,11,60,
+  154,236,105,175,186,19,133,206,218,91,165,37,189,184,173,2,154,39,199,213,
+  197,213,43,18,1,83,110,140,107,2,137,156,76,163,153,190,170,57,10,90,247,53,
+  160,214,211,93,117,159,3,118,253,37,230,236,28,121,250,120,42,41,243,23,44,2,
+  28,169,153,14,249,173,24,142,203,195,5,79,26,50,228,236,113,244,157,34,7,200,
+  15,98,138,235,18,60,219,135,83,137,91,169,145,123,110,163,160,139,177,50,205,
+  156,232,57,80,101,204,204,4,172,201,57,14,57,112,123,168,78,89,8,26,97,235,
+  52,24,159,165,29,219,82,79,4,61,224,209,81,116,19,48,217,203,15,219,19,67,69,
+  102,188,224,126,27,116,208,78,19,140,230,57,38,223,253,188,176,245,119,80,
+  230,157,126,5,131,89,154,122,77,157,58,80,188,109,34,184,175,134,33,3,5,209,
+  153,232,248,199,160,187,159,230,144,191,190,133,82,161,144,63,25,24,17,237,
+  192,42,27,254,154,239,144,247,223,50,48,130,18,16,156,115,130,231,118,228,
+  123,9,72,201,57,97,235,249,168,208,124,184,103,13,165,252,55,230,228,204,67,
+  73,207,149,9,131,157,207,112,167,226,249,130,242,17,116,48,169,202,250,208,
+  176,153,72,70,203,7,83,57,159,118,157,173,144,182,16,15,193,248,240,120,203,
+  196,135,243,222,211,176,93,126,90,22,211,180,247,140,1,200,198,249,11,113,
+  131,163,144,250,90,52,62,144,192,206,104,76,193,253,54,115,210,179,228,183,
+  198,82,111,66,98,10,38,74,118,142,129,245,191,3,241,105,93,157,26,216,89,36,
+  8,238,225,35,113,214,133,154,106,152,187,225,187,104,67,167,65,105,214,173,5,
+  247,116,249,112,118,214,225,20,115,83,19,192,213,56,206,46,99,172,130,123,
+  247,8,106,188,98,188,75,52,182,189,24,183,169,25,138,58,135,210,117,159,210,
+  61,178,192,39,222,7,121,50,228,183,32,27,172,48,118,209,192,90,58,28,178,142,
+  181,196,123,42,121,189,99,66,247,235,205,105,243,100,25,238,27,35,144,225,
+  147,129,180,102,142,214,218,136,22,116,219,187,84,90,196,40,229,146,140,83,
+  172,152,100,136,186,72,12,222,213,8,52,127,211,190,45,244,229,57,124,148,225,
+  54,111,167,209,121,41,214,117,213,84,165,167,193,38,141,111,186,117,255,198,
+  62,60,161,36,191,59,134,9,134,215,30,132,190,118,179,96,188,163,174,55,210,
+  213,104,36,23,240,224,84,204,19,192,191,122,158,104,92,117,188,181,181,242,
+  34,249,0,134,100,139,187,88,215,175,245,38,63,99,148,82,175,204,66,249,29,
+  138,126,157,204,131,55,121,14,229,42,116,42,209,70,51,54,118,152,237,179,184,
+  202,220,212,36,210,88,9,116,250,10,19,223,197,130,39,192,41,187,71,135,1,189,
+  94,79,47,13,209,56,228,99,163,25,107,25,129,77,24,118,227,230,173,212,72,187,
+  204,251,240,8,214,138,28,208,56,242,179,163,152,166,103,115,48,136,9,91,24,
+  156,6,35,69,185,43,35,192,86,35,92,214,138,12,132,91,248,227,112,106,127,8,
+  151,179,82,39,189,75,225,230,173,72,69,184,159,254,56,28,240,199,59,93,67,
+  166,25,234,58,35,209,35,20,222,67,70,225,99,132,174,241,176,152,225,194,31,0,
+  199,42,55,215,65,69,93,30,122,59,117,71,144,41,64,43,218,63,88,215,105,224,
+  95,192,142,35,174,142,110,233,96,175,240,37,122,123,76,133,68,10,79,159,82,
+  207,27,178,87,196,212,242,39,113,5,253,85,19,118,94,91,61,191,77,237,165,255,
+  120,47,245,220,98,85,115,196,204,45,26,113,17,244,74,152,87,1,148,205,15,91,
+  190,212,201,8,152,107,149,8,150,21,240,11,238,162,72,213,96,216,20,53,132,
+  186,28,141,227,113,95,219,197,112,187,13,131,95,154,137,38,228,3,48,33,222,
+  233,241,159,249,177,101,77,68,18,109,124,158,153,137,142,227,213,167,236,213,
+  223,217,156,191,239,104,235,104,179,116,251,207,160,203,202,150,179,165,27,
+  132,139,40,215,62,63,62,169,134,53,105,208,8,30,186,245,122,142,138,185,52,
+  157,183,89,221,84,160,132,173,219,176,28,108,4,200,179,49,41,5,116,247,100,
+  250,254,48,152,73,163,255,137,126,53,222,189,25,182,42,53,99,103,32,167,173,
+  204,120,10,238,195,96,178,179,240,241,39,211,65,214,232,112,221,153,10,67,79,
+  102,17,101,7,109,83,98,118,228,200,163,89,155,108,215,62,61,45,164,138,145,
+  139,30,80,140,219,40,238,36,194,114,127,63,16,144,147,163,40,185,212,155,216,
+  54,104,191,63,225,50,29,203,155,52,70,246,124,201,243,54,46,204,209,137,133,
+  154,93,116,187,97,160,59,53,133,229,184,207,195,64,138,25,31,221,188,54,148,
+  234,42,211,72,225,55,13,254,115,221,97,142,82,104,162,183,254,102,104,72,204,
+  92,125,35,21,151,1,218,163,156,65,50,251,223,86,224,144,63,129,39,67,87,239,
+  146,70,255,28,168,202,196,17,58,228,159,142,101,163,99,195,54,208,80,176,224,
+  174,194,13,90,125,12,112,5,13,246,100,205,39,154,79,53,199,20,243,5,59,1,35,
+  176,127,178,127,1,52,106,135,1,161,43,192,166,28,189,71,225,121,118,202,136,
+  174,144,88,255,140,239,233,206,27,157,74,99,28,58,176,137,72,69,207,113,124,
+  104,1,100,70,251,95,129,6,61,232,204,98,192,115,50,221,227,60,250,125,104,
+  137,128,149,117,48,47,194,132,83,22,45,108,249,56,130,42,183,232,184,70,44,
+  68,151,66,225,32,74,255,182,33,3,209,89,124,244,85,2,180,215,107,246,163,89,
+  5,178,39,51,59,47,140,9,77,168,127,93,15,219,241,163,171,228,63,209,141,59,
+  79,213,59,129,60,141,186,199,108,190,112,37,185,46,6,247,26,152,158,67,127,
+  59,153,82,91,135,187,226,245,131,150,89,96,2,19,42,170,43,125,163,153,224,41,
+  170,193,54,160,55,51,48,8,150,157,201,154,141,211,135,12,40,62,188,31,138,
+  126,155,105,10,99,249,198,55,213,222,112,55,133,230,242,222,200,144,97,91,
+  204,226,142,54,215,58,88,71,91,71,130,88,204,221,60,52,209,42,120,94,132,138,
+  41,64,24,61,9,19,75,13,157,13,223,23,65,61,71,26,146,26,57,139,63,178,15,245,
+  23,64,103,35,41,105,153,178,107,164,26,253,38,141,192,154,176,97,244,25,195,
+  215,15,30,217,29,163,214,102,59,228,118,99,184,247,16,155,170,244,99,166,251,
+  183,245,61,84,6,210,118,154,164,105,168,69,55,49,13,234,111,237,166,90,140,
+  250,35,24,6,238,104,59,238,67,221,213,54,194,7,107,230,70,13,198,169,26,236,
+  100,194,39,243,65,237,157,44,48,151,163,11,27,120,240,120,125,219,151,170,
+  246,161,94,41,134,234,20,65,80,149,26,30,9,251,21,143,110,52,170,186,147,7,
+  160,253,184,207,14,252,168,170,131,45,137,3,230,67,213,118,131,84,93,135,70,
+  241,135,157,79,130,142,59,142,154,111,96,17,8,238,252,72,170,160,98,169,172,
+  248,3,48,250,142,227,254,158,75,44,140,142,131,181,210,193,118,180,225,12,
+  106,196,145,172,93,3,182,131,194,217,155,35,18,173,206,91,166,192,184,157,
+  151,168,194,200,54,207,183,209,131,86,177,141,218,248,55,227,21,159,37,34,
+  201,95,219,131,250,7,159,235,230,50,19,148,60,48,73,254,59,7,86,145,86,216,
+  202,119,83,41,53,225,105,191,187,174,162,1,229,86,70,34,111,179,228,241,204,
+  4,46,94,184,64,241,229,170,244,170,16,108,13,94,161,83,55,159,118,73,14,54,
+  106,44,73,116,199,164,136,35,149,39,255,251,221,84,141,155,56,225,233,77,32,
+  80,194,150,191,3,84,219,8,186,131,64,214,30,96,155,133,72,193,189,253,10,213,
+  73,131,214,87,224,5,92,206,64,74,98,92,23,30,189,214,52,104,234,44,221,160,
+  233,19,169,126,24,3,32,153,153,10,101,5,163,6,198,55,227,59,224,23,110,78,64,
+  98,78,234,169,64,252,3,163,71,229,228,126,199,224,233,132,249,5,54,170,198,
+  176,69,188,79,145,141,52,243,218,144,41,204,254,97,217,240,248,156,59,59,218,
+  2,239,49,89,101,66,1,237,26,142,127,208,241,37,72,225,9,42,133,79,2,130,207,
+  206,128,160,177,205,146,56,180,163,205,223,114,49,24,156,93,61,37,94,236,79,
+  242,55,92,101,83,142,194,226,63,117,13,111,80,133,246,156,16,60,241,90,182,
+  173,162,27,79,182,243,59,126,192,127,238,2,108,164,125,159,213,209,141,153,
+  186,37,107,2,44,131,4,208,243,58,62,58,251,18,172,234,155,120,220,245,15,74,
+  47,74,63,219,174,98,184,23,131,127,113,178,106,113,103,241,94,135,70,209,239,
+  24,152,143,171,183,126,176,33,26,35,246,113,31,19,248,141,17,123,239,52,141,
+  106,171,148,125,156,255,153,254,1,153,198,7,50,3,106,232,35,141,162,159,156,
+  41,84,186,21,119,187,102,168,255,217,239,232,35,173,100,170,60,102,0,25,105,
+  57,242,31,12,108,90,23,60,76,21,162,67,214,15,165,251,180,249,3,10,145,238,
+  27,212,205,67,71,84,72,64,91,53,12,121,205,208,48,109,148,110,96,166,184,1,
+  247,128,214,108,115,178,243,153,128,148,147,3,190,166,104,78,203,149,255,56,
+  66,233,110,145,210,157,55,74,249,0,8,72,240,251,48,38,231,240,110,64,9,252,
+  219,201,2,194,54,215,99,56,40,60,37,75,71,51,183,250,33,152,63,24,143,127,31,
+  172,234,48,81,243,167,244,210,251,93,234,253,194,94,149,247,254,99,93,193,96,
+  92,83,152,42,243,103,194,98,177,1,22,101,15,226,95,115,137,122,202,56,6,105,
+  62,159,37,127,195,2,50,243,175,72,179,12,222,181,122,111,133,222,171,247,226,
+  11,88,117,126,237,165,63,45,92,176,82,227,144,143,176,181,234,207,6,177,34,
+  45,24,161,128,129,157,212,83,183,144,180,212,245,242,40,42,130,219,130,225,
+  14,22,118,160,18,69,99,15,195,81,108,79,14,155,129,75,65,137,65,248,233,130,
+  85,196,77,113,42,252,107,240,169,246,52,35,110,227,99,241,144,105,183,231,92,
+  149,109,128,157,115,245,215,177,243,65,93,136,157,91,95,82,158,214,162,166,
+  136,193,253,215,47,197,68,58,222,144,172,60,221,142,17,220,98,35,236,215,220,
+  244,11,11,7,217,163,156,152,144,197,98,112,130,231,239,80,209,56,212,58,195,
+  127,43,48,14,101,25,156,75,239,69,170,123,98,172,226,215,158,238,170,37,131,
+  225,252,158,171,33,202,79,247,34,229,254,105,248,124,111,58,45,177,208,177,
+  248,239,197,224,40,125,202,201,38,157,30,247,242,167,194,175,193,107,239,87,
+  231,169,42,84,136,190,3,49,103,24,129,23,71,4,247,237,72,54,158,5,87,207,51,
+  226,249,133,86,215,89,131,229,8,105,36,31,123,218,157,248,152,128,180,224,
+  163,116,122,190,97,207,53,12,200,31,16,253,212,247,208,210,55,229,180,212,
+  145,141,112,251,156,81,150,35,69,77,224,201,4,62,192,64,138,102,245,180,234,
+  245,102,61,39,62,86,147,108,30,145,145,177,82,147,187,82,75,31,174,175,196,8,
+  147,45,75,214,130,214,95,232,241,45,160,177,107,231,243,242,93,184,23,255,32,
+  216,196,221,133,234,213,195,246,147,102,208,88,55,89,124,52,82,177,57,162,
+  136,12,241,23,3,13,243,230,33,58,77,150,138,234,239,163,20,84,244,29,40,79,
+  10,30,201,248,75,81,45,245,232,152,22,142,119,200,191,87,26,137,59,92,65,205,
+  234,17,12,135,54,203,95,194,78,0,153,54,71,212,104,233,8,253,67,6,61,127,199,
+  200,120,34,244,19,15,10,36,1,223,219,178,109,167,239,136,209,147,96,47,186,
+  119,194,77,80,162,111,31,190,88,3,55,82,172,88,32,141,245,28,17,31,246,180,
+  139,168,116,39,3,183,125,206,49,129,57,181,146,64,234,53,31,104,26,201,88,43,
+  120,162,171,127,238,106,208,98,80,55,49,135,6,57,47,32,157,6,7,105,147,69,
+  118,154,194,227,219,248,209,20,104,88,57,12,224,135,52,13,165,123,217,125,49,
+  202,215,95,96,83,18,186,198,173,6,244,210,46,118,122,23,155,111,193,64,229,
+  45,192,66,195,117,253,53,56,104,71,196,31,234,104,120,168,163,163,129,63,21,
+  213,102,225,91,133,139,233,227,227,137,128,236,231,116,60,158,35,146,142,142,
+  82,226,196,73,136,26,3,6,103,249,12,71,38,105,83,143,82,200,245,244,212,67,
+  236,162,6,232,127,76,160,73,57,31,176,199,129,47,108,29,12,157,7,68,252,140,
+  71,24,175,141,102,188,3,244,226,29,10,94,60,125,113,75,86,70,38,224,77,128,
+  54,241,242,74,21,47,147,191,120,196,215,26,58,127,75,79,219,68,123,14,224,
+  131,104,222,57,170,104,83,127,144,91,147,88,51,138,110,77,93,251,162,129,28,
+  230,160,211,128,49,104,90,116,2,28,89,43,53,120,54,24,110,51,228,173,55,209,
+  111,255,232,208,237,134,41,59,40,255,9,20,37,147,64,250,37,36,68,17,246,126,
+  22,147,7,75,144,241,3,69,34,124,222,209,166,72,241,158,110,49,13,152,183,134,
+  133,186,196,89,150,96,224,22,133,31,224,35,52,85,63,30,228,68,187,171,81,107,
+  93,15,83,50,17,20,103,145,52,102,211,151,244,25,70,91,14,122,18,242,132,160,
+  58,43,135,92,31,7,67,7,142,26,232,51,137,248,193,247,115,155,56,85,44,66,133,
+  216,237,131,150,32,138,66,224,102,232,113,61,63,142,19,239,162,253,237,132,
+  142,127,168,203,157,33,65,248,56,32,205,13,72,64,244,83,97,242,64,55,120,226,
+  29,164,158,142,20,16,48,104,137,115,48,78,232,64,150,202,174,133,139,192,81,
+  250,126,93,232,252,103,1,244,178,84,114,24,44,190,41,25,6,225,233,241,48,65,
+  179,176,216,85,103,132,185,139,247,38,215,226,182,42,129,158,75,73,131,214,
+  248,44,106,49,228,226,51,70,87,131,81,202,174,53,166,224,251,23,61,232,96,97,
+  36,207,64,104,68,85,240,116,224,180,228,192,202,44,193,128,96,73,174,188,86,
+  171,26,217,154,183,153,190,198,160,98,194,52,240,205,96,160,150,160,186,93,
+  83,247,116,208,77,178,229,136,20,17,1,229,163,178,205,137,174,6,158,246,209,
+  74,234,200,113,12,105,90,218,165,116,14,52,34,120,118,150,246,184,186,113,
+  173,113,23,198,93,38,205,228,4,66,2,81,65,210,104,57,226,250,70,67,210,57,
+  215,126,222,186,216,28,83,249,186,114,220,11,198,240,132,17,212,232,189,222,
+  228,39,12,176,15,76,168,48,6,240,29,189,120,151,204,207,194,123,28,123,229,
+  16,73,7,58,85,6,116,75,129,218,120,50,155,6,121,213,147,122,184,188,72,242,
+  192,131,18,194,54,136,201,150,110,58,150,65,129,22,124,124,152,102,158,40,
+  252,165,185,167,192,28,27,129,175,209,25,111,66,1,133,129,153,241,145,92,11,
+  61,119,150,76,103,212,104,57,2,67,195,80,61,158,70,51,91,142,132,143,13,70,5,
+  236,198,85,65,26,113,108,195,48,8,135,39,24,75,96,120,191,67,50,41,185,162,
+  100,244,116,11,158,199,241,25,99,178,244,239,15,17,89,130,111,19,78,55,208,
+  115,200,18,190,125,155,122,197,235,184,66,87,108,107,39,153,197,147,233,72,
+  14,239,95,138,113,16,75,187,235,172,14,167,208,213,55,106,181,64,31,53,106,
+  142,36,121,167,27,172,205,171,187,105,220,117,29,52,35,209,46,31,79,215,234,
+  117,231,243,65,252,232,155,145,224,248,49,7,197,236,144,119,224,217,164,134,
+  205,67,208,178,29,175,1,187,37,26,201,69,101,125,78,219,60,93,51,221,237,171,
+  209,56,191,247,4,69,45,17,72,27,181,125,234,15,120,25,124,248,177,152,134,
+  218,218,27,250,75,99,253,193,150,81,154,103,32,141,113,159,58,239,246,242,
+  207,163,251,229,93,96,244,102,107,120,111,218,80,94,233,79,154,118,197,58,
+  253,138,211,224,58,195,187,252,188,181,181,226,60,213,231,13,227,186,23,185,
+  14,105,72,23,158,188,11,255,62,29,240,15,185,193,111,214,214,104,240,211,84,
+  97,244,146,230,134,34,250,62,2,79,26,95,92,138,239,224,246,106,197,114,252,
+  36,90,192,196,226,7,175,131,191,195,106,246,233,241,155,113,126,108,49,103,
+  254,162,135,27,178,64,35,174,192,26,249,105,61,51,145,78,199,191,149,111,183,
+  177,200,182,11,93,181,6,144,71,253,166,203,219,161,208,233,199,215,91,91,150,
+  66,243,245,127,1,183,49,18,33,181,44,52,224,229,87,227,97,3,126,127,57,253,
+  248,159,131,122,121,122,236,3,59,27,74,187,15,60,49,0,18,56,52,104,124,248,
+  109,183,149,17,140,20,30,96,23,0,212,34,49,10,223,168,164,250,127,128,168,
+  107,195,175,39,10,27,225,163,253,169,20,183,8,242,160,111,240,242,182,112,
+  114,14,15,167,228,208,154,191,41,253,161,3,97,0,221,102,182,248,228,247,80,
+  36,179,120,137,127,30,81,146,8,139,143,196,208,203,5,139,22,5,94,6,127,132,
+  190,218,57,248,253,26,139,15,37,76,126,2,65,99,222,198,198,128,236,78,252,28,
+  0,189,1,172,203,241,137,97,18,139,71,39,177,179,111,84,170,240,252,229,133,
+  247,169,220,159,150,70,216,240,139,138,205,94,227,123,183,162,163,124,38,226,
+  158,78,128,174,235,141,240,242,218,169,38,104,180,230,102,47,127,152,28,124,
+  153,182,171,228,201,227,186,192,203,116,108,159,80,211,38,191,21,165,236,29,
+  2,95,0,226,65,246,106,34,80,104,3,153,76,158,151,43,47,4,123,154,7,30,238,66,
+  193,29,133,71,172,182,76,130,223,150,115,184,58,30,6,215,253,110,229,224,158,
+  119,158,145,172,208,227,43,170,176,102,188,165,70,175,248,164,81,154,129,207,
+  151,240,16,119,172,55,249,41,35,211,220,19,9,46,103,208,220,168,142,48,138,2,
+  234,15,180,16,168,142,225,160,44,155,1,32,102,220,137,184,174,113,253,174,58,
+  30,84,42,220,82,181,122,8,42,204,160,125,160,53,13,237,131,110,2,45,3,74,7,
+  138,65,131,154,214,252,125,74,137,57,186,114,18,69,133,224,0,213,138,10,236,
+  56,180,81,128,81,45,33,44,133,129,214,107,142,224,1,77,233,241,43,158,160,
+  115,28,57,129,242,130,209,87,105,122,239,28,88,95,24,121,5,179,120,14,3,225,
+  168,252,64,5,161,19,164,190,69,133,75,132,163,159,135,195,225,195,64,154,108,
+  6,118,118,85,125,214,28,106,74,122,233,115,34,210,67,26,253,251,174,49,71,
+  113,16,191,245,52,194,87,98,54,3,209,129,186,203,145,146,131,151,108,6,155,
+  55,33,90,154,166,179,54,86,13,197,71,32,141,202,35,144,119,174,210,46,141,46,
+  31,30,202,52,160,229,106,175,186,195,226,163,242,46,25,205,54,230,96,163,250,
+  53,154,173,109,206,179,184,254,189,139,255,201,72,98,204,138,171,102,114,213,
+  27,93,95,143,199,47,231,148,152,117,222,245,46,163,184,0,159,225,190,135,182,
+  33,174,3,216,172,221,156,102,214,181,118,70,53,72,188,153,248,169,186,148,
+  110,1,148,173,1,194,155,173,199,214,124,70,162,65,106,53,41,128,140,71,161,
+  74,9,34,123,192,146,100,200,199,175,80,53,109,84,95,162,146,160,91,250,68,38,
+  2,13,101,12,66,159,13,249,123,108,252,137,248,16,135,238,6,171,12,210,124,
+  131,245,243,13,122,224,126,54,108,41,218,200,101,210,228,53,78,153,146,139,
+  58,222,40,188,224,147,114,177,67,234,167,107,90,28,242,235,44,110,99,38,245,
+  48,38,42,136,105,53,232,24,196,2,95,172,31,84,222,68,90,20,119,199,199,99,88,
+  117,205,5,218,77,137,57,219,187,126,175,209,181,223,232,93,252,59,35,108,252,
+  241,229,14,147,181,67,112,61,131,109,27,81,80,205,248,132,26,196,9,132,8,196,
+  160,8,150,3,218,193,120,245,104,43,62,133,86,79,212,168,150,182,168,86,26,
+  138,142,40,51,167,241,150,118,48,166,210,72,77,221,77,173,17,64,209,168,197,
+  32,252,96,41,93,77,236,205,80,124,127,37,214,213,136,86,114,34,184,90,49,107,
+  234,201,16,16,75,211,106,148,51,51,16,140,75,137,126,190,19,205,131,39,88,
+  245,83,224,118,180,84,113,5,252,197,155,2,163,217,124,79,239,5,81,69,103,63,
+  152,102,54,58,187,80,236,232,113,221,84,16,140,68,118,140,53,92,95,130,123,6,
+  138,125,245,101,229,248,151,195,168,72,45,76,86,67,216,254,197,114,142,250,
+  35,224,174,162,47,101,51,132,94,226,199,227,120,134,186,254,241,236,176,11,
+  78,9,158,118,1,25,65,25,67,122,34,80,218,112,252,102,51,120,19,6,244,38,26,
+  193,151,48,218,201,49,18,65,174,193,146,111,192,149,101,0,158,163,107,160,
+  223,248,81,84,143,120,39,237,13,24,60,101,173,110,195,29,120,161,184,67,6,
+  234,222,100,239,54,146,94,27,153,70,227,177,170,88,225,170,1,231,11,159,161,
+  56,228,63,245,211,227,238,54,210,112,69,154,131,33,4,87,227,160,16,194,195,
+  184,103,202,144,31,132,102,48,209,54,252,62,234,63,213,14,140,87,79,245,0,
+  176,158,180,185,58,35,156,21,228,243,186,160,86,76,146,126,209,249,103,208,
+  206,221,226,250,158,38,100,146,115,116,237,225,160,56,81,186,29,68,63,158,
+  124,198,10,197,179,14,71,110,14,125,127,154,76,52,147,6,249,120,31,117,140,
+  73,199,225,160,243,40,88,14,34,83,122,169,191,34,111,193,231,89,8,159,70,239,
+  201,103,242,99,125,248,6,164,196,123,140,191,181,113,153,43,57,71,142,188,
+  134,185,214,100,63,125,21,150,1,102,33,160,74,207,157,172,236,33,252,124,90,
+  62,253,238,106,110,174,252,214,21,6,213,64,134,48,145,15,108,67,179,251,43,
+  208,6,114,164,130,177,241,101,196,160,84,239,1,181,207,198,111,166,207,110,
+  29,6,239,10,163,119,125,173,129,92,147,198,11,239,53,184,186,198,227,126,149,
+  62,131,197,117,30,215,130,12,135,157,58,63,140,104,55,218,209,21,219,51,156,
+  61,0,105,171,57,236,93,111,142,110,149,71,208,51,68,224,147,91,124,214,239,
+  133,39,118,49,127,154,119,213,141,110,253,42,170,141,12,237,24,234,218,103,
+  14,19,75,245,112,183,245,106,69,54,34,116,201,195,177,79,241,225,61,216,43,
+  40,33,62,174,30,79,82,182,126,85,115,152,29,80,106,149,163,26,176,47,11,126,
+  253,50,198,122,126,77,30,182,106,45,0,153,73,51,235,163,154,195,251,128,245,
+  136,56,207,243,210,198,43,136,153,45,97,222,249,18,34,96,232,232,49,77,52,42,
+  160,28,6,0,165,148,43,173,178,127,58,125,89,30,174,174,239,33,176,109,240,
+  251,168,177,116,191,95,66,247,25,184,247,199,152,140,9,214,217,200,94,252,94,
+  34,125,60,208,128,91,180,141,184,162,217,121,43,152,141,58,217,40,14,65,42,
+  12,244,149,47,216,76,102,11,239,94,36,23,90,207,160,207,141,94,114,21,227,
+  188,158,204,51,186,46,107,200,146,232,113,237,174,6,173,199,71,150,24,156,73,
+  222,39,15,225,121,214,19,117,95,70,226,209,198,247,146,95,96,79,27,232,71,54,
+  12,3,219,59,225,221,131,160,181,151,24,155,102,208,149,238,253,149,137,62,88,
+  4,157,246,158,215,61,228,35,118,22,55,17,80,236,254,5,123,19,68,51,0,91,251,
+  14,13,135,159,136,187,208,250,37,57,140,164,68,29,38,115,141,64,99,192,191,
+  50,168,156,79,99,7,3,76,168,133,235,250,34,189,118,35,125,223,173,65,178,27,
+  172,117,27,74,189,162,7,223,204,50,123,147,189,6,215,233,241,94,7,47,184,55,
+  113,3,159,220,114,249,112,43,141,223,211,137,235,199,183,102,165,108,175,145,
+  244,181,158,177,54,174,190,19,230,79,111,150,52,138,45,170,71,91,52,138,244,
+  73,6,116,222,27,240,155,77,216,108,77,59,25,229,57,226,188,159,174,103,210,
+  198,36,181,174,87,75,236,248,149,173,161,77,118,35,219,238,178,175,53,12,152,
+  34,235,167,107,46,6,62,134,139,192,7,3,254,15,184,227,139,205,122,75,55,152,
+  70,111,150,209,155,230,50,130,17,185,69,74,66,79,32,42,48,166,86,2,238,59,
+  111,6,20,174,70,147,245,240,154,46,244,190,27,160,90,120,215,167,105,164,55,
+  131,253,251,224,132,106,250,253,149,224,132,29,74,94,171,228,205,74,190,69,
+  201,127,167,228,31,42,121,139,146,191,169,228,109,74,190,79,201,119,43,249,
+  187,52,183,248,26,224,122,151,82,118,82,201,125,74,126,84,201,183,41,121,182,
+  146,235,148,220,172,228,19,149,124,133,146,27,148,60,90,201,141,74,238,80,
+  242,52,37,79,85,242,165,74,30,163,228,139,149,92,175,228,156,146,219,148,188,
+  235,45,150,127,167,228,103,149,220,164,212,199,42,121,175,82,46,43,121,178,
+  82,62,89,201,11,148,124,190,146,39,40,121,188,146,243,74,126,69,129,79,84,
+  121,167,220,251,148,124,151,146,239,83,242,55,149,252,67,37,127,67,201,119,
+  40,121,139,146,239,86,242,163,74,126,82,201,155,149,188,141,230,25,94,144,
+  227,169,248,245,255,138,209,155,252,152,187,162,184,123,48,167,133,107,2,113,
+  117,80,64,58,201,135,176,199,182,241,142,6,246,189,33,37,162,152,163,147,54,
+  24,165,60,3,236,200,15,75,78,61,184,172,70,235,165,213,15,144,139,61,151,112,
+  189,182,44,178,28,65,249,182,246,172,121,80,120,239,152,235,226,120,146,115,
+  202,105,179,54,8,79,237,193,101,125,124,220,53,108,118,145,52,211,101,128,31,
+  30,161,70,196,114,164,231,18,152,140,46,154,55,247,92,10,236,100,216,200,69,
+  186,254,55,167,159,146,114,78,181,158,38,27,58,223,167,206,225,49,114,2,87,
+  167,148,222,25,245,1,84,182,126,69,242,78,146,62,114,137,228,116,182,6,160,
+  128,212,183,126,131,13,162,46,226,77,35,80,123,162,199,217,73,90,91,191,233,
+  41,60,9,251,213,88,107,99,133,9,170,226,26,199,181,182,158,7,255,174,15,246,
+  240,39,160,0,186,141,234,106,61,67,169,179,182,58,79,222,109,63,121,107,78,
+  103,224,168,181,71,120,226,65,12,177,78,165,250,38,244,113,68,59,126,225,2,
+  249,145,115,10,217,225,115,38,88,47,173,89,122,221,184,164,13,167,72,23,184,
+  225,244,174,145,244,194,239,38,224,65,111,232,253,30,107,215,154,24,225,189,
+  22,202,174,163,78,235,148,188,83,194,147,248,126,146,181,75,120,130,126,159,
+  157,110,82,38,146,94,114,145,185,242,199,240,14,48,88,186,7,225,34,77,212,96,
+  73,246,163,155,211,143,162,65,108,61,93,115,24,76,85,47,220,226,199,50,240,
+  150,216,41,139,142,74,246,83,173,223,192,237,9,168,7,157,65,217,67,26,123,78,
+  3,119,226,129,96,104,209,122,218,218,84,9,187,123,209,68,122,44,221,244,83,
+  67,138,189,177,116,211,253,159,127,133,18,111,6,106,188,85,65,75,119,136,192,
+  235,226,11,236,187,111,242,243,47,193,142,146,55,119,222,12,219,228,190,23,
+  130,193,3,106,59,60,156,218,85,198,62,48,134,215,255,245,23,18,254,115,255,
+  76,251,181,141,235,25,107,227,236,144,191,124,155,141,155,9,249,136,219,6,
+  254,250,11,149,1,184,53,149,219,232,223,132,193,111,100,249,30,98,207,248,
+  232,223,106,217,110,251,47,38,254,127,252,83,82,252,200,242,101,43,151,84,78,
+  42,40,41,225,150,204,90,189,36,179,112,121,113,165,88,88,145,84,146,95,89,89,
+  72,255,86,204,36,174,176,162,162,172,226,151,38,103,105,254,35,37,133,38,177,
+  204,148,95,82,82,182,44,95,44,52,61,226,44,42,42,172,48,21,149,85,152,150,
+  149,173,90,149,95,90,48,140,181,54,205,92,94,90,86,81,92,186,28,160,30,45,45,
+  91,83,170,214,155,98,39,84,198,133,26,149,46,43,171,168,40,92,38,226,223,8,
+  202,175,52,45,171,40,44,40,44,21,139,243,75,42,213,38,73,236,207,8,165,149,
+  45,47,43,205,169,44,172,0,240,137,244,127,156,105,66,193,117,141,230,150,23,
+  150,58,42,202,150,21,86,86,102,151,61,90,88,122,99,139,153,171,202,11,43,42,
+  203,74,129,246,57,249,171,10,11,28,197,229,133,73,37,197,208,231,15,99,203,
+  94,81,81,152,95,240,35,200,146,157,229,37,197,148,13,63,210,32,179,112,117,
+  97,133,152,93,150,85,88,82,68,107,23,47,158,180,184,28,186,92,156,191,162,
+  112,109,225,178,37,149,98,65,113,233,132,248,201,243,7,195,1,27,16,107,113,
+  169,9,27,35,195,38,154,88,131,248,181,216,250,7,17,149,57,197,31,197,4,117,
+  255,17,84,208,224,71,81,65,217,15,163,90,59,140,3,208,37,197,101,75,176,9,
+  195,173,32,40,43,45,133,57,14,49,60,182,188,184,52,238,199,43,129,216,127,80,
+  11,229,80,91,81,40,58,43,74,151,44,43,43,40,28,220,21,18,137,82,87,206,196,
+  32,86,149,19,152,136,202,226,178,82,74,106,66,168,121,142,34,155,249,21,203,
+  157,171,80,8,194,133,51,39,92,112,85,185,189,142,91,28,200,45,87,89,40,114,
+  203,33,41,125,224,154,73,7,61,74,69,26,174,23,195,117,241,170,242,18,16,134,
+  18,172,91,1,247,149,235,96,145,173,226,184,181,112,189,166,184,20,80,85,174,
+  94,134,239,67,195,253,129,159,14,232,84,71,230,204,57,217,41,75,236,243,29,
+  115,231,216,231,100,47,73,158,57,99,102,118,22,199,197,114,165,156,147,43,
+  129,127,113,208,42,182,212,89,82,18,199,205,201,159,195,205,44,165,127,29,
+  234,55,54,27,119,232,151,44,37,41,215,163,167,13,148,169,169,13,234,234,149,
+  250,55,32,239,126,136,93,159,124,232,198,182,255,209,52,46,145,229,47,41,184,
+  190,156,98,227,94,135,36,78,97,247,252,131,3,109,51,167,252,56,158,79,167,
+  222,88,166,249,31,160,111,164,210,255,74,104,75,160,175,99,208,199,118,72,
+  197,144,226,31,100,101,49,10,13,137,74,255,233,15,50,220,195,195,248,215,8,
+  253,159,123,112,112,159,234,53,150,227,15,176,189,184,180,88,92,71,231,32,30,
+  244,234,108,27,247,194,44,150,78,194,245,43,144,206,206,97,233,75,72,109,144,
+  182,67,90,58,7,225,125,15,229,39,149,45,123,245,169,35,15,253,181,121,169,20,
+  187,185,241,161,203,235,94,112,140,74,110,125,136,239,223,240,135,49,247,60,
+  151,120,223,194,25,57,120,207,113,213,144,76,211,192,242,2,32,53,190,15,253,
+  227,63,210,214,249,192,186,134,105,73,99,75,35,223,126,123,247,175,83,190,
+  239,123,200,31,49,119,114,250,125,183,197,247,165,174,121,98,97,226,251,149,
+  27,59,230,142,118,254,24,248,187,164,237,183,59,143,108,75,252,249,171,59,62,
+  249,89,247,76,235,212,87,191,75,190,42,252,233,190,63,252,118,203,199,186,61,
+  139,38,36,149,189,81,16,59,164,121,216,63,182,50,93,10,141,102,69,176,23,176,
+  220,246,52,203,107,26,88,190,178,151,230,213,238,73,211,48,111,185,121,25,
+  205,221,199,126,75,243,194,143,62,194,220,180,100,187,118,58,134,187,86,167,
+  62,128,249,75,207,221,178,10,114,219,215,219,226,95,130,188,246,246,125,239,
+  126,10,121,194,29,223,63,170,79,82,199,207,109,111,243,204,75,88,157,196,53,
+  207,89,190,170,238,245,36,110,234,51,75,79,205,255,34,201,182,229,237,181,
+  183,253,101,116,178,227,219,47,63,61,117,203,236,228,103,63,73,31,242,113,87,
+  117,50,126,227,122,28,164,13,255,201,237,255,138,55,7,174,245,187,57,110,199,
+  91,144,194,202,182,239,198,47,209,0,55,223,26,40,219,5,101,226,78,224,120,88,
+  153,233,29,152,183,157,63,222,207,41,172,251,43,199,69,67,154,8,105,22,164,
+  149,144,214,66,218,2,233,143,144,222,133,244,33,164,78,72,87,32,25,118,133,
+  253,189,60,184,78,132,228,128,180,20,146,8,201,13,105,27,164,157,144,62,128,
+  212,6,233,44,194,188,205,113,99,32,221,5,201,6,201,1,169,0,210,99,144,182,64,
+  218,1,105,47,164,35,144,206,64,234,133,52,242,111,28,119,11,164,88,72,54,72,
+  15,67,42,130,244,24,164,231,32,189,246,183,1,90,254,22,118,237,131,235,22,72,
+  157,144,186,176,252,239,128,11,146,9,210,93,144,18,32,37,66,74,129,148,9,105,
+  49,164,2,72,37,144,68,72,85,144,182,64,250,13,164,237,144,94,131,180,11,210,
+  94,72,205,127,255,47,254,253,239,224,223,45,220,52,197,93,157,86,90,48,19,
+  180,52,184,151,197,143,21,102,21,23,112,92,46,71,61,134,66,197,107,156,86,
+  137,46,38,104,153,45,92,200,185,163,190,157,125,45,199,93,230,126,220,123,
+  228,184,107,92,24,234,194,101,206,10,176,6,201,133,149,203,42,138,203,197,
+  178,10,88,93,154,144,11,11,248,11,53,215,251,170,48,159,154,235,60,78,238,29,
+  141,234,142,103,21,86,172,46,94,86,152,36,86,148,164,130,19,93,130,72,26,52,
+  225,254,37,190,32,148,85,40,218,75,197,138,226,194,202,153,165,211,150,149,
+  64,63,159,96,217,141,228,36,231,47,43,225,62,103,117,20,113,150,152,47,58,
+  193,89,249,90,3,87,21,98,88,119,201,197,149,229,249,226,178,21,216,227,29,92,
+  82,73,89,101,33,163,0,246,5,215,123,103,248,153,108,198,79,251,106,96,10,244,
+  159,169,220,135,154,64,217,34,165,140,141,148,227,30,229,146,11,75,10,197,
+  194,36,160,17,56,94,2,228,138,232,70,173,230,160,239,101,215,119,81,197,193,
+  16,97,127,114,93,99,110,27,103,95,91,44,42,28,229,62,228,82,74,156,149,43,82,
+  138,75,10,167,211,45,10,140,237,86,205,140,66,49,201,9,251,141,210,80,187,
+  152,27,203,102,22,112,183,133,149,170,84,222,135,101,216,69,18,248,156,42,56,
+  103,199,210,180,252,74,209,142,46,35,199,101,224,125,122,89,129,179,68,225,
+  18,140,119,41,150,205,133,153,42,201,47,47,47,44,200,44,172,116,150,136,92,9,
+  150,34,158,105,5,5,21,20,215,89,205,128,4,93,63,188,11,80,7,163,6,49,126,180,
+  176,192,190,118,217,138,252,210,229,192,110,237,204,202,228,233,73,89,105,64,
+  225,244,117,192,117,144,210,225,90,184,91,125,3,2,238,102,109,26,172,129,18,
+  186,20,56,46,94,155,14,68,20,35,80,118,217,188,226,130,194,164,21,249,21,220,
+  10,109,38,96,66,166,193,202,130,107,112,108,233,68,114,92,163,22,100,133,141,
+  8,92,157,178,138,85,249,12,235,87,88,158,83,186,130,214,32,97,133,229,88,1,
+  40,128,90,238,91,109,86,73,97,97,57,215,163,205,46,172,88,85,92,58,176,208,
+  64,83,68,204,203,47,22,83,202,42,40,33,224,29,207,125,100,37,208,10,53,147,
+  34,84,130,178,203,66,84,114,83,34,230,193,144,10,41,113,14,14,118,41,21,5,
+  206,114,238,1,110,201,18,112,189,87,229,3,242,138,229,149,220,84,184,47,89,
+  70,247,5,229,249,192,161,105,112,191,234,145,37,32,255,75,86,229,3,119,210,
+  225,190,124,201,146,194,210,213,197,21,72,255,92,118,95,132,127,151,150,227,
+  150,193,29,140,121,9,204,211,18,113,29,202,243,175,185,37,203,10,97,210,65,
+  107,113,184,175,41,45,227,184,97,26,216,228,60,194,113,27,53,75,202,74,105,
+  229,107,26,4,99,56,230,104,97,148,20,194,1,87,101,197,160,171,180,69,229,78,
+  113,25,247,43,109,81,69,33,180,216,160,5,138,129,2,142,123,65,139,122,169,
+  164,16,132,28,238,94,209,174,202,103,179,83,175,173,44,94,94,154,15,187,133,
+  253,218,202,114,216,69,139,69,220,7,90,24,242,178,21,32,99,135,241,170,4,53,
+  70,27,94,193,127,142,235,211,174,89,86,73,203,148,191,215,250,63,145,166,37,
+  231,78,115,204,252,249,125,147,146,211,232,251,9,198,55,255,223,167,217,246,
+  204,57,246,52,160,9,227,19,184,211,129,178,85,176,85,170,16,89,73,226,155,
+  255,103,83,120,95,255,25,127,254,59,204,104,3,57,
 };
@@ -1,767 +1,385 @@
 unsigned int winexesvc64_exe_len = 19456;
-unsigned char winexesvc64_exe[] = {
-  77,90,144,0,3,0,0,0,4,0,0,0,255,255,0,0,184,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,14,31,186,14,
-  0,180,9,205,33,184,1,76,205,33,84,104,105,115,32,112,114,111,103,114,97,109,
-  32,99,97,110,110,111,116,32,98,101,32,114,117,110,32,105,110,32,68,79,83,32,
-  109,111,100,101,46,13,13,10,36,0,0,0,0,0,0,0,80,69,0,0,100,134,7,0,82,55,249,
-  77,0,0,0,0,0,0,0,0,240,0,47,2,11,2,2,56,0,46,0,0,0,26,0,0,0,12,0,0,48,21,0,0,
-  0,16,0,0,0,0,64,0,0,0,0,0,0,16,0,0,0,2,0,0,4,0,0,0,0,0,0,0,5,0,2,0,0,0,0,0,0,
-  160,0,0,0,4,0,0,28,163,0,0,3,0,0,0,0,0,32,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,16,
-  0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,244,13,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,46,116,101,120,116,0,0,0,160,44,0,0,0,16,0,0,0,46,0,0,0,4,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,32,0,80,96,46,100,97,116,97,0,0,0,240,0,0,0,0,64,0,0,0,2,0,0,0,
-  50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,80,192,46,114,100,97,116,97,0,0,240,5,0,
-  0,0,80,0,0,0,6,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,80,64,46,98,115,115,
-  0,0,0,0,112,10,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,96,
-  192,46,105,100,97,116,97,0,0,244,13,0,0,0,112,0,0,0,14,0,0,0,58,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,64,0,48,192,46,67,82,84,0,0,0,0,104,0,0,0,0,128,0,0,0,2,0,0,
-  0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,64,192,46,116,108,115,0,0,0,0,72,0,0,0,
-  0,144,0,0,0,2,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,96,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,72,131,236,8,72,131,196,8,195,15,31,128,0,0,0,0,72,131,236,56,139,5,54,
-  80,0,0,68,139,13,63,80,0,0,76,141,5,248,79,0,0,72,141,21,233,79,0,0,72,141,
-  13,222,79,0,0,137,5,244,79,0,0,72,141,5,237,79,0,0,72,137,68,36,32,232,123,
-  41,0,0,137,5,213,79,0,0,72,131,196,56,195,15,31,132,0,0,0,0,0,72,131,236,40,
-  102,129,61,147,239,255,255,77,90,199,5,253,79,0,0,1,0,0,0,199,5,247,79,0,0,1,
-  0,0,0,199,5,241,79,0,0,1,0,0,0,199,5,235,79,0,0,1,0,0,0,116,121,49,192,139,
-  13,241,79,0,0,137,5,135,79,0,0,133,201,116,87,185,2,0,0,0,232,29,41,0,0,72,
-  199,193,255,255,255,255,232,145,23,0,0,139,21,219,79,0,0,72,137,5,68,89,0,0,
-  72,137,5,77,89,0,0,72,139,5,178,100,0,0,137,16,232,79,25,0,0,139,21,25,79,0,
-  0,133,210,116,10,139,5,191,79,0,0,133,192,116,123,49,192,72,131,196,40,195,
-  15,31,64,0,185,1,0,0,0,232,198,40,0,0,235,167,15,31,64,0,72,99,21,37,239,255,
-  255,72,141,5,226,238,255,255,72,141,4,2,129,56,80,69,0,0,15,133,105,255,255,
-  255,15,183,80,24,72,141,72,24,102,129,250,11,1,116,83,102,129,250,11,2,15,
-  133,79,255,255,255,131,184,132,0,0,0,14,15,134,66,255,255,255,68,139,128,248,
-  0,0,0,69,133,192,15,149,192,15,182,192,233,47,255,255,255,102,15,31,68,0,0,
-  72,141,13,185,23,0,0,255,21,239,99,0,0,199,5,41,79,0,0,1,0,0,0,49,192,72,131,
-  196,40,195,102,144,131,121,92,14,15,134,253,254,255,255,49,192,131,185,208,0,
-  0,0,0,15,149,192,233,238,254,255,255,15,31,68,0,0,65,85,49,192,185,13,0,0,0,
-  65,84,85,87,86,83,72,129,236,152,0,0,0,68,139,37,195,78,0,0,72,141,84,36,32,
-  69,133,228,72,137,215,243,72,171,15,133,209,2,0,0,101,72,139,4,37,48,0,0,0,
-  72,139,88,8,49,192,240,72,15,177,29,55,88,0,0,72,133,192,116,53,72,57,195,15,
-  132,89,2,0,0,72,139,61,214,98,0,0,49,246,235,9,72,57,195,15,132,69,2,0,0,185,
-  232,3,0,0,255,215,72,137,240,240,72,15,177,29,2,88,0,0,72,133,192,117,223,
-  139,5,7,88,0,0,49,219,131,248,1,15,132,48,2,0,0,139,5,246,87,0,0,133,192,15,
-  132,110,2,0,0,199,5,168,77,0,0,1,0,0,0,139,5,222,87,0,0,131,248,1,15,132,37,
-  2,0,0,133,219,117,10,49,192,240,72,135,5,183,87,0,0,72,139,5,0,46,0,0,72,133,
-  192,116,12,69,49,192,186,2,0,0,0,49,201,255,208,232,218,24,0,0,72,141,13,211,
-  2,0,0,255,21,57,98,0,0,72,137,5,94,77,0,0,232,1,29,0,0,72,141,13,74,61,0,0,
-  72,139,29,143,97,0,0,255,211,72,133,192,15,132,26,2,0,0,72,141,21,89,61,0,0,
-  72,137,193,255,21,132,97,0,0,72,133,192,116,9,72,141,13,28,253,255,255,255,
-  208,232,245,31,0,0,68,139,29,158,77,0,0,69,133,219,116,116,72,139,5,118,98,0,
-  0,49,201,72,139,0,235,17,132,210,15,149,194,132,201,116,46,132,210,116,42,72,
-  131,192,1,15,182,16,128,250,32,126,231,137,203,131,243,1,128,250,34,15,68,
-  203,235,231,15,31,68,0,0,72,131,192,1,15,182,16,128,250,32,127,4,132,210,117,
-  240,246,68,36,92,1,72,141,21,180,236,255,255,72,137,5,61,86,0,0,184,10,0,0,0,
-  72,137,21,81,86,0,0,15,133,235,0,0,0,137,5,53,86,0,0,139,45,163,76,0,0,49,
-  219,49,246,141,77,1,72,99,201,72,193,225,3,232,92,38,0,0,73,137,196,49,192,
-  133,237,72,139,61,134,76,0,0,126,65,72,139,12,31,131,198,1,232,56,38,0,0,68,
-  141,104,1,77,99,237,76,137,233,232,49,38,0,0,73,137,4,28,72,139,20,31,77,137,
-  232,72,137,193,72,131,195,8,232,34,38,0,0,57,245,127,202,72,99,237,72,141,4,
-  237,0,0,0,0,72,139,21,68,76,0,0,73,199,4,4,0,0,0,0,72,139,5,97,97,0,0,76,137,
-  37,38,76,0,0,139,13,28,76,0,0,72,137,16,76,139,5,30,76,0,0,72,139,21,15,76,0,
-  0,232,98,17,0,0,68,139,21,23,76,0,0,137,5,245,75,0,0,69,133,210,15,132,255,0,
-  0,0,68,139,13,217,75,0,0,69,133,201,117,11,232,187,37,0,0,139,5,213,75,0,0,
-  72,129,196,152,0,0,0,91,94,95,93,65,92,65,93,195,15,31,68,0,0,15,183,68,36,
-  96,233,11,255,255,255,102,15,31,68,0,0,139,5,218,85,0,0,187,1,0,0,0,131,248,
-  1,15,133,208,253,255,255,185,31,0,0,0,232,122,37,0,0,139,5,188,85,0,0,131,
-  248,1,15,133,222,253,255,255,15,31,0,72,141,21,121,107,0,0,72,141,13,98,107,
-  0,0,232,93,37,0,0,199,5,147,85,0,0,2,0,0,0,233,185,253,255,255,72,137,209,
-  255,21,169,95,0,0,233,33,253,255,255,72,141,21,105,107,0,0,72,141,13,74,107,
-  0,0,199,5,104,85,0,0,1,0,0,0,232,35,37,0,0,233,122,253,255,255,72,141,13,35,
-  59,0,0,255,211,72,133,192,102,144,15,133,210,253,255,255,72,141,13,27,59,0,0,
-  255,211,72,133,192,15,133,192,253,255,255,72,141,13,9,59,0,0,255,21,119,95,0,
-  0,72,133,192,15,132,200,253,255,255,233,165,253,255,255,137,193,232,222,36,0,
-  0,102,15,31,68,0,0,72,131,236,40,199,5,82,75,0,0,0,0,0,0,232,157,28,0,0,72,
-  131,196,40,233,100,252,255,255,15,31,64,0,72,131,236,40,199,5,50,75,0,0,1,0,
-  0,0,232,125,28,0,0,72,131,196,40,233,68,252,255,255,15,31,64,0,86,83,72,137,
-  203,72,131,236,40,72,139,1,139,0,61,145,0,0,192,119,59,61,141,0,0,192,114,
-  116,190,1,0,0,0,49,210,185,8,0,0,0,232,115,36,0,0,72,131,248,1,15,132,41,1,0,
-  0,72,133,192,116,55,185,8,0,0,0,255,208,184,255,255,255,255,72,131,196,40,91,
-  94,195,144,61,148,0,0,192,15,132,198,0,0,0,15,135,128,0,0,0,61,146,0,0,192,
-  15,132,228,0,0,0,61,147,0,0,192,116,169,72,139,21,30,74,0,0,49,192,72,133,
-  210,116,199,72,131,196,40,72,137,217,91,94,255,226,15,31,64,0,61,8,0,0,192,
-  15,132,181,0,0,0,15,135,143,0,0,0,61,2,0,0,128,15,132,164,0,0,0,61,5,0,0,192,
-  117,192,49,210,185,11,0,0,0,232,225,35,0,0,72,131,248,1,15,132,188,0,0,0,72,
-  133,192,116,165,185,11,0,0,0,255,208,72,131,196,40,184,255,255,255,255,91,94,
-  195,61,149,0,0,192,116,104,61,150,0,0,192,117,132,49,210,185,4,0,0,0,232,165,
-  35,0,0,72,131,248,1,15,132,155,0,0,0,72,133,192,15,132,101,255,255,255,185,4,
-  0,0,0,255,208,72,131,196,40,184,255,255,255,255,91,94,195,49,246,233,249,254,
-  255,255,15,31,132,0,0,0,0,0,61,29,0,0,192,116,184,61,140,0,0,192,15,31,64,0,
-  15,133,45,255,255,255,102,46,15,31,132,0,0,0,0,0,184,255,255,255,255,233,238,
-  254,255,255,102,15,31,68,0,0,186,1,0,0,0,185,8,0,0,0,232,49,35,0,0,133,246,
-  116,221,232,248,27,0,0,184,255,255,255,255,15,31,0,233,195,254,255,255,186,1,
-  0,0,0,185,11,0,0,0,232,12,35,0,0,184,255,255,255,255,233,170,254,255,255,102,
-  144,186,1,0,0,0,185,4,0,0,0,232,241,34,0,0,184,255,255,255,255,233,143,254,
-  255,255,144,144,144,144,144,144,144,86,72,137,206,83,72,137,211,186,47,0,0,0,
-  72,131,236,40,232,226,34,0,0,72,133,192,117,18,186,92,0,0,0,72,137,241,232,
-  208,34,0,0,72,133,192,116,13,198,0,0,72,141,72,1,72,137,115,8,235,14,72,141,
-  5,223,56,0,0,72,137,241,72,137,67,8,72,137,11,186,37,0,0,0,232,163,34,0,0,72,
-  133,192,116,6,198,0,0,72,255,192,72,137,67,16,72,131,196,40,184,1,0,0,0,91,
-  94,195,65,87,65,86,65,85,68,141,106,255,65,84,85,73,141,104,8,87,72,137,207,
-  86,76,137,198,83,72,137,203,72,131,236,72,76,139,61,220,92,0,0,76,141,116,36,
-  60,235,80,69,49,201,72,137,108,36,32,65,184,1,0,0,0,72,137,218,72,139,14,65,
-  255,215,133,192,117,13,255,21,84,92,0,0,61,229,3,0,0,117,51,65,185,1,0,0,0,
-  77,137,240,72,137,234,72,139,14,255,21,72,92,0,0,133,192,116,26,131,124,36,
-  60,0,116,19,128,59,10,116,14,72,255,195,65,137,220,65,41,252,65,255,205,121,
-  165,198,3,0,72,131,196,72,68,137,224,91,94,95,93,65,92,65,93,65,94,65,95,195,
-  85,87,86,83,72,137,203,72,141,107,8,72,129,236,72,4,0,0,72,141,116,36,48,76,
-  137,140,36,136,4,0,0,76,141,140,36,128,4,0,0,76,137,132,36,128,4,0,0,73,137,
-  208,186,0,4,0,0,76,137,140,36,48,4,0,0,72,137,241,72,137,247,255,21,40,93,0,
-  0,49,192,72,131,201,255,69,49,201,242,174,72,137,242,72,137,108,36,32,72,247,
-  209,68,141,65,255,72,139,11,255,21,109,92,0,0,133,192,117,39,255,21,139,91,0,
-  0,61,229,3,0,0,117,26,65,185,1,0,0,0,76,141,132,36,60,4,0,0,72,137,234,72,
-  139,11,255,21,122,91,0,0,72,139,11,255,21,41,91,0,0,139,132,36,60,4,0,0,72,
-  129,196,72,4,0,0,91,94,95,93,195,65,85,65,84,85,72,137,205,185,0,128,0,0,87,
-  86,83,72,131,236,120,232,209,32,0,0,72,133,192,72,137,195,117,21,72,139,77,0,
-  72,141,21,48,55,0,0,232,26,255,255,255,233,0,1,0,0,49,192,185,0,32,0,0,72,
-  137,223,243,171,72,141,116,36,32,73,131,204,255,72,137,247,177,18,243,171,72,
-  137,233,72,137,92,36,40,72,139,69,0,72,137,68,36,32,139,69,8,49,237,137,68,
-  36,96,232,217,32,0,0,76,139,68,36,32,186,0,128,0,0,72,137,217,232,39,254,255,
-  255,133,192,126,74,76,141,45,124,38,0,0,235,43,72,137,250,72,137,217,232,167,
-  32,0,0,72,57,216,117,23,64,136,232,76,137,225,242,174,72,247,209,138,68,11,
-  255,60,32,116,19,132,192,116,15,73,131,197,16,73,139,125,0,72,133,255,117,
-  204,235,87,72,137,241,65,255,85,8,133,192,117,160,72,139,68,36,32,72,139,8,
-  255,21,55,90,0,0,72,139,68,36,32,72,139,8,255,21,25,90,0,0,72,139,68,36,32,
-  72,139,53,221,89,0,0,72,139,8,255,214,72,139,68,36,32,72,139,72,32,255,214,
-  72,139,76,36,32,232,55,32,0,0,72,137,217,232,47,32,0,0,235,25,72,139,76,36,
-  32,72,141,21,97,54,0,0,73,137,216,232,26,254,255,255,233,59,255,255,255,72,
-  131,196,120,91,94,95,93,65,92,65,93,195,86,83,72,137,203,72,131,236,88,72,
-  139,73,56,72,133,201,15,132,144,0,0,0,72,141,84,36,48,232,215,252,255,255,
-  133,192,117,20,72,139,11,72,141,21,62,54,0,0,232,213,253,255,255,233,134,1,0,
-  0,72,141,67,40,199,68,36,32,0,0,0,0,65,185,2,0,0,0,76,139,68,36,64,72,139,84,
-  36,56,190,1,0,0,0,72,137,68,36,40,72,139,76,36,48,255,21,218,88,0,0,133,192,
-  15,133,79,1,0,0,255,21,148,89,0,0,76,139,76,36,56,137,68,36,40,72,141,21,8,
-  54,0,0,72,139,68,36,64,76,139,68,36,48,64,48,246,72,139,11,72,137,68,36,32,
-  232,103,253,255,255,233,26,1,0,0,131,123,52,0,116,50,255,21,49,89,0,0,76,141,
-  68,36,72,186,255,1,15,0,72,137,193,255,21,134,88,0,0,133,192,117,118,255,21,
-  60,89,0,0,72,141,21,222,53,0,0,65,137,192,233,216,0,0,0,72,139,3,72,139,8,
-  255,21,73,88,0,0,133,192,117,21,255,21,23,89,0,0,72,141,21,219,53,0,0,65,137,
-  192,233,179,0,0,0,255,21,234,88,0,0,69,49,192,76,141,76,36,72,186,255,1,15,0,
-  72,137,193,255,21,52,88,0,0,133,192,117,28,255,21,226,88,0,0,72,139,11,72,
-  141,21,207,53,0,0,65,137,192,49,246,232,203,252,255,255,235,87,72,141,67,40,
-  69,49,192,68,139,75,48,199,68,36,32,1,0,0,0,186,0,0,0,2,72,139,76,36,72,72,
-  137,68,36,40,190,1,0,0,0,255,21,191,87,0,0,133,192,117,27,255,21,149,88,0,0,
-  72,139,11,72,141,21,163,53,0,0,65,137,192,64,48,246,232,125,252,255,255,72,
-  139,76,36,72,255,21,253,87,0,0,131,123,52,0,117,36,255,21,193,87,0,0,133,192,
-  117,26,255,21,95,88,0,0,72,141,21,145,53,0,0,65,137,192,72,139,11,232,74,252,
-  255,255,49,246,72,131,196,88,137,240,91,94,195,65,84,186,32,0,0,0,85,87,86,
-  83,72,137,203,72,129,236,16,2,0,0,72,139,73,8,232,8,30,0,0,72,133,192,72,137,
-  198,15,132,101,4,0,0,72,137,217,232,5,254,255,255,133,192,15,132,85,4,0,0,
-  255,21,226,87,0,0,137,197,72,141,124,36,96,72,141,21,75,53,0,0,193,229,16,3,
-  107,64,72,137,249,65,137,232,232,191,29,0,0,72,141,5,88,77,0,0,69,49,192,199,
-  68,36,48,0,0,0,0,199,68,36,40,0,1,0,0,199,68,36,32,0,1,0,0,65,185,1,0,0,0,72,
-  137,68,36,56,186,3,0,0,0,72,137,249,76,139,37,71,87,0,0,65,255,212,72,137,67,
-  16,72,255,192,117,32,255,21,149,87,0,0,72,139,11,72,141,21,252,52,0,0,65,137,
-  193,73,137,248,232,125,251,255,255,233,190,3,0,0,72,141,21,20,53,0,0,65,137,
-  232,72,137,249,232,69,29,0,0,72,141,5,222,76,0,0,69,49,192,199,68,36,48,0,0,
-  0,0,199,68,36,40,0,1,0,0,199,68,36,32,0,1,0,0,65,185,1,0,0,0,72,137,68,36,56,
-  186,3,0,0,0,72,137,249,65,255,212,72,137,67,24,72,255,192,117,32,255,21,34,
-  87,0,0,72,139,11,72,141,21,211,52,0,0,65,137,193,73,137,248,232,10,251,255,
-  255,233,65,3,0,0,72,141,21,236,52,0,0,65,137,232,72,137,249,232,210,28,0,0,
-  72,141,5,107,76,0,0,69,49,192,199,68,36,48,0,0,0,0,199,68,36,40,0,1,0,0,199,
-  68,36,32,0,1,0,0,65,185,1,0,0,0,72,137,68,36,56,186,3,0,0,0,72,137,249,65,
-  255,212,72,137,67,32,72,255,192,117,32,255,21,175,86,0,0,72,139,11,72,141,21,
-  171,52,0,0,65,137,193,73,137,248,232,151,250,255,255,233,196,2,0,0,72,139,11,
-  72,141,21,193,52,0,0,65,137,232,232,128,250,255,255,49,210,72,139,75,16,255,
-  21,7,86,0,0,133,192,117,33,255,21,109,86,0,0,61,23,2,0,0,116,20,72,139,11,72,
-  141,21,163,52,0,0,232,84,250,255,255,233,119,2,0,0,49,210,72,139,75,24,255,
-  21,214,85,0,0,133,192,117,33,255,21,60,86,0,0,61,23,2,0,0,116,20,72,139,11,
-  72,141,21,143,52,0,0,232,35,250,255,255,233,60,2,0,0,49,210,72,139,75,32,255,
-  21,165,85,0,0,133,192,117,33,255,21,11,86,0,0,61,23,2,0,0,116,20,72,139,11,
-  72,141,21,124,52,0,0,232,242,249,255,255,233,1,2,0,0,72,141,172,36,208,1,0,0,
-  72,139,61,113,86,0,0,72,139,75,16,65,184,1,0,0,0,186,1,0,0,0,72,255,198,255,
-  215,72,139,75,24,65,184,1,0,0,0,186,1,0,0,0,255,215,72,139,75,32,65,184,1,0,
-  0,0,186,1,0,0,0,255,215,49,192,185,6,0,0,0,72,137,239,243,171,72,141,148,36,
-  96,1,0,0,69,49,201,73,137,240,72,137,215,177,26,243,171,72,137,84,36,72,199,
-  132,36,96,1,0,0,104,0,0,0,49,210,72,137,108,36,80,72,199,68,36,64,0,0,0,0,72,
-  139,67,16,129,140,36,156,1,0,0,0,1,0,0,72,139,75,40,72,199,68,36,56,0,0,0,0,
-  199,68,36,48,0,0,0,0,199,68,36,40,1,0,0,0,72,137,132,36,176,1,0,0,72,139,67,
-  24,72,199,68,36,32,0,0,0,0,72,137,132,36,184,1,0,0,72,139,67,32,72,137,132,
-  36,192,1,0,0,255,21,39,84,0,0,133,192,15,132,243,0,0,0,72,139,3,72,139,80,32,
-  72,137,148,36,240,1,0,0,72,139,148,36,208,1,0,0,72,137,148,36,248,1,0,0,72,
-  139,72,32,255,21,70,85,0,0,72,139,3,69,49,201,72,141,148,36,15,2,0,0,65,184,
-  1,0,0,0,72,141,72,8,72,137,76,36,32,72,139,8,255,21,24,85,0,0,133,192,117,6,
-  255,21,174,84,0,0,65,131,201,255,69,49,192,185,2,0,0,0,72,141,148,36,240,1,0,
-  0,255,21,100,85,0,0,133,192,137,132,36,8,2,0,0,72,139,140,36,208,1,0,0,116,
-  16,72,141,148,36,8,2,0,0,255,21,107,84,0,0,235,22,199,132,36,8,2,0,0,52,18,0,
-  0,186,52,18,0,0,255,21,3,85,0,0,72,139,75,24,72,139,53,24,84,0,0,255,214,72,
-  139,75,32,255,214,72,139,140,36,208,1,0,0,72,139,53,193,83,0,0,255,214,72,
-  139,140,36,216,1,0,0,255,214,68,139,132,36,8,2,0,0,72,139,11,72,141,21,187,
-  50,0,0,232,19,248,255,255,235,27,255,21,14,84,0,0,72,139,11,72,141,21,182,50,
-  0,0,65,137,193,73,137,240,232,246,247,255,255,72,139,75,32,255,21,167,83,0,0,
-  72,139,75,24,255,21,157,83,0,0,72,139,75,16,255,21,147,83,0,0,72,139,75,32,
-  255,21,89,83,0,0,72,139,75,24,255,21,79,83,0,0,72,139,75,16,255,21,69,83,0,0,
-  72,139,75,40,255,21,59,83,0,0,72,129,196,16,2,0,0,49,192,91,94,95,93,65,92,
-  195,85,186,32,0,0,0,87,86,83,72,137,203,72,131,236,40,72,139,113,8,72,137,
-  241,232,107,25,0,0,72,137,197,49,192,72,133,237,116,101,72,139,61,114,31,0,0,
-  72,255,197,72,137,233,72,137,250,232,92,25,0,0,72,57,232,73,137,192,117,52,
-  49,192,72,131,201,255,242,174,72,247,209,72,255,201,72,99,201,65,128,60,8,0,
-  117,28,72,139,11,72,141,21,15,50,0,0,65,184,100,0,0,0,232,48,247,255,255,184,
-  1,0,0,0,235,20,72,139,11,72,141,21,3,50,0,0,73,137,240,232,23,247,255,255,49,
-  192,72,131,196,40,91,94,95,93,195,65,84,186,32,0,0,0,85,87,86,83,72,137,203,
-  72,131,236,32,76,139,97,8,76,137,225,232,213,24,0,0,72,137,197,49,192,72,133,
-  237,15,132,219,0,0,0,72,139,61,240,30,0,0,72,141,117,1,72,137,241,72,137,250,
-  232,193,24,0,0,72,57,240,73,137,192,117,39,49,192,72,131,201,255,242,174,72,
-  247,209,72,255,201,72,99,201,65,128,60,8,32,117,15,74,141,76,1,1,232,143,24,
-  0,0,137,67,52,235,123,72,139,61,163,30,0,0,72,137,241,72,137,250,232,128,24,
-  0,0,72,57,240,117,39,49,192,72,131,201,255,242,174,72,247,209,72,255,201,72,
-  99,201,128,124,41,1,32,117,15,72,141,76,14,1,232,81,24,0,0,137,67,48,235,61,
-  72,139,61,93,30,0,0,72,137,241,72,137,250,232,66,24,0,0,72,57,240,117,45,49,
-  192,72,131,201,255,242,174,72,247,209,72,255,201,72,99,201,128,124,41,1,32,
-  117,21,72,141,76,14,1,232,147,23,0,0,72,137,67,56,184,1,0,0,0,235,20,72,139,
-  11,72,141,21,16,49,0,0,77,137,224,232,7,246,255,255,49,192,72,131,196,32,91,
-  94,95,93,65,92,195,83,65,185,32,2,0,0,65,184,32,0,0,0,186,2,0,0,0,72,129,236,
-  176,0,0,0,72,141,132,36,152,0,0,0,72,199,132,36,152,0,0,0,0,0,0,0,72,199,132,
-  36,144,0,0,0,0,0,0,0,198,132,36,160,0,0,0,0,198,132,36,161,0,0,0,0,72,141,
-  140,36,160,0,0,0,198,132,36,162,0,0,0,0,198,132,36,163,0,0,0,0,198,132,36,
-  164,0,0,0,0,198,132,36,165,0,0,0,5,72,137,68,36,80,199,68,36,72,0,0,0,0,199,
-  68,36,64,0,0,0,0,199,68,36,56,0,0,0,0,199,68,36,48,0,0,0,0,199,68,36,40,0,0,
-  0,0,199,68,36,32,0,0,0,0,255,21,97,80,0,0,133,192,15,132,195,0,0,0,72,139,
-  132,36,152,0,0,0,69,49,192,199,68,36,96,255,1,31,0,199,68,36,100,2,0,0,0,199,
-  68,36,104,0,0,0,0,72,141,84,36,96,199,68,36,124,0,0,0,0,199,132,36,128,0,0,0,
-  2,0,0,0,76,141,140,36,144,0,0,0,72,137,132,36,136,0,0,0,185,1,0,0,0,255,21,
-  83,80,0,0,133,192,117,105,186,40,0,0,0,185,64,0,0,0,255,21,47,81,0,0,72,133,
-  192,72,137,195,116,81,186,1,0,0,0,72,137,193,255,21,249,79,0,0,133,192,116,
-  63,69,49,201,76,139,132,36,144,0,0,0,186,1,0,0,0,72,137,217,255,21,20,80,0,0,
-  133,192,116,34,199,5,26,70,0,0,24,0,0,0,72,137,29,27,70,0,0,184,1,0,0,0,199,
-  5,20,70,0,0,0,0,0,0,235,2,49,192,72,129,196,176,0,0,0,91,195,65,87,65,86,65,
-  85,65,84,85,87,86,83,72,131,236,88,232,105,254,255,255,137,194,131,200,255,
-  133,210,15,132,104,1,0,0,76,139,53,218,79,0,0,76,139,37,227,79,0,0,76,141,
-  124,36,76,76,139,45,223,79,0,0,76,137,245,185,40,0,0,0,232,206,21,0,0,72,141,
-  112,8,72,137,195,185,8,0,0,0,49,192,69,49,201,65,184,1,0,0,0,72,137,247,186,
-  1,0,0,0,243,171,65,255,212,72,137,67,32,72,141,5,127,69,0,0,69,49,192,199,68,
-  36,48,0,0,0,0,199,68,36,40,0,1,0,0,65,185,255,0,0,0,72,137,68,36,56,199,68,
-  36,32,0,1,0,0,186,3,0,0,64,72,141,13,234,46,0,0,65,255,213,72,131,248,255,72,
-  137,3,117,25,72,139,75,32,255,21,67,79,0,0,72,137,217,232,175,21,0,0,49,192,
-  233,187,0,0,0,72,137,242,72,137,193,255,21,48,79,0,0,133,192,15,133,141,0,0,
-  0,255,21,146,79,0,0,61,23,2,0,0,116,32,61,229,3,0,0,117,121,65,185,1,0,0,0,
-  77,137,248,72,137,242,72,139,11,255,21,127,79,0,0,133,192,116,96,185,16,0,0,
-  0,232,253,20,0,0,72,137,24,73,137,193,139,5,81,59,0,0,49,210,49,201,76,141,5,
-  252,243,255,255,255,192,137,5,62,59,0,0,65,137,65,8,72,199,68,36,40,0,0,0,0,
-  199,68,36,32,0,0,0,0,255,21,207,78,0,0,72,133,192,117,13,72,139,11,255,213,
-  72,139,75,32,255,213,235,23,72,137,193,255,213,233,207,254,255,255,72,139,11,
-  65,255,214,72,139,75,32,65,255,214,72,137,217,232,242,20,0,0,233,181,254,255,
-  255,72,131,196,88,91,94,95,93,65,92,65,93,65,94,65,95,195,144,144,144,144,
-  144,144,144,144,144,144,144,144,87,86,72,141,53,231,26,0,0,72,131,236,72,232,
-  110,14,0,0,72,141,124,36,32,185,8,0,0,0,243,165,72,141,76,36,32,255,21,35,78,
-  0,0,72,131,196,72,49,192,94,95,195,72,131,236,40,131,249,2,116,11,131,249,3,
-  116,18,255,201,117,66,235,24,199,5,36,68,0,0,7,0,0,0,235,52,199,5,24,68,0,0,
-  4,0,0,0,235,40,199,5,20,68,0,0,0,0,0,0,199,5,2,68,0,0,1,0,0,0,199,5,8,68,0,0,
-  0,0,0,0,199,5,2,68,0,0,0,0,0,0,72,141,21,227,67,0,0,72,139,13,252,67,0,0,255,
-  21,170,77,0,0,133,192,117,13,72,139,5,47,78,0,0,72,131,196,40,255,224,72,131,
-  196,40,195,72,131,236,56,49,201,69,49,201,49,210,72,199,68,36,40,0,0,0,0,199,
-  68,36,32,0,0,0,0,76,141,5,134,253,255,255,255,21,163,77,0,0,72,137,193,184,1,
-  0,0,0,72,133,201,116,8,255,21,112,77,0,0,49,192,72,131,196,56,195,86,72,137,
-  214,72,141,21,52,255,255,255,83,137,203,72,141,13,40,45,0,0,72,131,236,56,
-  199,5,90,67,0,0,48,0,0,0,199,5,84,67,0,0,2,0,0,0,199,5,78,67,0,0,3,0,0,0,199,
-  5,72,67,0,0,0,0,0,0,199,5,66,67,0,0,0,0,0,0,199,5,60,67,0,0,0,0,0,0,199,5,54,
-  67,0,0,0,0,0,0,255,21,204,76,0,0,72,133,192,72,137,5,46,67,0,0,15,132,139,0,
-  0,0,76,141,68,36,44,137,217,72,137,242,232,57,255,255,255,133,192,72,139,13,
-  16,67,0,0,72,139,29,189,76,0,0,116,57,137,5,237,66,0,0,139,68,36,44,72,141,
-  21,214,66,0,0,199,5,208,66,0,0,1,0,0,0,199,5,214,66,0,0,0,0,0,0,199,5,208,66,
-  0,0,0,0,0,0,137,5,194,66,0,0,255,211,235,49,199,5,168,66,0,0,4,0,0,0,199,5,
-  174,66,0,0,0,0,0,0,72,141,21,147,66,0,0,199,5,161,66,0,0,0,0,0,0,255,211,133,
-  192,117,6,255,21,225,76,0,0,72,131,196,56,91,94,195,144,144,144,144,144,144,
-  72,131,236,8,49,192,72,131,196,8,195,15,31,68,0,0,72,131,236,40,133,210,116,
-  24,131,250,3,116,19,184,1,0,0,0,72,131,196,40,195,102,15,31,132,0,0,0,0,0,
-  232,171,13,0,0,184,1,0,0,0,72,131,196,40,195,144,86,83,72,131,236,40,131,61,
-  19,25,0,0,2,116,10,199,5,7,25,0,0,2,0,0,0,131,250,2,116,18,131,250,1,116,63,
-  72,131,196,40,184,1,0,0,0,91,94,195,144,72,141,29,121,88,0,0,72,141,53,114,
-  88,0,0,72,57,243,116,224,72,139,3,72,133,192,116,2,255,208,72,131,195,8,72,
-  57,243,117,237,72,131,196,40,184,1,0,0,0,91,94,195,232,57,13,0,0,235,186,144,
-  144,144,144,144,144,144,72,131,236,8,72,139,5,49,77,0,0,72,131,196,8,255,224,
-  144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,72,131,236,8,72,
-  137,200,72,131,196,8,195,15,31,64,0,72,131,236,8,72,137,200,72,131,196,8,195,
-  144,144,144,144,83,72,137,203,72,131,236,48,72,139,13,177,65,0,0,232,204,255,
-  255,255,72,131,248,255,72,137,68,36,40,116,118,185,8,0,0,0,232,207,17,0,0,72,
-  139,13,144,65,0,0,232,171,255,255,255,72,139,13,116,65,0,0,72,137,68,36,40,
-  232,154,255,255,255,72,141,84,36,40,76,141,68,36,32,72,137,217,72,137,68,36,
-  32,232,163,17,0,0,72,139,76,36,40,72,137,195,232,134,255,255,255,72,139,76,
-  36,32,72,137,5,74,65,0,0,232,117,255,255,255,185,8,0,0,0,72,137,5,41,65,0,0,
-  232,124,17,0,0,72,137,216,72,131,196,48,91,195,72,137,217,255,21,166,76,0,0,
-  72,137,195,72,131,196,48,72,137,216,91,195,102,15,31,68,0,0,72,131,236,40,
-  232,71,255,255,255,72,131,248,1,25,192,72,131,196,40,195,144,144,144,144,144,
-  144,144,144,144,144,144,144,72,131,236,104,72,137,92,36,64,72,137,116,36,72,
-  72,137,124,36,80,72,137,108,36,88,76,137,100,36,96,131,57,6,118,110,72,141,
-  29,61,43,0,0,15,31,128,0,0,0,0,72,139,113,8,76,139,97,32,72,139,105,24,72,
-  139,121,16,232,251,16,0,0,72,141,21,44,43,0,0,72,141,72,96,73,137,241,73,137,
-  216,76,137,100,36,48,72,137,108,36,40,72,137,124,36,32,232,222,16,0,0,49,192,
-  72,139,92,36,64,72,139,116,36,72,72,139,124,36,80,72,139,108,36,88,76,139,
-  100,36,96,72,131,196,104,195,102,15,31,68,0,0,139,17,72,141,5,11,43,0,0,72,
-  99,20,144,72,141,4,2,255,224,72,141,29,54,42,0,0,235,132,15,31,64,0,72,141,
-  29,233,41,0,0,233,116,255,255,255,15,31,64,0,72,141,29,185,41,0,0,233,100,
-  255,255,255,15,31,64,0,72,141,29,233,41,0,0,233,84,255,255,255,15,31,64,0,72,
-  141,29,73,42,0,0,233,68,255,255,255,15,31,64,0,72,141,29,17,42,0,0,233,52,
-  255,255,255,144,144,144,144,72,131,236,8,49,192,72,131,196,8,195,144,144,144,
-  144,144,86,83,72,137,203,72,131,236,56,72,141,68,36,88,72,137,84,36,88,76,
-  137,68,36,96,76,137,76,36,104,72,137,68,36,40,232,9,16,0,0,72,141,13,130,42,
-  0,0,76,141,72,96,65,184,27,0,0,0,186,1,0,0,0,232,254,15,0,0,72,139,116,36,40,
-  232,228,15,0,0,72,141,72,96,72,137,218,73,137,240,232,237,15,0,0,232,240,15,
-  0,0,72,131,236,120,77,133,192,72,137,92,36,96,72,137,116,36,104,76,137,195,
-  72,137,124,36,112,72,137,206,72,137,215,117,20,72,139,92,36,96,72,139,116,36,
-  104,72,139,124,36,112,72,131,196,120,195,72,141,84,36,32,65,184,48,0,0,0,255,
-  21,38,74,0,0,72,133,192,116,103,139,68,36,68,131,248,4,117,60,73,137,216,72,
-  137,250,72,137,241,232,230,14,0,0,139,68,36,68,131,248,4,116,182,131,248,64,
-  116,177,76,141,76,36,92,68,139,68,36,92,72,139,84,36,56,72,139,76,36,32,255,
-  21,218,73,0,0,235,149,15,31,64,0,131,248,64,116,191,76,141,76,36,92,65,184,
-  64,0,0,0,72,139,84,36,56,72,139,76,36,32,255,21,180,73,0,0,235,162,72,141,13,
-  183,41,0,0,73,137,240,186,48,0,0,0,232,218,254,255,255,102,46,15,31,132,0,0,
-  0,0,0,72,131,236,88,68,139,5,69,53,0,0,72,137,92,36,48,72,137,116,36,56,72,
-  137,124,36,64,72,137,108,36,72,69,133,192,76,137,100,36,80,116,39,72,139,92,
-  36,48,72,139,116,36,56,72,139,124,36,64,72,139,108,36,72,76,139,100,36,80,72,
-  131,196,88,195,102,15,31,132,0,0,0,0,0,72,141,5,41,42,0,0,72,141,29,34,42,0,
-  0,199,5,232,52,0,0,1,0,0,0,72,137,194,72,41,218,72,131,250,7,126,181,72,131,
-  250,11,126,39,139,45,0,42,0,0,133,237,117,29,139,61,250,41,0,0,133,255,117,
-  19,139,53,244,41,0,0,72,141,21,241,41,0,0,133,246,72,15,68,218,139,11,133,
-  201,15,133,133,0,0,0,139,83,4,133,210,15,133,122,0,0,0,139,83,8,131,250,1,15,
-  133,155,1,0,0,72,131,195,12,72,141,61,179,41,0,0,72,57,195,15,131,83,255,255,
-  255,72,141,53,179,211,255,255,72,141,108,36,32,73,188,0,0,0,0,255,255,255,
-  255,139,75,4,139,19,68,139,67,8,65,15,182,192,72,1,242,72,1,241,131,248,16,
-  76,139,10,15,132,170,0,0,0,119,115,131,248,8,15,132,239,0,0,0,72,141,13,243,
-  40,0,0,65,15,182,208,72,199,68,36,32,0,0,0,0,232,161,253,255,255,144,72,57,
-  195,72,141,53,70,41,0,0,15,131,233,254,255,255,72,141,45,73,211,255,255,72,
-  141,124,36,44,15,31,64,0,139,75,4,65,184,4,0,0,0,72,137,250,72,1,233,139,1,3,
-  3,72,131,195,8,137,68,36,44,232,192,253,255,255,72,57,243,114,219,233,175,
-  254,255,255,102,15,31,68,0,0,131,248,32,116,91,131,248,64,117,140,73,41,209,
-  76,3,9,65,184,8,0,0,0,72,137,234,76,137,76,36,32,232,141,253,255,255,72,131,
-  195,12,72,57,251,15,130,60,255,255,255,233,116,254,255,255,15,183,1,102,133,
-  192,121,116,73,41,209,72,13,0,0,255,255,73,141,4,1,72,137,68,36,32,65,184,2,
-  0,0,0,72,137,234,232,83,253,255,255,235,196,144,139,1,133,192,121,106,73,41,
-  209,76,9,224,73,141,4,1,72,137,68,36,32,65,184,4,0,0,0,72,137,234,232,45,253,
-  255,255,235,158,15,182,1,132,192,121,52,73,41,209,72,13,0,255,255,255,73,141,
-  4,1,72,137,68,36,32,65,184,1,0,0,0,72,137,234,232,4,253,255,255,233,114,255,
-  255,255,73,41,209,73,141,4,1,72,137,68,36,32,235,144,144,73,41,209,76,1,200,
-  72,137,68,36,32,235,209,15,31,0,73,41,209,76,1,200,72,137,68,36,32,235,152,
-  72,141,13,116,39,0,0,232,103,252,255,255,144,144,144,144,144,144,144,83,72,
-  131,236,32,139,1,61,145,0,0,192,119,55,61,141,0,0,192,15,130,135,0,0,0,187,1,
-  0,0,0,49,210,185,8,0,0,0,232,6,12,0,0,72,131,248,1,15,132,65,1,0,0,72,133,
-  192,15,133,19,1,0,0,49,192,72,131,196,32,91,195,61,148,0,0,192,15,132,192,0,
-  0,0,15,134,159,0,0,0,61,149,0,0,192,15,31,68,0,0,15,132,218,0,0,0,61,150,0,0,
-  192,15,31,68,0,0,117,203,49,210,185,4,0,0,0,232,178,11,0,0,72,131,248,1,15,
-  132,13,1,0,0,72,133,192,15,133,208,0,0,0,184,1,0,0,0,72,131,196,32,91,195,15,
-  31,64,0,61,8,0,0,192,15,132,149,0,0,0,15,31,68,0,0,119,110,61,2,0,0,128,15,
-  132,131,0,0,0,61,5,0,0,192,15,133,117,255,255,255,49,210,185,11,0,0,0,232,92,
-  11,0,0,72,131,248,1,15,132,206,0,0,0,72,133,192,116,174,185,11,0,0,0,255,208,
-  184,255,255,255,255,144,233,74,255,255,255,61,146,0,0,192,116,68,61,147,0,0,
-  192,15,133,54,255,255,255,233,13,255,255,255,15,31,64,0,49,219,233,7,255,255,
-  255,102,15,31,132,0,0,0,0,0,61,29,0,0,192,15,132,71,255,255,255,61,140,0,0,
-  192,15,133,7,255,255,255,102,46,15,31,132,0,0,0,0,0,184,255,255,255,255,72,
-  131,196,32,91,195,15,31,68,0,0,185,8,0,0,0,255,208,184,255,255,255,255,233,
-  222,254,255,255,185,4,0,0,0,255,208,184,255,255,255,255,15,31,0,233,202,254,
-  255,255,186,1,0,0,0,185,8,0,0,0,232,172,10,0,0,133,219,116,184,232,115,3,0,0,
-  131,200,255,233,170,254,255,255,186,1,0,0,0,185,4,0,0,0,232,140,10,0,0,131,
-  200,255,233,147,254,255,255,186,1,0,0,0,185,11,0,0,0,232,117,10,0,0,131,200,
-  255,233,124,254,255,255,102,102,102,102,46,15,31,132,0,0,0,0,0,72,131,236,88,
-  72,137,116,36,48,72,137,92,36,40,72,137,124,36,56,72,137,108,36,64,76,137,
-  100,36,72,76,137,108,36,80,232,57,8,0,0,72,137,198,139,5,0,49,0,0,72,133,246,
-  117,43,72,139,92,36,40,72,139,116,36,48,72,139,124,36,56,72,139,108,36,64,76,
-  139,100,36,72,76,139,108,36,80,72,131,196,88,195,15,31,132,0,0,0,0,0,133,192,
-  117,209,72,141,13,149,37,0,0,199,5,187,48,0,0,1,0,0,0,232,198,8,0,0,72,133,
-  192,116,17,184,1,0,0,0,235,175,102,46,15,31,132,0,0,0,0,0,72,141,21,185,48,0,
-  0,185,48,0,0,0,72,141,45,45,50,0,0,68,141,37,38,50,0,0,68,141,45,127,253,255,
-  255,49,219,72,137,215,243,72,171,72,137,239,65,41,244,65,41,245,177,32,243,
-  72,171,72,137,215,235,47,15,31,64,0,198,68,221,0,9,68,137,108,221,4,72,131,
-  195,1,139,80,12,137,23,3,80,8,68,137,103,8,65,131,196,8,137,87,4,72,131,199,
-  12,72,131,251,32,116,22,72,137,217,232,221,6,0,0,72,133,192,117,200,72,133,
-  219,15,132,110,255,255,255,73,137,240,137,218,72,141,13,51,48,0,0,255,21,225,
-  67,0,0,184,1,0,0,0,233,8,255,255,255,144,144,144,85,72,137,229,86,72,137,206,
-  72,141,13,49,51,0,0,83,72,131,236,112,255,21,194,67,0,0,72,139,29,23,52,0,0,
-  72,141,85,232,69,49,192,72,137,217,232,184,10,0,0,72,133,192,73,137,193,15,
-  132,164,0,0,0,72,141,69,224,72,139,85,232,73,137,216,49,201,72,199,68,36,56,
-  0,0,0,0,72,137,68,36,48,72,141,69,216,72,137,68,36,40,72,141,5,217,50,0,0,72,
-  137,68,36,32,232,127,10,0,0,72,139,5,192,51,0,0,49,201,72,137,53,63,51,0,0,
-  199,5,21,50,0,0,9,4,0,192,199,5,15,50,0,0,1,0,0,0,72,137,5,20,50,0,0,72,139,
-  5,93,15,0,0,72,137,69,192,72,139,5,90,15,0,0,72,137,69,200,255,21,68,67,0,0,
-  72,141,13,17,15,0,0,255,21,87,67,0,0,255,21,113,66,0,0,186,9,4,0,192,72,137,
-  193,255,21,51,67,0,0,232,210,8,0,0,102,144,72,139,69,8,72,137,5,77,51,0,0,72,
-  141,69,8,72,137,5,226,50,0,0,233,118,255,255,255,15,31,68,0,0,72,131,236,104,
-  72,184,50,162,223,45,153,43,0,0,72,137,92,36,64,72,139,29,230,14,0,0,72,137,
-  116,36,72,72,137,124,36,80,72,137,108,36,88,76,137,100,36,96,72,57,195,116,
-  45,72,247,211,72,137,29,203,14,0,0,72,139,92,36,64,72,139,116,36,72,72,139,
-  124,36,80,72,139,108,36,88,76,139,100,36,96,72,131,196,104,195,15,31,68,0,0,
-  72,141,76,36,48,72,199,68,36,48,0,0,0,0,255,21,24,66,0,0,76,139,100,36,48,
-  255,21,197,65,0,0,137,197,255,21,205,65,0,0,137,199,137,237,255,21,3,66,0,0,
-  72,141,76,36,32,137,198,137,255,255,21,28,66,0,0,76,51,100,36,32,137,246,72,
-  184,255,255,255,255,255,255,0,0,73,49,236,73,49,252,73,49,244,73,33,196,76,
-  137,224,73,57,220,72,247,208,116,24,76,137,37,49,14,0,0,72,137,5,50,14,0,0,
-  233,98,255,255,255,15,31,68,0,0,72,184,204,93,32,210,102,212,255,255,73,188,
-  51,162,223,45,153,43,0,0,235,210,144,144,144,144,144,144,144,144,144,144,72,
-  131,236,8,219,227,72,131,196,8,195,144,144,144,144,144,86,83,72,131,236,40,
-  72,131,61,18,54,0,0,0,139,29,124,9,0,0,116,90,131,251,255,116,53,133,219,116,
-  27,72,141,53,106,9,0,0,102,46,15,31,132,0,0,0,0,0,137,216,255,20,198,131,235,
-  1,117,246,72,131,196,40,72,141,13,235,0,0,0,91,94,233,212,245,255,255,15,31,
-  64,0,49,219,72,141,53,55,9,0,0,235,7,15,31,68,0,0,137,195,141,67,1,137,194,
-  72,131,60,214,0,117,242,235,171,72,141,13,89,34,0,0,72,139,53,222,64,0,0,255,
-  214,72,133,192,72,137,5,150,53,0,0,116,28,72,141,21,96,34,0,0,72,137,193,255,
-  21,208,64,0,0,72,137,5,109,53,0,0,233,110,255,255,255,72,141,13,45,34,0,0,
-  255,214,72,133,192,72,137,5,101,53,0,0,117,207,72,141,13,36,34,0,0,255,214,
-  72,133,192,72,137,5,80,53,0,0,117,186,72,141,13,15,34,0,0,255,21,189,64,0,0,
-  199,5,63,53,0,0,1,0,0,0,72,137,5,48,53,0,0,235,154,102,102,102,102,102,46,15,
-  31,132,0,0,0,0,0,72,131,236,8,139,5,14,53,0,0,133,192,116,5,72,131,196,8,195,
-  199,5,251,52,0,0,1,0,0,0,72,131,196,8,233,218,254,255,255,102,46,15,31,132,0,
-  0,0,0,0,72,131,236,40,72,139,5,149,12,0,0,72,139,0,72,133,192,116,29,255,208,
-  72,139,5,132,12,0,0,72,141,80,8,72,139,64,8,72,137,21,117,12,0,0,72,133,192,
-  117,227,139,21,194,52,0,0,133,210,116,39,72,139,13,175,52,0,0,72,133,201,116,
-  27,199,5,168,52,0,0,0,0,0,0,255,21,158,63,0,0,72,199,5,143,52,0,0,0,0,0,0,72,
-  131,196,40,195,144,144,144,144,144,144,144,144,144,144,72,131,236,72,139,5,
-  134,52,0,0,72,137,92,36,40,72,137,116,36,48,72,137,124,36,56,72,137,108,36,
-  64,133,192,117,30,72,139,92,36,40,72,139,116,36,48,72,139,124,36,56,72,139,
-  108,36,64,72,131,196,72,195,15,31,68,0,0,72,141,13,105,52,0,0,255,21,39,63,0,
-  0,72,139,29,132,52,0,0,72,133,219,116,59,72,139,61,4,64,0,0,72,139,53,77,63,
-  0,0,102,15,31,132,0,0,0,0,0,139,11,255,215,72,137,197,255,214,133,192,117,14,
-  72,133,237,116,9,72,139,67,8,72,137,233,255,208,72,139,91,16,72,133,219,117,
-  220,72,139,5,89,63,0,0,72,139,92,36,40,72,141,13,9,52,0,0,72,139,116,36,48,
-  72,139,124,36,56,72,139,108,36,64,72,131,196,72,255,224,15,31,64,0,72,131,
-  236,40,131,250,1,116,71,114,22,131,250,3,117,5,232,43,255,255,255,184,1,0,0,
-  0,72,131,196,40,102,144,195,232,26,255,255,255,139,5,164,51,0,0,131,248,1,
-  117,228,72,141,13,184,51,0,0,199,5,142,51,0,0,0,0,0,0,255,21,92,62,0,0,235,
-  203,102,15,31,68,0,0,139,5,122,51,0,0,133,192,116,22,199,5,108,51,0,0,1,0,0,
-  0,184,1,0,0,0,72,131,196,40,195,102,144,72,141,13,121,51,0,0,255,21,175,62,0,
-  0,235,219,144,83,137,203,72,131,236,32,139,5,67,51,0,0,133,192,117,15,49,192,
-  72,131,196,32,91,195,15,31,128,0,0,0,0,72,141,13,73,51,0,0,255,21,7,62,0,0,
-  72,139,13,100,51,0,0,72,133,201,116,26,139,1,57,216,117,8,235,62,139,1,57,
-  216,116,41,72,137,202,72,139,73,16,72,133,201,117,238,72,141,13,22,51,0,0,
-  255,21,84,62,0,0,49,192,72,131,196,32,91,195,15,31,132,0,0,0,0,0,72,139,65,
-  16,72,137,66,16,232,243,3,0,0,235,212,72,139,65,16,72,137,5,14,51,0,0,235,
-  236,15,31,64,0,72,131,236,56,139,5,182,50,0,0,72,137,92,36,32,72,137,116,36,
-  40,72,137,211,72,137,124,36,48,137,206,133,192,117,30,72,139,92,36,32,72,139,
-  116,36,40,72,139,124,36,48,72,131,196,56,195,102,46,15,31,132,0,0,0,0,0,186,
-  24,0,0,0,185,1,0,0,0,232,233,3,0,0,72,137,199,184,255,255,255,255,72,133,255,
-  116,198,72,141,13,125,50,0,0,137,55,72,137,95,8,255,21,53,61,0,0,72,139,5,
-  146,50,0,0,72,141,13,99,50,0,0,72,137,61,132,50,0,0,72,137,71,16,255,21,150,
-  61,0,0,49,192,235,144,144,144,144,144,144,144,144,144,144,144,144,144,144,
-  144,72,131,236,8,102,129,57,77,90,116,7,49,192,72,131,196,8,195,72,99,65,60,
-  72,1,193,129,57,80,69,0,0,117,234,49,192,102,129,121,24,11,2,15,148,192,72,
-  131,196,8,195,102,102,102,102,102,102,46,15,31,132,0,0,0,0,0,72,131,236,8,72,
-  99,65,60,72,1,193,68,15,183,81,6,15,183,65,20,69,133,210,116,45,15,183,192,
-  72,141,68,1,24,49,201,235,4,72,131,192,40,68,139,64,12,69,137,193,73,57,209,
-  119,9,68,3,64,8,76,57,194,114,10,131,193,1,68,57,209,114,223,49,192,72,131,
-  196,8,195,15,31,0,72,131,236,8,102,129,61,99,200,255,255,77,90,116,17,49,192,
-  72,131,196,8,195,102,46,15,31,132,0,0,0,0,0,72,99,21,133,200,255,255,72,141,
-  5,66,200,255,255,72,141,4,2,129,56,80,69,0,0,117,213,102,129,120,24,11,2,117,
-  205,68,15,183,64,6,15,183,80,20,69,133,192,116,191,15,183,210,72,141,68,16,
-  24,49,210,235,8,15,31,64,0,72,131,192,40,246,64,39,32,116,9,72,133,201,116,
-  162,72,131,233,1,131,194,1,68,57,194,114,229,235,146,15,31,0,72,131,236,8,
-  102,129,61,227,199,255,255,77,90,72,141,5,220,199,255,255,116,10,49,192,72,
-  131,196,8,195,15,31,0,72,99,21,5,200,255,255,72,1,194,129,58,80,69,0,0,117,
-  228,102,129,122,24,11,2,117,220,235,220,15,31,64,0,72,131,236,8,102,129,61,
-  163,199,255,255,77,90,72,141,5,156,199,255,255,116,10,49,192,72,131,196,8,
-  195,15,31,0,72,99,21,197,199,255,255,72,1,194,129,58,80,69,0,0,117,228,102,
-  129,122,24,11,2,117,220,68,15,183,82,6,73,137,201,73,41,193,15,183,66,20,69,
-  133,210,116,200,15,183,192,72,141,68,2,24,49,210,235,10,102,15,31,68,0,0,72,
-  131,192,40,139,72,12,65,137,200,77,57,193,114,8,3,72,8,73,57,201,114,11,131,
-  194,1,68,57,210,114,225,144,235,148,72,133,192,116,143,139,64,36,72,131,196,
-  8,247,208,193,232,31,195,102,102,102,46,15,31,132,0,0,0,0,0,72,131,236,72,72,
-  137,116,36,48,72,137,92,36,40,72,137,206,72,137,124,36,56,72,137,108,36,64,
-  232,200,0,0,0,72,131,248,8,118,30,49,219,72,137,216,72,139,116,36,48,72,139,
-  92,36,40,72,139,124,36,56,72,139,108,36,64,72,131,196,72,195,102,129,61,195,
-  198,255,255,77,90,117,215,72,99,21,246,198,255,255,72,141,5,179,198,255,255,
-  72,141,4,2,129,56,80,69,0,0,117,189,102,129,120,24,11,2,117,181,15,183,104,6,
-  15,183,80,20,133,237,116,169,15,183,210,49,255,72,141,92,16,24,235,11,15,31,
-  128,0,0,0,0,72,131,195,40,65,184,8,0,0,0,72,137,242,72,137,217,232,11,1,0,0,
-  133,192,15,132,123,255,255,255,131,199,1,57,239,114,220,233,109,255,255,255,
-  144,144,144,144,144,144,144,255,37,118,59,0,0,144,144,0,0,0,0,0,0,0,0,255,37,
-  166,59,0,0,144,144,255,37,118,59,0,0,144,144,255,37,142,59,0,0,144,144,255,
-  37,62,60,0,0,144,144,255,37,14,60,0,0,144,144,255,37,14,60,0,0,144,144,255,
-  37,142,59,0,0,144,144,255,37,126,59,0,0,144,144,255,37,142,59,0,0,144,144,
-  255,37,198,59,0,0,144,144,255,37,238,59,0,0,144,144,255,37,150,59,0,0,144,
-  144,255,37,230,59,0,0,144,144,255,37,230,59,0,0,144,144,255,37,142,59,0,0,
-  144,144,255,37,238,59,0,0,144,144,255,37,158,59,0,0,144,144,255,37,14,59,0,0,
-  144,144,255,37,78,59,0,0,144,144,255,37,62,59,0,0,144,144,255,37,214,58,0,0,
-  144,144,255,37,62,59,0,0,144,144,255,37,222,58,0,0,144,144,255,37,94,59,0,0,
-  144,144,255,37,102,59,0,0,144,144,255,37,166,59,0,0,144,144,255,37,38,59,0,0,
-  144,144,255,37,46,59,0,0,144,144,255,37,126,59,0,0,144,144,0,0,0,0,0,0,0,0,
-  255,37,46,58,0,0,144,144,255,37,30,58,0,0,144,144,255,37,134,57,0,0,144,144,
-  255,37,142,57,0,0,144,144,255,37,142,57,0,0,144,144,255,37,174,57,0,0,144,
-  144,255,37,190,57,0,0,144,144,255,37,86,57,0,0,144,144,255,37,94,57,0,0,144,
-  144,255,37,30,58,0,0,144,144,255,37,6,57,0,0,144,144,255,37,238,56,0,0,144,
-  144,255,37,182,56,0,0,144,144,255,37,254,56,0,0,144,144,255,37,6,57,0,0,144,
-  144,255,37,246,56,0,0,144,144,255,37,174,56,0,0,144,144,255,37,150,56,0,0,
-  144,144,255,37,142,57,0,0,144,144,255,37,94,57,0,0,144,144,255,37,190,57,0,0,
-  144,144,255,37,222,56,0,0,144,144,255,37,134,57,0,0,144,144,255,37,38,57,0,0,
-  144,144,255,37,102,56,0,0,144,144,255,37,110,56,0,0,144,144,255,37,134,57,0,
-  0,144,144,255,37,118,57,0,0,144,144,255,37,30,57,0,0,144,144,255,37,30,57,0,
-  0,144,144,255,37,86,57,0,0,144,144,255,37,190,56,0,0,144,144,255,37,126,56,0,
-  0,144,144,255,37,182,56,0,0,144,144,255,37,214,56,0,0,144,144,255,37,246,56,
-  0,0,144,144,255,37,246,56,0,0,144,144,255,37,54,56,0,0,144,144,255,37,30,56,
-  0,0,144,144,255,37,6,57,0,0,144,144,255,37,142,56,0,0,144,144,255,37,246,55,
-  0,0,144,144,255,37,118,56,0,0,144,144,0,0,0,0,0,0,0,0,255,37,102,55,0,0,144,
-  144,255,37,102,55,0,0,144,144,255,37,70,55,0,0,144,144,255,37,94,55,0,0,144,
-  144,255,37,46,55,0,0,144,144,255,37,94,55,0,0,144,144,255,37,22,55,0,0,144,
-  144,255,37,6,55,0,0,144,144,255,37,78,55,0,0,144,144,255,37,22,55,0,0,144,
-  144,255,37,70,55,0,0,144,144,255,37,78,55,0,0,144,144,255,37,62,55,0,0,144,
-  144,255,37,22,55,0,0,144,144,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
-  255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,83,
-  64,0,0,0,0,0,2,28,64,0,0,0,0,0,113,83,64,0,0,0,0,0,53,33,64,0,0,0,0,0,117,83,
-  64,0,0,0,0,0,161,32,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,83,64,0,
-  0,0,0,0,129,83,64,0,0,0,0,0,135,83,64,0,0,0,0,0,144,83,64,0,0,0,0,0,160,83,
-  64,0,0,0,0,0,99,38,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,39,64,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
-  255,255,255,255,0,0,0,0,0,0,0,0,128,99,64,0,0,0,0,0,32,100,64,0,0,0,0,0,152,
-  60,64,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,162,223,
-  45,153,43,0,0,205,93,32,210,102,212,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,115,118,99,114,
-  56,48,46,100,108,108,0,109,115,118,99,114,55,48,46,100,108,108,0,109,115,118,
-  99,114,116,46,100,108,108,0,0,0,0,0,0,95,115,101,116,95,105,110,118,97,108,
-  105,100,95,112,97,114,97,109,101,116,101,114,95,104,97,110,100,108,101,114,0,
-  0,0,0,0,0,0,0,0,0,46,0,101,114,114,111,114,58,32,117,110,97,98,108,101,32,
-  116,111,32,97,108,108,111,99,97,116,101,32,98,117,102,102,101,114,32,102,111,
-  114,32,99,111,109,109,97,110,100,10,0,101,114,114,111,114,32,73,103,110,111,
-  114,105,110,103,32,117,110,107,110,111,119,110,32,99,111,109,109,97,110,100,
-  32,40,37,115,41,10,0,101,114,114,111,114,32,73,110,99,111,114,114,101,99,116,
-  32,114,117,110,97,115,32,99,114,101,100,101,110,116,105,97,108,115,10,0,101,
-  114,114,111,114,32,67,97,110,110,111,116,32,76,111,103,111,110,85,115,101,
-  114,40,37,115,44,37,115,44,37,115,41,32,37,100,10,0,101,114,114,111,114,32,
-  67,97,110,110,111,116,32,79,112,101,110,80,114,111,99,101,115,115,84,111,107,
-  101,110,32,37,100,10,0,101,114,114,111,114,32,67,97,110,110,111,116,32,73,
-  109,112,101,114,115,111,110,97,116,101,78,97,109,101,100,80,105,112,101,67,
-  108,105,101,110,116,32,37,100,10,0,101,114,114,111,114,32,67,97,110,110,111,
-  116,32,79,112,101,110,84,104,114,101,97,100,84,111,107,101,110,32,37,100,10,
-  0,101,114,114,111,114,32,67,97,110,110,111,116,32,68,117,112,108,105,99,97,
-  116,101,32,84,111,107,101,110,32,37,100,10,0,101,114,114,111,114,32,67,97,
-  110,110,111,116,32,82,101,118,101,114,116,84,111,83,101,108,102,32,37,100,10,
-  0,92,92,46,92,112,105,112,101,92,97,104,101,120,101,99,95,115,116,100,105,
-  110,37,48,56,88,0,101,114,114,111,114,32,67,97,110,110,111,116,32,99,114,101,
-  97,116,101,32,105,110,32,112,105,112,101,40,37,115,41,44,32,101,114,114,111,
-  114,32,48,120,37,48,56,88,10,0,92,92,46,92,112,105,112,101,92,97,104,101,120,
-  101,99,95,115,116,100,111,117,116,37,48,56,88,0,101,114,114,111,114,32,67,97,
-  110,110,111,116,32,99,114,101,97,116,101,32,111,117,116,32,112,105,112,101,
-  40,37,115,41,44,32,101,114,114,111,114,32,48,120,37,48,56,88,10,0,92,92,46,
-  92,112,105,112,101,92,97,104,101,120,101,99,95,115,116,100,101,114,114,37,48,
-  56,88,0,101,114,114,111,114,32,67,97,110,110,111,116,32,99,114,101,97,116,
-  101,32,101,114,114,32,112,105,112,101,40,37,115,41,44,32,101,114,114,111,114,
-  32,48,120,37,48,56,120,10,0,115,116,100,95,105,111,95,101,114,114,32,37,48,
-  56,88,10,0,101,114,114,111,114,32,67,111,110,110,101,99,116,78,97,109,101,
-  100,80,105,112,101,40,112,105,110,41,10,0,101,114,114,111,114,32,67,111,110,
-  110,101,99,116,78,97,109,101,100,80,105,112,101,40,112,111,117,116,41,10,0,
-  101,114,114,111,114,32,67,111,110,110,101,99,116,78,97,109,101,100,80,105,
-  112,101,40,112,101,114,114,41,10,0,114,101,116,117,114,110,95,99,111,100,101,
-  32,37,48,56,88,10,0,101,114,114,111,114,32,67,114,101,97,116,105,110,103,32,
-  112,114,111,99,101,115,115,40,37,115,41,32,37,100,10,0,118,101,114,115,105,
-  111,110,32,48,120,37,48,52,88,10,0,101,114,114,111,114,32,85,110,107,110,111,
-  119,110,32,97,114,103,117,109,101,110,116,32,40,37,115,41,10,0,101,114,114,
-  111,114,32,85,110,107,110,111,119,110,32,99,111,109,109,97,100,32,40,37,115,
-  41,10,0,92,92,46,92,112,105,112,101,92,97,104,101,120,101,99,0,114,117,110,0,
-  115,101,116,0,103,101,116,0,118,101,114,115,105,111,110,0,114,117,110,97,115,
-  0,105,109,112,108,101,118,101,108,0,115,121,115,116,101,109,0,0,0,0,0,0,0,0,
-  0,0,119,105,110,101,120,101,115,118,99,0,0,0,0,0,0,0,65,114,103,117,109,101,
-  110,116,32,115,105,110,103,117,108,97,114,105,116,121,32,40,83,73,71,78,41,0,
-  0,0,0,0,65,114,103,117,109,101,110,116,32,100,111,109,97,105,110,32,101,114,
-  114,111,114,32,40,68,79,77,65,73,78,41,0,0,79,118,101,114,102,108,111,119,32,
-  114,97,110,103,101,32,101,114,114,111,114,32,40,79,86,69,82,70,76,79,87,41,0,
-  80,97,114,116,105,97,108,32,108,111,115,115,32,111,102,32,115,105,103,110,
-  105,102,105,99,97,110,99,101,32,40,80,76,79,83,83,41,0,0,0,0,84,111,116,97,
-  108,32,108,111,115,115,32,111,102,32,115,105,103,110,105,102,105,99,97,110,
-  99,101,32,40,84,76,79,83,83,41,0,0,0,0,0,0,84,104,101,32,114,101,115,117,108,
-  116,32,105,115,32,116,111,111,32,115,109,97,108,108,32,116,111,32,98,101,32,
-  114,101,112,114,101,115,101,110,116,101,100,32,40,85,78,68,69,82,70,76,79,87,
-  41,0,85,110,107,110,111,119,110,32,101,114,114,111,114,0,0,0,0,0,95,109,97,
-  116,104,101,114,114,40,41,58,32,37,115,32,105,110,32,37,115,40,37,103,44,32,
-  37,103,41,32,32,40,114,101,116,118,97,108,61,37,103,41,10,0,0,126,212,255,
-  255,12,213,255,255,28,213,255,255,44,213,255,255,60,213,255,255,76,213,255,
-  255,255,212,255,255,77,105,110,103,119,45,119,54,52,32,114,117,110,116,105,
-  109,101,32,102,97,105,108,117,114,101,58,10,0,0,0,0,0,32,32,86,105,114,116,
-  117,97,108,81,117,101,114,121,32,102,97,105,108,101,100,32,102,111,114,32,37,
-  100,32,98,121,116,101,115,32,97,116,32,97,100,100,114,101,115,115,32,37,112,
-  0,0,0,0,0,0,0,0,32,32,85,110,107,110,111,119,110,32,112,115,101,117,100,111,
-  32,114,101,108,111,99,97,116,105,111,110,32,112,114,111,116,111,99,111,108,
-  32,118,101,114,115,105,111,110,32,37,100,46,10,0,0,0,0,0,0,0,32,32,85,110,
-  107,110,111,119,110,32,112,115,101,117,100,111,32,114,101,108,111,99,97,116,
-  105,111,110,32,98,105,116,32,115,105,122,101,32,37,100,46,10,0,0,0,0,0,0,0,
-  46,112,100,97,116,97,0,0,0,0,0,0,0,0,0,0,109,115,118,99,114,56,48,46,100,108,
-  108,0,109,115,118,99,114,55,48,46,100,108,108,0,109,115,118,99,114,116,46,
-  100,108,108,0,108,111,110,103,106,109,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,100,112,0,0,0,0,0,0,0,0,0,0,140,124,0,0,84,115,0,0,220,112,0,0,0,0,
-  0,0,0,0,0,0,72,125,0,0,204,115,0,0,60,114,0,0,0,0,0,0,0,0,0,0,92,125,0,0,44,
-  117,0,0,76,114,0,0,0,0,0,0,0,0,0,0,232,125,0,0,60,117,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,68,118,0,0,0,0,0,0,96,118,0,0,0,0,0,0,120,118,0,0,0,0,
-  0,0,140,118,0,0,0,0,0,0,170,118,0,0,0,0,0,0,202,118,0,0,0,0,0,0,216,118,0,0,
-  0,0,0,0,236,118,0,0,0,0,0,0,254,118,0,0,0,0,0,0,28,119,0,0,0,0,0,0,44,119,0,
-  0,0,0,0,0,64,119,0,0,0,0,0,0,92,119,0,0,0,0,0,0,112,119,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,142,119,0,0,0,0,0,0,156,119,0,0,0,0,0,0,176,119,0,0,0,0,0,0,192,119,
-  0,0,0,0,0,0,212,119,0,0,0,0,0,0,228,119,0,0,0,0,0,0,252,119,0,0,0,0,0,0,18,
-  120,0,0,0,0,0,0,42,120,0,0,0,0,0,0,62,120,0,0,0,0,0,0,76,120,0,0,0,0,0,0,96,
-  120,0,0,0,0,0,0,118,120,0,0,0,0,0,0,138,120,0,0,0,0,0,0,160,120,0,0,0,0,0,0,
-  182,120,0,0,0,0,0,0,198,120,0,0,0,0,0,0,218,120,0,0,0,0,0,0,240,120,0,0,0,0,
-  0,0,2,121,0,0,0,0,0,0,20,121,0,0,0,0,0,0,46,121,0,0,0,0,0,0,62,121,0,0,0,0,0,
-  0,90,121,0,0,0,0,0,0,114,121,0,0,0,0,0,0,130,121,0,0,0,0,0,0,144,121,0,0,0,0,
-  0,0,170,121,0,0,0,0,0,0,182,121,0,0,0,0,0,0,196,121,0,0,0,0,0,0,218,121,0,0,
-  0,0,0,0,238,121,0,0,0,0,0,0,8,122,0,0,0,0,0,0,28,122,0,0,0,0,0,0,52,122,0,0,
-  0,0,0,0,82,122,0,0,0,0,0,0,90,122,0,0,0,0,0,0,110,122,0,0,0,0,0,0,124,122,0,
-  0,0,0,0,0,152,122,0,0,0,0,0,0,170,122,0,0,0,0,0,0,186,122,0,0,0,0,0,0,212,
-  122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,122,
-  0,0,0,0,0,0,248,122,0,0,0,0,0,0,8,123,0,0,0,0,0,0,20,123,0,0,0,0,0,0,34,123,
-  0,0,0,0,0,0,50,123,0,0,0,0,0,0,68,123,0,0,0,0,0,0,88,123,0,0,0,0,0,0,98,123,
-  0,0,0,0,0,0,112,123,0,0,0,0,0,0,122,123,0,0,0,0,0,0,132,123,0,0,0,0,0,0,144,
-  123,0,0,0,0,0,0,152,123,0,0,0,0,0,0,162,123,0,0,0,0,0,0,172,123,0,0,0,0,0,0,
-  186,123,0,0,0,0,0,0,194,123,0,0,0,0,0,0,202,123,0,0,0,0,0,0,212,123,0,0,0,0,
-  0,0,220,123,0,0,0,0,0,0,230,123,0,0,0,0,0,0,238,123,0,0,0,0,0,0,248,123,0,0,
-  0,0,0,0,2,124,0,0,0,0,0,0,12,124,0,0,0,0,0,0,22,124,0,0,0,0,0,0,32,124,0,0,0,
-  0,0,0,42,124,0,0,0,0,0,0,52,124,0,0,0,0,0,0,62,124,0,0,0,0,0,0,72,124,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,68,118,0,0,0,0,0,0,96,118,0,0,0,0,0,0,120,118,0,0,0,0,
-  0,0,140,118,0,0,0,0,0,0,170,118,0,0,0,0,0,0,202,118,0,0,0,0,0,0,216,118,0,0,
-  0,0,0,0,236,118,0,0,0,0,0,0,254,118,0,0,0,0,0,0,28,119,0,0,0,0,0,0,44,119,0,
-  0,0,0,0,0,64,119,0,0,0,0,0,0,92,119,0,0,0,0,0,0,112,119,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,142,119,0,0,0,0,0,0,156,119,0,0,0,0,0,0,176,119,0,0,0,0,0,0,192,119,
-  0,0,0,0,0,0,212,119,0,0,0,0,0,0,228,119,0,0,0,0,0,0,252,119,0,0,0,0,0,0,18,
-  120,0,0,0,0,0,0,42,120,0,0,0,0,0,0,62,120,0,0,0,0,0,0,76,120,0,0,0,0,0,0,96,
-  120,0,0,0,0,0,0,118,120,0,0,0,0,0,0,138,120,0,0,0,0,0,0,160,120,0,0,0,0,0,0,
-  182,120,0,0,0,0,0,0,198,120,0,0,0,0,0,0,218,120,0,0,0,0,0,0,240,120,0,0,0,0,
-  0,0,2,121,0,0,0,0,0,0,20,121,0,0,0,0,0,0,46,121,0,0,0,0,0,0,62,121,0,0,0,0,0,
-  0,90,121,0,0,0,0,0,0,114,121,0,0,0,0,0,0,130,121,0,0,0,0,0,0,144,121,0,0,0,0,
-  0,0,170,121,0,0,0,0,0,0,182,121,0,0,0,0,0,0,196,121,0,0,0,0,0,0,218,121,0,0,
-  0,0,0,0,238,121,0,0,0,0,0,0,8,122,0,0,0,0,0,0,28,122,0,0,0,0,0,0,52,122,0,0,
-  0,0,0,0,82,122,0,0,0,0,0,0,90,122,0,0,0,0,0,0,110,122,0,0,0,0,0,0,124,122,0,
-  0,0,0,0,0,152,122,0,0,0,0,0,0,170,122,0,0,0,0,0,0,186,122,0,0,0,0,0,0,212,
-  122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,122,
-  0,0,0,0,0,0,248,122,0,0,0,0,0,0,8,123,0,0,0,0,0,0,20,123,0,0,0,0,0,0,34,123,
-  0,0,0,0,0,0,50,123,0,0,0,0,0,0,68,123,0,0,0,0,0,0,88,123,0,0,0,0,0,0,98,123,
-  0,0,0,0,0,0,112,123,0,0,0,0,0,0,122,123,0,0,0,0,0,0,132,123,0,0,0,0,0,0,144,
-  123,0,0,0,0,0,0,152,123,0,0,0,0,0,0,162,123,0,0,0,0,0,0,172,123,0,0,0,0,0,0,
-  186,123,0,0,0,0,0,0,194,123,0,0,0,0,0,0,202,123,0,0,0,0,0,0,212,123,0,0,0,0,
-  0,0,220,123,0,0,0,0,0,0,230,123,0,0,0,0,0,0,238,123,0,0,0,0,0,0,248,123,0,0,
-  0,0,0,0,2,124,0,0,0,0,0,0,12,124,0,0,0,0,0,0,22,124,0,0,0,0,0,0,32,124,0,0,0,
-  0,0,0,42,124,0,0,0,0,0,0,52,124,0,0,0,0,0,0,62,124,0,0,0,0,0,0,72,124,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,29,0,65,108,108,111,99,97,116,101,65,110,100,73,110,
-  105,116,105,97,108,105,122,101,83,105,100,0,0,95,0,67,114,101,97,116,101,80,
-  114,111,99,101,115,115,65,115,85,115,101,114,65,0,0,180,0,68,117,112,108,105,
-  99,97,116,101,84,111,107,101,110,69,120,0,0,49,1,73,109,112,101,114,115,111,
-  110,97,116,101,78,97,109,101,100,80,105,112,101,67,108,105,101,110,116,0,0,
-  52,1,73,110,105,116,105,97,108,105,122,101,83,101,99,117,114,105,116,121,68,
-  101,115,99,114,105,112,116,111,114,0,0,67,1,76,111,103,111,110,85,115,101,
-  114,65,0,0,172,1,79,112,101,110,80,114,111,99,101,115,115,84,111,107,101,110,
-  0,0,177,1,79,112,101,110,84,104,114,101,97,100,84,111,107,101,110,0,12,2,82,
-  101,103,105,115,116,101,114,83,101,114,118,105,99,101,67,116,114,108,72,97,
-  110,100,108,101,114,65,0,22,2,82,101,118,101,114,116,84,111,83,101,108,102,0,
-  0,42,2,83,101,116,69,110,116,114,105,101,115,73,110,65,99,108,65,0,0,58,2,83,
-  101,116,83,101,99,117,114,105,116,121,68,101,115,99,114,105,112,116,111,114,
-  68,97,99,108,0,68,2,83,101,116,83,101,114,118,105,99,101,83,116,97,116,117,
-  115,0,0,74,2,83,116,97,114,116,83,101,114,118,105,99,101,67,116,114,108,68,
-  105,115,112,97,116,99,104,101,114,65,0,54,0,67,108,111,115,101,72,97,110,100,
-  108,101,0,62,0,67,111,110,110,101,99,116,78,97,109,101,100,80,105,112,101,0,
-  0,82,0,67,114,101,97,116,101,69,118,101,110,116,65,0,0,101,0,67,114,101,97,
-  116,101,78,97,109,101,100,80,105,112,101,65,0,0,115,0,67,114,101,97,116,101,
-  84,104,114,101,97,100,0,0,134,0,68,101,108,101,116,101,67,114,105,116,105,99,
-  97,108,83,101,99,116,105,111,110,0,145,0,68,105,115,99,111,110,110,101,99,
-  116,78,97,109,101,100,80,105,112,101,0,157,0,69,110,116,101,114,67,114,105,
-  116,105,99,97,108,83,101,99,116,105,111,110,0,0,243,0,70,108,117,115,104,70,
-  105,108,101,66,117,102,102,101,114,115,0,0,253,0,70,114,101,101,76,105,98,
-  114,97,114,121,0,71,1,71,101,116,67,117,114,114,101,110,116,80,114,111,99,
-  101,115,115,0,72,1,71,101,116,67,117,114,114,101,110,116,80,114,111,99,101,
-  115,115,73,100,0,74,1,71,101,116,67,117,114,114,101,110,116,84,104,114,101,
-  97,100,0,0,75,1,71,101,116,67,117,114,114,101,110,116,84,104,114,101,97,100,
-  73,100,0,0,95,1,71,101,116,69,120,105,116,67,111,100,101,80,114,111,99,101,
-  115,115,0,0,117,1,71,101,116,76,97,115,116,69,114,114,111,114,0,0,131,1,71,
-  101,116,77,111,100,117,108,101,72,97,110,100,108,101,65,0,0,152,1,71,101,116,
-  79,118,101,114,108,97,112,112,101,100,82,101,115,117,108,116,0,164,1,71,101,
-  116,80,114,111,99,65,100,100,114,101,115,115,0,0,187,1,71,101,116,83,116,97,
-  114,116,117,112,73,110,102,111,65,0,206,1,71,101,116,83,121,115,116,101,109,
-  84,105,109,101,65,115,70,105,108,101,84,105,109,101,0,227,1,71,101,116,84,
-  105,99,107,67,111,117,110,116,0,0,39,2,73,110,105,116,105,97,108,105,122,101,
-  67,114,105,116,105,99,97,108,83,101,99,116,105,111,110,0,79,2,76,101,97,118,
-  101,67,114,105,116,105,99,97,108,83,101,99,116,105,111,110,0,0,80,2,76,111,
-  97,100,76,105,98,114,97,114,121,65,0,0,86,2,76,111,99,97,108,65,108,108,111,
-  99,0,0,161,2,81,117,101,114,121,80,101,114,102,111,114,109,97,110,99,101,67,
-  111,117,110,116,101,114,0,179,2,82,101,97,100,70,105,108,101,0,0,205,2,82,
-  101,115,101,116,69,118,101,110,116,0,0,209,2,82,116,108,65,100,100,70,117,
-  110,99,116,105,111,110,84,97,98,108,101,0,210,2,82,116,108,67,97,112,116,117,
-  114,101,67,111,110,116,101,120,116,0,217,2,82,116,108,76,111,111,107,117,112,
-  70,117,110,99,116,105,111,110,69,110,116,114,121,0,0,224,2,82,116,108,86,105,
-  114,116,117,97,108,85,110,119,105,110,100,0,0,45,3,83,101,116,72,97,110,100,
-  108,101,73,110,102,111,114,109,97,116,105,111,110,0,0,82,3,83,101,116,85,110,
-  104,97,110,100,108,101,100,69,120,99,101,112,116,105,111,110,70,105,108,116,
-  101,114,0,94,3,83,108,101,101,112,0,102,3,84,101,114,109,105,110,97,116,101,
-  80,114,111,99,101,115,115,0,0,109,3,84,108,115,71,101,116,86,97,108,117,101,
-  0,118,3,85,110,104,97,110,100,108,101,100,69,120,99,101,112,116,105,111,110,
-  70,105,108,116,101,114,0,0,142,3,86,105,114,116,117,97,108,80,114,111,116,
-  101,99,116,0,0,144,3,86,105,114,116,117,97,108,81,117,101,114,121,0,0,150,3,
-  87,97,105,116,70,111,114,77,117,108,116,105,112,108,101,79,98,106,101,99,116,
-  115,0,0,172,3,87,114,105,116,101,70,105,108,101,0,76,0,95,115,116,114,100,
-  117,112,0,78,0,95,95,100,108,108,111,110,101,120,105,116,0,81,0,95,95,103,
-  101,116,109,97,105,110,97,114,103,115,0,82,0,95,95,105,110,105,116,101,110,
-  118,0,83,0,95,95,105,111,98,95,102,117,110,99,0,0,90,0,95,95,108,99,111,110,
-  118,95,105,110,105,116,0,0,96,0,95,95,115,101,116,95,97,112,112,95,116,121,
-  112,101,0,0,98,0,95,95,115,101,116,117,115,101,114,109,97,116,104,101,114,
-  114,0,0,112,0,95,97,99,109,100,108,110,0,119,0,95,97,109,115,103,95,101,120,
-  105,116,0,0,130,0,95,99,101,120,105,116,0,0,198,0,95,102,109,111,100,101,0,0,
-  245,0,95,105,110,105,116,116,101,114,109,0,34,1,95,108,111,99,107,0,111,1,95,
-  111,110,101,120,105,116,0,208,1,95,117,110,108,111,99,107,0,213,1,95,118,115,
-  110,112,114,105,110,116,102,0,0,50,2,97,98,111,114,116,0,59,2,97,116,111,105,
-  0,0,62,2,99,97,108,108,111,99,0,0,71,2,101,120,105,116,0,0,85,2,102,112,114,
-  105,110,116,102,0,91,2,102,114,101,101,0,0,99,2,102,119,114,105,116,101,0,0,
-  142,2,109,97,108,108,111,99,0,0,148,2,109,101,109,99,112,121,0,0,173,2,115,
-  105,103,110,97,108,0,0,176,2,115,112,114,105,110,116,102,0,181,2,115,116,114,
-  99,104,114,0,0,188,2,115,116,114,108,101,110,0,0,190,2,115,116,114,110,99,
-  109,112,0,195,2,115,116,114,115,116,114,0,0,215,2,118,102,112,114,105,110,
-  116,102,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,
-  112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,0,0,112,0,
-  0,65,68,86,65,80,73,51,50,46,100,108,108,0,0,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,
-  112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,20,112,0,0,75,69,82,78,
-  69,76,51,50,46,100,108,108,0,0,0,0,40,112,0,0,109,115,118,99,114,116,46,100,
-  108,108,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,
-  0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,
-  0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,
-  0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,
-  0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,60,112,0,0,109,115,118,99,114,
-  116,46,100,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,64,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,16,64,0,0,0,0,0,32,40,64,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,39,64,0,0,0,0,0,128,39,64,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,65,144,64,0,0,0,0,0,68,144,64,0,0,0,0,0,112,96,64,0,
-  0,0,0,0,64,128,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+unsigned int winexesvc64_exe_zlen = 8037;
+unsigned char winexesvc64_exe_z[] = {
+  120,249,204,104,3,57,237,61,11,116,20,85,150,213,157,52,52,132,208,65,105,
+  137,72,160,197,68,18,36,152,134,4,18,33,144,38,29,172,134,14,9,144,0,74,52,
+  132,124,4,9,73,76,170,65,24,84,176,19,156,218,162,53,163,226,186,243,113,85,
+  198,249,168,235,103,28,129,160,163,29,130,9,248,5,148,63,34,126,102,166,98,
+  131,242,81,64,252,212,222,123,223,171,78,119,39,176,238,204,217,221,217,93,
+  114,78,231,214,251,223,119,223,125,247,221,247,94,213,189,249,255,0,254,159,
+  43,214,246,22,102,133,248,127,62,33,92,111,140,49,26,51,133,209,180,120,51,
+  255,207,86,221,113,115,78,151,19,103,99,151,203,100,19,189,12,198,125,26,67,
+  228,144,13,66,151,255,231,48,167,207,221,157,64,135,249,131,174,19,132,175,
+  98,255,14,130,54,11,66,252,223,225,15,250,241,81,28,161,209,221,253,65,219,
+  66,252,65,159,208,73,129,221,30,19,233,151,185,48,232,15,250,4,110,100,10,
+  225,135,86,225,210,187,229,11,250,131,174,235,75,14,167,47,48,206,11,130,254,
+  160,137,54,232,7,26,77,168,222,208,131,31,234,220,89,69,130,238,122,90,247,
+  87,45,70,230,203,241,143,150,170,169,93,145,211,140,242,77,235,230,175,250,
+  146,127,233,255,226,63,209,123,204,44,122,183,153,219,44,195,86,243,112,166,
+  98,26,7,28,227,84,98,39,3,112,251,76,231,10,32,222,103,237,36,16,139,126,213,
+  100,211,87,20,48,29,71,128,47,55,168,63,73,193,232,61,24,246,110,203,132,234,
+  26,245,250,147,171,214,100,63,244,165,166,229,223,220,97,250,190,64,224,158,
+  112,206,6,159,78,6,159,2,252,73,90,97,247,43,177,39,169,161,251,10,200,98,
+  192,220,22,50,99,153,0,173,136,29,173,120,43,161,254,108,16,250,98,58,68,24,
+  152,156,55,17,200,71,160,152,254,0,250,154,28,167,22,160,13,21,235,149,5,228,
+  46,168,175,98,122,189,128,94,115,248,137,221,15,56,38,3,142,57,2,153,242,84,
+  219,147,5,33,240,91,12,139,229,214,36,192,21,186,246,201,23,8,162,141,107,50,
+  81,70,89,154,240,163,17,203,166,194,120,209,39,198,87,173,57,31,99,144,102,
+  35,48,90,154,10,240,101,251,205,216,223,254,150,181,248,142,136,83,89,141,30,
+  71,243,154,252,150,245,126,203,70,127,231,245,104,9,209,50,204,73,4,108,1,
+  188,53,235,151,229,216,227,20,222,99,142,81,85,179,119,69,9,84,130,110,167,
+  237,126,111,11,249,16,131,58,58,191,192,79,117,176,188,163,216,238,111,193,
+  57,232,40,194,87,45,196,53,199,240,118,210,169,36,181,205,192,202,139,18,109,
+  121,77,159,137,242,190,211,226,51,150,38,252,16,188,82,84,162,147,240,3,104,
+  81,153,103,182,251,79,136,150,23,19,198,207,131,32,16,34,67,204,106,179,52,
+  222,100,196,196,236,189,11,241,54,49,208,135,226,242,32,174,69,5,1,170,237,
+  19,229,19,84,200,200,10,121,62,82,76,189,231,161,249,15,242,93,141,95,235,41,
+  166,51,115,233,43,228,198,26,116,157,102,250,93,62,235,148,98,58,50,151,76,
+  237,90,26,147,32,161,233,144,167,47,34,112,159,105,211,92,26,37,148,113,136,
+  70,191,60,187,127,11,251,54,75,219,169,30,140,39,42,189,111,68,42,101,45,164,
+  97,69,127,114,170,33,129,18,166,101,99,225,132,7,64,24,105,239,139,216,234,
+  96,35,241,231,77,152,32,183,106,214,198,50,86,111,31,200,141,246,13,161,210,
+  175,135,33,145,18,30,203,199,81,57,36,73,208,250,50,236,239,14,81,17,2,3,26,
+  119,91,214,111,109,220,33,141,110,220,45,141,20,189,126,131,101,99,220,234,
+  243,182,187,255,42,191,229,61,109,88,125,126,184,197,249,86,224,175,108,252,
+  130,169,247,68,55,238,246,156,56,227,76,44,49,64,227,127,60,134,222,44,76,
+  217,115,96,9,69,81,42,202,214,153,115,144,109,208,38,132,108,202,64,151,190,
+  169,27,220,72,55,251,25,95,190,65,44,223,33,182,126,28,165,150,92,43,8,46,
+  121,155,221,223,116,28,198,96,45,100,184,219,33,42,253,134,121,219,13,106,38,
+  164,57,125,139,12,249,229,199,221,114,167,106,167,172,209,67,68,101,224,176,
+  124,89,133,174,138,222,54,179,58,28,162,179,190,190,231,77,177,252,56,176,
+  235,113,154,116,138,213,9,53,185,58,162,163,89,208,84,6,36,113,203,73,215,66,
+  172,18,59,196,141,248,197,185,21,211,80,55,101,182,0,80,23,14,64,18,89,7,161,
+  211,57,211,215,211,145,80,187,45,141,26,113,87,236,1,10,239,240,196,168,175,
+  36,225,192,238,129,176,184,102,219,163,220,100,132,163,196,113,75,27,209,199,
+  178,9,237,98,197,4,249,93,49,29,44,22,4,122,193,8,25,161,105,39,140,71,203,
+  48,156,115,43,169,162,87,139,121,194,145,239,145,195,113,28,87,44,161,113,94,
+  8,64,189,37,9,25,234,161,98,182,62,116,226,171,174,162,188,75,179,254,190,20,
+  66,87,99,200,103,93,204,242,79,91,130,89,23,21,51,222,83,175,129,146,157,43,
+  41,71,236,53,19,56,175,84,53,91,154,118,179,184,171,244,56,75,147,159,197,
+  244,193,24,235,242,82,98,30,75,227,118,252,180,237,41,124,139,175,85,61,2,
+  234,10,159,191,228,100,108,214,116,38,61,213,95,13,33,121,151,220,89,129,118,
+  195,80,126,80,250,152,233,28,139,187,244,116,39,79,135,41,43,191,133,153,68,
+  197,16,225,31,94,122,141,189,167,208,66,158,230,26,18,177,36,206,157,20,3,99,
+  231,241,148,160,237,220,140,210,15,43,197,151,139,200,63,188,165,177,29,229,
+  196,125,40,193,179,31,164,8,52,175,65,222,226,165,223,195,0,15,37,215,120,34,
+  72,193,14,44,40,202,7,230,223,170,125,130,248,100,155,41,251,203,84,30,13,
+  124,103,27,209,157,86,35,218,160,32,39,243,30,63,96,132,111,245,169,31,95,
+  163,99,132,166,91,16,163,167,40,65,219,137,117,18,86,128,81,246,122,108,116,
+  17,57,172,247,52,66,89,100,65,245,169,96,217,95,8,156,190,149,144,159,18,195,
+  203,219,207,116,126,67,194,142,173,31,228,225,94,218,156,189,14,209,4,124,45,
+  77,169,200,91,163,245,116,42,70,226,145,141,15,125,190,199,40,104,191,6,109,
+  229,72,31,170,231,174,226,249,128,191,58,219,32,43,203,68,157,234,119,141,94,
+  199,211,88,71,51,75,34,156,79,14,215,147,30,248,33,248,129,227,28,81,126,23,
+  134,240,253,45,215,243,197,77,253,100,56,147,139,151,109,41,161,121,127,82,
+  221,201,98,164,216,118,100,76,209,32,202,13,230,64,127,88,82,62,202,164,12,
+  162,140,6,161,99,182,144,133,193,13,60,115,47,204,172,249,33,45,142,200,193,
+  252,199,183,57,230,58,230,56,138,157,190,219,53,16,248,46,223,34,243,92,81,
+  126,111,142,91,110,231,124,36,186,149,236,195,37,184,76,75,137,19,3,133,121,
+  32,209,228,234,68,155,131,202,139,242,65,81,233,239,208,246,1,122,177,154,
+  181,168,68,119,188,62,214,65,235,94,190,124,66,148,63,135,44,154,85,44,161,
+  165,113,176,119,85,226,68,65,186,28,29,198,247,23,181,54,135,124,216,145,242,
+  157,67,123,103,197,83,237,81,200,201,162,83,62,170,207,120,199,173,142,210,
+  54,90,133,0,21,223,18,51,44,70,98,52,118,89,74,76,115,203,235,18,127,26,141,
+  120,173,75,92,141,80,110,36,232,146,119,110,17,40,188,46,49,45,154,147,227,
+  172,102,77,190,133,45,130,59,52,232,194,169,231,68,249,20,245,67,60,187,203,
+  233,115,104,162,18,163,89,151,18,138,158,17,154,85,153,175,119,100,48,235,
+  136,219,215,152,56,145,106,251,156,178,174,156,143,114,13,30,82,230,147,53,4,
+  74,91,179,13,177,163,151,98,28,197,64,77,81,126,167,5,85,84,236,128,247,216,
+  157,234,46,27,141,132,40,183,121,172,162,146,143,162,40,109,60,140,208,96,
+  100,1,156,206,220,121,188,136,222,227,177,147,54,151,247,109,16,71,103,95,
+  188,12,194,114,167,40,151,36,194,180,206,99,10,145,146,103,182,31,71,35,129,
+  234,1,40,227,38,171,192,216,26,204,61,117,4,243,33,63,205,237,75,93,5,210,59,
+  112,157,40,159,199,248,223,98,237,89,251,61,131,114,126,170,186,229,143,129,
+  12,65,63,242,151,55,250,37,139,203,251,70,156,75,185,11,176,212,60,111,7,128,
+  19,78,58,180,98,51,208,228,113,50,192,41,42,102,205,58,254,102,236,186,30,
+  186,178,43,148,241,33,233,70,102,109,47,143,16,109,248,232,6,221,109,188,141,
+  225,117,61,192,192,149,20,7,157,47,27,135,195,181,95,29,140,78,152,38,48,153,
+  115,103,80,218,235,130,108,158,168,184,50,197,166,29,150,70,212,226,81,3,73,
+  83,247,49,39,242,3,97,8,160,158,73,80,15,243,32,191,22,37,153,47,55,89,255,
+  232,204,65,74,29,210,38,71,68,195,103,175,49,166,69,51,26,248,158,183,102,61,
+  56,143,244,138,166,2,3,138,230,135,111,194,204,204,252,121,50,84,108,30,199,
+  58,151,131,53,164,229,164,157,193,246,72,25,189,13,91,27,76,126,227,211,5,
+  105,140,102,181,99,81,159,51,81,220,162,25,44,76,75,88,75,117,123,150,105,
+  214,137,55,145,254,112,36,3,48,146,153,3,81,81,137,34,250,185,88,38,171,102,
+  29,196,50,29,226,153,94,66,193,101,253,28,146,65,121,113,251,220,161,53,167,
+  179,66,67,52,235,39,243,136,15,161,220,123,172,156,253,140,250,22,58,135,159,
+  139,100,128,146,78,101,58,126,64,128,159,231,8,248,90,158,17,59,46,18,9,136,
+  24,154,245,117,82,173,60,87,105,214,245,193,202,54,176,202,160,199,234,93,80,
+  27,149,209,172,223,207,101,253,245,36,106,214,86,86,106,176,102,45,157,71,
+  120,255,140,21,129,242,234,52,114,5,15,131,57,143,222,79,117,20,209,155,106,
+  250,60,94,115,44,142,244,65,151,89,53,15,229,19,162,29,164,117,52,99,17,19,
+  119,10,95,28,141,200,125,2,205,200,111,136,190,85,137,11,160,141,233,208,70,
+  235,159,227,162,150,228,136,242,55,14,89,85,95,39,141,205,52,47,159,168,164,
+  27,226,161,143,36,12,220,39,175,1,185,64,31,246,76,50,204,13,133,221,74,210,
+  141,80,181,67,251,128,228,161,230,247,216,160,255,115,245,254,127,151,142,
+  157,105,117,201,231,212,187,208,251,251,107,81,212,199,129,212,71,80,140,190,
+  81,243,88,203,71,220,255,217,150,89,147,241,188,201,225,193,38,223,239,106,
+  178,47,54,233,96,77,30,75,15,54,185,123,8,53,185,228,111,108,210,198,155,124,
+  126,142,222,228,51,93,77,254,51,122,120,223,102,212,83,90,89,171,234,106,136,
+  182,239,22,149,233,113,154,181,247,28,26,241,171,65,78,206,209,189,220,242,9,
+  184,33,29,157,124,99,21,203,141,168,96,64,129,120,205,186,183,88,47,48,49,
+  178,192,3,88,224,26,44,48,81,47,0,152,61,21,44,16,19,89,96,21,22,56,133,95,
+  31,24,72,23,127,54,113,167,129,54,21,119,80,111,166,199,177,245,136,22,87,81,
+  107,135,77,5,58,59,236,138,163,8,91,88,4,8,219,94,68,159,47,81,216,62,156,
+  184,192,128,116,221,225,194,37,107,223,139,131,81,226,22,145,129,62,76,88,68,
+  138,19,174,24,133,34,80,58,135,105,189,185,113,107,214,37,162,123,64,129,144,
+  153,158,44,134,124,185,27,28,29,54,30,141,137,47,80,38,24,122,93,58,97,228,
+  102,22,105,195,103,63,9,161,17,69,108,171,115,90,151,18,133,144,248,112,226,
+  9,202,248,48,235,55,132,207,81,24,68,172,117,106,49,101,196,149,25,186,97,1,
+  250,240,197,217,39,130,22,224,230,130,58,158,17,183,151,102,125,14,26,112,
+  208,58,232,39,241,136,165,78,80,211,21,148,7,48,49,19,39,172,163,198,164,56,
+  204,96,166,221,210,18,40,26,184,162,131,101,64,71,237,91,240,159,102,141,34,
+  20,166,199,195,34,16,15,89,80,236,79,39,225,191,142,143,83,70,235,108,22,189,
+  46,113,63,54,181,215,169,232,173,224,240,190,50,6,134,247,242,115,32,183,64,
+  12,245,47,210,163,55,142,225,12,122,66,61,115,22,197,16,114,201,111,103,179,
+  182,52,235,175,216,19,240,230,67,236,9,82,111,10,166,22,4,83,243,216,83,178,
+  102,157,48,155,150,105,20,64,204,35,187,163,164,173,152,164,211,220,16,189,
+  249,14,51,42,89,75,174,68,66,191,129,90,237,113,9,54,185,217,245,195,144,183,
+  222,160,133,248,188,90,130,201,89,170,75,246,123,210,153,94,65,171,169,168,
+  237,128,157,151,99,245,68,179,224,25,194,122,97,193,94,108,70,187,190,106,
+  218,89,221,41,59,231,235,168,49,184,4,158,80,7,157,197,253,56,211,185,81,125,
+  8,23,153,222,99,54,183,82,102,134,21,91,221,19,223,133,149,165,241,16,241,72,
+  246,9,148,163,62,143,129,116,157,243,106,43,230,201,58,129,168,141,232,17,53,
+  155,199,50,205,231,54,24,212,7,208,0,91,110,122,224,39,80,201,134,161,92,89,
+  58,175,174,102,21,244,80,122,245,170,20,3,148,22,125,238,254,6,117,38,149,78,
+  11,100,67,233,91,186,74,79,225,165,83,47,80,218,202,74,63,52,8,75,228,102,
+  134,209,35,206,142,74,227,81,181,247,25,78,15,27,31,165,217,142,22,27,113,
+  182,77,119,21,1,11,201,11,196,189,141,228,114,2,103,234,163,250,153,19,60,
+  235,14,104,219,153,129,71,132,79,80,26,232,139,143,179,240,147,60,126,3,135,
+  191,230,240,41,60,238,69,9,90,24,98,80,41,135,195,110,211,59,212,251,187,102,
+  45,43,100,179,183,141,70,134,161,196,164,245,2,244,228,142,6,158,185,163,246,
+  69,2,87,103,208,72,244,42,170,5,52,88,126,80,137,90,109,51,23,17,104,12,185,
+  133,173,213,179,169,118,207,226,45,216,106,75,14,197,93,63,83,215,42,165,153,
+  76,254,161,138,240,13,59,137,154,12,82,193,173,48,106,240,196,3,154,117,32,
+  85,35,13,239,48,13,158,202,78,147,69,57,225,170,169,220,94,98,135,105,224,84,
+  70,59,116,220,14,211,5,201,60,159,111,20,248,169,16,168,101,234,226,80,31,
+  238,139,12,168,58,101,28,44,64,144,244,41,2,88,180,221,110,37,245,35,124,150,
+  191,110,65,148,213,119,173,216,231,58,152,96,109,180,135,178,251,1,65,125,47,
+  113,150,48,60,253,140,190,94,249,76,247,228,245,184,214,57,90,52,125,141,211,
+  151,61,92,235,114,96,143,253,249,104,92,213,247,192,86,16,20,231,40,207,149,
+  76,42,228,22,48,229,226,121,43,25,71,124,133,74,159,34,66,165,21,48,13,208,
+  71,196,124,176,64,95,120,108,76,255,95,161,111,100,206,97,1,212,248,239,97,
+  148,93,208,130,135,232,234,247,3,177,170,120,151,220,170,152,102,78,96,238,
+  124,221,62,211,119,167,65,157,245,203,166,73,19,80,130,57,204,98,119,78,121,
+  111,6,219,214,197,98,173,123,8,207,61,129,65,136,211,158,206,247,208,117,169,
+  18,227,96,130,20,1,32,127,10,154,234,124,249,7,82,147,231,133,109,145,194,
+  191,239,23,125,25,127,29,76,123,71,81,173,233,143,244,94,149,104,35,106,159,
+  126,10,166,94,34,208,227,154,25,116,106,32,162,183,246,54,20,122,222,111,208,
+  125,194,55,81,210,101,218,14,230,165,29,173,144,233,94,218,227,157,66,208,75,
+  251,64,39,55,62,109,50,58,245,99,85,115,88,28,227,107,235,167,185,56,3,98,
+  191,203,197,206,62,157,79,140,11,125,53,93,207,218,78,214,142,210,137,36,158,
+  7,219,119,0,23,192,242,26,73,36,32,228,90,60,94,179,110,200,39,182,102,124,
+  210,180,67,130,245,172,46,159,31,106,102,182,193,150,121,47,52,152,14,57,103,
+  227,70,49,54,57,149,157,51,119,152,110,134,214,153,179,246,162,92,129,59,107,
+  159,145,43,112,103,237,98,174,142,247,148,224,211,196,224,211,56,254,164,89,
+  223,118,243,41,102,26,157,139,246,47,21,129,41,251,163,228,3,192,21,106,22,
+  57,133,132,190,198,81,151,19,254,4,217,165,44,217,116,124,10,125,149,61,10,
+  112,195,247,197,58,76,59,167,232,20,195,48,107,101,39,127,146,77,91,167,224,
+  129,81,192,222,97,250,221,20,129,59,101,127,110,74,144,158,15,81,21,79,240,8,
+  237,125,182,152,127,236,102,231,225,193,239,192,240,188,157,232,98,110,11,
+  158,39,53,237,150,226,189,231,163,36,102,116,134,29,4,235,231,27,234,51,177,
+  124,222,83,124,51,77,238,100,111,246,229,87,162,75,245,190,29,166,222,87,50,
+  194,121,207,27,165,203,188,231,13,210,228,208,227,131,102,209,151,176,130,
+  118,0,25,245,8,178,78,75,71,81,107,129,25,98,196,115,151,54,51,68,121,142,
+  135,22,81,179,98,241,91,208,230,46,124,129,43,236,249,132,128,89,59,26,241,
+  61,9,165,203,219,121,135,114,132,208,48,217,215,97,11,100,26,144,255,69,7,
+  116,231,109,218,71,226,236,7,102,146,150,177,147,154,247,6,16,47,54,99,134,
+  103,48,131,18,139,239,142,80,30,245,231,24,129,142,96,112,72,65,215,58,192,
+  182,120,27,168,140,27,45,46,182,169,107,53,182,11,130,100,211,52,172,5,125,
+  200,82,221,16,145,130,17,171,48,187,188,95,68,183,78,109,36,101,127,67,167,
+  160,109,24,3,9,243,219,186,206,247,212,27,25,146,134,43,217,169,124,68,127,
+  23,225,70,31,182,56,18,110,212,86,129,198,9,106,231,60,183,92,145,184,192,
+  155,213,107,89,13,80,60,251,58,96,67,126,159,2,234,10,40,7,160,228,45,6,245,
+  107,69,156,250,109,28,177,203,168,235,72,3,92,224,146,79,194,30,27,75,167,97,
+  61,201,88,163,77,61,18,71,179,7,45,83,137,10,182,163,96,59,10,182,163,64,59,
+  128,213,34,142,175,50,0,228,112,12,86,86,62,176,25,175,43,96,222,250,18,198,
+  141,132,33,108,164,241,240,37,116,166,128,96,146,52,126,62,233,75,104,193,
+  112,69,87,152,210,139,186,194,46,40,220,233,236,10,15,192,48,206,222,8,254,
+  229,254,75,217,0,103,138,48,58,243,80,39,7,82,192,106,234,6,205,118,17,27,
+  192,62,212,227,216,123,71,226,172,20,23,56,54,95,165,175,118,234,15,22,164,
+  144,4,153,62,179,48,122,136,242,65,84,184,142,67,80,61,97,161,241,184,51,31,
+  231,118,9,116,27,72,190,200,13,67,6,52,170,19,229,119,97,35,128,103,12,152,2,
+  117,44,66,34,213,225,25,69,27,221,131,56,200,239,157,102,189,118,26,59,96,
+  187,13,45,90,123,207,69,123,38,2,193,233,192,229,164,250,23,102,228,30,163,
+  165,141,222,115,57,210,139,184,149,47,113,162,57,119,58,145,32,166,210,172,7,
+  93,64,207,245,72,15,204,244,58,101,114,108,206,161,241,237,202,245,71,204,
+  245,36,116,117,83,10,169,141,91,200,241,30,121,182,27,29,114,31,54,207,169,
+  152,242,50,144,249,74,112,208,37,40,15,29,202,193,225,23,243,154,252,200,11,
+  133,210,8,236,87,26,246,43,19,251,149,131,131,47,226,224,23,226,242,210,37,
+  31,96,244,83,70,34,72,24,62,18,5,144,154,206,100,152,40,111,21,83,14,138,222,
+  243,189,239,126,25,254,199,220,61,66,73,69,155,84,77,199,61,9,74,246,249,20,
+  180,129,238,185,92,201,248,42,133,216,241,36,70,156,17,45,206,131,74,12,90,
+  195,110,194,235,155,217,209,104,197,122,37,61,154,209,101,76,211,47,112,183,
+  224,109,235,39,250,178,95,194,130,89,109,22,239,108,154,159,25,47,189,143,
+  160,58,209,230,122,85,255,110,72,153,30,173,92,238,84,114,205,14,203,70,191,
+  104,56,37,26,78,122,207,197,185,149,190,150,198,167,33,203,242,6,239,57,179,
+  165,241,75,234,69,236,105,88,90,32,223,206,224,246,75,125,2,205,202,65,19,80,
+  249,84,104,204,226,237,196,197,213,151,234,162,150,86,37,142,194,241,128,54,
+  28,228,192,19,71,212,208,169,24,162,162,80,170,161,237,68,149,206,245,179,78,
+  215,31,234,124,62,120,62,236,61,103,147,230,195,32,122,214,185,82,118,185,
+  163,250,56,54,51,41,241,57,50,172,77,245,97,17,236,96,214,183,150,123,209,77,
+  125,39,26,82,179,108,50,84,53,249,87,72,80,68,140,197,190,185,124,209,6,18,
+  67,14,114,235,6,197,213,217,80,50,176,173,25,253,218,172,184,29,235,238,115,
+  52,36,87,52,207,149,138,185,30,179,108,52,52,250,87,164,179,234,180,176,234,
+  12,60,99,52,158,96,213,99,90,202,174,96,114,160,185,25,107,54,108,103,161,93,
+  150,97,66,104,248,81,32,163,52,2,40,119,219,119,193,243,106,92,46,108,138,
+  129,93,52,140,167,139,6,203,189,247,9,252,74,70,191,108,232,213,79,63,158,
+  119,176,203,6,75,211,229,6,190,128,219,230,183,241,75,6,188,140,183,172,253,
+  87,60,149,95,79,199,241,120,223,211,120,16,195,143,232,97,207,91,250,145,255,
+  31,98,244,58,99,245,58,119,10,93,107,25,84,27,114,255,176,30,171,198,242,203,
+  107,248,5,132,87,191,128,176,52,161,48,215,47,33,74,130,181,190,203,47,33,
+  158,227,151,16,116,84,223,220,57,13,254,211,29,136,228,164,251,15,75,211,56,
+  28,198,88,46,207,236,135,58,123,179,203,169,144,251,5,75,35,74,124,118,199,
+  208,212,187,251,253,130,142,174,147,95,45,240,198,58,143,252,16,188,194,8,
+  222,47,188,25,188,95,32,202,62,139,110,26,14,73,155,213,134,40,178,7,71,215,
+  12,33,151,12,235,250,178,232,135,194,175,37,60,60,26,157,146,87,193,95,152,
+  252,64,153,145,198,78,155,65,112,100,162,224,200,65,169,33,186,241,0,68,205,
+  50,35,11,181,43,38,193,142,20,58,227,185,14,101,73,50,202,146,52,148,37,153,
+  40,75,114,80,150,128,64,169,230,2,69,175,31,212,150,93,192,70,235,233,222,
+  237,149,52,126,141,213,110,102,180,30,192,118,131,207,135,224,227,179,182,64,
+  174,22,186,97,246,165,166,142,193,43,203,164,107,9,164,222,243,61,58,102,103,
+  183,209,162,252,165,35,229,43,71,202,215,47,218,40,180,47,112,61,142,71,187,
+  243,67,161,143,83,174,254,48,26,166,157,65,41,236,39,15,138,42,52,59,229,219,
+  204,14,88,99,228,185,16,221,209,79,244,126,107,147,174,64,37,251,195,94,76,
+  43,223,142,110,26,26,107,112,126,200,39,228,131,128,241,216,52,20,246,31,231,
+  114,14,235,52,179,5,171,88,148,255,140,119,54,144,195,62,86,16,112,58,212,
+  105,214,173,76,19,28,148,142,72,23,171,176,135,193,202,241,226,22,42,135,205,
+  2,187,255,18,125,121,160,44,21,171,176,94,216,119,4,207,142,112,174,165,65,
+  210,126,118,80,237,51,29,24,163,191,3,113,79,95,186,108,245,143,165,155,101,
+  57,99,242,88,164,162,21,210,251,68,11,254,14,19,30,53,176,9,110,26,56,134,
+  178,222,130,75,156,156,7,75,189,233,102,246,184,93,179,58,115,73,34,14,176,
+  96,143,230,146,130,126,7,232,149,91,176,18,218,20,141,133,56,117,183,25,237,
+  203,136,74,158,25,223,123,24,75,232,226,227,39,80,115,231,50,141,191,47,64,
+  250,202,230,49,79,126,148,250,47,215,177,37,7,150,146,4,92,247,122,82,96,64,
+  218,74,169,226,217,247,97,191,249,22,102,185,168,2,194,223,103,112,3,53,244,
+  29,160,102,141,159,130,59,204,10,60,188,127,195,129,135,195,154,21,63,218,
+  144,59,228,227,154,53,106,10,43,96,147,219,101,216,54,12,193,188,99,43,32,
+  120,70,164,249,131,47,160,185,236,199,92,246,239,92,246,175,92,87,111,115,
+  203,71,93,89,135,197,179,59,165,120,183,156,100,39,164,77,99,0,116,46,12,246,
+  111,243,219,183,216,118,87,125,0,140,240,234,88,222,203,192,238,112,253,244,
+  208,167,97,250,10,30,34,121,179,47,27,135,235,90,194,170,62,176,25,184,217,
+  251,173,38,101,192,52,189,10,214,154,219,33,166,139,191,229,253,218,192,118,
+  111,192,224,57,67,23,167,190,216,0,105,201,157,31,124,173,203,19,40,50,30,
+  138,4,122,19,62,114,155,47,215,0,107,175,119,226,94,193,115,42,240,12,148,
+  184,105,56,29,177,29,201,161,35,54,218,167,60,2,203,191,52,4,230,206,130,225,
+  252,64,96,103,14,117,110,41,36,116,214,208,138,26,155,58,188,171,64,37,196,
+  123,222,131,200,196,144,200,66,140,220,2,145,22,140,180,254,41,7,185,109,114,
+  70,144,199,210,224,49,240,243,170,72,249,97,86,76,253,51,104,147,108,34,186,
+  116,152,190,213,149,6,8,118,118,211,87,64,114,152,214,227,2,161,144,12,72,
+  128,125,131,98,106,196,8,95,33,236,13,114,128,233,172,158,126,108,94,126,170,
+  88,183,166,211,235,54,160,192,196,62,159,206,246,131,87,193,158,41,93,223,
+  173,61,54,25,79,128,76,15,164,235,47,32,133,105,216,184,45,86,76,107,211,25,
+  175,38,115,81,167,75,57,104,97,104,79,194,12,55,203,58,63,198,46,78,167,115,
+  218,201,52,197,27,9,133,67,210,4,81,201,142,206,161,129,200,159,76,151,249,
+  172,127,176,185,223,39,2,151,238,133,170,251,227,81,98,31,145,220,245,118,98,
+  47,231,199,65,81,207,97,64,232,166,201,108,54,32,7,244,73,103,74,107,68,251,
+  218,81,253,254,31,119,97,55,214,95,1,91,58,143,137,236,161,5,247,111,85,205,
+  109,116,157,168,152,126,61,150,222,123,240,124,6,21,110,38,49,113,255,88,157,
+  66,37,147,96,220,222,210,223,159,88,57,150,198,234,138,14,83,245,88,54,76,33,
+  219,68,80,249,99,87,140,197,66,207,99,161,67,205,179,217,121,164,98,202,165,
+  98,30,139,190,134,235,251,17,95,172,139,242,247,158,68,123,174,138,177,108,
+  136,6,43,134,172,253,30,115,96,18,66,41,69,148,223,20,21,23,116,127,135,231,
+  11,40,114,5,21,41,154,212,165,18,4,249,67,113,196,137,242,148,56,245,52,172,
+  111,129,15,88,208,212,31,242,7,142,113,122,100,42,166,141,99,216,120,218,112,
+  60,97,80,223,199,33,77,147,223,213,199,211,70,155,0,164,103,26,29,25,116,241,
+  223,150,120,253,120,77,237,196,43,23,185,131,173,200,77,154,212,14,136,221,5,
+  21,203,227,69,185,212,172,89,51,232,197,32,211,131,99,168,151,229,212,100,
+  118,35,129,27,227,52,235,35,217,136,125,160,135,253,107,213,154,172,252,155,
+  165,222,124,91,35,150,59,38,138,134,214,53,89,248,218,151,231,115,187,191,
+  106,205,138,248,24,163,229,97,150,92,213,125,62,241,18,78,203,166,153,189,44,
+  155,28,3,243,128,253,83,45,155,252,176,37,50,196,219,119,4,96,13,243,39,59,
+  149,156,126,121,114,171,43,107,215,242,62,206,168,28,179,59,107,107,125,95,
+  111,171,193,153,181,171,254,163,224,137,128,192,240,201,46,223,142,239,203,
+  73,3,120,66,72,123,229,214,166,237,244,126,218,148,237,161,239,167,121,246,
+  84,173,185,19,208,244,188,3,104,228,0,26,133,128,134,95,122,221,178,105,55,
+  160,17,23,111,223,29,48,179,241,240,39,159,201,25,97,3,62,135,81,127,82,244,
+  118,26,188,91,1,137,173,245,127,14,60,216,213,254,167,29,216,62,180,114,24,
+  30,164,190,33,248,149,91,77,216,176,97,235,154,27,168,221,207,170,214,172,
+  196,118,15,7,14,235,251,127,40,191,65,47,255,203,238,229,223,232,232,177,60,
+  224,61,171,151,75,222,225,74,105,181,108,154,66,68,220,206,136,104,68,236,
+  251,234,251,115,127,178,34,246,115,200,219,243,179,90,235,205,81,162,217,149,
+  181,163,62,134,250,176,187,254,227,230,192,195,40,163,30,80,114,18,177,197,
+  179,59,91,213,97,109,17,227,37,134,234,79,239,118,9,23,117,59,165,159,51,47,
+  27,138,74,203,126,62,199,75,24,99,134,8,26,232,95,91,59,246,207,179,15,186,
+  115,166,157,134,227,165,246,176,225,248,19,31,142,151,45,155,22,209,104,128,
+  104,249,61,12,134,29,50,149,196,197,7,98,130,239,91,182,37,235,123,144,83,
+  168,132,196,24,216,9,53,218,248,240,118,24,178,190,172,63,220,185,84,11,234,
+  243,90,210,178,9,130,208,220,28,180,207,144,244,27,10,235,241,90,210,253,28,
+  78,154,200,96,255,8,168,167,223,29,145,191,157,195,47,56,124,132,195,191,68,
+  192,251,35,242,61,198,97,127,14,103,232,237,115,184,247,134,240,240,17,30,
+  190,149,135,171,56,212,251,113,45,135,163,195,240,236,234,239,104,94,126,40,
+  135,107,179,56,94,17,240,57,14,95,227,112,14,135,183,102,133,151,239,197,195,
+  95,100,50,184,145,195,31,50,195,211,207,240,240,115,28,62,146,25,222,222,173,
+  17,237,29,201,12,199,239,90,14,171,120,124,77,68,250,50,29,175,8,168,227,253,
+  26,207,127,119,4,158,123,51,195,241,211,225,56,14,135,70,244,227,126,61,223,
+  120,222,110,102,56,125,171,120,188,14,167,114,120,43,135,163,35,194,87,112,
+  216,139,195,25,17,241,83,35,226,39,133,167,107,186,226,215,101,111,228,146,
+  221,153,255,190,191,165,179,217,247,20,198,33,12,222,193,195,25,87,51,232,
+  225,225,39,108,61,127,17,178,130,167,175,225,240,62,14,155,57,124,156,195,
+  242,107,123,46,255,194,136,240,248,200,129,143,228,135,213,229,44,191,173,
+  130,193,71,39,134,151,55,70,148,215,119,62,239,240,93,194,165,17,143,24,127,
+  252,190,41,51,141,62,112,162,231,241,33,207,33,223,61,209,103,113,139,107,
+  150,149,85,47,174,40,173,43,171,47,91,90,41,85,214,151,178,239,254,234,67,
+  190,99,185,100,43,230,146,173,152,75,182,98,126,188,173,24,102,36,38,104,30,
+  70,183,11,163,255,133,218,134,161,87,38,245,198,27,0,113,79,117,25,126,214,
+  109,75,158,237,186,113,70,74,120,122,69,45,126,19,203,105,158,236,44,200,119,
+  184,48,11,126,134,92,85,93,187,220,86,143,31,16,235,201,5,115,242,102,77,117,
+  23,204,77,17,10,203,234,113,70,217,170,107,27,26,108,181,85,54,252,14,117,
+  113,21,48,110,77,121,165,45,185,208,93,48,123,54,53,84,84,43,93,48,87,81,48,
+  23,228,91,84,105,171,167,15,158,109,139,27,64,26,212,218,26,240,35,87,148,11,
+  248,97,96,101,29,36,2,186,149,64,178,226,25,78,29,11,157,154,149,236,163,106,
+  148,63,75,203,164,69,16,76,78,185,193,150,212,128,220,158,4,227,117,219,40,
+  91,210,109,41,54,91,50,12,49,136,166,108,8,244,21,132,187,65,206,247,219,163,
+  105,67,224,55,10,126,19,225,231,134,159,6,241,249,64,182,229,169,203,199,165,
+  163,16,145,22,47,173,180,85,149,45,174,246,212,87,222,192,76,152,216,108,115,
+  22,215,75,158,178,234,153,158,202,250,21,148,8,184,161,200,74,170,176,45,92,
+  33,85,54,216,202,36,91,25,251,100,219,150,84,23,252,54,47,200,1,117,13,149,
+  158,138,90,232,26,73,61,100,35,96,47,169,182,188,182,218,166,243,85,82,197,
+  232,190,63,162,220,194,197,56,204,43,43,67,243,143,174,227,31,0,254,120,249,
+  93,93,91,115,219,237,75,235,122,150,255,21,33,241,235,86,193,120,53,8,194,
+  225,144,56,241,46,65,120,27,226,38,134,200,248,18,136,27,229,17,4,119,72,156,
+  10,113,19,47,96,69,198,185,140,193,5,28,222,201,225,58,14,159,230,240,77,14,
+  247,115,120,140,195,31,56,28,178,156,193,81,28,230,112,88,194,97,221,242,240,
+  118,239,231,225,95,114,248,2,135,126,14,63,224,240,51,14,191,227,240,178,59,
+  25,28,201,225,36,14,221,28,46,224,112,25,135,255,196,225,227,28,110,228,176,
+  157,195,131,28,158,224,208,184,130,193,129,28,142,230,112,18,135,55,115,88,
+  207,225,189,28,54,115,248,52,135,27,57,220,198,225,65,14,191,224,208,188,146,
+  211,141,195,116,14,103,113,120,51,135,53,28,174,226,240,81,14,159,230,112,11,
+  135,31,172,12,167,239,209,136,240,231,60,124,142,67,243,79,120,63,57,28,206,
+  225,24,14,157,28,206,227,112,33,135,117,28,174,228,176,145,195,102,14,31,229,
+  240,73,14,159,229,112,11,135,91,57,124,147,195,15,56,60,204,225,95,56,252,
+  130,195,115,28,26,87,113,59,56,28,94,193,161,141,195,145,28,166,115,56,137,
+  67,113,213,37,126,191,196,239,255,127,249,61,225,34,246,117,74,47,96,95,231,
+  143,61,216,215,177,27,46,102,95,39,221,112,113,251,58,185,97,246,117,158,237,
+  193,190,206,139,221,236,235,244,51,94,204,190,206,21,198,112,251,58,35,141,
+  221,237,235,220,96,188,176,125,29,167,177,187,125,157,105,198,139,217,215,25,
+  23,102,95,103,82,15,246,117,102,69,216,215,169,236,193,190,78,67,132,125,157,
+  181,23,176,175,243,179,30,237,235,252,234,2,246,117,78,247,96,81,231,123,97,
+  106,125,101,165,123,241,194,250,50,152,188,55,246,96,95,71,236,209,190,206,
+  180,30,236,235,76,239,22,231,66,254,233,209,234,142,39,194,234,142,183,7,171,
+  59,143,246,104,117,231,215,221,172,238,188,130,49,52,40,158,58,52,109,227,16,
+  222,165,24,82,196,139,64,67,116,52,96,159,241,73,248,20,83,138,22,151,47,201,
+  173,245,32,79,142,48,94,216,98,79,193,5,236,240,20,26,221,181,101,21,156,102,
+  128,231,156,48,187,60,79,24,73,241,44,4,45,29,141,236,128,62,77,77,193,22,
+  251,165,16,219,60,239,132,217,230,217,101,156,37,85,67,127,166,122,106,168,
+  141,34,220,121,11,187,49,54,183,172,14,246,62,80,71,13,217,151,56,128,113,
+  238,218,218,37,158,58,61,51,242,51,200,207,163,152,194,85,223,226,26,216,117,
+  0,237,83,163,122,182,249,51,43,234,98,54,127,110,141,98,54,127,170,162,186,
+  219,252,89,26,85,84,221,0,36,156,83,86,237,169,20,150,69,93,176,18,225,254,
+  40,142,12,148,149,128,116,32,13,163,66,53,115,65,120,228,130,246,131,158,13,
+  177,20,228,14,90,10,154,33,148,150,130,58,204,45,246,204,140,176,27,52,11,
+  194,104,192,17,205,242,204,198,231,218,133,165,85,64,34,88,53,200,162,80,109,
+  205,50,74,71,35,25,145,54,130,22,178,24,15,72,30,190,75,65,19,25,165,101,229,
+  75,43,170,107,132,229,240,180,180,225,182,82,102,19,232,222,160,61,161,118,
+  65,183,58,244,181,64,85,67,191,151,10,195,13,165,104,227,73,168,13,218,22,
+  218,105,40,245,212,80,220,30,67,233,178,134,26,110,14,72,24,99,44,91,88,91,
+  47,9,19,184,149,161,73,198,114,110,61,232,70,35,107,161,216,88,197,51,207,
+  231,150,135,202,141,85,203,145,52,64,223,160,173,161,135,141,75,43,151,150,
+  215,1,69,255,45,104,117,232,133,160,213,161,151,131,86,135,94,13,90,29,122,
+  13,159,106,202,97,75,209,22,180,63,180,207,184,76,111,140,217,7,249,27,126,
+  65,251,67,252,212,105,96,221,255,158,95,55,59,69,117,17,118,138,234,254,103,
+  127,255,145,29,163,184,184,158,207,103,23,240,120,91,242,197,207,111,87,143,
+  248,49,22,131,46,253,253,163,253,57,154,217,184,57,57,172,91,192,32,58,137,
+  187,244,247,127,255,239,223,1,127,75,109,237,
 };